@@ -4,6 +4,7 @@
 #include <sparky\core\resourcemanager.hpp>
 #include <sparky\utils\gldevice.hpp>
 #include <sparky\generation\chunk.hpp>
+#include <sparky\generation\materialregistry.hpp>
 #include <sparky\utils\threadmanager.hpp>
 #include <sparky\core\time.hpp>
 #include <sparky\rendering\meshrenderer.hpp>
@@ -16,7 +17,7 @@
 using namespace sparky;
 
 Game::Game(void)
-	: m_pWorld(nullptr), m_pWorldTexture(nullptr), m_pInput(nullptr), m_pLight(nullptr)
+	: m_pWorld(nullptr), m_pWorldTexture(nullptr), m_pInput(nullptr), m_pLight(nullptr), m_pVoxelShader(nullptr)
 {
 	m_pWorld = new World();
 	m_pWorld->addRef();
@@ -29,13 +30,20 @@ Game::Game(void)
 	desc.filter = eTextureFilter::NEAREST;
 	desc.mode = eTextureWrapMode::REPEAT;
 
-	m_pWorldTexture = new Texture("assets/grass.png", desc);
+	//every voxel type is a layer of the tilesheet, so a chunk of mixed voxels is still one draw
+	MaterialRegistry& materials = MaterialRegistry::getInstance();
+	materials.load("assets/tilesheet.png", 32);
+	materials.setLayer(eVoxelType::GRASS, 0);
+	materials.setLayer(eVoxelType::DIRT, 1);
+	materials.setLayer(eVoxelType::STONE, 2);
+
+	m_pWorldTexture = materials.getTexture();
 	m_pWorldTexture->addRef();
 
 	m_pObject = new GameObject(Vector3f(-1.0f, 0.0f, 0.0f));
 	m_pObject->addRef();
 
-	m_pObject->addComponent(new MeshRenderer(new Model("assets/model.obj"), new Texture("assets/tex_model.png", desc)));
+	m_pObject->addComponent(new MeshRenderer(new Model("assets/model.obj"), ResourceManager::getInstance().loadTexture("assets/tex_model.png", desc)));
 
 	m_pInput = new Input();
 
@@ -51,6 +59,7 @@ Game::Game(void)
 
 	m_pLight = new DirectionalLight(dl);
 	m_pLight->addRef();
+	m_pLight->addLight();
 
 
 	SPARKY_POINT_LIGHT_DESC pl;
@@ -69,6 +78,7 @@ Game::Game(void)
 
 	m_pBluePoint = new PointLight(pl);
 	m_pBluePoint->addRef();
+	m_pBluePoint->addLight();
 
 
 	pl.base.position = Vector3f(7.5f, 6.0f, 0.0f);
@@ -76,8 +86,10 @@ Game::Game(void)
 
 	m_pRedPoint = new PointLight(pl);
 	m_pRedPoint->addRef();
+	m_pRedPoint->addLight();
 
 	m_pShader = ResourceManager::getInstance().getShader<DeferredShader>("deferred");
+	m_pVoxelShader = ResourceManager::getInstance().getShader<VoxelShader>("voxel");
 
 	module::Perlin module;
 	utils::NoiseMap heightMap;
@@ -110,11 +122,14 @@ Game::Game(void)
 
 			for (int y = 0; y < h; y++)
 			{
-				m_pWorld->getVoxel(x, y, z)->setActive(true);
+				Voxel* pVoxel = m_pWorld->getVoxel(x, y, z);
+				pVoxel->setActive(true);
+				pVoxel->setType(y == h - 1 ? eVoxelType::GRASS : (y >= h - 4 ? eVoxelType::DIRT : eVoxelType::STONE));
 			}
 		}
 	}
 
+	m_pWorld->setTexture(m_pWorldTexture);
 	m_pWorld->build(eMeshingType::GREEDY);
 }
 
@@ -130,10 +145,6 @@ Game::~Game(void)
 
 void Game::update(void)
 {
-	m_pLight->addLight();
-	m_pBluePoint->addLight();
-	m_pRedPoint->addLight();
-
 	m_pWorld->update();
 
 	if (m_pInput->getKey(SDLK_w))
@@ -185,14 +196,6 @@ void Game::update(void)
 
 void Game::render(void)
 {
-	m_pShader->bind();
-	m_pWorldTexture->bind();
-
-	m_pWorld->render(m_pShader);
-
-	m_pWorldTexture->unbind();
-
+	m_pWorld->render(m_pVoxelShader);
 	m_pObject->render(m_pShader);
-
-	m_pShader->unbind();
 }
\ No newline at end of file
@@ -11,6 +11,7 @@ Class Includes
 #include <sparky\rendering\texture.hpp>
 #include <sparky\input\input.hpp>
 #include <sparky\rendering\deferredshader.hpp>
+#include <sparky\rendering\voxelshader.hpp>
 #include <sparky\lighting\directionallight.hpp>
 #include <sparky\lighting\pointlight.hpp>
 #include <sparky\core\gameobject.hpp>
@@ -27,6 +28,7 @@ private:
 	sparky::PointLight*		  m_pRedPoint;
 
 	sparky::DeferredShader*   m_pShader;
+	sparky::VoxelShader*	  m_pVoxelShader;
 
 public:
 	/*
@@ -0,0 +1,283 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// 
+// Sparky Engine
+// 2016 - Benjamin Carter (benjamin.mark.carter@hotmail.com)
+// 
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+// 
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+// 
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgement
+//    in the product documentation would be appreciated but is not required.
+// 
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+// 
+// 3. This notice may not be removed or altered from any source distribution.
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __SPARKY_FRAME_ALLOCATOR_HPP__
+#define __SPARKY_FRAME_ALLOCATOR_HPP__
+
+/*
+====================
+CPP Includes
+====================
+*/
+#include <cstddef>							// Sizes and alignments of allocations.
+#include <array>							// The double-buffered allocators of each thread.
+#include <vector>							// Storage for each thread's arena.
+#include <memory>							// Each thread's arena is owned by the FrameAllocator.
+#include <mutex>							// Guards the registration of new thread arenas.
+#include <atomic>							// The current frame is read by every thread.
+#include <type_traits>						// Alignment of the types allocated through the adaptor.
+/*
+====================
+Class Includes
+====================
+*/
+#include <sparky\core\linearallocator.hpp>	// Each frame's memory is bumped from a LinearAllocator.
+#include <sparky\utils\defines.hpp>		// Portable thread local storage for each thread's arena.
+
+namespace sparky
+{
+	struct FrameArena_t
+	{
+		std::array<LinearAllocator, 2> buffers;	///< Double-buffered allocators, alternating each frame.
+		unsigned int				   frame;	///< The last frame that this arena allocated within.
+	};
+
+	class FrameAllocator
+	{
+	private:
+		/*
+		====================
+		Member Variables
+		====================
+		*/
+		std::vector<std::unique_ptr<FrameArena_t>> m_arenas;	///< One arena per thread that has allocated frame memory.
+		std::mutex								   m_mutex;		///< Guards the registration of new thread arenas.
+		std::atomic<unsigned int>				   m_frame;		///< The current frame, incremented at the end of every frame.
+
+		static SPARKY_THREAD_LOCAL FrameArena_t*   m_sLocalArena;	///< The calling thread's arena, owned by m_arenas.
+
+	private:
+		/*
+		====================
+		Private Ctor
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Constructs a FrameAllocator object instance.
+		////////////////////////////////////////////////////////////
+		explicit FrameAllocator(void);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Deletes the copy constructor of the FrameAllocator.
+		///
+		/// \param other	The other FrameAllocator that will not be copied.
+		///
+		////////////////////////////////////////////////////////////
+		explicit FrameAllocator(const FrameAllocator& other) = delete;
+
+	public:
+		/*
+		====================
+		Getters and Setters
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Gets the instance of the FrameAllocator.
+		///
+		/// The instance is intentionally never destroyed, as the 
+		/// PoolManager and EventManager still use frame memory while
+		/// they are destroyed.
+		///
+		/// \retval FrameAllocator&	The instance of the FrameAllocator.
+		///
+		////////////////////////////////////////////////////////////
+		static FrameAllocator& getInstance(void);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Gets the current frame.
+		///
+		/// \retval unsigned int	The amount of frames that have ended.
+		///
+		////////////////////////////////////////////////////////////
+		unsigned int getFrame(void) const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Gets the frame memory used by the calling thread this frame.
+		///
+		/// \retval std::size_t	The bytes requested, including alignment padding.
+		///
+		////////////////////////////////////////////////////////////
+		std::size_t getLocalUsed(void);
+
+		/*
+		====================
+		Methods
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Allocates memory from the calling thread's arena.
+		///
+		/// The memory remains valid until the end of the next frame,
+		/// so results produced by a worker may be consumed by the main
+		/// thread once the frame has ended. No destructors are called.
+		///
+		/// \param size			The size of the memory in bytes.
+		/// \param alignment	The alignment of the memory, must be a power of two.
+		///
+		/// \retval void*	The allocated memory.
+		///
+		////////////////////////////////////////////////////////////
+		void* allocate(std::size_t size, std::size_t alignment);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Ends the current frame.
+		///
+		/// Called by the GameManager once the frame has finished. Each
+		/// thread's arena resets the older of its buffers the next time 
+		/// it allocates, so no thread has to wait on another.
+		///
+		////////////////////////////////////////////////////////////
+		void endFrame(void);
+	};
+
+	template <typename T>
+	class FrameAllocatorAdaptor
+	{
+	public:
+		/*
+		====================
+		Type Definitions
+		====================
+		*/
+		typedef T				value_type;
+		typedef T*				pointer;
+		typedef const T*		const_pointer;
+		typedef T&				reference;
+		typedef const T&		const_reference;
+		typedef std::size_t		size_type;
+		typedef std::ptrdiff_t	difference_type;
+
+		template <typename U>
+		struct rebind
+		{
+			typedef FrameAllocatorAdaptor<U> other;
+		};
+
+		/*
+		====================
+		Ctor and Dtor
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Constructs a FrameAllocatorAdaptor object instance.
+		////////////////////////////////////////////////////////////
+		FrameAllocatorAdaptor(void);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Constructs a FrameAllocatorAdaptor from an adaptor of another type.
+		///
+		/// \param other	The adaptor to construct from.
+		///
+		////////////////////////////////////////////////////////////
+		template <typename U>
+		FrameAllocatorAdaptor(const FrameAllocatorAdaptor<U>& other);
+
+		/*
+		====================
+		Methods
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Allocates memory for count objects from the FrameAllocator.
+		///
+		/// \param count	The amount of objects.
+		///
+		/// \retval T*	The allocated, uninitialised memory.
+		///
+		////////////////////////////////////////////////////////////
+		T* allocate(std::size_t count);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Does nothing, frame memory is released at the end of the frame.
+		///
+		/// \param pMemory	The memory to de-allocate.
+		/// \param count	The amount of objects.
+		///
+		////////////////////////////////////////////////////////////
+		void deallocate(T* pMemory, std::size_t count);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Gets the maximum amount of objects that can be allocated.
+		///
+		/// \retval std::size_t	The maximum amount of objects.
+		///
+		////////////////////////////////////////////////////////////
+		std::size_t max_size(void) const;
+	};
+
+	////////////////////////////////////////////////////////////
+	/// \brief Every FrameAllocatorAdaptor allocates from the same FrameAllocator.
+	////////////////////////////////////////////////////////////
+	template <typename T, typename U>
+	bool operator==(const FrameAllocatorAdaptor<T>& left, const FrameAllocatorAdaptor<U>& right);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Every FrameAllocatorAdaptor allocates from the same FrameAllocator.
+	////////////////////////////////////////////////////////////
+	template <typename T, typename U>
+	bool operator!=(const FrameAllocatorAdaptor<T>& left, const FrameAllocatorAdaptor<U>& right);
+
+	template <typename T>
+	using FrameVector = std::vector<T, FrameAllocatorAdaptor<T>>;
+
+	#include <sparky\core\frameallocator.inl>
+
+}//namespace sparky
+
+#endif//__SPARKY_FRAME_ALLOCATOR_HPP__
+
+////////////////////////////////////////////////////////////
+/// \class sparky::FrameAllocator
+/// \ingroup core
+///
+/// sparky::FrameAllocator provides temporary memory that lasts
+/// for the current and the following frame. Each thread owns
+/// a pair of LinearAllocators which alternate each frame, so 
+/// workers allocate without locking and the main thread can
+/// consume their results after the frame boundary.
+///
+/// sparky::FrameAllocatorAdaptor allows STL containers to use
+/// frame memory, with FrameVector provided for convenience. As 
+/// the memory is released at the end of the frame, containers 
+/// using the adaptor must not outlive the following frame.
+///
+/// Usage example:
+/// \code
+/// // Gather the visible objects of this frame without the heap.
+/// sparky::FrameVector<sparky::GameObject*> visible;
+/// visible.reserve(objects.size());
+///
+/// for (auto& pObject : objects)
+/// {
+///		if (pObject->isVisible())
+///		{
+///			visible.push_back(pObject);
+///		}
+/// }
+///
+/// // At the end of the frame.
+/// sparky::FrameAllocator::getInstance().endFrame();
+/// \endcode
+///
+////////////////////////////////////////////////////////////
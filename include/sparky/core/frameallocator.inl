@@ -0,0 +1,56 @@
+/*
+====================
+Ctor and Dtor
+====================
+*/
+////////////////////////////////////////////////////////////
+template <typename T>
+FrameAllocatorAdaptor<T>::FrameAllocatorAdaptor(void)
+{
+}
+
+////////////////////////////////////////////////////////////
+template <typename T>
+template <typename U>
+FrameAllocatorAdaptor<T>::FrameAllocatorAdaptor(const FrameAllocatorAdaptor<U>&)
+{
+}
+
+/*
+====================
+Methods
+====================
+*/
+////////////////////////////////////////////////////////////
+template <typename T>
+T* FrameAllocatorAdaptor<T>::allocate(std::size_t count)
+{
+	return static_cast<T*>(FrameAllocator::getInstance().allocate(sizeof(T) * count, std::alignment_of<T>::value));
+}
+
+////////////////////////////////////////////////////////////
+template <typename T>
+void FrameAllocatorAdaptor<T>::deallocate(T*, std::size_t)
+{
+}
+
+////////////////////////////////////////////////////////////
+template <typename T>
+std::size_t FrameAllocatorAdaptor<T>::max_size(void) const
+{
+	return static_cast<std::size_t>(-1) / sizeof(T);
+}
+
+////////////////////////////////////////////////////////////
+template <typename T, typename U>
+bool operator==(const FrameAllocatorAdaptor<T>&, const FrameAllocatorAdaptor<U>&)
+{
+	return true;
+}
+
+////////////////////////////////////////////////////////////
+template <typename T, typename U>
+bool operator!=(const FrameAllocatorAdaptor<T>&, const FrameAllocatorAdaptor<U>&)
+{
+	return false;
+}
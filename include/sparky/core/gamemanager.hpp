@@ -38,6 +38,9 @@ Member Variables
 */
 #include <sparky\utils\singleton.hpp>	// Game Manager is a singleton object.
 #include <sparky\rendering\gbuffer.hpp> // The deferred rendering pipeline GBuffer
+#include <sparky\rendering\buffers.hpp> // The camera data of the frame is held in a uniform buffer.
+#include <sparky\lighting\lightclusters.hpp> // The point lights of the frame are assigned to clusters.
+#include <sparky\utils\filewatcher.hpp>	// Shaders, textures and the config are reloaded when they change.
 
 namespace sparky
 {
@@ -51,8 +54,6 @@ namespace sparky
 	class DirectionalShader;
 	class PointShader;
 	class MeshData;
-	class DirectionalLight;
-	class PointLight;
 
 	class GameManager final : public Singleton<GameManager>
 	{
@@ -70,10 +71,14 @@ namespace sparky
 		PointShader*				   m_pPoint;			///< The shader that renders the point lights.
 		MeshData*					   m_pQuad;				///< The complete scene is render onto this quad.
 															  
-		std::vector<DirectionalLight*> m_directionalLights; ///< The directional lights within this frame.
-		std::vector<PointLight*>	   m_pointLights;		///< The point lights within this frame.
-															  
 		GBuffer						   m_buffer;			///< The deferred rendering pipeline uses this GBuffer.
+		UniformBuffer				   m_frameData;			///< The camera matrices of the frame, written once per frame.
+
+		LightClusters				   m_clusters;			///< The clusters the point lights of the frame are assigned to.
+		TextureBuffer				   m_clusterData;		///< The light list of every cluster.
+		TextureBuffer				   m_lightIndices;		///< The light index lists of every cluster.
+
+		FileWatcher					   m_watcher;			///< Reports edited shaders, textures and configs for hot reloading.
 
 	private:
 		/*
@@ -90,6 +95,35 @@ namespace sparky
 		////////////////////////////////////////////////////////////
 		GameManager(void);
 
+		/*
+		====================
+		Private Methods
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Renders every point light of the frame in a single 
+		///		   pass.
+		///
+		/// The lights of the LightRegistry are assigned to the clusters
+		/// of the main camera, then the clusters are uploaded for the
+		/// point shader to read. The pass is scissored to the 
+		/// screen area the lights cover, and skipped when none of them
+		/// are on screen.
+		///
+		////////////////////////////////////////////////////////////
+		void renderPointLights(void);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Reloads every file that has changed since the last
+		///		   frame.
+		///
+		/// Called before a frame is rendered, so nothing is in use.
+		/// Shaders and textures are reloaded by the ResourceManager,
+		/// the config applies its camera settings to the main camera.
+		///
+		////////////////////////////////////////////////////////////
+		void reloadChanges(void);
+
 	public:
 		/*
 		====================
@@ -116,28 +150,6 @@ namespace sparky
 		////////////////////////////////////////////////////////////
 		void init(void);
 
-		////////////////////////////////////////////////////////////
-		/// \brief Adds a DirectionalLight to the engine.
-		///
-		/// Lights are added each frame so that multi-pass lighting can
-		/// be achieved to get a arbitrary number of lights.
-		///
-		/// \param pLight	The DirectionalLight to add to the application.
-		///
-		////////////////////////////////////////////////////////////
-		void addLight(DirectionalLight* pLight);
-
-		////////////////////////////////////////////////////////////
-		/// \brief Adds a PointLight to the engine.
-		///
-		/// Lights are added each frame so that multi-pass lighting can
-		/// be achieved to get a arbitrary number of lights.
-		///
-		/// \param pLight	The PointLight to add to the application.
-		///
-		////////////////////////////////////////////////////////////
-		void addLight(PointLight* pLight);
-
 		////////////////////////////////////////////////////////////
 		/// \brief Pushes a Scene to the top of the stack.
 		///
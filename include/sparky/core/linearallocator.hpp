@@ -0,0 +1,162 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// 
+// Sparky Engine
+// 2016 - Benjamin Carter (benjamin.mark.carter@hotmail.com)
+// 
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+// 
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+// 
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgement
+//    in the product documentation would be appreciated but is not required.
+// 
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+// 
+// 3. This notice may not be removed or altered from any source distribution.
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __SPARKY_LINEAR_ALLOCATOR_HPP__
+#define __SPARKY_LINEAR_ALLOCATOR_HPP__
+
+/*
+====================
+CPP Includes
+====================
+*/
+#include <cstddef>	// Sizes and alignments of allocations.
+#include <vector>	// Blocks allocated when the allocator has run out of space.
+
+namespace sparky
+{
+	class LinearAllocator
+	{
+	private:
+		/*
+		====================
+		Member Variables
+		====================
+		*/
+		char*			   m_pBlock;	///< The block of memory that allocations are bumped from.
+		std::size_t		   m_capacity;	///< The size of the block in bytes.
+		std::size_t		   m_offset;	///< The offset of the next allocation within the block.
+		std::size_t		   m_requested;	///< The bytes requested since the last reset, including alignment padding.
+		std::vector<char*> m_overflow;	///< Heap allocations made once the block was full, freed upon reset.
+
+	public:
+		/*
+		====================
+		Ctor and Dtor
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Constructs an empty LinearAllocator.
+		///
+		/// No block is allocated until the first reset, at which point
+		/// the block is sized to fit everything requested before it.
+		///
+		////////////////////////////////////////////////////////////
+		explicit LinearAllocator(void);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Constructs a LinearAllocator with a block of the given size.
+		///
+		/// \param capacity	The size of the block in bytes.
+		///
+		////////////////////////////////////////////////////////////
+		explicit LinearAllocator(std::size_t capacity);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Deletes the copy constructor of the LinearAllocator.
+		///
+		/// \param other	The other LinearAllocator that will not be copied.
+		///
+		////////////////////////////////////////////////////////////
+		explicit LinearAllocator(const LinearAllocator& other) = delete;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Destructs the LinearAllocator, freeing the block and any overflow.
+		////////////////////////////////////////////////////////////
+		~LinearAllocator(void);
+
+		/*
+		====================
+		Getters and Setters
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Gets the size of the block.
+		///
+		/// \retval std::size_t	The capacity of the block in bytes.
+		///
+		////////////////////////////////////////////////////////////
+		std::size_t getCapacity(void) const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Gets the amount of memory requested since the last reset.
+		///
+		/// \retval std::size_t	The requested bytes, including alignment padding.
+		///
+		////////////////////////////////////////////////////////////
+		std::size_t getUsed(void) const;
+
+		/*
+		====================
+		Methods
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Allocates memory by bumping the offset within the block.
+		///
+		/// If the block is full, the memory is allocated from the heap
+		/// instead and the block is grown upon the next reset, so that
+		/// a steady workload stops touching the heap.
+		///
+		/// \param size			The size of the memory in bytes.
+		/// \param alignment	The alignment of the memory, must be a power of two.
+		///
+		/// \retval void*	The allocated memory, valid until the next reset.
+		///
+		////////////////////////////////////////////////////////////
+		void* allocate(std::size_t size, std::size_t alignment);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Releases every allocation at once.
+		///
+		/// No destructors are called, the memory is simply reused.
+		///
+		////////////////////////////////////////////////////////////
+		void reset(void);
+	};
+
+}//namespace sparky
+
+#endif//__SPARKY_LINEAR_ALLOCATOR_HPP__
+
+////////////////////////////////////////////////////////////
+/// \class sparky::LinearAllocator
+/// \ingroup core
+///
+/// sparky::LinearAllocator hands out memory by incrementing an
+/// offset within a single block, and releases every allocation
+/// at once when it is reset. It is used for temporary memory that
+/// has a well known lifetime, such as the duration of a frame.
+///
+/// Usage example:
+/// \code
+/// sparky::LinearAllocator allocator(1024);
+///
+/// // Allocate an array of temporary integers.
+/// int* pValues = static_cast<int*>(allocator.allocate(sizeof(int) * 16, std::alignment_of<int>::value));
+///
+/// // Release every allocation.
+/// allocator.reset();
+/// \endcode
+///
+////////////////////////////////////////////////////////////
@@ -30,13 +30,17 @@
 CPP Includes
 ====================
 */
+#include <array>						// Generation swap buffers for each thread's pool.
 #include <vector>						// Container for all of the objects currently retained by the pool.
+#include <memory>						// Each thread's autorelease pool is owned by the manager.
+#include <mutex>						// Guards the registry of pools and each individual pool.
 /*
 ====================
 Class Includes
 ====================
 */
 #include <sparky\utils\singleton.hpp>	// PoolManager is a singleton, therefore it inherits from the Singleton class.
+#include <sparky\utils\defines.hpp>	// Portable thread local storage for each thread's pool.
 
 namespace sparky
 {
@@ -47,6 +51,13 @@ namespace sparky
 	*/
 	class Ref;
 
+	struct AutoreleasePool_t
+	{
+		std::array<std::vector<Ref*>, 2> buffers;		///< Generation swap buffers, one is filled while the other is being released.
+		unsigned int					 generation;	///< Incremented upon every flush, the lowest bit selects the buffer being filled.
+		std::mutex						 mutex;			///< Only contended while the pool is being swapped by flush.
+	};
+
 	class PoolManager : public Singleton<PoolManager>
 	{
 		friend class Singleton<PoolManager>;
@@ -57,7 +68,13 @@ namespace sparky
 		Member Variables
 		====================
 		*/
-		std::vector<Ref*> m_objects;		///< Currently retained dynamic objects.
+		std::vector<std::unique_ptr<AutoreleasePool_t>> m_pools;			///< One autorelease pool per thread that has created a Ref.
+		mutable std::mutex								m_mutex;			///< Guards the registration of new thread pools.
+
+		unsigned int									m_lastFlushCount;	///< The amount of Refs released by the previous flush.
+		double											m_lastFlushTime;	///< The time in milliseconds the previous flush took.
+
+		static SPARKY_THREAD_LOCAL AutoreleasePool_t*	m_sLocalPool;		///< The calling thread's pool, owned by m_pools.
 
 	private:
 		/*
@@ -74,6 +91,23 @@ namespace sparky
 		////////////////////////////////////////////////////////////
 		explicit PoolManager(void);
 
+		/*
+		====================
+		Private Methods
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Gets the autorelease pool of the calling thread.
+		///
+		/// The first call on a thread creates the pool and registers
+		/// it with the manager, this is the only point at which the
+		/// manager wide lock is taken on the allocation path.
+		///
+		/// \retval AutoreleasePool_t&	The calling thread's pool.
+		///
+		////////////////////////////////////////////////////////////
+		AutoreleasePool_t& getLocalPool(void);
+
 	public:
 		/*
 		====================
@@ -90,6 +124,38 @@ namespace sparky
 		////////////////////////////////////////////////////////////
 		~PoolManager(void);
 
+		/*
+		====================
+		Getters and Setters
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Gets the amount of Refs currently awaiting release.
+		///
+		/// \retval unsigned int	The pending Refs across every thread's pool.
+		///
+		////////////////////////////////////////////////////////////
+		unsigned int getPendingCount(void) const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Gets the amount of Refs released by the previous flush.
+		///
+		/// Paired with getLastFlushTime, this is used to profile the
+		/// cost of the flush against the amount of objects within the pool.
+		///
+		/// \retval unsigned int	The released Refs of the previous flush.
+		///
+		////////////////////////////////////////////////////////////
+		unsigned int getLastFlushCount(void) const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Gets the time the previous flush took to complete.
+		///
+		/// \retval double	The duration of the previous flush in milliseconds.
+		///
+		////////////////////////////////////////////////////////////
+		double getLastFlushTime(void) const;
+
 		/*
 		====================
 		Methods
@@ -98,9 +164,9 @@ namespace sparky
 		////////////////////////////////////////////////////////////
 		/// \brief Adds a dynamic object Ref to the pool.
 		///
-		/// The object added is retained within the pool until the 
-		/// end of the current frame, where the objects reference
-		/// count is decremented and cleared from the pool.
+		/// The object added is retained within the calling thread's
+		/// pool until the end of the current frame, where the objects 
+		/// reference count is decremented and cleared from the pool.
 		///
 		/// \param pObject	The Ref to add to the pool.
 		///
@@ -110,9 +176,9 @@ namespace sparky
 		////////////////////////////////////////////////////////////
 		/// \brief Checks to see if the passed in object is currently within the pool.
 		///
-		/// This method will search through all of the objects within
-		/// the current pool and return true if the object parameter
-		/// has been found.
+		/// Every Ref records the pool that is pending its release, 
+		/// so this is a constant time check rather than a search
+		/// through all of the objects within the pool.
 		///
 		/// \param pObject	The Ref to search the pool for.
 		///
@@ -121,12 +187,30 @@ namespace sparky
 		////////////////////////////////////////////////////////////
 		bool contains(Ref* pObject) const;
 
+		////////////////////////////////////////////////////////////
+		/// \brief Removes a dynamic object Ref from the pool.
+		///
+		/// The Ref is swapped with the last object of its pool in
+		/// constant time. The reference that the pool would have
+		/// released at the end of the frame is handed to the caller,
+		/// who is then responsible for releasing it.
+		///
+		/// \param pObject	The Ref to remove from the pool.
+		///
+		/// \retval	bool	True if the Ref was pending and has been removed.
+		///
+		////////////////////////////////////////////////////////////
+		bool removeObject(Ref* pObject);
+
 		////////////////////////////////////////////////////////////
 		/// \brief Flushes the pool of all currently retained Ref's.
 		///
-		/// At the end of each frame, the pool is emptied of all 
-		/// retained Ref's, each Ref's reference counter is decremented
-		/// before flushing.
+		/// At the end of each frame, the pools of every thread swap
+		/// their generation buffers and the retired buffer is emptied
+		/// of all retained Ref's, each Ref's reference counter is 
+		/// decremented before flushing. Refs created while flushing 
+		/// are kept for the next frame. This should only be called 
+		/// from the main thread at the frame boundary.
 		///
 		////////////////////////////////////////////////////////////
 		void flush(void);
@@ -140,9 +224,10 @@ namespace sparky
 ///
 /// sparky::PoolManager is a singleton class that is responsible 
 /// for the basic garbage collection of Sparky. Dynamic Ref objects 
-/// are added to the list. At the end of the current frame, each 
-/// objects reference count is decremented and if the count is 0, 
-/// it is deleted. 
+/// are added to the autorelease pool of the thread that created them,
+/// so worker threads never contend on a global lock. At the end of 
+/// the current frame the pools are merged, each objects reference 
+/// count is decremented and if the count is 0, it is deleted. 
 
 /// After every Ref object has been checked, the object pool is cleared. 
 /// The only Ref objects left after the flushing are objects that are 
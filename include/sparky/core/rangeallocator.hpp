@@ -0,0 +1,277 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// 
+// Sparky Engine
+// 2016 - Benjamin Carter (benjamin.mark.carter@hotmail.com)
+// 
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+// 
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+// 
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgement
+//    in the product documentation would be appreciated but is not required.
+// 
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+// 
+// 3. This notice may not be removed or altered from any source distribution.
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __SPARKY_RANGE_ALLOCATOR_HPP__
+#define __SPARKY_RANGE_ALLOCATOR_HPP__
+
+/*
+====================
+CPP Includes
+====================
+*/
+#include <map>		// The free ranges, by offset and by size.
+#include <vector>	// The allocations, indexed by their handles.
+
+namespace sparky
+{
+	struct RangeStats_t
+	{
+		unsigned int capacity;		///< The size of the managed range.
+		unsigned int used;			///< The amount allocated.
+		unsigned int freeRanges;	///< The amount of separate free ranges.
+		unsigned int largestFree;	///< The size of the largest free range.
+		float		 fragmentation;	///< The share of free space outside the largest free range, from 0 to 1.
+	};
+
+	struct RangeMove_t
+	{
+		unsigned int from;	///< The offset the allocation was at.
+		unsigned int to;	///< The offset the allocation is now at.
+		unsigned int size;	///< The size of the allocation.
+	};
+
+	class RangeAllocator final
+	{
+	private:
+		/*
+		====================
+		Structures
+		====================
+		*/
+		struct Allocation_t
+		{
+			unsigned int offset;	///< The start of the allocation.
+			unsigned int size;		///< The size of the allocation, 0 when the handle is free.
+		};
+
+		/*
+		====================
+		Member Variables
+		====================
+		*/
+		std::vector<Allocation_t>					m_allocations;	///< Every allocation, indexed by its handle.
+		std::vector<unsigned int>					m_freeHandles;	///< Handles that can be reused.
+		std::map<unsigned int, unsigned int>		m_freeRanges;	///< The free ranges, the size keyed by the offset.
+		std::multimap<unsigned int, unsigned int>	m_freeSizes;	///< The free ranges, the offset keyed by the size.
+		unsigned int								m_capacity;		///< The size of the managed range.
+		unsigned int								m_used;			///< The amount allocated.
+
+		/*
+		====================
+		Private Methods
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Adds a free range, merging it with its neighbours.
+		///
+		/// \param offset	The start of the range.
+		/// \param size		The size of the range.
+		///
+		////////////////////////////////////////////////////////////
+		void insertFree(unsigned int offset, unsigned int size);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Removes a free range from the size lookup.
+		///
+		/// \param offset	The start of the range.
+		/// \param size		The size of the range.
+		///
+		////////////////////////////////////////////////////////////
+		void eraseSize(const unsigned int offset, const unsigned int size);
+
+	public:
+		/*
+		====================
+		Ctor and Dtor
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Constructs a RangeAllocator object that is entirely free.
+		///
+		/// \param capacity		The size of the range to manage.
+		///
+		////////////////////////////////////////////////////////////
+		explicit RangeAllocator(const unsigned int capacity = 0);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Destruction of the RangeAllocator object.
+		////////////////////////////////////////////////////////////
+		~RangeAllocator(void) = default;
+
+		/*
+		====================
+		Getters and Setters
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Retrieves the size of the managed range.
+		///
+		/// \retval unsigned int	The capacity.
+		///
+		////////////////////////////////////////////////////////////
+		unsigned int getCapacity(void) const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Retrieves the amount that is not allocated.
+		///
+		/// The free space may be split across several ranges, see 
+		/// getStats for the largest of them.
+		///
+		/// \retval unsigned int	The free space.
+		///
+		////////////////////////////////////////////////////////////
+		unsigned int getFree(void) const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Retrieves the current offset of an allocation.
+		///
+		/// The offset of an allocation may change when the allocator
+		/// is defragmented, so it should be read when it is used.
+		///
+		/// \param handle			The handle of the allocation.
+		///
+		/// \retval unsigned int	The offset of the allocation.
+		///
+		////////////////////////////////////////////////////////////
+		unsigned int getOffset(const unsigned int handle) const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Retrieves the size of an allocation.
+		///
+		/// \param handle			The handle of the allocation.
+		///
+		/// \retval unsigned int	The size of the allocation.
+		///
+		////////////////////////////////////////////////////////////
+		unsigned int getSize(const unsigned int handle) const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Retrieves the usage and fragmentation of the range.
+		///
+		/// The fragmentation is 0 when all of the free space is one
+		/// range, and approaches 1 as it is split into small pieces.
+		///
+		/// \retval RangeStats_t	The statistics of the allocator.
+		///
+		////////////////////////////////////////////////////////////
+		RangeStats_t getStats(void) const;
+
+		/*
+		====================
+		Methods
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Allocates a contiguous range.
+		///
+		/// The smallest free range that fits is split, which keeps 
+		/// the large ranges intact for large requests.
+		///
+		/// \param size				The size to allocate, must not be 0.
+		///
+		/// \retval unsigned int	The handle of the allocation, or INVALID_HANDLE
+		///							if no free range is large enough.
+		///
+		////////////////////////////////////////////////////////////
+		unsigned int allocate(const unsigned int size);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Frees an allocation, merging it with neighbouring
+		///		   free ranges.
+		///
+		/// \param handle	The handle of the allocation, which may be reused.
+		///
+		////////////////////////////////////////////////////////////
+		void free(const unsigned int handle);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Extends the managed range.
+		///
+		/// \param capacity		The new capacity, ignored if it is smaller.
+		///
+		////////////////////////////////////////////////////////////
+		void grow(const unsigned int capacity);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Packs every allocation towards the start of the range.
+		///
+		/// Allocations keep their order and handles, afterwards all
+		/// of the free space is a single range at the end. The moves
+		/// are listed in ascending order with one per allocation, 
+		/// including those that did not move. A move may overlap its 
+		/// own source, so the data should either be copied in order
+		/// with memmove semantics or into new storage.
+		///
+		/// \retval std::vector<RangeMove_t>	The moves to apply to the data.
+		///
+		////////////////////////////////////////////////////////////
+		std::vector<RangeMove_t> defragment(void);
+
+		/*
+		====================
+		Constant Variables
+		====================
+		*/
+		static const unsigned int INVALID_HANDLE = 0xFFFFFFFF;	///< Returned when an allocation fails.
+	};
+
+}//namespace sparky
+
+#endif//__SPARKY_RANGE_ALLOCATOR_HPP__
+
+////////////////////////////////////////////////////////////
+/// \class sparky::RangeAllocator
+/// \ingroup core
+///
+/// sparky::RangeAllocator divides a range, such as the vertices of
+/// a large GPU buffer, between many allocations. It does not own
+/// any memory itself, it only hands out offsets, so the data can
+/// live anywhere. Freed ranges are merged with their neighbours and
+/// the allocator can be defragmented when the free space becomes 
+/// too scattered to satisfy a request.
+///
+/// Allocations are referred to by handles, as their offsets change
+/// when the allocator is defragmented.
+///
+/// Usage example:
+/// \code
+/// sparky::RangeAllocator allocator(1024);
+///
+/// unsigned int handle = allocator.allocate(100);
+///
+/// if (handle == sparky::RangeAllocator::INVALID_HANDLE && allocator.getFree() >= 100)
+/// {
+///		// Enough space exists, but it is scattered.
+///		for (const auto& move : allocator.defragment())
+///		{
+///			std::memmove(&data[move.to], &data[move.from], move.size);
+///		}
+///
+///		handle = allocator.allocate(100);
+/// }
+///
+/// std::cout << allocator.getStats().fragmentation << std::endl;
+/// \endcode
+///
+////////////////////////////////////////////////////////////
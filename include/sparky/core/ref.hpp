@@ -25,17 +25,37 @@
 #ifndef __SPARKY_REF_HPP__
 #define __SPARKY_REF_HPP__
 
+/*
+====================
+CPP Includes
+====================
+*/
+#include <atomic>	// The reference count is shared between threads.
+
 namespace sparky
 {
+	/*
+	====================
+	Sparky Forward Declarations
+	====================
+	*/
+	struct AutoreleasePool_t;
+
 	class Ref
 	{
+		friend class PoolManager;
+
 	private:
 		/*
 		====================
 		Member Variables
 		====================
 		*/
-		unsigned int m_references;	///< The number of references that this object has currently obtained. Starts at 1 by default.
+		std::atomic<unsigned int>		  m_references;				///< The number of references that this object has currently obtained. Starts at 1 by default.
+
+		std::atomic<AutoreleasePool_t*>	  m_pAutoreleasePool;		///< The pool that is pending this Ref's release, null if no release is pending.
+		unsigned int					  m_autoreleaseGeneration;	///< The generation of the pool when this Ref was added.
+		unsigned int					  m_autoreleaseIndex;		///< The slot of this Ref within the pool, allowing constant time removal.
 
 	public:
 		/*
@@ -48,8 +68,10 @@ namespace sparky
 		///
 		///	This default constructor initialises the Ref and sets
 		/// the reference count to one. Upon construction the object
-		/// is added to the PoolManager. At the end of the current frame
-		/// the pool is emptied and cleared and all Ref objects within the
+		/// is added to the constructing thread's autorelease pool within
+		/// the PoolManager, so Refs may be created on worker threads. 
+		/// At the end of the current frame the pools are merged and
+		/// cleared and all Ref objects within the
 		/// list have their references decremented. If the count is 
 		/// equal to 0, the Ref object is deleted.
 		/// 
@@ -108,8 +130,15 @@ namespace sparky
 		/// When a call no longer needs to retain a reference to the
 		/// Ref, the reference counter should be decremented.
 		///
+		/// The decrement is performed with release semantics and the
+		/// thread that drops the final reference synchronises with
+		/// every prior release, so it is safe for that thread alone
+		/// to destroy the object.
+		///
+		/// \retval unsigned int	The reference count after the decrement.
+		///
 		////////////////////////////////////////////////////////////
-		void removeRef(void);
+		unsigned int removeRef(void);
 
 		////////////////////////////////////////////////////////////
 		/// \brief Error-checking and referencing decrementing of Ref objects.
@@ -132,9 +161,7 @@ namespace sparky
 	{
 		if (ref)
 		{
-			ref->removeRef();
-
-			if (ref->getRefCount() == 0)
+			if (ref->removeRef() == 0)
 			{
 				delete ref;
 				ref = nullptr;
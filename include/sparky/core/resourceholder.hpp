@@ -25,18 +25,13 @@
 #ifndef __SPARKY_RESOURCE_HOLDER_HPP__
 #define __SPARKY_RESOURCE_HOLDER_HPP__
 
-/*
-====================
-CPP Includes
-====================
-*/
-#include <map>						// Storage type for resources.
 /*
 ====================
 Class Includes
 ====================
 */
-#include <sparky\utils\string.hpp>	// Key values for resources.
+#include <sparky\utils\flathashmap.hpp>	// Storage type for resources.
+#include <sparky\utils\stringid.hpp>		// Key values for resources.
 #include <sparky\core\ref.hpp>		// All objects in the template should inherit from ref.
 #include <sparky\rendering\ishader.hpp>
 #include <sparky\utils\debug.hpp>	// For printing messages if the resources is already stored.
@@ -52,7 +47,7 @@ namespace sparky
 		Member Variables
 		====================
 		*/
-		std::map<String, T*> m_resources;	///< The resources of the holder are stored within a map.
+		FlatHashMap<StringId, T*> m_resources;	///< The resources of the holder are stored within a map, keyed by the hash of their name.
 
 	public:
 		/*
@@ -86,7 +81,7 @@ namespace sparky
 		////////////////////////////////////////////////////////////
 		/// \brief Retrieves a resource (by name) from the ResourceHolder.
 		///
-		/// The map is search by name from the current resources and
+		/// The map is searched by the hashed name of the resource and
 		/// retrieves the value which matches the parameter name. If the
 		/// resource is not found, a warning message is printed to the console
 		/// window and the method will return a null pointer.
@@ -97,7 +92,20 @@ namespace sparky
 		///					resource is not found, null pointer is returned.
 		///
 		////////////////////////////////////////////////////////////
-		T* get(const String& name) const;
+		T* get(const StringId& name) const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Searches for a resource (by name) in the ResourceHolder.
+		///
+		/// Identical to get, but a missing resource is not reported,
+		/// for callers that only act on resources that are stored.
+		///
+		/// \param name		The name of the resource to search for.
+		///
+		/// \retval T		The resource associated with the name, or null pointer.
+		///
+		////////////////////////////////////////////////////////////
+		T* find(const StringId& name) const;
 
 		/*
 		====================
@@ -105,7 +113,7 @@ namespace sparky
 		====================
 		*/
 		////////////////////////////////////////////////////////////
-		/// \brief Adds a resource to the map with an associated String key.
+		/// \brief Adds a resource to the map with an associated StringId key.
 		///
 		/// When a resource is added to the ResourceHolder object, it checks
 		/// to make sure that no objects have the same key. If the key is not
@@ -116,7 +124,7 @@ namespace sparky
 		/// \param pResource	The resource to add to the map.
 		///
 		////////////////////////////////////////////////////////////
-		void add(const String& name, T* pResource);
+		void add(const StringId& name, T* pResource);
 
 		////////////////////////////////////////////////////////////
 		/// \brief Removes a resource from the ResourceHolder object.
@@ -130,7 +138,18 @@ namespace sparky
 		/// \param name		The key of the resource to remove.
 		///
 		////////////////////////////////////////////////////////////
-		void remove(const String& name);
+		void remove(const StringId& name);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Calls a function for every resource in the holder.
+		///
+		/// Resources must not be added or removed from within the function.
+		///
+		/// \param function		Called with the name and resource of each entry.
+		///
+		////////////////////////////////////////////////////////////
+		template <typename Function>
+		void forEach(Function function) const;
 	};
 
 	#include <sparky\core\resourceholder.inl>
@@ -9,21 +9,21 @@ ResourceHolder<T>::ResourceHolder(void)
 template <typename T>
 ResourceHolder<T>::~ResourceHolder(void)
 {
-	for (auto& r : m_resources)
+	m_resources.forEach([](const StringId&, T* pResource)
 	{
-		Ref::release(r.second);
-	}
+		Ref::release(pResource);
+	});
 }
 
 ////////////////////////////////////////////////////////////
 template <typename T>
-T* ResourceHolder<T>::get(const String& name) const
+T* ResourceHolder<T>::get(const StringId& name) const
 {
-	auto itr = m_resources.find(name);
+	T* const* ppResource = m_resources.find(name);
 
-	if (itr != m_resources.end())
+	if (ppResource)
 	{
-		return itr->second;
+		return *ppResource;
 	}
 
 	DebugLog::warning(name, "was not a stored resource.");
@@ -32,31 +32,49 @@ T* ResourceHolder<T>::get(const String& name) const
 
 ////////////////////////////////////////////////////////////
 template <typename T>
-void ResourceHolder<T>::add(const String& name, T* pResource)
+T* ResourceHolder<T>::find(const StringId& name) const
 {
-	auto itr = m_resources.find(name);
+	T* const* ppResource = m_resources.find(name);
+
+	return ppResource ? *ppResource : nullptr;
+}
 
-	if (itr != m_resources.end())
+////////////////////////////////////////////////////////////
+template <typename T>
+void ResourceHolder<T>::add(const StringId& name, T* pResource)
+{
+	if (!m_resources.insert(name, pResource))
 	{
 		DebugLog::warning(name, "is already a resource in this list.");
 		return;
 	}
 
 	pResource->addRef();
-	m_resources.insert(std::make_pair(name, pResource));
 }
 
 ////////////////////////////////////////////////////////////
 template <typename T>
-void ResourceHolder<T>::remove(const String& name)
+void ResourceHolder<T>::remove(const StringId& name)
 {
-	auto itr = m_resources.find(name);
+	T** ppResource = m_resources.find(name);
 
-	if (itr != m_resources.end())
+	if (ppResource)
 	{
-		m_resources.erase(itr);
-		Ref::release(itr->second);
+		T* pResource = *ppResource;
+
+		m_resources.erase(name);
+		Ref::release(pResource);
+
+		return;
 	}
 
 	DebugLog::warning(name, "was not a stored resource, so is not removed.");
+}
+
+////////////////////////////////////////////////////////////
+template <typename T>
+template <typename Function>
+void ResourceHolder<T>::forEach(Function function) const
+{
+	m_resources.forEach(function);
 }
\ No newline at end of file
@@ -32,6 +32,7 @@ Class Includes
 */
 #include <sparky\utils\singleton.hpp>		// Resource Manager is a singleton object.
 #include <sparky\core\resourceholder.hpp>	// Retains a number of different resources.
+#include <sparky\rendering\texture.hpp>		// Textures are retained by the file they are loaded from.
 
 namespace sparky
 {
@@ -53,6 +54,7 @@ namespace sparky
 		====================
 		*/
 		ResourceHolder<IShaderComponent> m_shaders;		///< The storage of all shaders.
+		ResourceHolder<Texture>			 m_textures;	///< The storage of all textures, keyed by their file and description.
 
 	private:
 		/*
@@ -92,7 +94,25 @@ namespace sparky
 		///
 		////////////////////////////////////////////////////////////
 		template <typename T = IShaderComponent>
-		T* getShader(const String& name) const;
+		T* getShader(const StringId& name) const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Retrieves a texture, loading it if it is not stored.
+		///
+		/// Textures are keyed by their file and description, so loading
+		/// the same file with the same description twice returns the
+		/// same Texture and decodes the file once. The file and 
+		/// description of a stored Texture are compared on a hit, so 
+		/// two textures whose keys collide are never confused. A new
+		/// Texture is decoded in the background, see TextureLoader.
+		///
+		/// \param filename		The file of the texture.
+		/// \param desc			The formats and rendering technique of the texture.
+		///
+		/// \retval Texture*	The texture of the file.
+		///
+		////////////////////////////////////////////////////////////
+		Texture* loadTexture(const String& filename, const SPARKY_TEXTURE_DESC& desc);
 
 		/*
 		====================
@@ -110,7 +130,7 @@ namespace sparky
 		/// \param pShader	The shader to add to the ResourceHolder.
 		///
 		////////////////////////////////////////////////////////////
-		void addShader(const String& name, IShaderComponent* pShader);
+		void addShader(const StringId& name, IShaderComponent* pShader);
 
 		////////////////////////////////////////////////////////////
 		/// \brief Removes a shader from the ResourceHolder lists.
@@ -122,12 +142,26 @@ namespace sparky
 		/// \param name		The name of the shader object to remove.
 		///
 		////////////////////////////////////////////////////////////
-		void removeShader(const String& name);
+		void removeShader(const StringId& name);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Reloads every resource that depends on a file.
+		///
+		/// Shader files are passed to the ShaderRegistry, and every
+		/// shader reads its uniforms again if a Program was relinked.
+		/// Every stored texture of the file is loaded again in place.
+		///
+		/// \param filename		The file that has changed.
+		///
+		/// \retval bool	True if any resource depended on the file.
+		///
+		////////////////////////////////////////////////////////////
+		bool reload(const String& filename);
 	};
 
 	////////////////////////////////////////////////////////////
 	template <typename T>
-	T* ResourceManager::getShader(const String& name) const
+	T* ResourceManager::getShader(const StringId& name) const
 	{
 		return dynamic_cast<T*>(m_shaders.get(name));
 	}
@@ -0,0 +1,260 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// 
+// Sparky Engine
+// 2016 - Benjamin Carter (benjamin.mark.carter@hotmail.com)
+// 
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+// 
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+// 
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgement
+//    in the product documentation would be appreciated but is not required.
+// 
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+// 
+// 3. This notice may not be removed or altered from any source distribution.
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __SPARKY_SLAB_ALLOCATOR_HPP__
+#define __SPARKY_SLAB_ALLOCATOR_HPP__
+
+/*
+====================
+CPP Includes
+====================
+*/
+#include <cstddef>						// Sizes of the allocated slots.
+#include <new>							// Fallback to the global operator new.
+#include <vector>						// Storage for every slab allocated by the allocator.
+#include <mutex>						// Guards the shared free list between threads.
+#include <atomic>						// Statistics are updated from every thread.
+#include <type_traits>					// Alignment requirements of the allocated type.
+/*
+====================
+Class Includes
+====================
+*/
+#include <sparky\utils\defines.hpp>	// Portable thread local storage for the per-thread caches.
+
+namespace sparky
+{
+	template <typename T>
+	class SlabAllocator
+	{
+	private:
+		/*
+		====================
+		Structures
+		====================
+		*/
+		struct FreeSlot_t
+		{
+			FreeSlot_t* pNext;	///< The next free slot, stored within the unused memory of the slot.
+		};
+
+		struct ThreadCache_t
+		{
+			FreeSlot_t*	 pHead;	///< The first free slot owned by the thread.
+			unsigned int count;	///< The amount of free slots owned by the thread.
+		};
+
+		/*
+		====================
+		Member Variables
+		====================
+		*/
+		std::vector<void*>					m_slabs;		///< Every slab allocated, slabs are retained for reuse rather than freed.
+		FreeSlot_t*							m_pFreeList;	///< Free slots shared between all threads.
+		mutable std::mutex					m_mutex;		///< Guards the slabs and the shared free list.
+
+		std::atomic<unsigned int>			m_liveCount;	///< The amount of slots currently holding an object.
+		std::atomic<unsigned int>			m_slotCount;	///< The amount of slots across all slabs.
+
+		static SPARKY_THREAD_LOCAL ThreadCache_t m_sCache;	///< The calling thread's cache of free slots.
+
+		/*
+		====================
+		Constant Variables
+		====================
+		*/
+		static const std::size_t			m_sSlotAlignment;	///< The alignment of a slot, satisfying both T and a free slot.
+		static const std::size_t			m_sSlotSize;		///< The size of a slot, large enough for T and rounded to the slot alignment.
+		static const unsigned int			m_sSlabSlots;		///< The amount of slots within a single slab.
+		static const unsigned int			m_sCacheSize;		///< The maximum amount of free slots a thread caches.
+
+	private:
+		/*
+		====================
+		Private Ctor
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Constructs a SlabAllocator object instance.
+		///
+		/// No slabs are allocated until the first object is requested.
+		///
+		////////////////////////////////////////////////////////////
+		explicit SlabAllocator(void);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Deletes the copy constructor of the SlabAllocator.
+		///
+		/// \param other	The other SlabAllocator that will not be copied.
+		///
+		////////////////////////////////////////////////////////////
+		explicit SlabAllocator(const SlabAllocator<T>& other) = delete;
+
+		/*
+		====================
+		Private Methods
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Refills the calling thread's cache from the shared free list.
+		///
+		/// A new slab is allocated when the shared free list is empty.
+		/// This is the only point on the allocation path which takes
+		/// the shared lock.
+		///
+		////////////////////////////////////////////////////////////
+		void refill(void);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Returns half of the calling thread's cache to the shared free list.
+		///
+		/// This stops a thread that only releases objects, such as the
+		/// main thread flushing the PoolManager, from hoarding slots.
+		///
+		////////////////////////////////////////////////////////////
+		void drain(void);
+
+	public:
+		/*
+		====================
+		Getters and Setters
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Gets the instance of the SlabAllocator.
+		///
+		/// Unlike the other Singletons within the engine, the instance
+		/// is intentionally never destroyed. Refs released by the 
+		/// PoolManager during static destruction can therefore still
+		/// return their memory to the allocator.
+		///
+		/// \retval SlabAllocator<T>&	The instance of the allocator for T.
+		///
+		////////////////////////////////////////////////////////////
+		static SlabAllocator<T>& getInstance(void);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Gets the amount of slots currently holding an object.
+		///
+		/// \retval unsigned int	The live objects allocated from the slabs.
+		///
+		////////////////////////////////////////////////////////////
+		unsigned int getLiveCount(void) const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Gets the amount of slots available for allocation.
+		///
+		/// This includes the slots cached by each thread.
+		///
+		/// \retval unsigned int	The free slots across all slabs.
+		///
+		////////////////////////////////////////////////////////////
+		unsigned int getFreeCount(void) const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Gets the amount of slabs allocated.
+		///
+		/// \retval unsigned int	The amount of slabs.
+		///
+		////////////////////////////////////////////////////////////
+		unsigned int getSlabCount(void) const;
+
+		/*
+		====================
+		Methods
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Allocates memory for a single T.
+		///
+		/// Requests which are not the size of T, such as a class 
+		/// derived from T, are forwarded to the global operator new.
+		///
+		/// \param size	The size of the memory requested.
+		///
+		/// \retval void*	The allocated, uninitialised memory.
+		///
+		////////////////////////////////////////////////////////////
+		void* allocate(std::size_t size);
+
+		////////////////////////////////////////////////////////////
+		/// \brief De-allocates memory previously allocated for a single T.
+		///
+		/// The slot is returned to the calling thread's cache, which
+		/// does not need to be the thread that allocated it.
+		///
+		/// \param pMemory	The memory to de-allocate.
+		/// \param size		The size of the memory, as passed to allocate.
+		///
+		////////////////////////////////////////////////////////////
+		void deallocate(void* pMemory, std::size_t size);
+	};
+
+	#include <sparky\core\slaballocator.inl>
+
+}//namespace sparky
+
+#endif//__SPARKY_SLAB_ALLOCATOR_HPP__
+
+////////////////////////////////////////////////////////////
+/// \class sparky::SlabAllocator
+/// \ingroup core
+///
+/// sparky::SlabAllocator is a typed, thread-safe allocator
+/// that carves fixed size slots out of large slabs. Slabs are
+/// retained once allocated, so objects which are frequently 
+/// created and destroyed, such as Chunks, stop touching the
+/// general purpose heap once the application reaches a steady
+/// state, and sit contiguously in memory.
+///
+/// Each thread keeps a small cache of free slots, so the shared
+/// lock is only taken when a cache needs refilling or draining.
+///
+/// Ref objects opt into the allocator by declaring a class-level
+/// operator new and delete. Below is an example of its use.
+///
+/// Usage example:
+/// \code
+/// class Type : public sparky::Ref
+/// {
+/// public:
+///		static void* operator new(std::size_t size)
+///		{
+///			return sparky::SlabAllocator<Type>::getInstance().allocate(size);
+///		}
+///
+///		static void operator delete(void* pMemory, std::size_t size)
+///		{
+///			sparky::SlabAllocator<Type>::getInstance().deallocate(pMemory, size);
+///		}
+/// };
+///
+/// // Allocated from the slabs of Type.
+/// Type* pType = new Type();
+///
+/// // Print the amount of live Types.
+/// std::cout << sparky::SlabAllocator<Type>::getInstance().getLiveCount() << std::endl;
+/// \endcode
+///
+////////////////////////////////////////////////////////////
@@ -0,0 +1,189 @@
+/*
+====================
+Static Fields
+====================
+*/
+////////////////////////////////////////////////////////////
+template <typename T>
+SPARKY_THREAD_LOCAL typename SlabAllocator<T>::ThreadCache_t SlabAllocator<T>::m_sCache = { nullptr, 0 };
+
+/*
+====================
+Constant Variables
+====================
+*/
+////////////////////////////////////////////////////////////
+template <typename T>
+const std::size_t SlabAllocator<T>::m_sSlotAlignment = (std::alignment_of<T>::value > std::alignment_of<FreeSlot_t>::value) 
+													 ? std::alignment_of<T>::value : std::alignment_of<FreeSlot_t>::value;
+
+////////////////////////////////////////////////////////////
+template <typename T>
+const std::size_t SlabAllocator<T>::m_sSlotSize = ((sizeof(T) > sizeof(FreeSlot_t) ? sizeof(T) : sizeof(FreeSlot_t)) + m_sSlotAlignment - 1) 
+												/ m_sSlotAlignment * m_sSlotAlignment;
+
+////////////////////////////////////////////////////////////
+template <typename T>
+const unsigned int SlabAllocator<T>::m_sSlabSlots = (65536 / m_sSlotSize > 8) ? static_cast<unsigned int>(65536 / m_sSlotSize) : 8;
+
+////////////////////////////////////////////////////////////
+template <typename T>
+const unsigned int SlabAllocator<T>::m_sCacheSize = 32;
+
+/*
+====================
+Private Ctor
+====================
+*/
+////////////////////////////////////////////////////////////
+template <typename T>
+SlabAllocator<T>::SlabAllocator(void)
+	: m_slabs(), m_pFreeList(nullptr), m_mutex(), m_liveCount(0), m_slotCount(0)
+{
+}
+
+/*
+====================
+Private Methods
+====================
+*/
+////////////////////////////////////////////////////////////
+template <typename T>
+void SlabAllocator<T>::refill(void)
+{
+	std::lock_guard<std::mutex> guard(m_mutex);
+
+	if (!m_pFreeList)
+	{
+		char* pSlab = static_cast<char*>(::operator new(m_sSlotSize * m_sSlabSlots));
+		m_slabs.push_back(pSlab);
+
+		// Link the slots in reverse so that they are handed out in address order.
+		for (unsigned int i = m_sSlabSlots; i > 0; --i)
+		{
+			FreeSlot_t* pSlot = reinterpret_cast<FreeSlot_t*>(pSlab + (i - 1) * m_sSlotSize);
+			pSlot->pNext = m_pFreeList;
+			m_pFreeList = pSlot;
+		}
+
+		m_slotCount += m_sSlabSlots;
+	}
+
+	while (m_pFreeList && m_sCache.count < m_sCacheSize / 2)
+	{
+		FreeSlot_t* pSlot = m_pFreeList;
+		m_pFreeList = pSlot->pNext;
+
+		pSlot->pNext = m_sCache.pHead;
+		m_sCache.pHead = pSlot;
+		++m_sCache.count;
+	}
+}
+
+////////////////////////////////////////////////////////////
+template <typename T>
+void SlabAllocator<T>::drain(void)
+{
+	std::lock_guard<std::mutex> guard(m_mutex);
+
+	while (m_sCache.count > m_sCacheSize / 2)
+	{
+		FreeSlot_t* pSlot = m_sCache.pHead;
+		m_sCache.pHead = pSlot->pNext;
+		--m_sCache.count;
+
+		pSlot->pNext = m_pFreeList;
+		m_pFreeList = pSlot;
+	}
+}
+
+/*
+====================
+Getters and Setters
+====================
+*/
+////////////////////////////////////////////////////////////
+template <typename T>
+SlabAllocator<T>& SlabAllocator<T>::getInstance(void)
+{
+	static SlabAllocator<T>* pInstance = new SlabAllocator<T>();
+	return *pInstance;
+}
+
+////////////////////////////////////////////////////////////
+template <typename T>
+unsigned int SlabAllocator<T>::getLiveCount(void) const
+{
+	return m_liveCount.load(std::memory_order_relaxed);
+}
+
+////////////////////////////////////////////////////////////
+template <typename T>
+unsigned int SlabAllocator<T>::getFreeCount(void) const
+{
+	return m_slotCount.load(std::memory_order_relaxed) - m_liveCount.load(std::memory_order_relaxed);
+}
+
+////////////////////////////////////////////////////////////
+template <typename T>
+unsigned int SlabAllocator<T>::getSlabCount(void) const
+{
+	std::lock_guard<std::mutex> guard(m_mutex);
+	return m_slabs.size();
+}
+
+/*
+====================
+Methods
+====================
+*/
+////////////////////////////////////////////////////////////
+template <typename T>
+void* SlabAllocator<T>::allocate(std::size_t size)
+{
+	if (size != sizeof(T))
+	{
+		return ::operator new(size);
+	}
+
+	if (!m_sCache.pHead)
+	{
+		this->refill();
+	}
+
+	FreeSlot_t* pSlot = m_sCache.pHead;
+	m_sCache.pHead = pSlot->pNext;
+	--m_sCache.count;
+
+	m_liveCount.fetch_add(1, std::memory_order_relaxed);
+
+	return pSlot;
+}
+
+////////////////////////////////////////////////////////////
+template <typename T>
+void SlabAllocator<T>::deallocate(void* pMemory, std::size_t size)
+{
+	if (!pMemory)
+	{
+		return;
+	}
+
+	if (size != sizeof(T))
+	{
+		::operator delete(pMemory);
+		return;
+	}
+
+	FreeSlot_t* pSlot = static_cast<FreeSlot_t*>(pMemory);
+	pSlot->pNext = m_sCache.pHead;
+	m_sCache.pHead = pSlot;
+	++m_sCache.count;
+
+	m_liveCount.fetch_sub(1, std::memory_order_relaxed);
+
+	if (m_sCache.count > m_sCacheSize)
+	{
+		this->drain();
+	}
+}
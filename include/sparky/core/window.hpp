@@ -235,6 +235,15 @@ namespace sparky
 		////////////////////////////////////////////////////////////
 		bool isRunning(void) const;
 
+		////////////////////////////////////////////////////////////
+		/// \brief Checks to see if the Window object was created without
+		///		   a desktop window or OpenGL context.
+		///
+		/// \retval	bool		Whether the Window object is headless.
+		///
+		////////////////////////////////////////////////////////////
+		bool isHeadless(void) const;
+
 		/*
 		====================
 		Methods
@@ -277,6 +286,21 @@ namespace sparky
 		////////////////////////////////////////////////////////////
 		bool create(const ConfigFile& config);
 
+		////////////////////////////////////////////////////////////
+		/// \brief Creates a Window object without a desktop window.
+		///
+		/// No SDL window or OpenGL context is created, the Window only
+		/// provides its size and running state. This is used to run
+		/// the engine on machines without a display or GPU, where the
+		/// GLDevice is initialised with the GLRecorder instead.
+		///
+		/// \param config	The configuration file which contains the Window settings.
+		///
+		/// \retval bool	Returns true if the Window object initialise successfully.
+		///
+		////////////////////////////////////////////////////////////
+		bool createHeadless(const ConfigFile& config);
+
 		////////////////////////////////////////////////////////////
 		/// \brief Clears the current Window object.
 		///
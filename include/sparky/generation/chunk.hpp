@@ -31,6 +31,7 @@ CPP Includes
 ====================
 */
 #include <array>						// Storage type for voxels.
+#include <cstddef>						// Sizes for the class-level allocation operators.
 
 /*
 ====================
@@ -72,7 +73,8 @@ namespace sparky
 		*/
 		static const int		m_sSize;		///< The standard size of all Chunks.
 		std::array<Voxel, 4096> m_voxels;		///< The individual voxels of the Chunk.
-		MeshData*				m_pMesh;	    ///< The mesh that renders the voxels.
+		MeshData*				m_pMesh;	    ///< The mesh that the voxels are built into.
+		unsigned int			m_arenaMesh;	///< The handle of the uploaded mesh within the World's vertex arena.
 		World*					m_pWorld;		///< World object that this chunk is attached to.
 		bool					m_isActive;		///< If the Chunk has any voxels its needs to render.
 		std::array<Chunk*, 6>   m_neighbours;	///< The neighbouring chunks of the Chunk.
@@ -131,6 +133,33 @@ namespace sparky
 		////////////////////////////////////////////////////////////
 		~Chunk(void);
 
+		/*
+		====================
+		Operators
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Allocates the Chunk from its SlabAllocator.
+		///
+		/// Chunks are created and destroyed as the World streams, allocating
+		/// them from slabs keeps that churn off the general purpose heap.
+		///
+		/// \param size	The size of the object being allocated.
+		///
+		/// \retval void*	The memory of the new Chunk.
+		///
+		////////////////////////////////////////////////////////////
+		static void* operator new(std::size_t size);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Returns the memory of the Chunk to its SlabAllocator.
+		///
+		/// \param pMemory	The memory of the destroyed Chunk.
+		/// \param size		The size of the destroyed object.
+		///
+		////////////////////////////////////////////////////////////
+		static void operator delete(void* pMemory, std::size_t size);
+
 		/*
 		====================
 		Getters and Setters
@@ -216,7 +245,8 @@ namespace sparky
 		void greedy(void);
 
 		////////////////////////////////////////////////////////////
-		/// \brief Clears the Chunk MeshData of all vertices and indices.
+		/// \brief Clears the Chunk MeshData of all vertices and indices,
+		///		   and frees its range of the World's vertex arena.
 		////////////////////////////////////////////////////////////
 		void reset(void);
 
@@ -224,7 +254,8 @@ namespace sparky
 		/// \brief Updates the current Chunk object.
 		///
 		/// When the chunk is updated, it will check if it needs to
-		/// become active or needs to be generated.
+		/// become active or needs to be generated. A generated mesh is
+		/// uploaded into the World's vertex arena.
 		///
 		////////////////////////////////////////////////////////////
 		void update(void) override;
@@ -0,0 +1,180 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// 
+// Sparky Engine
+// 2016 - Benjamin Carter (benjamin.mark.carter@hotmail.com)
+// 
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+// 
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+// 
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgement
+//    in the product documentation would be appreciated but is not required.
+// 
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+// 
+// 3. This notice may not be removed or altered from any source distribution.
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __SPARKY_MATERIAL_REGISTRY_HPP__
+#define __SPARKY_MATERIAL_REGISTRY_HPP__
+
+/*
+====================
+CPP Includes
+====================
+*/
+#include <array>							// The layer of each voxel type.
+/*
+====================
+Class Includes
+====================
+*/
+#include <sparky\utils\singleton.hpp>		// The Material Registry is a singleton object.
+#include <sparky\utils\string.hpp>			// The tilesheet the layers are cut from.
+#include <sparky\generation\voxel.hpp>		// The materials are looked up by voxel type.
+
+namespace sparky
+{
+	/*
+	====================
+	Sparky Forward Declarations
+	====================
+	*/
+	class Texture;
+
+	class MaterialRegistry final : public Singleton<MaterialRegistry>
+	{
+		friend class Singleton<MaterialRegistry>;
+
+	private:
+		/*
+		====================
+		Constant Variables
+		====================
+		*/
+		static const unsigned int m_sTypeCount = static_cast<unsigned int>(eVoxelType::MAX_TYPES);	///< The amount of voxel types.
+
+		/*
+		====================
+		Member Variables
+		====================
+		*/
+		Texture*						m_pTexture;	///< The array texture of every material, owned by the ResourceManager.
+		std::array<float, m_sTypeCount>	m_layers;	///< The layer of the array texture each voxel type is drawn with.
+
+	private:
+		/*
+		====================
+		Private Ctor
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Default constructor of the MaterialRegistry object.
+		///
+		/// Each voxel type starts on the layer of its own value.
+		///
+		////////////////////////////////////////////////////////////
+		explicit MaterialRegistry(void);
+
+	public:
+		/*
+		====================
+		Dtor
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Destructor of the MaterialRegistry object.
+		////////////////////////////////////////////////////////////
+		~MaterialRegistry(void) = default;
+
+		/*
+		====================
+		Getters and Setters
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Sets the layer a voxel type is drawn with.
+		///
+		/// Chunks read the layers while they are meshed on the worker
+		/// threads, so the layers should be set before the World is
+		/// built.
+		///
+		/// \param type		The voxel type.
+		/// \param layer	The layer of the array texture.
+		///
+		////////////////////////////////////////////////////////////
+		void setLayer(const eVoxelType type, const unsigned int layer);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Retrieves the layer a voxel type is drawn with.
+		///
+		/// \param type		The voxel type.
+		///
+		/// \retval float	The layer, as it is stored in each Vertex.
+		///
+		////////////////////////////////////////////////////////////
+		float getLayer(const eVoxelType type) const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Retrieves the array texture of every material.
+		///
+		/// \retval Texture*	The array texture, null until load is called.
+		///
+		////////////////////////////////////////////////////////////
+		Texture* getTexture(void) const;
+
+		/*
+		====================
+		Methods
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Loads the materials from a tilesheet.
+		///
+		/// The tilesheet is cut into square tiles, read left to right
+		/// and top to bottom, and each tile becomes a layer of a 
+		/// GL_TEXTURE_2D_ARRAY. The layers repeat, so merged faces 
+		/// tile their material once per voxel. The texture is loaded
+		/// through the ResourceManager, so it is hot reloaded.
+		///
+		/// \param filename		The tilesheet of the materials.
+		/// \param tileSize		The width and height of a tile in pixels.
+		///
+		////////////////////////////////////////////////////////////
+		void load(const String& filename, const unsigned int tileSize);
+	};
+
+}//namespace sparky
+
+#endif//__SPARKY_MATERIAL_REGISTRY_HPP__
+
+////////////////////////////////////////////////////////////
+/// \class sparky::MaterialRegistry
+/// \ingroup generation
+///
+/// sparky::MaterialRegistry maps each voxel type to a layer of a
+/// single array texture. The mesher writes the layer into every 
+/// vertex of a face, so a Chunk draws all of its voxel types in
+/// one call with one texture bound.
+///
+/// Usage example:
+/// \code
+/// sparky::MaterialRegistry& materials = sparky::MaterialRegistry::getInstance();
+///
+/// // A 64x64 tilesheet of 32x32 tiles gives four layers.
+/// materials.load("assets/tilesheet.png", 32);
+/// materials.setLayer(sparky::eVoxelType::GRASS, 0);
+/// materials.setLayer(sparky::eVoxelType::DIRT, 1);
+/// materials.setLayer(sparky::eVoxelType::STONE, 2);
+///
+/// pWorld->setTexture(materials.getTexture());
+/// \endcode
+///
+////////////////////////////////////////////////////////////
\ No newline at end of file
@@ -35,7 +35,9 @@ namespace sparky
 	enum class eVoxelType
 	{
 		DIRT,
-		STONE
+		STONE,
+		GRASS,
+		MAX_TYPES
 	};
 
 	class Voxel
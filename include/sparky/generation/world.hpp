@@ -38,6 +38,7 @@ Class Includes
 */
 #include <sparky\core\ref.hpp>		// World is a dynamically allocated object.
 #include <sparky\math\vector3.hpp>	// The position of the chunk in world position.
+#include <sparky\rendering\vertexarena.hpp>	// The meshes of every chunk share one set of buffers.
 
 namespace sparky
 {
@@ -60,6 +61,7 @@ namespace sparky
 	class Chunk;
 	class Voxel;
 	class IShaderComponent;
+	class Texture;
 
 	class Comparer
 	{
@@ -94,6 +96,8 @@ namespace sparky
 		====================
 		*/
 		std::map<Vector3i, Chunk*, Comparer> m_chunks;	///< All the chunks within the World.
+		Texture*							 m_pTexture;	///< The texture every Chunk is rendered with.
+		VertexArena							 m_arena;		///< Holds the meshes of every Chunk, destroyed after the chunks.
 
 	public:
 		/*
@@ -173,6 +177,32 @@ namespace sparky
 		////////////////////////////////////////////////////////////
 		Voxel* getVoxel(const int x, const int y, const int z);
 
+		////////////////////////////////////////////////////////////
+		/// \brief Sets the texture that every Chunk is rendered with.
+		///
+		/// The texture is retained, and the previous texture released.
+		///
+		/// \param pTexture	The texture of the World.
+		///
+		////////////////////////////////////////////////////////////
+		void setTexture(Texture* pTexture);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Retrieves the texture that every Chunk is rendered with.
+		///
+		/// \retval Texture*	The texture of the World, may be null.
+		///
+		////////////////////////////////////////////////////////////
+		const Texture* getTexture(void) const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Retrieves the arena that holds the meshes of every Chunk.
+		///
+		/// \retval VertexArena&	The vertex arena of the World.
+		///
+		////////////////////////////////////////////////////////////
+		VertexArena& getArena(void);
+
 		////////////////////////////////////////////////////////////
 		/// \brief Add a Chunk to the World at the specified position.
 		///
@@ -205,6 +235,8 @@ namespace sparky
 		////////////////////////////////////////////////////////////
 		/// \brief Renders all of the Chunks within the World.
 		///
+		/// The draws of the Chunks are recorded into the RenderQueue.
+		///
 		/// \param pShader	The shader to render the World with.
 		///
 		////////////////////////////////////////////////////////////
@@ -75,7 +75,7 @@ namespace sparky
 		////////////////////////////////////////////////////////////
 		/// \brief Default destruction of the DirectionalLight object.
 		////////////////////////////////////////////////////////////
-		DirectionalLight(void) = default;
+		~DirectionalLight(void) = default;
 
 		/*
 		====================
@@ -110,25 +110,16 @@ namespace sparky
 		====================
 		*/
 		////////////////////////////////////////////////////////////
-		/// \brief Sets the uniform variables of the DirectionalLight.
+		/// \brief Writes the DirectionalLight into the packed light data.
 		///
-		/// The directional lights are constructed within the shader as
-		/// a struct. These uniforms comply with the variables of the structs.
+		/// Every directional light is shaded in a single pass, which
+		/// reads the lights from the Lights uniform block.
 		///
-		/// \param uniform	The uniform class of the currently bound shader.
+		/// \param data		The packed light data.
+		/// \param index	The element of the light data to write.
 		///
 		////////////////////////////////////////////////////////////
-		void setUniforms(Uniform& uniform);
-
-		////////////////////////////////////////////////////////////
-		/// \brief Adds the DirectionalLight to the current pipeline if the conditions
-		///        are correct.
-		///
-		/// As DirectionalLight "technically" do not have a starting position,
-		/// they are always added to the engine at the beginning of the frame.
-		///
-		////////////////////////////////////////////////////////////
-		void addLight(void) override;
+		void pack(LightData_t& data, const unsigned int index) const override;
 	};
 
 }//namespace sparky
@@ -154,7 +145,7 @@ namespace sparky
 /// memset(&desc, 0, sizeof(sparky::SPARKY_DIRECTIONAL_LIGHT_DESC));
 ///
 /// // Fill the description with information about the light.
-/// desc.base.name      = "u_light";						
+/// desc.base.name      = "sun";						
 /// desc.base.position  = sparky::Vector3f::zero();			
 /// desc.base.colour    = sparky::Vector3f(0.5f, 0.0f, 0.0f);	
 /// desc.base.intensity = 0.45f;					
@@ -164,8 +155,8 @@ namespace sparky
 /// sparky::DirectionalLight* pLight = new sparky::DirectionalLight(desc);
 /// pLight->addRef();
 ///
-/// // Within a shader update the lights uniform variables.
-/// pLight->setUniforms(m_uniform);
+/// // Add the light once, it is lit every frame until removed.
+/// pLight->addLight();
 /// \endcode
 ///
 ////////////////////////////////////////////////////////////
\ No newline at end of file
@@ -36,12 +36,23 @@ Class Includes
 
 namespace sparky
 {
+	/*
+	====================
+	Enumerations
+	====================
+	*/
+	enum class eLightType
+	{
+		DIRECTIONAL,
+		POINT
+	};
+
 	/*
 	====================
 	Sparky Forward Declarations
 	====================
 	*/
-	class Uniform;
+	struct LightData_t;
 
 	struct SPARKY_BASE_LIGHT_DESC
 	{
@@ -64,10 +75,12 @@ namespace sparky
 		Member Variables
 		====================
 		*/
-		String   m_name;		///< The name of the light (within the shader).
-		Vector3f m_position;	///< Position of the light within the scene.
-		Vector3f m_colour;		///< RGB values of the light.
-		float    m_intensity;	///< The light intensity.
+		String		 m_name;		///< The name of the light (within the shader).
+		Vector3f	 m_position;	///< Position of the light within the scene.
+		Vector3f	 m_colour;		///< RGB values of the light.
+		float		 m_intensity;	///< The light intensity.
+		eLightType	 m_type;		///< The type of the light, which table of the LightRegistry it is held in.
+		unsigned int m_handle;		///< The handle of the light within the LightRegistry.
 
 	protected:
 		/*
@@ -76,16 +89,13 @@ namespace sparky
 		====================
 		*/
 		////////////////////////////////////////////////////////////
-		/// \brief Sets the uniforms of this Light object.
+		/// \brief Flags the light to be re-packed by the LightRegistry.
 		///
-		/// The uniforms are set so that the communication between this
-		/// Light and the currently bound shader can be achieved.
-		///
-		/// \param uniform		A reference to the current Uniform object of the shader.
-		/// \param extension	The base externsion of the light within the shader.
+		/// Called whenever a property of the light changes, lights 
+		/// that have not been added are ignored.
 		///
 		////////////////////////////////////////////////////////////
-		void setUniforms(Uniform& uniform, const String& extension);
+		void invalidate(void);
 
 	public:
 		/*
@@ -102,14 +112,18 @@ namespace sparky
 		/// lights have several variables to be set within the class itself.
 		///
 		/// \param desc		The description of the light.
+		/// \param type		The type of the light.
 		///
 		////////////////////////////////////////////////////////////
-		explicit Light(const SPARKY_BASE_LIGHT_DESC& desc);
+		explicit Light(const SPARKY_BASE_LIGHT_DESC& desc, const eLightType type);
 
 		////////////////////////////////////////////////////////////
-		/// \brief Default destructor of the Light object.
+		/// \brief Destructor of the Light object.
+		///
+		/// The light is removed from the LightRegistry if it was added.
+		///
 		////////////////////////////////////////////////////////////
-		virtual ~Light(void) = default;
+		virtual ~Light(void);
 
 		/*
 		====================
@@ -202,10 +216,52 @@ namespace sparky
 		void setIntensity(const float intensity);
 
 		////////////////////////////////////////////////////////////
-		/// \brief Adds the light to the current pipeline if the conditions
-		///        are correct.
+		/// \brief Retrieves the type of the Light object.
+		///
+		/// \retval eLightType	The type of the Light.
+		///
+		////////////////////////////////////////////////////////////
+		eLightType getType(void) const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Retrieves the handle of the Light within the
+		///		   LightRegistry.
+		///
+		/// \retval unsigned int	The handle, LightRegistry::INVALID_HANDLE if not added.
+		///
+		////////////////////////////////////////////////////////////
+		unsigned int getHandle(void) const;
+
+		/*
+		====================
+		Methods
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Adds the light to the LightRegistry.
+		///
+		/// Lights only need to be added once, they stay lit until they
+		/// are removed or destroyed. Adding a light twice has no effect.
+		///
+		////////////////////////////////////////////////////////////
+		void addLight(void);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Removes the light from the LightRegistry.
 		////////////////////////////////////////////////////////////
-		virtual void addLight(void) = 0;
+		void removeLight(void);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Writes the light into the packed light data.
+		///
+		/// Called by the LightRegistry for the lights that have changed
+		/// since the last upload.
+		///
+		/// \param data		The packed light data.
+		/// \param index	The element of the light data to write.
+		///
+		////////////////////////////////////////////////////////////
+		virtual void pack(LightData_t& data, const unsigned int index) const = 0;
 	};
 
 }//namespace sparky
@@ -223,4 +279,7 @@ namespace sparky
 /// code example is provided in sparky::PointLight and 
 /// sparky::DirectionalLight.
 ///
+/// Added lights are held by the sparky::LightRegistry, which only
+/// re-packs a light after one of its setters has been called.
+///
 ////////////////////////////////////////////////////////////
\ No newline at end of file
@@ -0,0 +1,340 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// 
+// Sparky Engine
+// 2016 - Benjamin Carter (benjamin.mark.carter@hotmail.com)
+// 
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+// 
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+// 
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgement
+//    in the product documentation would be appreciated but is not required.
+// 
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+// 
+// 3. This notice may not be removed or altered from any source distribution.
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __SPARKY_LIGHT_CLUSTERS_HPP__
+#define __SPARKY_LIGHT_CLUSTERS_HPP__
+
+/*
+====================
+CPP Includes
+====================
+*/
+#include <atomic>						// Slices are claimed and completed by the assigning threads.
+#include <memory>						// The job of each build is shared with the worker threads.
+#include <vector>						// Storage of the grid and the light index lists.
+/*
+====================
+Class Includes
+====================
+*/
+#include <sparky\math\vector4.hpp>		// The lights are passed in as spheres, w is the radius.
+#include <sparky\math\rect.hpp>			// The screen area covered by the lights.
+
+namespace sparky
+{
+	/*
+	====================
+	Sparky Forward Declarations
+	====================
+	*/
+	class Camera;
+
+	struct Cluster_t
+	{
+		unsigned int offset;	///< The index of the cluster's first light within the light index list.
+		unsigned int count;		///< The amount of lights affecting the cluster.
+	};
+
+	struct ClusterStats_t
+	{
+		unsigned int lights;		///< The amount of lights that were assigned.
+		unsigned int visibleLights;	///< The amount of lights that cover part of the screen.
+		unsigned int references;	///< The total length of the light index lists.
+		unsigned int maxLights;		///< The most lights affecting a single cluster.
+		unsigned int overflow;		///< The amount of references dropped because a cluster was full.
+	};
+
+	class LightClusters final
+	{
+	public:
+		/*
+		====================
+		Constant Variables
+		====================
+		*/
+		static const unsigned int GRID_X = 16;				///< The amount of tiles across the screen.
+		static const unsigned int GRID_Y = 9;				///< The amount of tiles down the screen.
+		static const unsigned int GRID_Z = 24;				///< The amount of depth slices between the near and far planes.
+		static const unsigned int MAX_CLUSTER_LIGHTS = 128;	///< The most lights a single cluster can reference.
+
+	private:
+		/*
+		====================
+		Structures
+		====================
+		*/
+		struct Sphere_t
+		{
+			float			x;			///< The view space x of the light.
+			float			y;			///< The view space y of the light.
+			float			z;			///< The view space depth of the light.
+			float			radius;		///< The range of the light.
+			unsigned int	firstSlice;	///< The nearest slice the sphere overlaps, GRID_Z if it is off screen.
+			unsigned int	lastSlice;	///< The furthest slice the sphere overlaps.
+			unsigned int	firstColumn;///< The leftmost tile column the sphere covers on screen.
+			unsigned int	lastColumn;	///< The rightmost tile column the sphere covers on screen.
+			unsigned int	firstRow;	///< The lowest tile row the sphere covers on screen.
+			unsigned int	lastRow;	///< The highest tile row the sphere covers on screen.
+		};
+
+		struct AssignJob_t
+		{
+			std::atomic<unsigned int>	next;	///< The next slice to be claimed.
+			std::atomic<unsigned int>	done;	///< The amount of slices that have been assigned.
+		};
+
+		/*
+		====================
+		Member Variables
+		====================
+		*/
+		std::vector<Sphere_t>		m_spheres;		///< The lights of the current build, in view space.
+		std::vector<float>			m_boundsX;		///< The view space minimum then maximum x of every tile column, per slice.
+		std::vector<float>			m_boundsY;		///< The view space minimum then maximum y of every tile row, per slice.
+		std::vector<float>			m_depths;		///< The view space depth at the start of every slice, and the end of the last.
+
+		std::vector<unsigned short>	m_grid;			///< MAX_CLUSTER_LIGHTS light indices for every cluster, filled while assigning.
+		std::vector<unsigned int>	m_counts;		///< The amount of lights found for every cluster, may exceed MAX_CLUSTER_LIGHTS.
+
+		std::vector<Cluster_t>		m_clusters;		///< The light list of every cluster within m_indices.
+		std::vector<unsigned short>	m_indices;		///< The light index lists of every cluster, one after another.
+		Rectf						m_screenBounds;	///< The screen area covered by the lights, in normalised device coordinates.
+
+		float						m_fov;			///< The field of view the bounds were built for.
+		float						m_aspectRatio;	///< The aspect ratio the bounds were built for.
+		float						m_nearPlane;	///< The near plane the bounds were built for.
+		float						m_farPlane;		///< The far plane the bounds were built for.
+
+		ClusterStats_t				m_stats;		///< The statistics of the last build.
+
+		static const unsigned int	m_sParallelLights = 64;	///< Below this amount of lights, the slices are assigned on the calling thread.
+
+	private:
+		/*
+		====================
+		Private Methods
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Rebuilds the view space bounds of every cluster if
+		///		   the projection has changed.
+		///
+		/// The slices are spaced exponentially, so that clusters near
+		/// the camera are as thin as they are wide on screen.
+		///
+		/// \param fov			The vertical field of view in degrees.
+		/// \param aspectRatio	The width of the screen divided by its height.
+		/// \param nearPlane	The distance to the near plane.
+		/// \param farPlane		The distance to the far plane.
+		///
+		////////////////////////////////////////////////////////////
+		void setProjection(const float fov, const float aspectRatio, const float nearPlane, const float farPlane);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Retrieves the slice a view space depth falls into.
+		///
+		/// \param depth			The view space depth.
+		///
+		/// \retval unsigned int	The slice, clamped to the grid.
+		///
+		////////////////////////////////////////////////////////////
+		unsigned int getSlice(const float depth) const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Tests every light overlapping a slice against each
+		///		   of the slice's clusters.
+		///
+		/// A slice's clusters share their depth range, and each tile 
+		/// column and row shares its x and y range, so the distance 
+		/// from a sphere to a cluster is built from one distance per
+		/// column, per row and per slice. Only the tiles the sphere
+		/// covers on screen are tested, the columns four at a time 
+		/// when SSE is available.
+		///
+		/// \param slice	The slice to assign.
+		///
+		////////////////////////////////////////////////////////////
+		void assign(const unsigned int slice);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Claims and assigns slices until none are left.
+		///
+		/// A task that starts after every slice has been claimed 
+		/// returns without touching the clusters.
+		///
+		/// \param pJob	The job the slices are claimed from.
+		///
+		////////////////////////////////////////////////////////////
+		void assign(const std::shared_ptr<AssignJob_t>& pJob);
+
+	public:
+		/*
+		====================
+		Ctor and Dtor
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Constructs an empty LightClusters object.
+		///
+		/// The bounds of the clusters are built by the first build.
+		///
+		////////////////////////////////////////////////////////////
+		explicit LightClusters(void);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Destruction of the LightClusters object.
+		////////////////////////////////////////////////////////////
+		~LightClusters(void) = default;
+
+		/*
+		====================
+		Getters and Setters
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Retrieves the light list of every cluster.
+		///
+		/// The clusters are ordered by column, then row, then slice,
+		/// see getClusterIndex.
+		///
+		/// \retval vector	The clusters of the last build.
+		///
+		////////////////////////////////////////////////////////////
+		const std::vector<Cluster_t>& getClusters(void) const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Retrieves the light index lists of every cluster.
+		///
+		/// \retval vector	The indices into the spheres of the last build.
+		///
+		////////////////////////////////////////////////////////////
+		const std::vector<unsigned short>& getIndices(void) const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Retrieves the statistics of the last build.
+		///
+		/// \retval ClusterStats_t	The statistics of the last build.
+		///
+		////////////////////////////////////////////////////////////
+		const ClusterStats_t& getStats(void) const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Retrieves the screen area covered by the lights of
+		///		   the last build.
+		///
+		/// Only valid when at least one light is visible.
+		///
+		/// \retval Rectf	The area in normalised device coordinates.
+		///
+		////////////////////////////////////////////////////////////
+		const Rectf& getScreenBounds(void) const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Retrieves the scale that turns the logarithm of a
+		///		   view space depth into a slice.
+		///
+		/// slice = log(depth) * scale + bias
+		///
+		/// \retval float	The slice scale.
+		///
+		////////////////////////////////////////////////////////////
+		float getSliceScale(void) const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Retrieves the bias added to the scaled logarithm of 
+		///		   a view space depth, see getSliceScale.
+		///
+		/// \retval float	The slice bias.
+		///
+		////////////////////////////////////////////////////////////
+		float getSliceBias(void) const;
+
+		/*
+		====================
+		Methods
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Retrieves the index of a cluster.
+		///
+		/// \param x				The tile column, from the left of the screen.
+		/// \param y				The tile row, from the bottom of the screen.
+		/// \param z				The depth slice, from the near plane.
+		///
+		/// \retval unsigned int	The index of the cluster.
+		///
+		////////////////////////////////////////////////////////////
+		static unsigned int getClusterIndex(const unsigned int x, const unsigned int y, const unsigned int z);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Assigns lights to every cluster they overlap.
+		///
+		/// The lights are moved into the view space of the camera and
+		/// projected onto the screen. Lights that cover part of the 
+		/// screen are tested against the clusters they overlap, lights
+		/// that do not cost nothing further.
+		/// Large amounts of lights are assigned on the worker threads,
+		/// one slice at a time.
+		///
+		/// \param camera	The camera the grid is built for.
+		/// \param pSpheres	The world position of each light, w is its range.
+		/// \param count	The amount of lights, at most 65536.
+		///
+		////////////////////////////////////////////////////////////
+		void build(Camera& camera, const Vector4f* pSpheres, const unsigned int count);
+	};
+
+}//namespace sparky
+
+#endif//__SPARKY_LIGHT_CLUSTERS_HPP__
+
+////////////////////////////////////////////////////////////
+/// \class sparky::LightClusters
+/// \ingroup lighting
+///
+/// sparky::LightClusters divides the view frustum into a grid of
+/// clusters, tiles across the screen and slices along the depth,
+/// and lists the lights that affect each cluster. A lighting pass
+/// then only has to shade a pixel with the lights of the cluster
+/// it falls within, instead of every light in the scene.
+///
+/// The grid is built on the CPU, so the lists can be inspected
+/// without a context.
+///
+/// Usage example:
+/// \code
+/// sparky::LightClusters clusters;
+///
+/// // Assign the lights of the frame.
+/// clusters.build(sparky::Camera::getMain(), lights.positionRange, lightCount);
+///
+/// const sparky::Cluster_t& cluster = clusters.getClusters()[sparky::LightClusters::getClusterIndex(0, 0, 0)];
+///
+/// for (unsigned int i = 0; i < cluster.count; i++)
+/// {
+///		unsigned short light = clusters.getIndices()[cluster.offset + i];
+/// }
+/// \endcode
+///
+////////////////////////////////////////////////////////////
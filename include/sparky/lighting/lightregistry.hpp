@@ -0,0 +1,271 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// 
+// Sparky Engine
+// 2016 - Benjamin Carter (benjamin.mark.carter@hotmail.com)
+// 
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+// 
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+// 
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgement
+//    in the product documentation would be appreciated but is not required.
+// 
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+// 
+// 3. This notice may not be removed or altered from any source distribution.
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __SPARKY_LIGHT_REGISTRY_HPP__
+#define __SPARKY_LIGHT_REGISTRY_HPP__
+
+/*
+====================
+CPP Includes
+====================
+*/
+#include <vector>						// The dense light tables and their handles.
+/*
+====================
+Class Includes
+====================
+*/
+#include <sparky\utils\singleton.hpp>	// The Light Registry is a singleton object.
+#include <sparky\rendering\buffers.hpp>	// The packed lights are held in a uniform buffer.
+#include <sparky\lighting\light.hpp>	// The lights are stored by their type.
+
+namespace sparky
+{
+	struct LightRegistryStats_t
+	{
+		unsigned int lights;		///< The amount of lights within the registry.
+		unsigned int packedLights;	///< The amount of lights packed by the last upload.
+		unsigned int uploadedBytes;	///< The amount of bytes written to the uniform buffer by the last upload.
+	};
+
+	class LightRegistry final : public Singleton<LightRegistry>
+	{
+		friend class Singleton<LightRegistry>;
+
+	public:
+		/*
+		====================
+		Constant Variables
+		====================
+		*/
+		static const unsigned int INVALID_HANDLE = 0xFFFFFFFF;	///< The handle of a light that has not been added.
+
+	private:
+		/*
+		====================
+		Structures
+		====================
+		*/
+		struct Table_t
+		{
+			std::vector<Light*>			lights;			///< The lights of the type, densely packed in the order of the light data.
+			std::vector<unsigned int>	owners;			///< The handle of each dense light.
+			std::vector<unsigned int>	slots;			///< The dense index of each handle.
+			std::vector<unsigned int>	freeHandles;	///< Handles of removed lights, reused before new ones are made.
+			unsigned int				capacity;		///< The amount of lights the uniform block holds.
+			unsigned int				dirtyBegin;		///< The first dense index to be re-packed.
+			unsigned int				dirtyEnd;		///< One past the last dense index to be re-packed.
+		};
+
+		/*
+		====================
+		Constant Variables
+		====================
+		*/
+		static const unsigned int m_sTypeCount = 2;	///< The amount of light types, one table each.
+
+		/*
+		====================
+		Member Variables
+		====================
+		*/
+		Table_t					m_tables[m_sTypeCount];	///< The lights of each type.
+		LightData_t				m_data;					///< The packed lights, mirrored in the uniform buffer.
+		UniformBuffer			m_buffer;				///< The packed lights, read by the lighting passes.
+		bool					m_countsDirty;			///< Whether a light was added or removed since the last upload.
+		LightRegistryStats_t	m_stats;				///< The statistics of the last upload.
+
+	private:
+		/*
+		====================
+		Private Ctor
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Default constructor of the LightRegistry object.
+		////////////////////////////////////////////////////////////
+		explicit LightRegistry(void);
+
+		/*
+		====================
+		Private Methods
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Flags a dense light to be re-packed.
+		///
+		/// The dirty lights of a table are kept as a single range, so
+		/// the upload is at most one write per array.
+		///
+		/// \param table	The table of the light.
+		/// \param index	The dense index of the light.
+		///
+		////////////////////////////////////////////////////////////
+		void markDirty(Table_t& table, const unsigned int index);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Packs and uploads the dirty range of a table.
+		///
+		/// \param type		The type of the lights within the table.
+		///
+		////////////////////////////////////////////////////////////
+		void uploadTable(const eLightType type);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Writes part of the light data to the uniform buffer.
+		///
+		/// \param offset	The offset of the data within LightData_t.
+		/// \param size		The size of the data in bytes.
+		///
+		////////////////////////////////////////////////////////////
+		void uploadRange(const size_t offset, const size_t size);
+
+	public:
+		/*
+		====================
+		Dtor
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Default destructor of the LightRegistry object.
+		////////////////////////////////////////////////////////////
+		~LightRegistry(void) = default;
+
+		/*
+		====================
+		Getters and Setters
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Retrieves the packed lights.
+		///
+		/// The lights of each type are densely packed from the start
+		/// of their arrays, up to the count of that type.
+		///
+		/// \retval LightData_t	The packed lights.
+		///
+		////////////////////////////////////////////////////////////
+		const LightData_t& getData(void) const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Retrieves the amount of lights of a type.
+		///
+		/// \param type		The type of the lights.
+		///
+		/// \retval unsigned int	The amount of lights.
+		///
+		////////////////////////////////////////////////////////////
+		unsigned int getCount(const eLightType type) const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Retrieves the statistics of the last upload.
+		///
+		/// \retval LightRegistryStats_t	The statistics of the last upload.
+		///
+		////////////////////////////////////////////////////////////
+		const LightRegistryStats_t& getStats(void) const;
+
+		/*
+		====================
+		Methods
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Adds a light to the registry.
+		///
+		/// The light is packed by the next upload and stays lit until 
+		/// it is removed. Lights beyond the capacity of the uniform 
+		/// block are not added.
+		///
+		/// \param pLight	The light to add.
+		///
+		/// \retval unsigned int	The handle of the light, INVALID_HANDLE if the registry is full.
+		///
+		////////////////////////////////////////////////////////////
+		unsigned int add(Light* pLight);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Removes a light from the registry.
+		///
+		/// The last light of the type is moved into the gap, so only
+		/// that one light has to be re-packed.
+		///
+		/// \param type		The type of the light.
+		/// \param handle	The handle returned when the light was added.
+		///
+		////////////////////////////////////////////////////////////
+		void remove(const eLightType type, const unsigned int handle);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Flags a light to be re-packed by the next upload.
+		///
+		/// \param type		The type of the light.
+		/// \param handle	The handle returned when the light was added.
+		///
+		////////////////////////////////////////////////////////////
+		void invalidate(const eLightType type, const unsigned int handle);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Packs the changed lights and uploads them to the 
+		///		   uniform buffer.
+		///
+		/// Only the dirty range of each array is written, so a frame
+		/// in which no light has changed uploads nothing. The buffer
+		/// is created and bound to UNIFORM_BINDING_LIGHTS on the first
+		/// upload.
+		///
+		////////////////////////////////////////////////////////////
+		void upload(void);
+	};
+
+}//namespace sparky
+
+#endif//__SPARKY_LIGHT_REGISTRY_HPP__
+
+////////////////////////////////////////////////////////////
+/// \class sparky::LightRegistry
+/// \ingroup lighting
+///
+/// sparky::LightRegistry holds every light that has been added to
+/// the engine. Lights are stored densely by type, as a structure of
+/// arrays that matches the Lights uniform block, and are addressed
+/// by a handle that stays valid while other lights are removed.
+///
+/// Lights are only re-packed after one of their setters is called,
+/// so static lights cost nothing after the frame they are added.
+///
+/// Usage example:
+/// \code
+/// // Lights add and remove themselves from the registry.
+/// pLight->addLight();
+///
+/// // Once a frame, upload the lights that have changed.
+/// sparky::LightRegistry::getInstance().upload();
+///
+/// // The point lights are read back to cull them.
+/// const sparky::LightData_t& data = sparky::LightRegistry::getInstance().getData();
+/// unsigned int count = sparky::LightRegistry::getInstance().getCount(sparky::eLightType::POINT);
+/// \endcode
+///
+////////////////////////////////////////////////////////////
@@ -34,6 +34,13 @@ Class Includes
 
 namespace sparky
 {
+	/*
+	====================
+	Sparky Forward Declarations
+	====================
+	*/
+	struct LightData_t;
+
 	struct Attenuation
 	{
 		/*
@@ -147,26 +154,17 @@ namespace sparky
 		====================
 		*/
 		////////////////////////////////////////////////////////////
-		/// \brief Sets the uniform variables of a PointLight within a shader.
-		///
-		/// Whenever a PointLight is used within a shader, the variables
-		/// of the PointLight must be updated for correct shading behaviour.
-		///
-		/// \param uniform	The Uniforms of the currently bound shader.
+		/// \brief Writes the PointLight into the packed light data.
 		///
-		////////////////////////////////////////////////////////////
-		void setUniforms(Uniform& uniform);
-
-		////////////////////////////////////////////////////////////
-		/// \brief Adds the light to the current pipeline if the conditions
-		///        are correct.
+		/// Every point light is shaded in a single pass, which reads
+		/// the lights from the Lights uniform block. The lights off
+		/// screen are culled when they are assigned to the clusters.
 		///
-		/// For Point Lights their position and radius is checked using the
-		/// sphere check in the Frustum class. If they are currently within
-		/// view, they are added to the GameManager for rendering this frame.
+		/// \param data		The packed light data.
+		/// \param index	The element of the light data to write.
 		///
 		////////////////////////////////////////////////////////////
-		void addLight(void) override;
+		void pack(LightData_t& data, const unsigned int index) const override;
 	};
 
 }//namespace sparky
@@ -192,7 +190,7 @@ namespace sparky
 /// memset(&desc, 0, sizeof(sparky::SPARKY_POINT_LIGHT_DESC));
 ///
 /// // Set the information of the description.
-/// desc.base.name = "u_light";
+/// desc.base.name = "torch";
 /// desc.base.position = sparky::Vector3f::zero();
 /// desc.base.colour = sparky::Vector3f(0.5f, 0.0f, 0.0f);
 /// desc.base.intensity = 0.8f;
@@ -207,8 +205,8 @@ namespace sparky
 /// sparky::PointLight* pLight = new sparky::PointLight(desc);
 /// pLight->addRef();
 ///
-/// // Update the uniforms within a shader object.
-/// pLight->setUniforms(m_uniform);
+/// // Add the light once, it is lit every frame until removed.
+/// pLight->addLight();
 /// \endcode
 ///
 ////////////////////////////////////////////////////////////
\ No newline at end of file
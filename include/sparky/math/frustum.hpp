@@ -32,6 +32,7 @@ CPP Includes
 */
 #include <array>					// Stores all of the planes in the Frustum.
 #include <sparky\math\vector3.hpp>	// Used for checking points and position in the Frustum.
+#include <sparky\math\rect.hpp>		// The screen area covered by a sphere.
 
 namespace sparky
 {
@@ -74,6 +75,31 @@ namespace sparky
 		*/
 		static std::array<FrustumPlane_t, 6> m_planes;	/// The planes of the Frustum.
 
+	private:
+		/*
+		====================
+		Private Methods
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Projects a view space circle onto a single screen
+		///		   axis.
+		///
+		/// The bounds are where the lines from the eye touch the 
+		/// circle. A touching point in front of the near plane is 
+		/// replaced by where the circle crosses the near plane.
+		///
+		/// \param u			The view space position of the centre along the axis.
+		/// \param z			The view space depth of the centre.
+		/// \param radius		The radius of the circle.
+		/// \param nearPlane	The distance to the near plane.
+		/// \param tanHalfFoV	The tangent of half the field of view along the axis.
+		/// \param min			Set to the lowest normalised device coordinate.
+		/// \param max			Set to the highest normalised device coordinate.
+		///
+		////////////////////////////////////////////////////////////
+		static void projectCircle(const float u, const float z, const float radius, const float nearPlane, const float tanHalfFoV, float& min, float& max);
+
 	public:
 		/*
 		====================
@@ -139,6 +165,27 @@ namespace sparky
 		///
 		////////////////////////////////////////////////////////////
 		static bool checkRectangle(const Vector3f& position, const Vector3f& size);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Calculates the screen area covered by a sphere.
+		///
+		/// The sphere is given in view space, with x to the right, y 
+		/// up and z along the view direction. Only the part in front of
+		/// the near plane is projected, and the area is clamped to the
+		/// screen. This does not depend on the constructed Frustum, so
+		/// it can be used for any camera.
+		///
+		/// \param centre		The view space centre of the sphere.
+		/// \param radius		The radius of the sphere.
+		/// \param fov			The vertical field of view in degrees.
+		/// \param aspectRatio	The width of the screen divided by its height.
+		/// \param nearPlane	The distance to the near plane.
+		/// \param rect			Set to the covered area in normalised device coordinates.
+		///
+		/// \retval bool		False if the sphere does not cover any of the screen.
+		///
+		////////////////////////////////////////////////////////////
+		static bool projectSphere(const Vector3f& centre, const float radius, const float fov, const float aspectRatio, const float nearPlane, Rectf& rect);
 	};
 
 }//namespace sparky
@@ -174,6 +221,14 @@ namespace sparky
 /// {
 ///		std::cout << "Point is outside Frustum!" << std::endl;
 /// }
+///
+/// // Find the area of the screen a view space sphere covers.
+/// Rectf rect;
+///
+/// if (Frustum::projectSphere(Vector3f(0.0f, 0.0f, 10.0f), 2.0f, 70.0f, 16.0f / 9.0f, 0.1f, rect))
+/// {
+///		std::cout << rect.size.x << std::endl;
+/// }
 /// \endcode
 ///
 ////////////////////////////////////////////////////////////
\ No newline at end of file
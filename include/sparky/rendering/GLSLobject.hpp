@@ -25,12 +25,6 @@
 #ifndef __SPARKY_GLSL_OBJECT_HPP__
 #define __SPARKY_GLSL_OBJECT_HPP__
 
-/*
-====================
-CPP Includes
-====================
-*/
-#include <vector>					// Storage container for includes already loaded in.
 /*
 ====================
 Class Includes
@@ -71,29 +65,6 @@ namespace sparky
 		String				m_source;	///< Source ( text ) form of the shader.
 		GLuint				m_type;		///< Type of shader, set to GL_VERTEX_SHADER or GL_FRAGMENT_SHADER.
 		bool		        m_compiled;	///< Whether the shader has been compiled.
-		std::vector<String> m_includes;	///< All includes in the file, checks and prevents the same includes.
-
-	private:
-		/*
-		====================
-		Private Methods
-		====================
-		*/
-		////////////////////////////////////////////////////////////
-		/// \brief Parses the shader text file.
-		///
-		/// When the shader is parsed, it is error checked for the correct 
-		/// file location and presents an error if the shader cannot be found. 
-		/// The parser will store the shader within a source string, additional 
-		/// support for  include statements has been provided, which will be 
-		/// recursively parsed and added to the source string.
-		/// 
-		/// \param filename		The filename.
-		///
-		/// \retval bool	True if the shader and its include have been parsed.
-		///
-		////////////////////////////////////////////////////////////
-		bool parse(const String& filename);
 
 	public:
 		/*
@@ -107,7 +78,8 @@ namespace sparky
 		/// Constructs a new Shader object by loading the shader from the
 		/// specified filename and setting its type. Construction will fail
 		/// if the filename is not a valid shader or does not end in the
-		/// extension .glsl.
+		/// extension .glsl. The source is preprocessed by the 
+		/// ShaderRegistry, so each file and include is only read once.
 		///
 		/// \param filename		The file directory of the shader.
 		/// \param type			The type of shader being parsed.
@@ -37,6 +37,8 @@ Class Includes
 ====================
 */
 #include <sparky\rendering\vertex.hpp>	// The vertices have to be read to generate and bind meshes.
+#include <sparky\math\matrix4.hpp>		// The matrices of the uniform blocks.
+#include <sparky\math\vector4.hpp>		// The camera position of the frame uniform block.
 /*
 ====================
 Additional Includes
@@ -55,9 +57,83 @@ namespace sparky
 	{
 		ATTRIB_LOCATION_VERTEX,
 		ATTRIB_LOCATION_NORMAL,
-		ATTRIB_LOCATION_UV
+		ATTRIB_LOCATION_UV,
+		ATTRIB_LOCATION_LAYER
 	};
 
+	enum eUniformBinding
+	{
+		UNIFORM_BINDING_FRAME,
+		UNIFORM_BINDING_OBJECT,
+		UNIFORM_BINDING_LIGHTS
+	};
+
+	////////////////////////////////////////////////////////////
+	/// \brief The std140 layout of the FrameData uniform block,
+	///		   written once per frame.
+	////////////////////////////////////////////////////////////
+	struct FrameData_t
+	{
+		Matrix4f view;				///< The view matrix of the main camera.
+		Matrix4f projection;		///< The projection matrix of the main camera.
+		Matrix4f viewProjection;	///< The view matrix multiplied by the projection matrix.
+		Vector4f cameraPosition;	///< The position of the main camera, w is 1.
+	};
+
+	////////////////////////////////////////////////////////////
+	/// \brief The std140 layout of an element of the ObjectData 
+	///		   uniform block, written once per instance.
+	////////////////////////////////////////////////////////////
+	struct ObjectData_t
+	{
+		Matrix4f model;	///< The transformation of the object.
+	};
+
+	////////////////////////////////////////////////////////////
+	/// \brief The amount of elements in the ObjectData uniform block.
+	///
+	/// 16KB, the smallest uniform block size OpenGL guarantees. Must
+	/// match MAX_INSTANCES in shaders/core/uniforms.glsl.
+	////////////////////////////////////////////////////////////
+	const unsigned int MAX_INSTANCES = 256;
+
+	////////////////////////////////////////////////////////////
+	/// \brief The amount of point lights in the Lights uniform block.
+	///		   Must match MAX_POINT_LIGHTS in shaders/core/lighting.glsl.
+	////////////////////////////////////////////////////////////
+	const unsigned int MAX_POINT_LIGHTS = 256;
+
+	////////////////////////////////////////////////////////////
+	/// \brief The amount of directional lights in the Lights uniform
+	///		   block. Must match MAX_DIRECTIONAL_LIGHTS in 
+	///		   shaders/core/lighting.glsl.
+	////////////////////////////////////////////////////////////
+	const unsigned int MAX_DIRECTIONAL_LIGHTS = 8;
+
+	////////////////////////////////////////////////////////////
+	/// \brief The std140 layout of the Lights uniform block, only
+	///		   the lights that changed are written.
+	///
+	/// Each field is its own array so that the culling only has to
+	/// read the positions and ranges, and so that a range of lights
+	/// can be uploaded without the rest of the block.
+	////////////////////////////////////////////////////////////
+	struct LightData_t
+	{
+		Vector4f	 positionRange[MAX_POINT_LIGHTS];					///< The position of each point light, w is its range.
+		Vector4f	 colourIntensity[MAX_POINT_LIGHTS];					///< The colour of each point light, w is its intensity.
+		Vector4f	 attenuation[MAX_POINT_LIGHTS];						///< The constant, linear and exponent attenuation of each point light, w is unused.
+		Vector4f	 direction[MAX_DIRECTIONAL_LIGHTS];					///< The direction of each directional light, w is unused.
+		Vector4f	 directionalColourIntensity[MAX_DIRECTIONAL_LIGHTS];	///< The colour of each directional light, w is its intensity.
+		unsigned int pointCount;										///< The amount of point lights.
+		unsigned int directionalCount;									///< The amount of directional lights.
+		unsigned int padding[2];										///< Pads the counts to a uvec4.
+	};
+
+	static_assert(sizeof(FrameData_t) == 208, "FrameData_t must match the std140 layout of the FrameData block.");
+	static_assert(sizeof(ObjectData_t) == 64, "ObjectData_t must match the std140 layout of the ObjectData block.");
+	static_assert(sizeof(LightData_t) == 48 * MAX_POINT_LIGHTS + 32 * MAX_DIRECTIONAL_LIGHTS + 16, "LightData_t must match the std140 layout of the Lights block.");
+
 	class Buffer final
 	{
 	private:
@@ -122,6 +198,31 @@ namespace sparky
 		////////////////////////////////////////////////////////////
 		void bind(const std::vector<Vertex_t>& vertices, const std::vector<GLuint>& indices);
 
+		////////////////////////////////////////////////////////////
+		/// \brief Bind the information for the buffers from memory
+		///		   that is not owned by a mesh.
+		///
+		/// The data is handed straight to OpenGL, so it can point into
+		/// a mapped file and only has to stay alive for the call.
+		///
+		/// \param pVertices		The vertices of the mesh to populate the buffer with.
+		/// \param vertexCount	The amount of vertices.
+		/// \param pIndices		The indices of the mesh to populate the buffer with.
+		/// \param indexCount	The amount of indices.
+		///
+		////////////////////////////////////////////////////////////
+		void bind(const Vertex_t* pVertices, const GLuint vertexCount, const GLuint* pIndices, const GLuint indexCount);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Describes the layout of Vertex_t to the bound vertex
+		///		   array, reading from the bound vertex buffer.
+		///
+		/// This is shared with buffers that hold many meshes, such as
+		/// the VertexArena.
+		///
+		////////////////////////////////////////////////////////////
+		static void setAttributePointers(void);
+
 		////////////////////////////////////////////////////////////
 		/// \brief Enable the attributes of the vertices.
 		/// 
@@ -129,7 +230,7 @@ namespace sparky
 		/// between the vertex information and GLSL shaders.
 		///
 		////////////////////////////////////////////////////////////
-		void enableAttributes(void);
+		static void enableAttributes(void);
 
 		////////////////////////////////////////////////////////////
 		/// \brief Disable the attributes of the vertices.
@@ -138,7 +239,7 @@ namespace sparky
 		/// between the vertex information and the GLSL shaders.
 		///
 		////////////////////////////////////////////////////////////
-		void disableAttributes(void);
+		static void disableAttributes(void);
 	};
 
 
@@ -176,6 +277,19 @@ namespace sparky
 		////////////////////////////////////////////////////////////
 		~ArrayBuffer(void);
 
+		/*
+		====================
+		Getters and Setters
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Retrieves the ID of the vertex array object.
+		///
+		/// \retval GLuint	The vertex array object, 0 if not generated.
+		///
+		////////////////////////////////////////////////////////////
+		GLuint getID(void) const;
+
 		/*
 		====================
 		Methods
@@ -202,6 +316,209 @@ namespace sparky
 		void unbind(void);
 	};
 
+
+	class UniformBuffer final
+	{
+	private:
+		/*
+		====================
+		Member Variables
+		====================
+		*/
+		GLuint		m_ubo;	///< Uniform Buffer Object.
+		GLsizeiptr	m_size;	///< The size of the storage in bytes.
+
+	public:
+		/*
+		====================
+		Ctor and Dtor
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Default construction of the Uniform Buffer object.
+		////////////////////////////////////////////////////////////
+		explicit UniformBuffer(void);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Destruction of the Uniform Buffer object.
+		///
+		/// The destruction of the Uniform Buffer object deletes the
+		/// buffer on the GPU.
+		///
+		////////////////////////////////////////////////////////////
+		~UniformBuffer(void);
+
+		/*
+		====================
+		Getters and Setters
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Retrieves the ID of the uniform buffer object.
+		///
+		/// \retval GLuint	The uniform buffer object, 0 if not generated.
+		///
+		////////////////////////////////////////////////////////////
+		GLuint getID(void) const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Retrieves the size of the storage of the buffer.
+		///
+		/// \retval GLsizeiptr	The size in bytes.
+		///
+		////////////////////////////////////////////////////////////
+		GLsizeiptr getSize(void) const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Retrieves the alignment that bound ranges must start at.
+		///
+		/// The value of GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT is queried
+		/// on the first call, which must be made with a context.
+		///
+		/// \retval unsigned int	The offset alignment in bytes.
+		///
+		////////////////////////////////////////////////////////////
+		static unsigned int getOffsetAlignment(void);
+
+		/*
+		====================
+		Methods
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Generates the uniform buffer object for use.
+		////////////////////////////////////////////////////////////
+		void generate(void);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Gives the buffer new storage, optionally filled.
+		///
+		/// The previous storage is orphaned rather than overwritten,
+		/// so draws that are still reading it do not stall the CPU.
+		///
+		/// \param size		The size of the storage in bytes.
+		/// \param pData	The data to fill the storage with, may be null.
+		///
+		////////////////////////////////////////////////////////////
+		void allocate(const GLsizeiptr size, const void* pData = nullptr);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Copies data into part of the storage.
+		///
+		/// \param offset	The offset to write to, in bytes.
+		/// \param pData	The data to copy.
+		/// \param size		The size of the data in bytes.
+		///
+		////////////////////////////////////////////////////////////
+		void upload(const GLintptr offset, const void* pData, const GLsizeiptr size);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Binds the whole buffer to a uniform block binding.
+		///
+		/// \param binding	The binding point, see eUniformBinding.
+		///
+		////////////////////////////////////////////////////////////
+		void bindBase(const GLuint binding) const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Binds part of the buffer to a uniform block binding.
+		///
+		/// \param binding	The binding point, see eUniformBinding.
+		/// \param offset	The start of the range, a multiple of getOffsetAlignment.
+		/// \param size		The size of the range in bytes.
+		///
+		////////////////////////////////////////////////////////////
+		void bindRange(const GLuint binding, const GLintptr offset, const GLsizeiptr size) const;
+	};
+
+
+	class TextureBuffer final
+	{
+	private:
+		/*
+		====================
+		Member Variables
+		====================
+		*/
+		GLuint		m_buffer;	///< The buffer object holding the texels.
+		GLuint		m_texture;	///< The buffer texture the shaders sample.
+		GLsizeiptr	m_size;		///< The size of the storage in bytes.
+
+	public:
+		/*
+		====================
+		Ctor and Dtor
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Default construction of the Texture Buffer object.
+		////////////////////////////////////////////////////////////
+		explicit TextureBuffer(void);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Destruction of the Texture Buffer object.
+		///
+		/// The destruction of the Texture Buffer object deletes both
+		/// the buffer and the texture on the GPU.
+		///
+		////////////////////////////////////////////////////////////
+		~TextureBuffer(void);
+
+		/*
+		====================
+		Getters and Setters
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Retrieves the ID of the buffer texture.
+		///
+		/// \retval GLuint	The buffer texture.
+		///
+		////////////////////////////////////////////////////////////
+		GLuint getTexture(void) const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Retrieves the size of the current storage.
+		///
+		/// \retval GLsizeiptr	The size in bytes.
+		///
+		////////////////////////////////////////////////////////////
+		GLsizeiptr getSize(void) const;
+
+		/*
+		====================
+		Methods
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Generates the buffer and the texture that reads it.
+		///
+		/// \param format	The sized internal format of the texels, such as GL_R32UI.
+		///
+		////////////////////////////////////////////////////////////
+		void generate(const GLenum format);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Gives the buffer new storage filled with data.
+		///
+		/// The previous storage is orphaned rather than overwritten,
+		/// so draws that are still reading it do not stall the CPU.
+		///
+		/// \param size		The size of the storage in bytes.
+		/// \param pData	The data to fill the storage with.
+		///
+		////////////////////////////////////////////////////////////
+		void allocate(const GLsizeiptr size, const void* pData);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Binds the buffer texture to a texture unit.
+		///
+		/// \param unit		The texture unit.
+		///
+		////////////////////////////////////////////////////////////
+		void bind(const GLuint unit) const;
+	};
+
 }//namespace sparky
 
 #endif//__SPARKY_BUFFERS_HPP__
\ No newline at end of file
@@ -36,6 +36,14 @@ namespace sparky
 {
 	class DeferredShader final : public IShaderComponent
 	{
+	private:
+		/*
+		====================
+		Member Variables
+		====================
+		*/
+		GLint m_textureLocation;	///< The location of the diffuse texture sampler.
+
 	public:
 		/*
 		====================
@@ -47,6 +55,8 @@ namespace sparky
 		///
 		/// The default constructor will call the IShaderComponent constructor
 		/// and pass in the external deferred shaders for compilation and linking.
+		/// The FrameData and ObjectData uniform blocks are connected to
+		/// their bindings, the matrices are read from uniform buffers.
 		///
 		////////////////////////////////////////////////////////////
 		explicit DeferredShader(void);
@@ -61,13 +71,21 @@ namespace sparky
 		Methods
 		====================
 		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Reads the sampler location and connects the frame
+		///		   and object uniform blocks.
+		////////////////////////////////////////////////////////////
+		void loadUniforms(void) override;
+
 		////////////////////////////////////////////////////////////
 		/// \brief Override Update method for the DeferredShader.
 		///
 		/// This update method will bake the information of each piece
 		/// of geometry, it will bake the positional, diffuse and normal
 		/// information as textures and output them for use with subsequent
-		/// shaders.
+		/// shaders. The camera and model matrices are not set here, they 
+		/// are read from the frame and object uniform buffers, so the 
+		/// update is only needed once after binding.
 		///
 		/// \param transform	The Transform of the currently rendering object.
 		///
@@ -34,13 +34,6 @@ Class Includes
 
 namespace sparky
 {
-	/*
-	====================
-	Sparky Forward Declarations
-	====================
-	*/
-	class DirectionalLight;
-
 	class DirectionalShader final : public IShaderComponent
 	{
 	private:
@@ -49,7 +42,8 @@ namespace sparky
 		Member Variables
 		====================
 		*/
-		DirectionalLight* m_pLight;	///< The directional light of the shader.
+		GLint m_normalLocation;		///< The location of the normal sampler.
+		GLint m_diffuseLocation;	///< The location of the diffuse sampler.
 
 	public:
 		/*
@@ -62,7 +56,8 @@ namespace sparky
 		///
 		/// The Directional Shader inherits from the behaviour of the IShaderComponent
 		/// object, loads and compiles the basic vertex and fragment
-		/// shaders for use.
+		/// shaders for use. The Lights uniform block is connected to
+		/// its binding.
 		///
 		////////////////////////////////////////////////////////////
 		explicit DirectionalShader(void);
@@ -78,20 +73,17 @@ namespace sparky
 		====================
 		*/
 		////////////////////////////////////////////////////////////
-		/// \brief Sets the directional light to render with the current
-		///        shader object.
-		///
-		/// \param pLight	The directional light of the shader.
-		///
+		/// \brief Reads the GBuffer sampler locations and connects 
+		///		   the Lights uniform block.
 		////////////////////////////////////////////////////////////
-		void setActiveLight(DirectionalLight* pLight);
+		void loadUniforms(void) override;
 
 		////////////////////////////////////////////////////////////
 		/// \brief Updates the Uniform values of the Basic Shader.
 		///
 		/// The directional shader will bind the textures generated by
-		/// the deferred pipeline and apply a directional light effect to
-		/// the objects.
+		/// the deferred pipeline and apply every directional light of 
+		/// the Lights uniform block to the objects in a single pass.
 		///
 		/// \param transform	The transform of the current object being rendered.
 		///
@@ -110,8 +102,8 @@ namespace sparky
 /// sparky::DirectionalShader is one of the lighting specific shaders
 /// used within the application. It is responsible for calculation the
 /// effect that a directional light will have on the geometry within a 
-/// scene. It is used in conjunction with the PointShader for multi-pass
-/// lighting.
+/// scene. It is used in conjunction with the PointShader, each pass 
+/// shading every light of its type.
 ///
 /// Usage example:
 /// \code
@@ -36,6 +36,15 @@ Class Includes
 
 namespace sparky
 {
+	/*
+	====================
+	Sparky Forward Declarations
+	====================
+	*/
+	class IShaderComponent;
+	class Texture;
+	class Transform;
+
 	class IMeshComponent : public Ref
 	{
 	protected:
@@ -48,6 +57,9 @@ namespace sparky
 		std::vector<GLuint>	  m_indices;		///< Indices of the mesh.
 		Buffer				  m_buffer;			///< The vertex and index buffer.
 		ArrayBuffer			  m_arrayBuffer;	///< Array Buffer.
+		GLuint				  m_indexCount;		///< The amount of indices uploaded by generate, which are drawn.
+		Vector3f			  m_minimum;		///< The smallest corner of the box around the uploaded vertices.
+		Vector3f			  m_maximum;		///< The largest corner of the box around the uploaded vertices.
 
 		bool				  m_generated;		///< Whether the Mesh has been generated.
 
@@ -108,6 +120,48 @@ namespace sparky
 		////////////////////////////////////////////////////////////
 		GLuint getIndexCount(void) const;
 
+		////////////////////////////////////////////////////////////
+		/// \brief Retrieves the vertices attached to this Mesh.
+		///
+		/// \retval std::vector<Vertex_t>	The vertices of the Mesh.
+		///
+		////////////////////////////////////////////////////////////
+		const std::vector<Vertex_t>& getVertices(void) const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Retrieves the indices attached to this Mesh.
+		///
+		/// \retval std::vector<GLuint>	The indices of the Mesh.
+		///
+		////////////////////////////////////////////////////////////
+		const std::vector<GLuint>& getIndices(void) const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Retrieves the smallest corner of the box around
+		///		   the Mesh, known once it has been generated.
+		///
+		/// \retval const Vector3f&	The minimum position of the vertices.
+		///
+		////////////////////////////////////////////////////////////
+		const Vector3f& getMinimum(void) const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Retrieves the largest corner of the box around
+		///		   the Mesh, known once it has been generated.
+		///
+		/// \retval const Vector3f&	The maximum position of the vertices.
+		///
+		////////////////////////////////////////////////////////////
+		const Vector3f& getMaximum(void) const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Retrieves the amount of detail levels of the Mesh.
+		///
+		/// \retval unsigned int	The amount of levels, 1 unless overriden.
+		///
+		////////////////////////////////////////////////////////////
+		virtual unsigned int getLevelCount(void) const;
+
 		/*
 		====================
 		Methods
@@ -171,6 +225,19 @@ namespace sparky
 		////////////////////////////////////////////////////////////
 		void calculateNormals(void);
 
+		////////////////////////////////////////////////////////////
+		/// \brief Calculate the normals for each Vertex of a triangle
+		///		   list that does not belong to a Mesh.
+		///
+		/// Used to prepare meshes away from the main thread, such as
+		/// the detail levels of a Model.
+		///
+		/// \param vertices		The vertices to calculate the normals of.
+		/// \param indices		The indices of the triangle list.
+		///
+		////////////////////////////////////////////////////////////
+		static void calculateNormals(std::vector<Vertex_t>& vertices, const std::vector<GLuint>& indices);
+
 		////////////////////////////////////////////////////////////
 		/// \brief Calculate the normals for a specific face of the Mesh.
 		///
@@ -184,6 +251,16 @@ namespace sparky
 		////////////////////////////////////////////////////////////
 		void calculateFaceNormals(const GLuint start, const bool invert);
 
+		////////////////////////////////////////////////////////////
+		/// \brief Welds and reorders the vertices and indices for the
+		///		   vertex cache, see MeshOptimiser::optimise.
+		///
+		/// Must be called before the Mesh is generated. The Mesh looks
+		/// the same, but the order of its vertices and indices changes.
+		///
+		////////////////////////////////////////////////////////////
+		void optimise(void);
+
 		////////////////////////////////////////////////////////////
 		/// \brief Clears the vertices and indices of the Mesh object.
 		////////////////////////////////////////////////////////////
@@ -207,6 +284,23 @@ namespace sparky
 		////////////////////////////////////////////////////////////
 		void generate(const bool genNormals = false);
 
+		////////////////////////////////////////////////////////////
+		/// \brief Generates the buffers of the Mesh from memory that
+		///		   is not owned by the Mesh.
+		///
+		/// The vertices and indices are uploaded as they are, without
+		/// being copied into the Mesh, which is how cached models are
+		/// uploaded from a mapped file. Normals are expected to be
+		/// part of the vertices already.
+		///
+		/// \param pVertices		The vertices to upload.
+		/// \param vertexCount	The amount of vertices.
+		/// \param pIndices		The indices to upload.
+		/// \param indexCount	The amount of indices.
+		///
+		////////////////////////////////////////////////////////////
+		void generate(const Vertex_t* pVertices, const GLuint vertexCount, const GLuint* pIndices, const GLuint indexCount);
+
 		////////////////////////////////////////////////////////////
 		/// \brief Abstract rendering method for rendering the Mesh.
 		///
@@ -216,6 +310,35 @@ namespace sparky
 		///
 		////////////////////////////////////////////////////////////
 		virtual void render(void) = 0;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Records a draw of the Mesh into the RenderQueue.
+		///
+		/// Unlike render, nothing is drawn until the RenderQueue is 
+		/// submitted, at which point the draws of every object are 
+		/// sorted to reduce the amount of state changes. Meshes that
+		/// have not been generated are not recorded.
+		///
+		/// \param pShader		The shader to draw the Mesh with.
+		/// \param pTexture		The texture to apply to the Mesh, may be null.
+		/// \param transform	The transform of the object, must stay alive
+		///						until the RenderQueue is submitted.
+		///
+		////////////////////////////////////////////////////////////
+		virtual void queue(IShaderComponent* pShader, const Texture* pTexture, const Transform& transform);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Records a draw of one detail level of the Mesh.
+		///
+		/// Meshes with a single level record a draw through queue.
+		///
+		/// \param pShader		The shader to draw the Mesh with.
+		/// \param pTexture		The texture to apply to the Mesh, may be null.
+		/// \param transform	The transform of the object.
+		/// \param level		The detail level, clamped to the last level.
+		///
+		////////////////////////////////////////////////////////////
+		virtual void queueLevel(IShaderComponent* pShader, const Texture* pTexture, const Transform& transform, const unsigned int level);
 	};
 
 }//namespace sparky
@@ -34,6 +34,14 @@ Class Includes
 
 namespace sparky
 {
+	/*
+	====================
+	Sparky Forward Declarations
+	====================
+	*/
+	class IShaderComponent;
+	class Transform;
+
 	class IRenderComponent : public Ref
 	{
 	public:
@@ -63,10 +71,14 @@ namespace sparky
 		///
 		/// Components can be added to the GameObject class that will
 		/// need different type of behaviour, depending on the needed
-		/// rendering.
+		/// rendering. Draws are recorded into the RenderQueue rather
+		/// than issued immediately.
+		///
+		/// \param pShader		The shader to render the component with.
+		/// \param transform	The transform of the GameObject.
 		///
 		////////////////////////////////////////////////////////////
-		virtual void render(void) = 0;
+		virtual void render(IShaderComponent* pShader, const Transform& transform) = 0;
 	};
 }
 
@@ -52,8 +52,8 @@ namespace sparky
 		Member Variables	
 		====================
 		*/
-		Program m_program;	///< The Program contains the shader functionality.
-		Uniform m_uniform;  ///< Binds uniform variables within the shader.
+		Program* m_pProgram;	///< The Program contains the shader functionality, shared through the ShaderRegistry.
+		Uniform  m_uniform;		///< Binds uniform variables within the shader.
 
 	public:
 		/*
@@ -61,21 +61,36 @@ namespace sparky
 		Ctor and Dtor
 		====================
 		*/
-		////////////////////////////////////////////////////////////
-		/// \brief Default construction of the IShaderComponent object.
-		////////////////////////////////////////////////////////////
-		explicit IShaderComponent(void);
-
 		////////////////////////////////////////////////////////////
 		/// \brief Convenience constructor for child objects that only
 		//         contain a vertex and fragment shader.
+		///
+		/// The Program is acquired from the ShaderRegistry, so shaders
+		/// constructed from the same sources share a single Program.
+		///
 		////////////////////////////////////////////////////////////
 		explicit IShaderComponent(const String& vertexShader, const String& fragmentShader);
 
 		////////////////////////////////////////////////////////////
-		/// \brief Default destruction of the IShaderComponent object.
+		/// \brief Destruction of the IShaderComponent object.
+		///
+		/// The Program is given back to the ShaderRegistry.
+		///
 		////////////////////////////////////////////////////////////
-		virtual ~IShaderComponent(void) = default;
+		virtual ~IShaderComponent(void);
+
+		/*
+		====================
+		Getters and Setters
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Retrieves the Program of the IShaderComponent object.
+		///
+		/// \retval Program	The linked Program of the shader.
+		///
+		////////////////////////////////////////////////////////////
+		const Program& getProgram(void) const;
 
 		/*
 		====================
@@ -92,6 +107,18 @@ namespace sparky
 		////////////////////////////////////////////////////////////
 		void unbind(void) const;
 
+		////////////////////////////////////////////////////////////
+		/// \brief Reads the uniform locations and connects the uniform
+		///		   blocks used by the shader.
+		///
+		/// Called by each child object on construction, and again by
+		/// the ResourceManager whenever a hot reload has relinked the
+		/// Program, as the locations and bindings may have changed.
+		/// Shaders without uniforms of their own do nothing.
+		///
+		////////////////////////////////////////////////////////////
+		virtual void loadUniforms(void);
+
 		////////////////////////////////////////////////////////////
 		/// \brief Abstract method for updating the IShaderComponent object.
 		///
@@ -0,0 +1,225 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// 
+// Sparky Engine
+// 2016 - Benjamin Carter (benjamin.mark.carter@hotmail.com)
+// 
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+// 
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+// 
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgement
+//    in the product documentation would be appreciated but is not required.
+// 
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+// 
+// 3. This notice may not be removed or altered from any source distribution.
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __SPARKY_KTX_FILE_HPP__
+#define __SPARKY_KTX_FILE_HPP__
+
+/*
+====================
+CPP Includes
+====================
+*/
+#include <vector>					// The levels of the image.
+/*
+====================
+Class Includes
+====================
+*/
+#include <sparky\math\vector2.hpp>	// The dimensions of the image.
+#include <sparky\utils\string.hpp>	// The file the image is read from or written to.
+/*
+====================
+Additional Includes
+====================
+*/
+#include <GLEW\glew.h>				// The internal format of the image.
+
+namespace sparky
+{
+	class KTXFile final
+	{
+	private:
+		/*
+		====================
+		Structures
+		====================
+		*/
+		struct Level_t
+		{
+			unsigned int offset;	///< The offset of the level within the data.
+			unsigned int size;		///< The size of the level in bytes.
+		};
+
+		/*
+		====================
+		Member Variables
+		====================
+		*/
+		GLenum						m_internalFormat;	///< The compressed format of every level.
+		Vector2u					m_dimensions;		///< The size (in pixels) of the first level.
+		std::vector<Level_t>		m_levels;			///< The levels, from the full size image down.
+		std::vector<unsigned char>	m_data;				///< The blocks of every level, one after another.
+
+	public:
+		/*
+		====================
+		Ctor and Dtor
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Default constructor of the KTXFile object.
+		///
+		/// The file starts empty, see open and create.
+		///
+		////////////////////////////////////////////////////////////
+		explicit KTXFile(void);
+
+		/*
+		====================
+		Getters and Setters
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Retrieves the compressed format of the image.
+		///
+		/// \retval GLenum	The internal format (i.e GL_COMPRESSED_RGBA_S3TC_DXT5_EXT).
+		///
+		////////////////////////////////////////////////////////////
+		GLenum getInternalFormat(void) const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Retrieves the dimensions (in pixels) of the first level.
+		///
+		/// \retval Vector2u&	The pixel dimensions of the image.
+		///
+		////////////////////////////////////////////////////////////
+		const Vector2u& getDimensions(void) const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Retrieves the amount of mipmap levels.
+		///
+		/// \retval unsigned int	The amount of levels, 0 if the file is empty.
+		///
+		////////////////////////////////////////////////////////////
+		unsigned int getLevelCount(void) const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Retrieves the blocks of a level.
+		///
+		/// \param level	The level, 0 being the full size image.
+		///
+		/// \retval unsigned char*	The blocks of the level.
+		///
+		////////////////////////////////////////////////////////////
+		const unsigned char* getLevel(const unsigned int level) const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Retrieves the size of a level in bytes.
+		///
+		/// \param level	The level, 0 being the full size image.
+		///
+		/// \retval unsigned int	The size of the level.
+		///
+		////////////////////////////////////////////////////////////
+		unsigned int getLevelSize(const unsigned int level) const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Retrieves the size of every level in bytes.
+		///
+		/// \retval unsigned int	The size of the image data.
+		///
+		////////////////////////////////////////////////////////////
+		unsigned int getSize(void) const;
+
+		/*
+		====================
+		Methods
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Empties the file and sets the format of its levels.
+		///
+		/// \param internalFormat	The compressed format of the levels.
+		/// \param width			The width of the first level in pixels.
+		/// \param height			The height of the first level in pixels.
+		///
+		////////////////////////////////////////////////////////////
+		void create(const GLenum internalFormat, const unsigned int width, const unsigned int height);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Appends the next mipmap level.
+		///
+		/// Levels are added from the full size image down, each half
+		/// the size of the one before.
+		///
+		/// \param pData	The blocks of the level.
+		/// \param size		The size of the level in bytes.
+		///
+		////////////////////////////////////////////////////////////
+		void addLevel(const void* pData, const unsigned int size);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Reads a KTX file.
+		///
+		/// Only single 2D images of a compressed format are accepted,
+		/// which is everything the TextureBaker writes. Every level must
+		/// be the size of its dimensions, so a truncated or corrupted
+		/// file is rejected. Nothing is printed, so the file can be read
+		/// from any thread.
+		///
+		/// \param filename		The file to read.
+		///
+		/// \retval bool	True if the file was read.
+		///
+		////////////////////////////////////////////////////////////
+		bool open(const String& filename);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Writes the image to a KTX file.
+		///
+		/// \param filename		The file to write.
+		///
+		/// \retval bool	True if the file was written.
+		///
+		////////////////////////////////////////////////////////////
+		bool save(const String& filename) const;
+	};
+
+}//namespace sparky
+
+#endif//__SPARKY_KTX_FILE_HPP__
+
+////////////////////////////////////////////////////////////
+/// \class sparky::KTXFile
+/// \ingroup rendering
+///
+/// sparky::KTXFile reads and writes the Khronos KTX container, 
+/// holding a block-compressed image and its precomputed mipmap 
+/// levels. The levels are stored exactly as OpenGL takes them, so
+/// a Texture uploads them without any decoding.
+///
+/// Usage example:
+/// \code
+/// sparky::KTXFile file;
+///
+/// if (file.open("assets/tilesheet.ktx"))
+/// {
+///		for (unsigned int i = 0; i < file.getLevelCount(); i++)
+///		{
+///			// Upload file.getLevel(i), file.getLevelSize(i) bytes.
+///		}
+/// }
+/// \endcode
+///
+////////////////////////////////////////////////////////////
\ No newline at end of file
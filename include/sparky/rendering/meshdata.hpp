@@ -30,6 +30,7 @@
 CPP Includes
 ====================
 */
+#include <cstddef>						// Sizes for the class-level allocation operators.
 #include <sparky\rendering\imesh.hpp>	// Inherits from IMeshComponent.
 
 namespace sparky
@@ -53,6 +54,33 @@ namespace sparky
 		////////////////////////////////////////////////////////////
 		~MeshData(void) = default;
 
+		/*
+		====================
+		Operators
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Allocates the MeshData from its SlabAllocator.
+		///
+		/// Every Chunk owns a MeshData, so they share the same churn
+		/// and are allocated from slabs for the same reason.
+		///
+		/// \param size	The size of the object being allocated.
+		///
+		/// \retval void*	The memory of the new MeshData.
+		///
+		////////////////////////////////////////////////////////////
+		static void* operator new(std::size_t size);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Returns the memory of the MeshData to its SlabAllocator.
+		///
+		/// \param pMemory	The memory of the destroyed MeshData.
+		/// \param size		The size of the destroyed object.
+		///
+		////////////////////////////////////////////////////////////
+		static void operator delete(void* pMemory, std::size_t size);
+
 		/*
 		====================
 		Methods
@@ -0,0 +1,236 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// 
+// Sparky Engine
+// 2016 - Benjamin Carter (benjamin.mark.carter@hotmail.com)
+// 
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+// 
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+// 
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgement
+//    in the product documentation would be appreciated but is not required.
+// 
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+// 
+// 3. This notice may not be removed or altered from any source distribution.
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __SPARKY_MESH_OPTIMISER_HPP__
+#define __SPARKY_MESH_OPTIMISER_HPP__
+
+/*
+====================
+CPP Includes
+====================
+*/
+#include <vector>						// The vertices and indices that are optimised.
+/*
+====================
+Class Includes
+====================
+*/
+#include <sparky\rendering\vertex.hpp>	// The vertices that are welded and reordered.
+/*
+====================
+Additional Includes
+====================
+*/
+#include <GLEW\glew.h>					// The type of the indices.
+
+namespace sparky
+{
+	struct VertexCacheStats_t
+	{
+		unsigned int triangles;		///< The amount of triangles drawn.
+		unsigned int vertices;		///< The amount of vertices referenced by the triangles.
+		unsigned int transforms;	///< The amount of vertices the simulated cache had to transform.
+		float		 acmr;			///< The average cache miss ratio, transforms per triangle (0.5 at best, 3 at worst).
+		float		 atvr;			///< The average transform to vertex ratio, transforms per vertex (1 at best).
+	};
+
+	class MeshOptimiser final
+	{
+	public:
+		/*
+		====================
+		Constant Variables
+		====================
+		*/
+		static const unsigned int CACHE_SIZE = 16;			///< The entries of the simulated FIFO post-transform cache.
+		static const unsigned int SCORE_CACHE_SIZE = 32;	///< The entries of the LRU cache modelled while reordering triangles.
+
+	private:
+		/*
+		====================
+		Private Methods
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Scores how much drawing a vertex next would help
+		///		   the cache.
+		///
+		/// Vertices that were just used score highly, as do vertices
+		/// with few triangles left, so that lone triangles are not
+		/// stranded until they have dropped out of the cache.
+		///
+		/// \param cachePosition	The position of the vertex in the LRU cache, -1 if it is not cached.
+		/// \param valence			The amount of triangles of the vertex that have not been drawn.
+		///
+		/// \retval float	The score of the vertex.
+		///
+		////////////////////////////////////////////////////////////
+		static float getVertexScore(const int cachePosition, const unsigned int valence);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Simulates a FIFO cache drawing one triangle.
+		///
+		/// Rather than a queue, each vertex keeps the time it last
+		/// entered the cache, and is still cached if fewer than
+		/// cacheSize vertices have entered since. Adding cacheSize to
+		/// the time empties the cache.
+		///
+		/// \param pTriangle	The three indices of the triangle.
+		/// \param cacheSize	The entries of the cache.
+		/// \param timestamps	The time each vertex last entered the cache.
+		/// \param time			The amount of vertices that have entered the cache.
+		///
+		/// \retval unsigned int	The amount of vertices of the triangle that missed.
+		///
+		////////////////////////////////////////////////////////////
+		static unsigned int simulate(const GLuint* pTriangle, const unsigned int cacheSize, std::vector<unsigned int>& timestamps, unsigned int& time);
+
+	public:
+		/*
+		====================
+		Methods
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Measures how well a triangle list uses the cache.
+		///
+		/// The cache is simulated on the CPU as a FIFO, which is how
+		/// most GPUs keep transformed vertices, so the result does not
+		/// depend on the device the mesh is drawn with.
+		///
+		/// \param indices		The indices of the triangle list.
+		/// \param cacheSize	The entries of the simulated cache.
+		///
+		/// \retval VertexCacheStats_t	The misses of the triangle list.
+		///
+		////////////////////////////////////////////////////////////
+		static VertexCacheStats_t analyse(const std::vector<GLuint>& indices, const unsigned int cacheSize = CACHE_SIZE);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Sums the results of two analyses, such as those of
+		///		   the meshes of a Model.
+		///
+		/// \param first	The first result.
+		/// \param second	The second result.
+		///
+		/// \retval VertexCacheStats_t	The summed counts and their ratios.
+		///
+		////////////////////////////////////////////////////////////
+		static VertexCacheStats_t combine(const VertexCacheStats_t& first, const VertexCacheStats_t& second);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Merges vertices that are identical in every attribute.
+		///
+		/// Importers usually give every corner of every face its own
+		/// vertex, which the cache can never reuse. Vertices are only
+		/// merged when they are bit for bit the same, so the mesh
+		/// looks exactly as it did.
+		///
+		/// \param vertices		The vertices to weld, unique afterwards.
+		/// \param indices		The indices, remapped to the welded vertices.
+		///
+		////////////////////////////////////////////////////////////
+		static void weld(std::vector<Vertex_t>& vertices, std::vector<GLuint>& indices);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Reorders the triangles to reuse cached vertices.
+		///
+		/// Implements Tom Forsyth's "Linear-Speed Vertex Cache
+		/// Optimisation": the triangle with the highest summed vertex
+		/// score is drawn next, and only the triangles around the 
+		/// cached vertices are rescored after each one.
+		///
+		/// \param indices		The indices of the triangle list to reorder.
+		/// \param vertexCount	The amount of vertices the indices refer to.
+		///
+		////////////////////////////////////////////////////////////
+		static void optimiseVertexCache(std::vector<GLuint>& indices, const unsigned int vertexCount);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Reorders clusters of triangles so that those facing
+		///		   outwards are drawn first.
+		///
+		/// Based on "Fast Triangle Reordering for Vertex Locality and
+		/// Reduced Overdraw" (Sander et al.). The cache optimised order
+		/// is cut into clusters wherever the cache would start over, 
+		/// and again wherever the cost of a cut is within the threshold.
+		/// Clusters are then sorted by how far they face away from the
+		/// centre of the mesh, so that they tend to occlude the rest.
+		///
+		/// \param vertices		The vertices the indices refer to.
+		/// \param indices		The cache optimised indices to reorder.
+		/// \param threshold	How much the ACMR may worsen to allow more clusters.
+		///
+		////////////////////////////////////////////////////////////
+		static void optimiseOverdraw(const std::vector<Vertex_t>& vertices, std::vector<GLuint>& indices, const float threshold = 1.05f);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Reorders the vertices in the order they are first
+		///		   drawn, so that they are fetched from memory in order.
+		///
+		/// Vertices that no triangle uses are removed.
+		///
+		/// \param vertices		The vertices to reorder.
+		/// \param indices		The indices, remapped to the reordered vertices.
+		///
+		////////////////////////////////////////////////////////////
+		static void optimiseVertexFetch(std::vector<Vertex_t>& vertices, std::vector<GLuint>& indices);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Runs every stage, from welding to vertex fetch, in order.
+		///
+		/// \param vertices		The vertices of the mesh.
+		/// \param indices		The indices of the triangle list.
+		///
+		////////////////////////////////////////////////////////////
+		static void optimise(std::vector<Vertex_t>& vertices, std::vector<GLuint>& indices);
+	};
+
+}//namespace sparky
+
+#endif//__SPARKY_MESH_OPTIMISER_HPP__
+
+////////////////////////////////////////////////////////////
+/// \class sparky::MeshOptimiser
+/// \ingroup rendering
+///
+/// sparky::MeshOptimiser reorders the triangle lists of imported
+/// meshes so that the GPU transforms each vertex as few times as
+/// possible and draws less hidden surface. It runs once when a 
+/// Model is imported, the result is then kept in the mesh cache.
+///
+/// The results are measured with a CPU simulation of the vertex
+/// cache, which reports the ACMR and ATVR of a mesh without a GPU.
+///
+/// Usage example:
+/// \code
+/// const sparky::VertexCacheStats_t before = sparky::MeshOptimiser::analyse(indices);
+///
+/// sparky::MeshOptimiser::optimise(vertices, indices);
+///
+/// const sparky::VertexCacheStats_t after = sparky::MeshOptimiser::analyse(indices);
+/// sparky::DebugLog::message("ACMR", before.acmr, "->", after.acmr);
+/// \endcode
+///
+////////////////////////////////////////////////////////////
\ No newline at end of file
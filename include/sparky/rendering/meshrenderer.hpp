@@ -41,6 +41,7 @@ namespace sparky
 	*/
 	class IMeshComponent;
 	class Texture;
+	class Transform;
 
 	class MeshRenderer : public IRenderComponent
 	{
@@ -53,6 +54,30 @@ namespace sparky
 		IMeshComponent* m_pMesh;	///< The Mesh of the renderable component.
 		Texture*		m_pTexture;	///< The Texture of the mesh object.
 
+		static float m_sLevelScreenSize;	///< The screen size below which a mesh drops to its next detail level.
+
+	private:
+		/*
+		====================
+		Private Methods
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Picks the detail level of the mesh at a transform.
+		///
+		/// The bounds of the mesh are scaled by the transform and compared
+		/// against the height of the main camera's view at their distance.
+		/// Every halving of that size below the level screen size moves
+		/// to the next, coarser, level.
+		///
+		/// \param transform	The transform of the GameObject.
+		/// \param levels		The amount of detail levels of the mesh.
+		///
+		/// \retval unsigned int	The detail level to draw.
+		///
+		////////////////////////////////////////////////////////////
+		unsigned int getLevel(const Transform& transform, const unsigned int levels) const;
+
 	public:
 		/*
 		====================
@@ -81,14 +106,41 @@ namespace sparky
 		////////////////////////////////////////////////////////////
 		~MeshRenderer(void);
 
+		/*
+		====================
+		Getters and Setters
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Sets the screen size at which meshes change detail level.
+		///
+		/// The size is the radius of a mesh's bounds over half the height
+		/// of the view, so 0.5 drops to level 1 once a mesh covers less
+		/// than a quarter of the screen's height, level 2 below an eighth...
+		///
+		/// \param size	The screen size of the most detailed level.
+		///
+		////////////////////////////////////////////////////////////
+		static void setLevelScreenSize(const float size);
+
+		/*
+		====================
+		Methods
+		====================
+		*/
+
 		////////////////////////////////////////////////////////////
 		/// \brief Overriden render method for the MeshRenderer.
 		///
-		/// The render method will bind the texture passed in, in the 
-		/// constructor and render the mesh.
+		/// The render method will record a draw of the mesh with the
+		/// texture passed in, in the constructor. Meshes with several
+		/// detail levels are drawn at the level fitting their screen size.
+		///
+		/// \param pShader		The shader to render the mesh with.
+		/// \param transform	The transform of the GameObject.
 		///
 		////////////////////////////////////////////////////////////
-		void render(void) override;
+		void render(IShaderComponent* pShader, const Transform& transform) override;
 	};
 
 }//namespace sparky
@@ -130,6 +182,9 @@ namespace sparky
 /// sparky::MeshRenderer* pRenderer = new sparky::MeshRenderer(pModel, pTexture);
 ///
 /// pObject->addComponent(pRenderer);
+///
+/// // Models drop a detail level every time they halve below a quarter of the screen.
+/// sparky::MeshRenderer::setLevelScreenSize(0.5f);
 /// \endcode
 ///
 ////////////////////////////////////////////////////////////
\ No newline at end of file
@@ -0,0 +1,154 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// 
+// Sparky Engine
+// 2016 - Benjamin Carter (benjamin.mark.carter@hotmail.com)
+// 
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+// 
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+// 
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgement
+//    in the product documentation would be appreciated but is not required.
+// 
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+// 
+// 3. This notice may not be removed or altered from any source distribution.
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __SPARKY_MESH_SIMPLIFIER_HPP__
+#define __SPARKY_MESH_SIMPLIFIER_HPP__
+
+/*
+====================
+CPP Includes
+====================
+*/
+#include <vector>						// The vertices and indices that are simplified.
+/*
+====================
+Class Includes
+====================
+*/
+#include <sparky\rendering\vertex.hpp>	// The vertices of the simplified meshes.
+/*
+====================
+Additional Includes
+====================
+*/
+#include <GLEW\glew.h>					// The type of the indices.
+
+namespace sparky
+{
+	struct MeshLevel_t
+	{
+		std::vector<Vertex_t> vertices;	///< The vertices of the detail level.
+		std::vector<GLuint>	  indices;	///< The triangle list of the detail level.
+	};
+
+	class MeshSimplifier final
+	{
+	private:
+		/*
+		====================
+		Private Methods
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Gives every corner of every triangle its own vertex.
+		///
+		/// \param vertices		The shared vertices.
+		/// \param indices		The triangle list.
+		/// \param level		Filled with a vertex per index.
+		///
+		////////////////////////////////////////////////////////////
+		static void expand(const std::vector<Vertex_t>& vertices, const std::vector<GLuint>& indices, MeshLevel_t& level);
+
+	public:
+		/*
+		====================
+		Methods
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Removes triangles by collapsing edges until at most
+		///		   the target amount of indices are left.
+		///
+		/// Each vertex keeps the quadric error metric of the planes
+		/// around it (Garland and Heckbert), and the cheapest edges
+		/// are collapsed first, one vertex onto the other. The cost
+		/// also includes how far the uv and normal of the vertex are
+		/// from those it collapses onto, weighted by its area, so that
+		/// attributes are not stretched across the surface.
+		///
+		/// Vertices that share a position but not their attributes
+		/// (seams) are collapsed together, and only if every side of the
+		/// seam can be, so that seams do not open. Open borders are kept
+		/// in place and collapses that would flip a triangle are skipped, 
+		/// so fewer indices than the target may not be reached.
+		///
+		/// The result only refers to the vertices passed in and does
+		/// not depend on timing, so it is the same on every run.
+		///
+		/// \param vertices			The vertices of the mesh, welded.
+		/// \param indices			The triangle list to simplify.
+		/// \param targetIndexCount	The amount of indices to reduce to.
+		/// \param result			Filled with the simplified triangle list.
+		///
+		////////////////////////////////////////////////////////////
+		static void simplify(const std::vector<Vertex_t>& vertices, const std::vector<GLuint>& indices, const unsigned int targetIndexCount, 
+			std::vector<GLuint>& result);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Builds the detail levels of a mesh as it is imported.
+		///
+		/// The first level is the mesh itself. Every other level keeps
+		/// ratio times the triangles of the one before, simplified from
+		/// the mesh rather than the previous level so errors do not
+		/// add up. Normals are calculated per level the same way as for
+		/// the first, so a mesh that still has a vertex per corner once
+		/// welded stays flat shaded, and every level is optimised by 
+		/// the MeshOptimiser.
+		///
+		/// \param vertices		The welded vertices of the mesh, without normals.
+		/// \param indices		The triangle list of the mesh.
+		/// \param levelCount	The amount of levels to build, at least one.
+		/// \param ratio		The fraction of triangles kept from one level to the next.
+		/// \param levels		Filled with the levels, the first being full detail.
+		///
+		////////////////////////////////////////////////////////////
+		static void buildLevels(const std::vector<Vertex_t>& vertices, const std::vector<GLuint>& indices, const unsigned int levelCount, 
+			const float ratio, std::vector<MeshLevel_t>& levels);
+	};
+
+}//namespace sparky
+
+#endif//__SPARKY_MESH_SIMPLIFIER_HPP__
+
+////////////////////////////////////////////////////////////
+/// \class sparky::MeshSimplifier
+/// \ingroup rendering
+///
+/// sparky::MeshSimplifier generates the lower detail levels of
+/// the meshes of a Model when it is imported, which are then kept
+/// in the mesh cache. The MeshRenderer picks a level by how large 
+/// the Model is on screen, so distant props cost less to draw.
+///
+/// Usage example:
+/// \code
+/// // Three levels, each with half the triangles of the one before.
+/// std::vector<sparky::MeshLevel_t> levels;
+/// sparky::MeshSimplifier::buildLevels(vertices, indices, 3, 0.5f, levels);
+///
+/// // Or a single simplified triangle list over the same vertices.
+/// std::vector<GLuint> simplified;
+/// sparky::MeshSimplifier::simplify(vertices, indices, indices.size() / 4, simplified);
+/// \endcode
+///
+////////////////////////////////////////////////////////////
\ No newline at end of file
@@ -32,6 +32,8 @@ Class Includes
 */
 #include <sparky\rendering\meshdata.hpp>	// Model inherits from IMeshComponent and contains an array of Meshes
 #include <sparky\utils\string.hpp>			// For getting the file location of the Model
+#include <sparky\rendering\meshoptimiser.hpp>	// Imported meshes are optimised for the vertex cache.
+#include <sparky\rendering\meshsimplifier.hpp>	// The detail levels of imported meshes.
 
 /*
 ====================
@@ -47,12 +49,37 @@ namespace sparky
 	class Model final : public IMeshComponent
 	{
 	private:
+		/*
+		====================
+		Structures
+		====================
+		*/
+		struct Import_t
+		{
+			aiMesh*					 pMesh;		///< The Assimp mesh being converted.
+			std::vector<MeshLevel_t> levels;	///< The detail levels built from the mesh.
+			VertexCacheStats_t		 before;	///< The vertex cache use of the mesh as imported.
+			VertexCacheStats_t		 after;		///< The vertex cache use of the optimised first level.
+		};
+
+		/*
+		====================
+		Constant Variables
+		====================
+		*/
+		static const unsigned int m_sCacheMagic = 0x48534D53;	///< "SMSH", the first word of a mesh cache file.
+		static const unsigned int m_sCacheVersion = 4;			///< The layout of a mesh cache file, 3 holds detail levels, 4 welds before calculating normals.
+
 		/*
 		====================
 		Member Variables
 		====================
 		*/
-		std::vector<MeshData*> m_meshes;	///< All of the meshes that the model is constructed of.
+		std::vector<std::vector<MeshData*>> m_levels;	///< The meshes of each detail level, the first being full detail.
+
+		static String		m_sCache;		///< The directory mesh cache files are kept in, empty to always import.
+		static unsigned int	m_sLevelCount;	///< The amount of detail levels built for imported models.
+		static float		m_sLevelRatio;	///< The fraction of triangles kept from one detail level to the next.
 
 	private:
 		/*
@@ -69,23 +96,75 @@ namespace sparky
 		///
 		/// \param pNode	The Assimp node to process.
 		/// \param pScene   The scene that all these nodes are contained within.
+		/// \param imports	The meshes found, added to.
 		///
 		////////////////////////////////////////////////////////////
-		void loadNode(aiNode* pNode, const aiScene* pScene);
+		static void loadNode(aiNode* pNode, const aiScene* pScene, std::vector<Import_t>& imports);
 
 		////////////////////////////////////////////////////////////
 		/// \brief Converts an Assimp mesh to a Sparky Mesh.
 		///
 		/// This method will convert a mesh from the Assimp format
 		/// to a format that sparky can understand and render correctly. 
+		/// The detail levels of the mesh are built by the MeshSimplifier
+		/// and welded and reordered by the MeshOptimiser. Nothing is 
+		/// uploaded, so the meshes of a Model are loaded on the
+		/// ThreadManager at the same time.
+		///
+		/// \param import	The mesh to convert, its levels and stats are filled.
+		///
+		////////////////////////////////////////////////////////////
+		static void loadMesh(Import_t& import);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Uploads a mesh and adds it to a detail level.
+		///
+		/// \param level			The detail level of the mesh.
+		/// \param pVertices		The vertices of the mesh.
+		/// \param vertexCount	The amount of vertices.
+		/// \param pIndices		The indices of the mesh.
+		/// \param indexCount	The amount of indices.
 		///
-		/// \param pMesh	The Assimp mesh to be converted.
-		/// \param pScene	The scene the Assimp meshes are contained within.
+		////////////////////////////////////////////////////////////
+		void addMesh(const unsigned int level, const Vertex_t* pVertices, const GLuint vertexCount, const GLuint* pIndices, const GLuint indexCount);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Retrieves the path of the cache file of a model.
+		///
+		/// \param filename	The file location of the model.
+		///
+		/// \retval String	The cache file, named by the hash of the filename.
+		///
+		////////////////////////////////////////////////////////////
+		static String getCachePath(const String& filename);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Loads the meshes from a cache file.
+		///
+		/// The file is mapped and each mesh is uploaded straight from
+		/// the mapping, so no vertex is copied by the Model. A cache
+		/// of another version, vertex layout, source file or detail 
+		/// level settings is ignored.
+		///
+		/// \param path			The cache file to load.
+		/// \param sourceSize	The size of the model file the cache must match.
+		/// \param sourceTime	The modification time of the model file the cache must match.
+		///
+		/// \retval bool	True if the meshes were loaded.
+		///
+		////////////////////////////////////////////////////////////
+		bool loadCache(const String& path, const unsigned long long sourceSize, const unsigned long long sourceTime);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Writes the imported meshes to a cache file.
 		///
-		/// \retval MeshData*	The converted Sparky Mesh.
+		/// \param path			The cache file to write.
+		/// \param sourceSize	The size of the imported model file.
+		/// \param sourceTime	The modification time of the imported model file.
+		/// \param imports		The detail levels of every imported mesh.
 		///
 		////////////////////////////////////////////////////////////
-		MeshData* loadMesh(aiMesh* pMesh, const aiScene* pScene);
+		void saveCache(const String& path, const unsigned long long sourceSize, const unsigned long long sourceTime, const std::vector<Import_t>& imports) const;
 
 	public:
 		/*
@@ -99,7 +178,9 @@ namespace sparky
 		/// The constructor will create an Assimp importer and recursively
 		/// load all the meshes and objects contained within the file being
 		/// parsed in. If the loading fails an error message is presented
-		/// to the console window and the application will exit.
+		/// to the console window and the application will exit. When a
+		/// cache directory is set, an up to date cache of the file is
+		/// loaded instead and Assimp is not used at all.
 		///
 		/// \param filename	The file location of the model to load in.
 		///
@@ -115,6 +196,43 @@ namespace sparky
 		////////////////////////////////////////////////////////////
 		~Model(void);
 
+		/*
+		====================
+		Getters and Setters
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Retrieves the amount of detail levels of the Model.
+		///
+		/// \retval unsigned int	The amount of levels.
+		///
+		////////////////////////////////////////////////////////////
+		unsigned int getLevelCount(void) const override;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Sets the directory that imported models are cached in.
+		///
+		/// The first load of a model imports it through Assimp and
+		/// writes its meshes to the directory, later loads map the
+		/// cache instead. The directory must already exist.
+		///
+		/// \param directory	The directory ending in a slash, empty to always import.
+		///
+		////////////////////////////////////////////////////////////
+		static void setCache(const String& directory);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Sets the detail levels built for imported models.
+		///
+		/// Models that are already cached with other settings are
+		/// imported again.
+		///
+		/// \param count	The amount of levels, 1 for the full detail level only.
+		/// \param ratio	The fraction of triangles kept from one level to the next.
+		///
+		////////////////////////////////////////////////////////////
+		static void setLevels(const unsigned int count, const float ratio);
+
 		/*
 		====================
 		Methods
@@ -124,6 +242,27 @@ namespace sparky
 		/// \brief Renders all of the current meshes within the Model object.
 		////////////////////////////////////////////////////////////
 		void render(void) override;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Records a draw of every mesh within the Model object.
+		///
+		/// \param pShader		The shader to draw the meshes with.
+		/// \param pTexture		The texture to apply to the meshes, may be null.
+		/// \param transform	The transform of the object.
+		///
+		////////////////////////////////////////////////////////////
+		void queue(IShaderComponent* pShader, const Texture* pTexture, const Transform& transform) override;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Records a draw of every mesh of one detail level.
+		///
+		/// \param pShader		The shader to draw the meshes with.
+		/// \param pTexture		The texture to apply to the meshes, may be null.
+		/// \param transform	The transform of the object.
+		/// \param level		The detail level, clamped to the last level.
+		///
+		////////////////////////////////////////////////////////////
+		void queueLevel(IShaderComponent* pShader, const Texture* pTexture, const Transform& transform, const unsigned int level) override;
 	};
 
 }//namespace sparky
@@ -146,6 +285,12 @@ namespace sparky
 ///
 /// Usage example:
 /// \code
+/// // Cache imported models, the first run imports and the rest map the cache.
+/// sparky::Model::setCache("data/cache/");
+///
+/// // Build three detail levels, each with half the triangles of the last.
+/// sparky::Model::setLevels(3, 0.5f);
+///
 /// // Create a model and load it in.
 /// sparky::Model* pModel = new sparky::Model("assets/model.obj");
 ///
@@ -39,7 +39,7 @@ namespace sparky
 	Sparky Forward Declarations
 	====================
 	*/
-	class PointLight;
+	class LightClusters;
 
 	class PointShader final : public IShaderComponent
 	{
@@ -49,7 +49,16 @@ namespace sparky
 		Member Variables
 		====================
 		*/
-		PointLight* m_pLight;	///< The currently active point light.
+		const LightClusters* m_pClusters;			///< The clusters the point lights were assigned to this frame.
+
+		GLint				 m_positionLocation;	///< The location of the GBuffer position sampler.
+		GLint				 m_normalLocation;		///< The location of the GBuffer normal sampler.
+		GLint				 m_diffuseLocation;		///< The location of the GBuffer diffuse sampler.
+		GLint				 m_clustersLocation;	///< The location of the cluster light list sampler.
+		GLint				 m_indicesLocation;		///< The location of the light index list sampler.
+		GLint				 m_gridLocation;		///< The location of the cluster grid dimensions.
+		GLint				 m_tileSizeLocation;	///< The location of the size of a tile in pixels.
+		GLint				 m_sliceLocation;		///< The location of the depth slice scale and bias.
 
 	public:
 		/*
@@ -63,7 +72,8 @@ namespace sparky
 		/// The default constructor will bind and compile the two external
 		/// shaders for use with Point Lights. This shader is used within 
 		/// the multi-pass rendering pipeline to render point lights onto
-		/// geometry.
+		/// geometry. The FrameData and Lights uniform blocks are 
+		/// connected to their bindings.
 		///
 		////////////////////////////////////////////////////////////
 		explicit PointShader(void);
@@ -79,20 +89,27 @@ namespace sparky
 		====================
 		*/
 		////////////////////////////////////////////////////////////
-		/// \brief Sets the currently active point light of the multi-pass
-		///        rendering pipeline.
+		/// \brief Sets the clusters the point lights of the frame were
+		///		   assigned to.
 		///
-		/// \param pLight	The currently active point light.
+		/// \param pClusters	The clusters of the frame.
 		///
 		////////////////////////////////////////////////////////////
-		void setActiveLight(PointLight* pLight);
+		void setClusters(const LightClusters* pClusters);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Reads the sampler and cluster locations and connects
+		///		   the frame and Lights uniform blocks.
+		////////////////////////////////////////////////////////////
+		void loadUniforms(void) override;
 
 		////////////////////////////////////////////////////////////
 		/// \brief Updates the uniforms of the point light shader.
 		///
-		/// The uniforms updated within this shader is the currently
-		/// active point light and the normals generated from the 
-		/// deferred rendering pipeline.
+		/// The uniforms updated within this shader are the layout of
+		/// the light clusters and the samplers of the GBuffer and the 
+		/// cluster light lists. The lights themselves are read from 
+		/// the Lights uniform block.
 		///
 		/// \param transform	The transform of the currently rendering object.
 		///
@@ -110,7 +127,9 @@ namespace sparky
 ///
 /// sparky::PointShader is one of the shaders used within the 
 /// applications multi-pass rendering pipeline. It is responsible
-/// for rendering the effects of point lights onto geometry.
+/// for rendering the effects of point lights onto geometry. Every
+/// point light is drawn in a single pass, each pixel only shading
+/// the lights of the cluster it falls within.
 ///
 /// sparky::PointShader never has to be used implicitly by the
 /// user, instead it is utilised to render the lights of the scene
@@ -37,6 +37,8 @@ Class Includes
 ====================
 */
 #include <sparky\rendering\GLSLobject.hpp>	// GLSLObjects are linked within the Program object.
+#include <sparky\utils\flathashmap.hpp>		// Table of the active uniform locations.
+#include <sparky\utils\stringid.hpp>		// Uniform locations are keyed by the hash of their name.
 /*
 ====================
 Additional Includes
@@ -54,8 +56,26 @@ namespace sparky
 		Member Variables
 		====================
 		*/
-		GLuint					 m_ID;		///< The ID of the program. This is used to bind and unbind shader behaviour.
-		std::vector<GLSLObject*> m_shaders; ///< The shaders attached to the Program.
+		GLuint							m_ID;		///< The ID of the program. This is used to bind and unbind shader behaviour.
+		std::vector<GLSLObject*>		m_shaders;	///< The shaders attached to the Program.
+		FlatHashMap<StringId, GLint>	m_uniforms;	///< The location of every active uniform, read once after linking.
+
+	private:
+		/*
+		====================
+		Private Methods
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Reads the location of every active uniform.
+		///
+		/// Called once the Program has linked, so that uniform names
+		/// never need to be queried from the driver while rendering.
+		/// Every element of a uniform array is stored, both as 
+		/// "name[i]" and, for the first element, as "name".
+		///
+		////////////////////////////////////////////////////////////
+		void loadUniforms(void);
 
 	public:
 		/*
@@ -91,6 +111,28 @@ namespace sparky
 		////////////////////////////////////////////////////////////
 		GLuint getID(void) const;
 
+		////////////////////////////////////////////////////////////
+		/// \brief Retrieves the location of an active uniform.
+		///
+		/// The location is read from the table built when the Program
+		/// was linked, no OpenGL calls are made.
+		///
+		/// \param name		The name of the uniform within the shaders.
+		///
+		/// \retval GLint	The location of the uniform, or -1 if the 
+		///					uniform is not active in the Program.
+		///
+		////////////////////////////////////////////////////////////
+		GLint getUniformLocation(const StringId& name) const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Retrieves the amount of uniform locations in the table.
+		///
+		/// \retval unsigned int	The amount of uniform locations.
+		///
+		////////////////////////////////////////////////////////////
+		unsigned int getUniformCount(void) const;
+
 		/*
 		====================
 		Methods
@@ -116,8 +158,62 @@ namespace sparky
 		/// is bound, all of the functionality linked to it will be
 		/// executed.
 		///
+		/// \param retrievable	Whether the driver should keep the binary, see getBinary.
+		///
+		////////////////////////////////////////////////////////////
+		void link(const bool retrievable = false);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Links the Program from a binary retrieved by getBinary.
+		///
+		/// No shaders need to be attached. The driver may reject a
+		/// binary, for example after it has been updated, in which
+		/// case the Program is left unlinked.
+		///
+		/// \param format	The format of the binary.
+		/// \param pBinary	The binary.
+		/// \param length	The size of the binary in bytes.
+		///
+		/// \retval bool	True if the Program has been linked from the binary.
+		///
+		////////////////////////////////////////////////////////////
+		bool loadBinary(const GLenum format, const void* pBinary, const GLsizei length);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Retrieves the binary of the linked Program.
+		///
+		/// \param format	The format of the binary.
+		/// \param binary	The binary.
+		///
+		/// \retval bool	True if the driver provided a binary.
+		///
+		////////////////////////////////////////////////////////////
+		bool getBinary(GLenum& format, std::vector<char>& binary) const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Exchanges the linked state of two Programs.
+		///
+		/// Used to replace a Program that is in use with one that has
+		/// just been relinked, without changing its address. Uniform 
+		/// block bindings belong to the linked state, so they have to
+		/// be set again afterwards.
+		///
+		/// \param other	The Program to exchange with.
+		///
+		////////////////////////////////////////////////////////////
+		void swap(Program& other);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Connects a uniform block of the Program to a binding.
+		///
+		/// The block reads from whichever UniformBuffer is bound to
+		/// the binding. Nothing happens if the block is not active.
+		///
+		/// \param name		The name of the uniform block within the shaders.
+		/// \param binding	The binding point, see eUniformBinding.
+		///
 		////////////////////////////////////////////////////////////
-		void link(void);
+		void setBlockBinding(const String& name, const GLuint binding) const;
 
 		////////////////////////////////////////////////////////////
 		/// \brief Bind the Program ID.
@@ -140,7 +236,7 @@ namespace sparky
 
 }//namespace sparky
 
-#endif//__HYDRA_PROGRAM_HPP__
+#endif//__SPARKY_PROGRAM_HPP__
 
 ////////////////////////////////////////////////////////////
 /// \class sparky::Program
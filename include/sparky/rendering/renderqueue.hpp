@@ -0,0 +1,387 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// 
+// Sparky Engine
+// 2016 - Benjamin Carter (benjamin.mark.carter@hotmail.com)
+// 
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+// 
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+// 
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgement
+//    in the product documentation would be appreciated but is not required.
+// 
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+// 
+// 3. This notice may not be removed or altered from any source distribution.
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __SPARKY_RENDER_QUEUE_HPP__
+#define __SPARKY_RENDER_QUEUE_HPP__
+
+/*
+====================
+CPP Includes
+====================
+*/
+#include <atomic>						// Batches are claimed and completed by the packing threads.
+#include <memory>						// Each recording thread's command buffer is owned by the queue.
+#include <mutex>						// Guards the registration of new command buffers.
+#include <vector>						// Storage of the recorded and sorted draw commands.
+/*
+====================
+Class Includes
+====================
+*/
+#include <sparky\utils\singleton.hpp>	// RenderQueue is a singleton, therefore it inherits from the Singleton class.
+#include <sparky\utils\defines.hpp>	// Portable thread local storage for each thread's command buffer.
+#include <sparky\rendering\buffers.hpp>		// The object data of the draws is uploaded to a uniform buffer.
+#include <sparky\rendering\uniformring.hpp>	// The object data of each frame is allocated from a ring.
+/*
+====================
+Additional Includes
+====================
+*/
+#include <GLEW\glew.h>					// Vertex array objects and index counts of the draws.
+
+namespace sparky
+{
+	/*
+	====================
+	Sparky Forward Declarations
+	====================
+	*/
+	class IShaderComponent;
+	class Texture;
+	class Transform;
+
+	/*
+	====================
+	Enumerations
+	====================
+	*/
+	enum class eRenderPass
+	{
+		GEOMETRY,		///< Opaque geometry, drawn front to back.
+		TRANSLUCENT		///< Blended geometry, drawn back to front after all opaque geometry.
+	};
+
+	struct DrawCommand_t
+	{
+		unsigned long long	key;		///< The sort key, built from the pass, program, texture, depth and vertex array.
+		IShaderComponent*	pShader;	///< The shader to draw with.
+		const Texture*		pTexture;	///< The texture bound to the first unit, may be null.
+		const Transform*	pTransform;	///< The transform of the object, must stay alive until the queue is submitted.
+		GLuint				vao;		///< The vertex array object of the mesh.
+		GLsizei				indexCount;	///< The amount of indices to draw.
+		GLuint				firstIndex;	///< The first index to draw within the index buffer.
+		GLint				baseVertex;	///< Added to every index, for meshes that share a vertex buffer.
+	};
+
+	struct InstanceBatch_t
+	{
+		unsigned int first;		///< The index of the first command of the batch, in sorted order.
+		unsigned int count;		///< The amount of commands drawn by the batch, at most MAX_INSTANCES.
+		unsigned int offset;	///< The offset of the batch's object data within the object ring, in bytes.
+	};
+
+	struct RenderStats_t
+	{
+		unsigned int drawCalls;				///< The amount of draw calls issued.
+		unsigned int instances;				///< The amount of commands drawn, more than drawCalls whenever draws were instanced.
+		unsigned int stateChanges;			///< The amount of program, texture and vertex array binds issued.
+		unsigned int unsortedStateChanges;	///< The amount of binds the same draws would have needed in recording order.
+	};
+
+	class RenderQueue final : public Singleton<RenderQueue>
+	{
+		friend class Singleton<RenderQueue>;
+
+	private:
+		/*
+		====================
+		Structures
+		====================
+		*/
+		struct CommandBuffer_t
+		{
+			std::vector<DrawCommand_t> commands;	///< The commands recorded by a single thread.
+		};
+
+		struct SortEntry_t
+		{
+			unsigned long long	key;	///< The sort key of the command.
+			unsigned int		index;	///< The index of the command within the gathered commands.
+		};
+
+		struct PackJob_t
+		{
+			std::atomic<unsigned int>	next;	///< The next batch to be claimed.
+			std::atomic<unsigned int>	done;	///< The amount of batches that have been packed.
+			unsigned int				count;	///< The amount of batches to pack.
+		};
+
+		/*
+		====================
+		Constant Variables
+		====================
+		*/
+		static const unsigned int m_sParallelInstances = 2048;	///< Below this amount of instances, the batches are packed on the calling thread.
+
+		/*
+		====================
+		Member Variables
+		====================
+		*/
+		std::vector<std::unique_ptr<CommandBuffer_t>>	m_buffers;		///< One command buffer per thread that has recorded a draw.
+		std::mutex										m_mutex;		///< Guards the registration of new command buffers.
+
+		std::vector<DrawCommand_t>						m_commands;		///< The commands of every thread, gathered when submitted.
+		std::vector<SortEntry_t>						m_entries;		///< The keys of the gathered commands, in sorted order once sorted.
+		std::vector<SortEntry_t>						m_scratch;		///< Scratch storage for the radix sort.
+		std::vector<InstanceBatch_t>					m_batches;		///< The sorted commands, grouped into instanced draws.
+
+		UniformRing										m_objectRing;	///< Allocates the object data of each submission.
+		UniformBuffer									m_objects;		///< The uniform buffer the object ring is uploaded to.
+
+		RenderStats_t									m_stats;		///< The statistics of the last submission.
+
+		static SPARKY_THREAD_LOCAL CommandBuffer_t*		m_sLocalBuffer;	///< The calling thread's command buffer, owned by m_buffers.
+
+	private:
+		/*
+		====================
+		Private Ctor
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Default constructor of the RenderQueue object.
+		////////////////////////////////////////////////////////////
+		explicit RenderQueue(void);
+
+		/*
+		====================
+		Private Methods
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Retrieves the command buffer of the calling thread.
+		///
+		/// The buffer is created and registered the first time a 
+		/// thread records a command, after which no locking is needed.
+		///
+		/// \retval CommandBuffer_t	The calling thread's command buffer.
+		///
+		////////////////////////////////////////////////////////////
+		CommandBuffer_t& getLocalBuffer(void);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Sorts the gathered commands by their keys.
+		///
+		/// A least significant digit radix sort, eight bits at a time.
+		/// Digits that are the same across every key are skipped, as
+		/// usually only a few bits of the pass and program differ.
+		///
+		////////////////////////////////////////////////////////////
+		void sort(void);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Groups the sorted commands into instanced draws.
+		///
+		/// Neighbouring commands are merged while they share a shader,
+		/// texture and index range of the same vertex array, up to 
+		/// MAX_INSTANCES commands per batch.
+		///
+		////////////////////////////////////////////////////////////
+		void batch(void);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Writes the model matrices of a batch into the 
+		///		   object ring.
+		///
+		/// \param batch	The batch to pack, its range must be allocated.
+		///
+		////////////////////////////////////////////////////////////
+		void pack(const InstanceBatch_t& batch);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Claims and packs batches until none are left.
+		///
+		/// Called by the rendering thread and by the tasks it hands to
+		/// the ThreadManager. A task that starts after every batch has
+		/// been claimed returns without touching the queue.
+		///
+		/// \param pJob	The job the batches are claimed from.
+		///
+		////////////////////////////////////////////////////////////
+		void pack(const std::shared_ptr<PackJob_t>& pJob);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Allocates a range of the object ring for every batch
+		///		   and packs their object data into it.
+		///
+		/// Each batch starts at an aligned offset so that it can be 
+		/// bound on its own, its instances are tightly packed after it.
+		/// Large frames are packed in parallel.
+		///
+		/// \param size			The size of the allocated range in bytes.
+		///
+		/// \retval unsigned int	The offset of the allocated range.
+		///
+		////////////////////////////////////////////////////////////
+		unsigned int packObjects(unsigned int& size);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Packs the object data of every batch and uploads it.
+		///
+		/// The data is uploaded in a single call, each draw then binds
+		/// the range of its batch.
+		///
+		////////////////////////////////////////////////////////////
+		void uploadObjects(void);
+
+	public:
+		/*
+		====================
+		Dtor
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Default destructor of the RenderQueue object.
+		////////////////////////////////////////////////////////////
+		~RenderQueue(void) = default;
+
+		/*
+		====================
+		Getters and Setters
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Retrieves the statistics of the last submission.
+		///
+		/// The state changes are reported both as issued and as they 
+		/// would have been if the draws were issued in recording order.
+		///
+		/// \retval RenderStats_t	The statistics of the last submission.
+		///
+		////////////////////////////////////////////////////////////
+		const RenderStats_t& getStats(void) const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Retrieves the instanced draws of the last submission.
+		///
+		/// \retval vector	The batches in the order they were drawn.
+		///
+		////////////////////////////////////////////////////////////
+		const std::vector<InstanceBatch_t>& getBatches(void) const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Retrieves the packed object data of a batch.
+		///
+		/// Valid until the next submission.
+		///
+		/// \param batch			A batch of the last submission.
+		///
+		/// \retval ObjectData_t	The object data of the batch's first instance,
+		///						the others follow it.
+		///
+		////////////////////////////////////////////////////////////
+		const ObjectData_t* getObjectData(const InstanceBatch_t& batch) const;
+
+		/*
+		====================
+		Methods
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Builds the sort key of a draw.
+		///
+		/// From the most significant bit, the key contains 2 bits of
+		/// pass, 12 bits of program and 12 bits of texture. Opaque 
+		/// geometry follows with 14 bits of vertex array and 24 bits
+		/// of depth, so that objects sharing a mesh end up next to 
+		/// each other and can be instanced. Translucent geometry has 
+		/// to keep its depth order, so its depth comes before the 
+		/// vertex array.
+		///
+		/// \param pass		The pass the draw belongs to.
+		/// \param program	The ID of the program.
+		/// \param texture	The ID of the texture.
+		/// \param depth	The distance, or squared distance, from the camera to the object.
+		/// \param vao		The ID of the vertex array object.
+		///
+		/// \retval unsigned long long	The sort key.
+		///
+		////////////////////////////////////////////////////////////
+		static unsigned long long makeKey(const eRenderPass pass, const GLuint program, const GLuint texture, const float depth, const GLuint vao);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Records a draw into the calling thread's command buffer.
+		///
+		/// Commands can be recorded from any thread, but every thread
+		/// must have finished recording before the queue is submitted.
+		///
+		/// \param pass			The pass the draw belongs to.
+		/// \param pShader		The shader to draw with.
+		/// \param pTexture		The texture to bind to the first unit, may be null.
+		/// \param vao			The vertex array object of the mesh.
+		/// \param indexCount	The amount of indices to draw.
+		/// \param transform	The transform of the object being drawn.
+		/// \param firstIndex	The first index to draw within the index buffer.
+		/// \param baseVertex	Added to every index, for meshes that share a vertex buffer.
+		///
+		////////////////////////////////////////////////////////////
+		void push(const eRenderPass pass, IShaderComponent* pShader, const Texture* pTexture, const GLuint vao, const GLsizei indexCount, const Transform& transform,
+			const GLuint firstIndex = 0, const GLint baseVertex = 0);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Sorts and draws every recorded command.
+		///
+		/// Must be called from the thread that owns the OpenGL context.
+		/// Neighbouring draws of the same mesh are issued as a single 
+		/// instanced draw. Programs, textures and vertex arrays are only
+		/// bound when they differ from the previous draw, and shaders 
+		/// are only updated when bound. The model matrix of each 
+		/// instance is read from the ObjectData uniform block. Every 
+		/// command buffer is emptied, but keeps its memory for the next
+		/// frame.
+		///
+		////////////////////////////////////////////////////////////
+		void submit(void);
+	};
+
+}//namespace sparky
+
+#endif//__SPARKY_RENDER_QUEUE_HPP__
+
+////////////////////////////////////////////////////////////
+/// \class sparky::RenderQueue
+/// \ingroup rendering
+///
+/// sparky::RenderQueue collects the draws of a frame as plain
+/// draw commands instead of issuing them immediately. When the
+/// queue is submitted, the commands are sorted by a 64-bit key
+/// so that draws sharing a program and texture are issued 
+/// together, and opaque geometry is drawn front to back. Draws 
+/// of the same mesh are then merged into instanced draws, whose
+/// model matrices are packed into a uniform buffer.
+///
+/// Usage example:
+/// \code
+/// // Record the draws of the frame, from any thread.
+/// mesh->queue(pShader, pTexture, transform);
+///
+/// // Sort and issue the draws on the rendering thread.
+/// sparky::RenderQueue::getInstance().submit();
+///
+/// std::cout << sparky::RenderQueue::getInstance().getStats().stateChanges << std::endl;
+/// std::cout << sparky::RenderQueue::getInstance().getBatches().size() << std::endl;
+/// \endcode
+///
+////////////////////////////////////////////////////////////
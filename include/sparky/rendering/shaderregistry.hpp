@@ -0,0 +1,373 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// 
+// Sparky Engine
+// 2016 - Benjamin Carter (benjamin.mark.carter@hotmail.com)
+// 
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+// 
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+// 
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgement
+//    in the product documentation would be appreciated but is not required.
+// 
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+// 
+// 3. This notice may not be removed or altered from any source distribution.
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __SPARKY_SHADER_REGISTRY_HPP__
+#define __SPARKY_SHADER_REGISTRY_HPP__
+
+/*
+====================
+CPP Includes
+====================
+*/
+#include <vector>							// The linked programs and the includes of a source.
+#include <chrono>							// The time programs were first requested.
+/*
+====================
+Class Includes
+====================
+*/
+#include <sparky\utils\singleton.hpp>		// The Shader Registry is a singleton object.
+#include <sparky\utils\flathashmap.hpp>		// The file and source caches.
+#include <sparky\utils\stringid.hpp>		// Files and sources are keyed by hash.
+#include <sparky\utils\string.hpp>			// File contents and preprocessed sources.
+/*
+====================
+Additional Includes
+====================
+*/
+#include <GLEW\glew.h>						// The format of program binaries.
+
+namespace sparky
+{
+	/*
+	====================
+	Sparky Forward Declarations
+	====================
+	*/
+	class Program;
+
+	struct ShaderRegistryStats_t
+	{
+		unsigned int programs;			///< The amount of programs that are linked.
+		unsigned int sharedPrograms;	///< The amount of requests given an already linked program.
+		unsigned int filesRead;			///< The amount of shader files read from disk.
+		unsigned int sourcesReused;		///< The amount of requests given an already preprocessed source.
+		unsigned int binaryHits;		///< The amount of programs loaded from the binary cache.
+		unsigned int binaryMisses;		///< The amount of programs compiled while the binary cache was enabled.
+		double		 startupMilliseconds;	///< The time from the creation of the registry to the last program it linked.
+	};
+
+	class ShaderRegistry final : public Singleton<ShaderRegistry>
+	{
+		friend class Singleton<ShaderRegistry>;
+
+	private:
+		/*
+		====================
+		Structures
+		====================
+		*/
+		struct Source_t
+		{
+			String					source;	///< The source with every include expanded.
+			std::vector<StringId>	files;	///< The shader file and every file it includes, directly or not.
+			unsigned long long		hash;	///< The content hash of the source and its whole include closure.
+		};
+
+		struct Entry_t
+		{
+			Program*			pProgram;		///< The linked program.
+			String				vertexShader;	///< The file of the vertex shader.
+			String				fragmentShader;	///< The file of the fragment shader.
+			unsigned long long	vertexHash;		///< The closure hash of the vertex shader.
+			unsigned long long	fragmentHash;	///< The closure hash of the fragment shader.
+			unsigned int		vertexLength;	///< The length of the preprocessed vertex shader.
+			unsigned int		fragmentLength;	///< The length of the preprocessed fragment shader.
+			unsigned int		references;		///< The amount of shaders using the program.
+		};
+
+		/*
+		====================
+		Constant Variables
+		====================
+		*/
+		static const unsigned int m_sBinaryMagic = 0x42505053;	///< "SPPB", the first word of a program binary file.
+		static const unsigned int m_sBinaryVersion = 2;			///< The layout of a program binary file.
+
+		/*
+		====================
+		Member Variables
+		====================
+		*/
+		FlatHashMap<StringId, String>	m_files;		///< The contents of every file read, so includes are read once.
+		FlatHashMap<StringId, Source_t>	m_sources;		///< The preprocessed source of every shader, keyed by its path.
+		std::vector<Entry_t>			m_programs;		///< The linked programs, shared by every shader with the same sources.
+		String							m_binaryCache;	///< The directory of the program binaries, empty when disabled.
+		unsigned int					m_driverHash;	///< The hash of the driver, binaries from another driver are ignored.
+		bool							m_driverChecked;	///< Whether the driver has been checked for program binary support.
+		ShaderRegistryStats_t			m_stats;		///< The statistics of every program requested.
+		std::chrono::high_resolution_clock::time_point	m_start;	///< The time the registry was created, startup is timed from it.
+
+	private:
+		/*
+		====================
+		Private Ctor
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Default constructor of the ShaderRegistry object.
+		////////////////////////////////////////////////////////////
+		explicit ShaderRegistry(void);
+
+		/*
+		====================
+		Private Methods
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Retrieves the contents of a file.
+		///
+		/// The file is read from disk the first time it is requested,
+		/// every later request is served from memory.
+		///
+		/// \param filename		The file to read.
+		///
+		/// \retval String	The contents of the file, nullptr if it could not be read.
+		///
+		////////////////////////////////////////////////////////////
+		const String* readFile(const String& filename);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Expands the include statements of a file.
+		///
+		/// Include statements are replaced by the contents of the 
+		/// included file, which is expanded recursively. A file that 
+		/// has already been included is skipped.
+		///
+		/// \param filename		The file to expand.
+		/// \param source		The source the expanded file is appended to.
+		/// \param includes		The files already expanded into the source.
+		///
+		/// \retval bool	True if the file and its includes have been expanded.
+		///
+		////////////////////////////////////////////////////////////
+		bool expand(const String& filename, String& source, std::vector<StringId>& includes);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Preprocesses a shader.
+		///
+		/// \param filename		The file of the shader.
+		///
+		/// \retval Source_t	The preprocessed shader, nullptr if it could not be read.
+		///
+		////////////////////////////////////////////////////////////
+		const Source_t* preprocess(const String& filename);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Checks whether two shaders have the same source.
+		///
+		/// The preprocessed text is compared, so two sources are
+		/// never mistaken for one another by their hash alone.
+		///
+		/// \param first		The file of the first shader.
+		/// \param second		The file of the second shader.
+		///
+		/// \retval bool	True if both sources are identical, or both failed to preprocess.
+		///
+		////////////////////////////////////////////////////////////
+		bool isSameSource(const String& first, const String& second) const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Checks whether program binaries can be kept.
+		///
+		/// The first call after the cache directory is set asks the
+		/// driver whether it supports program binaries and hashes its
+		/// name and version, so it must be made with a context.
+		///
+		/// \retval bool	True if a cache directory is set and the driver supports binaries.
+		///
+		////////////////////////////////////////////////////////////
+		bool isBinaryCacheEnabled(void);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Builds the path of the binary of a program.
+		///
+		/// \param vertexHash	The closure hash of the vertex shader.
+		/// \param fragmentHash	The closure hash of the fragment shader.
+		///
+		/// \retval String	The path of the binary within the cache directory.
+		///
+		////////////////////////////////////////////////////////////
+		String getBinaryPath(const unsigned long long vertexHash, const unsigned long long fragmentHash) const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Links a program from the binary cache.
+		///
+		/// \param pProgram		The program to link.
+		/// \param entry		The hashes of the program's sources.
+		///
+		/// \retval bool	True if a binary for this driver was found and linked.
+		///
+		////////////////////////////////////////////////////////////
+		bool loadBinary(Program* pProgram, const Entry_t& entry) const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Compiles and links a program from its sources.
+		///
+		/// \param pProgram		The program to link, with no shaders attached.
+		/// \param entry		The shaders and hashes of the program.
+		/// \param cached		Whether the binary should be written to the cache.
+		///
+		////////////////////////////////////////////////////////////
+		void compile(Program* pProgram, const Entry_t& entry, const bool cached);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Writes the binary of a linked program to the cache.
+		///
+		/// \param pProgram		The linked program.
+		/// \param entry		The hashes of the program's sources.
+		///
+		////////////////////////////////////////////////////////////
+		void saveBinary(const Program* pProgram, const Entry_t& entry) const;
+
+	public:
+		/*
+		====================
+		Dtor
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Destructor of the ShaderRegistry object.
+		///
+		/// Any program that has not been released is deleted.
+		///
+		////////////////////////////////////////////////////////////
+		~ShaderRegistry(void);
+
+		/*
+		====================
+		Getters and Setters
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Retrieves the preprocessed source of a shader.
+		///
+		/// \param filename		The file of the shader.
+		/// \param source		The source, with every include expanded.
+		///
+		/// \retval bool	True if the shader has been read and preprocessed.
+		///
+		////////////////////////////////////////////////////////////
+		bool getSource(const String& filename, String& source);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Sets the directory that linked program binaries 
+		///		   are kept in.
+		///
+		/// The directory must already exist. Binaries are only kept
+		/// when the driver supports ARB_get_program_binary.
+		///
+		/// \param directory	The directory, ending in a slash. Empty disables the cache.
+		///
+		////////////////////////////////////////////////////////////
+		void setBinaryCache(const String& directory);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Retrieves the statistics of every program requested.
+		///
+		/// \retval ShaderRegistryStats_t	The statistics of every program requested.
+		///
+		////////////////////////////////////////////////////////////
+		const ShaderRegistryStats_t& getStats(void) const;
+
+		/*
+		====================
+		Methods
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Retrieves a linked program for a pair of shaders.
+		///
+		/// Programs are shared by the content of their preprocessed 
+		/// sources, so requesting the same shaders again returns the
+		/// same program. A new program is loaded from the binary cache
+		/// if possible, and compiled from source otherwise.
+		///
+		/// \param vertexShader		The file of the vertex shader.
+		/// \param fragmentShader	The file of the fragment shader.
+		///
+		/// \retval Program*	The linked program, to be given back with releaseProgram.
+		///
+		////////////////////////////////////////////////////////////
+		Program* acquireProgram(const String& vertexShader, const String& fragmentShader);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Gives back a program retrieved by acquireProgram.
+		///
+		/// The program is deleted once nothing is using it.
+		///
+		/// \param pProgram		The program to give back.
+		///
+		////////////////////////////////////////////////////////////
+		void releaseProgram(Program* pProgram);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Recompiles every program that depends on a file.
+		///
+		/// The file is read again, and every shader that includes it,
+		/// directly or through another include, is preprocessed again.
+		/// Each affected program is relinked in place, so the shaders 
+		/// using it keep their pointer but must read their uniform 
+		/// locations again. A program that fails to compile keeps its
+		/// previous version.
+		///
+		/// \param filename		The file that has changed.
+		///
+		/// \retval unsigned int	The amount of programs that were relinked.
+		///
+		////////////////////////////////////////////////////////////
+		unsigned int reload(const String& filename);
+	};
+
+}//namespace sparky
+
+#endif//__SPARKY_SHADER_REGISTRY_HPP__
+
+////////////////////////////////////////////////////////////
+/// \class sparky::ShaderRegistry
+/// \ingroup rendering
+///
+/// sparky::ShaderRegistry owns every linked Program of the engine.
+/// Shader files are read from disk once, their includes expanded 
+/// once, and two shaders with the same sources share one Program.
+///
+/// When a binary cache directory is set, linked programs are written
+/// to it and later runs load them instead of compiling, as long as
+/// the sources and the driver have not changed. The time from the
+/// creation of the registry to its last link is kept, to compare
+/// cold and warm starts.
+///
+/// Usage example:
+/// \code
+/// sparky::ShaderRegistry::getInstance().setBinaryCache("data/cache/");
+///
+/// sparky::Program* pProgram = sparky::ShaderRegistry::getInstance().acquireProgram("shaders/basic_vertex.glsl", "shaders/basic_fragment.glsl");
+///
+/// pProgram->bind();
+///
+/// // Once the program is no longer used.
+/// sparky::ShaderRegistry::getInstance().releaseProgram(pProgram);
+/// \endcode
+///
+////////////////////////////////////////////////////////////
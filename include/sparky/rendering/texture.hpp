@@ -32,6 +32,7 @@ Class Includes
 */
 #include <sparky\core\ref.hpp>		// Texture is a dynamically allocated object.
 #include <sparky\math\vector2.hpp>	// Stores the dimensions of the Texture.
+#include <sparky\utils\string.hpp>	// The file the Texture is loaded from.
 /*
 ====================
 Additional Includes
@@ -46,7 +47,7 @@ namespace sparky
 	Sparky Forward Declarations
 	====================
 	*/
-	class String;
+	class KTXFile;
 
 	/*
 	====================
@@ -79,6 +80,7 @@ namespace sparky
 		GLint            internalFormat;	///< The internal bit format.
 		eTextureFilter   filter;			///< The rendering filter.
 		eTextureWrapMode mode;				///< The mode the texture will apply to meshes.
+		unsigned int	 tileSize;			///< The size of the square tiles a GL_TEXTURE_2D_ARRAY is cut from, 0 for the width of the image.
 
 		/*
 		====================
@@ -94,7 +96,7 @@ namespace sparky
 		/// 
 		////////////////////////////////////////////////////////////
 		explicit SPARKY_TEXTURE_DESC(void)
-			: target(GL_TEXTURE_2D), internalFormat(GL_RGBA), filter(eTextureFilter::LINEAR), mode(eTextureWrapMode::CLAMP)
+			: target(GL_TEXTURE_2D), internalFormat(GL_RGBA), filter(eTextureFilter::LINEAR), mode(eTextureWrapMode::CLAMP), tileSize(0)
 		{
 		}
 	};
@@ -107,9 +109,11 @@ namespace sparky
 		Member Variables
 		====================
 		*/
-		GLuint	 m_ID;			///< The ID handle of the Texture.
-		Vector2u m_dimensions;	///< The size (in pixels) of the Texture.
-		void*	 m_pTexels;		///< The individual pixels of the Texture.
+		GLuint				m_ID;			///< The ID handle of the Texture.
+		Vector2u			m_dimensions;	///< The size (in pixels) of the Texture.
+		String				m_filename;		///< The file the Texture is loaded from.
+		SPARKY_TEXTURE_DESC	m_desc;			///< The formats and rendering technique of the Texture.
+		bool				m_loaded;		///< Whether the texels of the file have been uploaded.
 
 	public:
 		/*
@@ -121,10 +125,12 @@ namespace sparky
 		/// \brief Constructor for a Texture object with a filename and texture
 		///		   Settings.
 		///
-		/// This constructor loads in a texture from a file directory and sets
-		/// the parameters and behaviour of the texture with the settings of the 
-		/// description. If the texture fails to load, a warning message will be
-		/// printed to the console window.
+		/// This constructor sets the parameters and behaviour of the texture
+		/// with the settings of the description, then queues the file to be
+		/// decoded by the TextureLoader. Until the texels are uploaded the
+		/// Texture holds a single white placeholder texel. If the texture 
+		/// fails to load, a warning message will be printed to the console 
+		/// window.
 		///
 		/// \param filename		The file directory and name of the texture.
 		/// \param desc			A description of the Texture, its formats and rendering technique.
@@ -148,33 +154,99 @@ namespace sparky
 		///
 		/// Similar to other OpenGL functionality, the information and
 		/// behaviour of the texture is about to an unsigned int ID. 
+		/// The ID does not change when the texels are uploaded.
 		///
 		/// \retval GLuint	The Texture ID handle.
 		///
 		////////////////////////////////////////////////////////////
 		GLuint getID(void) const;
 
+		////////////////////////////////////////////////////////////
+		/// \brief Retrieves the target the Texture is bound to.
+		///
+		/// \retval GLenum	The target of the Texture (i.e GL_TEXTURE_2D).
+		///
+		////////////////////////////////////////////////////////////
+		GLenum getTarget(void) const;
+
 		////////////////////////////////////////////////////////////
 		/// \brief Retrieves the dimensions (in pixels) of the Texture.
 		///
-		/// \retval Vector2u&	The pixel dimensions of the Texture.
+		/// \retval Vector2u&	The pixel dimensions of the Texture, zero until it has loaded.
 		///
 		////////////////////////////////////////////////////////////
 		const Vector2u& getDimensions(void) const;
 
 		////////////////////////////////////////////////////////////
-		/// \brief Gets the individual pixels of the Texture object.
+		/// \brief Retrieves the file the Texture is loaded from.
 		///
-		/// \retval void*	The individual pixels of the Texture.
+		/// \retval String&	The file of the Texture.
 		///
 		////////////////////////////////////////////////////////////
-		void* getTexels(void) const;
+		const String& getFilename(void) const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Retrieves the description the Texture was created with.
+		///
+		/// \retval SPARKY_TEXTURE_DESC&	The formats and rendering technique of the Texture.
+		///
+		////////////////////////////////////////////////////////////
+		const SPARKY_TEXTURE_DESC& getDescription(void) const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Retrieves whether the texels of the file have been
+		///		   uploaded.
+		///
+		/// \retval bool	False while the placeholder is shown.
+		///
+		////////////////////////////////////////////////////////////
+		bool isLoaded(void) const;
 
 		/*
 		====================
 		Methods
 		====================
 		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Uploads decoded texels to the Texture.
+		///
+		/// Called by the TextureLoader on the main thread, the texels
+		/// are tightly packed RGBA rows. A GL_TEXTURE_2D_ARRAY cuts the
+		/// image into square tiles of the description's tile size, 
+		/// read left to right and top to bottom, one per layer.
+		///
+		/// \param width		The width of the image in pixels.
+		/// \param height		The height of the image in pixels.
+		/// \param pTexels		The texels of the image.
+		///
+		////////////////////////////////////////////////////////////
+		void upload(const unsigned int width, const unsigned int height, const void* pTexels);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Uploads baked blocks to the Texture.
+		///
+		/// Called by the TextureLoader on the main thread. Every level
+		/// of the file is uploaded as it is, so no mipmaps are made on
+		/// the driver. A GL_TEXTURE_2D_ARRAY cuts each level into tiles
+		/// along the block rows, so its tile size must be a multiple of
+		/// 4 and the levels stop once a tile is smaller than a block.
+		///
+		/// \param file		The blocks and mipmap levels of the image.
+		///
+		////////////////////////////////////////////////////////////
+		void upload(const KTXFile& file);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Loads the file of the Texture again.
+		///
+		/// Used by hot reloading, the file is decoded in the background
+		/// and the ID stays the same, so anything holding the Texture 
+		/// draws the new texels once they are uploaded. If the file 
+		/// fails to load, the previous texels are kept.
+		///
+		////////////////////////////////////////////////////////////
+		void reload(void);
+
 		////////////////////////////////////////////////////////////
 		/// \brief Binds the current Texture object for use.
 		///
@@ -192,9 +264,13 @@ namespace sparky
 		///
 		/// When the Texture object is unbound, the objects in the scene
 		/// will no longer make use of this Textures rendering methods.
+		/// Drawing code does not need to unbind, binding the next 
+		/// Texture replaces it.
+		///
+		/// \param location		The location to unbind the texture from. Default is 0.
 		///
 		////////////////////////////////////////////////////////////
-		void unbind(void) const;
+		void unbind(const GLuint location = 0) const;
 	};
 
 }//namespace sparky
@@ -228,6 +304,9 @@ namespace sparky
 ///
 /// // Bind the texture for use.
 /// pTexture->bind();
+///
+/// // Files baked by the TextureBaker are uploaded as they are.
+/// sparky::Texture* pBaked = new Texture("assets/image.ktx", desc);
 /// \endcode
 ///
 ////////////////////////////////////////////////////////////
\ No newline at end of file
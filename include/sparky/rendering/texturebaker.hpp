@@ -0,0 +1,271 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// 
+// Sparky Engine
+// 2016 - Benjamin Carter (benjamin.mark.carter@hotmail.com)
+// 
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+// 
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+// 
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgement
+//    in the product documentation would be appreciated but is not required.
+// 
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+// 
+// 3. This notice may not be removed or altered from any source distribution.
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __SPARKY_TEXTURE_BAKER_HPP__
+#define __SPARKY_TEXTURE_BAKER_HPP__
+
+/*
+====================
+CPP Includes
+====================
+*/
+#include <vector>						// The encoded blocks and the downsampled levels.
+/*
+====================
+Class Includes
+====================
+*/
+#include <sparky\utils\string.hpp>		// The files that are baked.
+/*
+====================
+Additional Includes
+====================
+*/
+#include <GLEW\glew.h>					// The compressed formats of the blocks.
+
+namespace sparky
+{
+	/*
+	====================
+	Sparky Forward Declarations
+	====================
+	*/
+	class KTXFile;
+
+	/*
+	====================
+	Enumerations
+	====================
+	*/
+	enum class eBlockFormat
+	{
+		BC1,	///< 8 bytes per 4x4 block, opaque colour (DXT1).
+		BC3		///< 16 bytes per 4x4 block, colour and smooth alpha (DXT5).
+	};
+
+	class TextureBaker final
+	{
+	public:
+		/*
+		====================
+		Constant Variables
+		====================
+		*/
+		static const unsigned int BLOCK_DIMENSION = 4;	///< The width and height of a block in texels.
+
+	private:
+		/*
+		====================
+		Structures
+		====================
+		*/
+		struct Block_t
+		{
+			float r[16];	///< The red channel of each texel, row by row.
+			float g[16];	///< The green channel of each texel.
+			float b[16];	///< The blue channel of each texel.
+			float a[16];	///< The alpha channel of each texel.
+		};
+
+		/*
+		====================
+		Private Methods
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Reads a block of texels from an image.
+		///
+		/// Blocks past the edge of the image repeat the last row and
+		/// column, so they do not pull the endpoints towards black.
+		///
+		/// \param width		The width of the image in pixels.
+		/// \param height		The height of the image in pixels.
+		/// \param pTexels		The tightly packed RGBA rows of the image.
+		/// \param x			The left texel of the block.
+		/// \param y			The top texel of the block.
+		/// \param block		The block to fill.
+		///
+		////////////////////////////////////////////////////////////
+		static void fetchBlock(const unsigned int width, const unsigned int height, const unsigned char* pTexels, 
+			const unsigned int x, const unsigned int y, Block_t& block);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Picks the closest of four colours for every texel.
+		///
+		/// \param block		The texels of the block.
+		/// \param palette		The red, green and blue of the four colours.
+		/// \param pIndices		The index of the closest colour of each texel.
+		///
+		/// \retval float	The summed squared error of the block.
+		///
+		////////////////////////////////////////////////////////////
+		static float selectColours(const Block_t& block, const float palette[3][4], unsigned char* pIndices);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Picks the closest of eight alphas for every texel.
+		///
+		/// \param block		The texels of the block.
+		/// \param palette		The eight alphas.
+		/// \param pIndices		The index of the closest alpha of each texel.
+		///
+		////////////////////////////////////////////////////////////
+		static void selectAlphas(const Block_t& block, const float palette[8], unsigned char* pIndices);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Encodes the colour of a block as BC1.
+		///
+		/// The endpoints start at the extremes of the block along its
+		/// principal axis, then are refitted once to the chosen indices
+		/// by least squares, keeping whichever has the lower error.
+		///
+		/// \param block		The texels of the block.
+		/// \param pOutput		The 8 bytes of the encoded block.
+		///
+		////////////////////////////////////////////////////////////
+		static void encodeColour(const Block_t& block, unsigned char* pOutput);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Encodes the alpha of a block as BC3 alpha.
+		///
+		/// \param block		The texels of the block.
+		/// \param pOutput		The 8 bytes of the encoded block.
+		///
+		////////////////////////////////////////////////////////////
+		static void encodeAlpha(const Block_t& block, unsigned char* pOutput);
+
+	public:
+		/*
+		====================
+		Getters and Setters
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Retrieves the OpenGL format of a block format.
+		///
+		/// \param format	The block format.
+		///
+		/// \retval GLenum	The compressed internal format.
+		///
+		////////////////////////////////////////////////////////////
+		static GLenum getInternalFormat(const eBlockFormat format);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Retrieves the size of a block of a block format.
+		///
+		/// \param format	The block format.
+		///
+		/// \retval unsigned int	The size of a block in bytes.
+		///
+		////////////////////////////////////////////////////////////
+		static unsigned int getBlockSize(const eBlockFormat format);
+
+		/*
+		====================
+		Methods
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Encodes an image into blocks.
+		///
+		/// Images that are not a multiple of the block size are padded
+		/// by repeating their edges.
+		///
+		/// \param format		The block format to encode to.
+		/// \param width		The width of the image in pixels.
+		/// \param height		The height of the image in pixels.
+		/// \param pTexels		The tightly packed RGBA rows of the image.
+		/// \param blocks		The encoded blocks, row by row.
+		///
+		////////////////////////////////////////////////////////////
+		static void encode(const eBlockFormat format, const unsigned int width, const unsigned int height, const unsigned char* pTexels, 
+			std::vector<unsigned char>& blocks);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Halves an image with a box filter.
+		///
+		/// Each texel of the result averages a 2x2 square of the image,
+		/// the last row or column of an odd size is left out. The 
+		/// result is never smaller than one pixel.
+		///
+		/// \param width		The width of the image in pixels.
+		/// \param height		The height of the image in pixels.
+		/// \param pTexels		The tightly packed RGBA rows of the image.
+		/// \param result		The tightly packed RGBA rows of the next level.
+		///
+		////////////////////////////////////////////////////////////
+		static void downsample(const unsigned int width, const unsigned int height, const unsigned char* pTexels, 
+			std::vector<unsigned char>& result);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Encodes an image and every one of its mipmap levels.
+		///
+		/// \param format		The block format to encode to.
+		/// \param width		The width of the image in pixels.
+		/// \param height		The height of the image in pixels.
+		/// \param pTexels		The tightly packed RGBA rows of the image.
+		/// \param file			The file to hold the levels.
+		///
+		////////////////////////////////////////////////////////////
+		static void bake(const eBlockFormat format, const unsigned int width, const unsigned int height, const unsigned char* pTexels, 
+			KTXFile& file);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Bakes an image file into a KTX file.
+		///
+		/// \param source			The image file to read (i.e a png).
+		/// \param destination		The KTX file to write.
+		/// \param format			The block format to encode to.
+		///
+		/// \retval bool	True if the KTX file was written.
+		///
+		////////////////////////////////////////////////////////////
+		static bool bake(const String& source, const String& destination, const eBlockFormat format);
+	};
+
+}//namespace sparky
+
+#endif//__SPARKY_TEXTURE_BAKER_HPP__
+
+////////////////////////////////////////////////////////////
+/// \class sparky::TextureBaker
+/// \ingroup rendering
+///
+/// sparky::TextureBaker compresses images offline, so textures are
+/// stored and uploaded as BC1 or BC3 blocks with their mipmaps
+/// already made. BC1 stores a texel in half a byte and BC3 in a 
+/// byte, against four bytes for an uncompressed texel, and loading
+/// no longer generates mipmaps on the driver.
+///
+/// The engine bakes from the command line, the baked file is then
+/// loaded like any other Texture.
+///
+/// Usage example:
+/// \code
+/// // sparky --bake assets/tilesheet.png assets/tilesheet.ktx bc3
+/// sparky::TextureBaker::bake("assets/tilesheet.png", "assets/tilesheet.ktx", sparky::eBlockFormat::BC3);
+///
+/// sparky::Texture* pTexture = new sparky::Texture("assets/tilesheet.ktx", desc);
+/// \endcode
+///
+////////////////////////////////////////////////////////////
\ No newline at end of file
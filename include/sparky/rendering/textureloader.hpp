@@ -0,0 +1,235 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// 
+// Sparky Engine
+// 2016 - Benjamin Carter (benjamin.mark.carter@hotmail.com)
+// 
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+// 
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+// 
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgement
+//    in the product documentation would be appreciated but is not required.
+// 
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+// 
+// 3. This notice may not be removed or altered from any source distribution.
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __SPARKY_TEXTURE_LOADER_HPP__
+#define __SPARKY_TEXTURE_LOADER_HPP__
+
+/*
+====================
+CPP Includes
+====================
+*/
+#include <vector>						// The decoded images waiting to be uploaded.
+#include <mutex>						// Guards the decoded images between the threads.
+#include <condition_variable>			// Waiting for the outstanding decodes on destruction.
+/*
+====================
+Class Includes
+====================
+*/
+#include <sparky\utils\singleton.hpp>	// The Texture Loader is a singleton object.
+#include <sparky\rendering\ktxfile.hpp>	// Baked files are read into their levels.
+
+namespace sparky
+{
+	/*
+	====================
+	Sparky Forward Declarations
+	====================
+	*/
+	class Texture;
+
+	struct TextureLoaderStats_t
+	{
+		unsigned int pending;		///< The amount of textures being decoded or waiting to be uploaded.
+		unsigned int uploads;		///< The amount of textures uploaded by the last call to upload.
+		unsigned int uploadedBytes;	///< The amount of bytes uploaded by the last call to upload.
+		unsigned int failures;		///< The amount of files that could not be decoded.
+	};
+
+	class TextureLoader final : public Singleton<TextureLoader>
+	{
+		friend class Singleton<TextureLoader>;
+
+	public:
+		/*
+		====================
+		Constant Variables
+		====================
+		*/
+		static const unsigned int DEFAULT_BUDGET = 4 * 1024 * 1024;	///< The default amount of bytes uploaded per frame.
+
+	private:
+		/*
+		====================
+		Structures
+		====================
+		*/
+		struct Image_t
+		{
+			Texture*					pTexture;	///< The texture to upload to, retained until the upload.
+			unsigned int				width;		///< The width of the image in pixels, 0 if decoding failed.
+			unsigned int				height;		///< The height of the image in pixels.
+			std::vector<unsigned char>	texels;		///< Tightly packed RGBA rows, ready to upload.
+			KTXFile						baked;		///< The levels of a baked file, used instead of the texels.
+		};
+
+		/*
+		====================
+		Member Variables
+		====================
+		*/
+		std::vector<Image_t>	m_images;		///< The decoded images, in the order they were finished.
+		unsigned int			m_decoding;		///< The amount of images still being decoded.
+		std::mutex				m_mutex;		///< Guards the decoded images and the decoding count.
+		std::condition_variable	m_condition;	///< Signalled whenever an image finishes decoding.
+		unsigned int			m_budget;		///< The amount of bytes uploaded per frame.
+		TextureLoaderStats_t	m_stats;		///< The statistics of the last upload.
+
+	private:
+		/*
+		====================
+		Private Ctor
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Default constructor of the TextureLoader object.
+		////////////////////////////////////////////////////////////
+		explicit TextureLoader(void);
+
+		/*
+		====================
+		Private Methods
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Decodes the file of a texture.
+		///
+		/// Run on the ThreadManager. The image is converted to RGBA
+		/// and its rows packed without padding, then queued for the
+		/// main thread to upload. KTX files are read as they are.
+		///
+		/// \param pTexture		The texture to decode the file of.
+		///
+		////////////////////////////////////////////////////////////
+		void decode(Texture* pTexture);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Retrieves the amount of bytes an image uploads.
+		///
+		/// \param image	The decoded image.
+		///
+		/// \retval unsigned int	The size of its texels or baked levels.
+		///
+		////////////////////////////////////////////////////////////
+		static unsigned int getSize(const Image_t& image);
+
+	public:
+		/*
+		====================
+		Dtor
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Destructor of the TextureLoader object.
+		///
+		/// Waits for the outstanding decodes, then releases every
+		/// texture that was never uploaded.
+		///
+		////////////////////////////////////////////////////////////
+		~TextureLoader(void);
+
+		/*
+		====================
+		Getters and Setters
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Sets the amount of bytes uploaded per frame.
+		///
+		/// At least one image is uploaded per frame, however large,
+		/// so that every texture eventually finishes.
+		///
+		/// \param budget	The amount of bytes.
+		///
+		////////////////////////////////////////////////////////////
+		void setBudget(const unsigned int budget);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Retrieves the amount of bytes uploaded per frame.
+		///
+		/// \retval unsigned int	The amount of bytes.
+		///
+		////////////////////////////////////////////////////////////
+		unsigned int getBudget(void) const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Retrieves the statistics of the last upload.
+		///
+		/// \retval TextureLoaderStats_t	The statistics of the last upload.
+		///
+		////////////////////////////////////////////////////////////
+		const TextureLoaderStats_t& getStats(void) const;
+
+		/*
+		====================
+		Methods
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Decodes the file of a texture in the background.
+		///
+		/// The texture is retained until its texels are uploaded, and
+		/// keeps whatever it showed before until then.
+		///
+		/// \param pTexture		The texture to load.
+		///
+		////////////////////////////////////////////////////////////
+		void load(Texture* pTexture);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Uploads the decoded images, up to the budget.
+		///
+		/// Called once a frame from the main thread, before rendering.
+		///
+		////////////////////////////////////////////////////////////
+		void upload(void);
+	};
+
+}//namespace sparky
+
+#endif//__SPARKY_TEXTURE_LOADER_HPP__
+
+////////////////////////////////////////////////////////////
+/// \class sparky::TextureLoader
+/// \ingroup rendering
+///
+/// sparky::TextureLoader moves image decoding off the main thread.
+/// Files are decoded by the ThreadManager into packed staging memory,
+/// and the main thread uploads a limited amount of them each frame,
+/// so loading a scene never waits on image files.
+///
+/// Textures queue themselves when they are constructed, and show a
+/// single white placeholder texel until their upload.
+///
+/// Usage example:
+/// \code
+/// // The texture starts decoding straight away.
+/// sparky::Texture* pTexture = new sparky::Texture("assets/grass.png", desc);
+///
+/// // Once a frame, before rendering.
+/// sparky::TextureLoader::getInstance().upload();
+/// \endcode
+///
+////////////////////////////////////////////////////////////
\ No newline at end of file
@@ -36,7 +36,7 @@ CPP Includes
 Class Includes
 ====================
 */
-#include <sparky\utils\string.hpp>	// Used to set the name of the uniform value being read from the shader.	
+#include <sparky\utils\stringid.hpp>		// Used to set the name of the uniform value being read from the shader.
 #include <sparky\math\matrix4.hpp>	// Binding matrices, vector3's and vector4's to uniform values.
 #include <sparky\math\vector2.hpp>	// Binding vector2's to uniform values.
 /*
@@ -65,20 +65,53 @@ namespace sparky
 		*/
 		Program* m_pProgram;	///< The program that the uniforms are added to.
 
-	private:
+	public:
 		/*
 		====================
-		Private Methods
+		Ctor and Dtor
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Uniform object constructor.
+		///
+		/// Uniform needs access to the Program and its shader so it
+		/// can successfully send uniforms to the shader for use.
+		///
+		/// \param pProgram		The program containing the shaders.
+		///
+		////////////////////////////////////////////////////////////
+		explicit Uniform(Program* pProgram);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Default destructor for Uniform object.
+		////////////////////////////////////////////////////////////
+		~Uniform(void) = default;
+
+		/*
+		====================
+		Getters and Setters
 		====================
 		*/
 		////////////////////////////////////////////////////////////
 		/// \brief Gets the location of the Uniform within the shader.
 		///
+		/// The location is read from the Program's table of active
+		/// uniforms, so no OpenGL calls are made. The location can be
+		/// stored and passed to setParameter to skip the lookup.
+		///
 		/// \param name		The name of the uniform variable.
 		///
+		/// \retval GLint	The location of the uniform, or -1 if it is
+		///					not active within the Program.
+		///
 		////////////////////////////////////////////////////////////
-		GLint getLocation(const String& name) const;
+		GLint getLocation(const StringId& name) const;
 
+		/*
+		====================
+		Methods
+		====================
+		*/
 		////////////////////////////////////////////////////////////
 		/// \brief Sets the value of a uniform that contains a single integer value.
 		///
@@ -235,33 +268,6 @@ namespace sparky
 		////////////////////////////////////////////////////////////
 		void setParameter(GLint location, const Matrix4f& matrix) const;
 
-	public:
-		/*
-		====================
-		Ctor and Dtor
-		====================
-		*/
-		////////////////////////////////////////////////////////////
-		/// \brief Uniform object constructor.
-		///
-		/// Uniform needs access to the Program and its shader so it
-		/// can successfully send uniforms to the shader for use.
-		///
-		/// \param pProgram		The program containing the shaders.
-		///
-		////////////////////////////////////////////////////////////
-		explicit Uniform(Program* pProgram);
-
-		////////////////////////////////////////////////////////////
-		/// \brief Default destructor for Uniform object.
-		////////////////////////////////////////////////////////////
-		~Uniform(void) = default;
-
-		/*
-		====================
-		Methods
-		====================
-		*/
 		////////////////////////////////////////////////////////////
 		/// \brief Sends a value ( by name ) to the programs shaders.
 		///
@@ -270,12 +276,12 @@ namespace sparky
 		///
 		////////////////////////////////////////////////////////////
 		template <typename T>
-		void setParameter(const String& name, T&& value) const;
+		void setParameter(const StringId& name, T&& value) const;
 	};
 
 	////////////////////////////////////////////////////////////
 	template <typename T>
-	inline void Uniform::setParameter(const String& name, T&& value) const
+	inline void Uniform::setParameter(const StringId& name, T&& value) const
 	{
 		setParameter(getLocation(name), std::forward<T>(value));
 	}
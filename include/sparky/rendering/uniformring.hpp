@@ -0,0 +1,221 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// 
+// Sparky Engine
+// 2016 - Benjamin Carter (benjamin.mark.carter@hotmail.com)
+// 
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+// 
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+// 
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgement
+//    in the product documentation would be appreciated but is not required.
+// 
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+// 
+// 3. This notice may not be removed or altered from any source distribution.
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __SPARKY_UNIFORM_RING_HPP__
+#define __SPARKY_UNIFORM_RING_HPP__
+
+/*
+====================
+CPP Includes
+====================
+*/
+#include <vector>	// Storage of the ring before it is uploaded.
+
+namespace sparky
+{
+	class UniformRing final
+	{
+	private:
+		/*
+		====================
+		Member Variables
+		====================
+		*/
+		std::vector<unsigned char>	m_data;			///< The contents of the ring, written before being uploaded.
+		unsigned int				m_alignment;	///< Every allocation starts at a multiple of the alignment.
+		unsigned int				m_head;			///< The end of the most recent allocation.
+		unsigned int				m_wrapCount;	///< The amount of times the ring has restarted from the beginning.
+		bool						m_wrapped;		///< True if the most recent allocation restarted from the beginning.
+
+		/*
+		====================
+		Constant Variables
+		====================
+		*/
+		static const unsigned int FRAMES_IN_FLIGHT = 3;	///< The amount of frames of data the ring grows to hold.
+
+	public:
+		/*
+		====================
+		Ctor and Dtor
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Constructs an empty UniformRing object.
+		///
+		/// The ring has no capacity until the first allocation, 
+		/// which grows it to fit.
+		///
+		/// \param alignment	The alignment of every allocation, in bytes.
+		///
+		////////////////////////////////////////////////////////////
+		explicit UniformRing(const unsigned int alignment = 1);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Destruction of the UniformRing object.
+		////////////////////////////////////////////////////////////
+		~UniformRing(void) = default;
+
+		/*
+		====================
+		Getters and Setters
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Retrieves the size of the ring in bytes.
+		///
+		/// \retval unsigned int	The capacity of the ring.
+		///
+		////////////////////////////////////////////////////////////
+		unsigned int getCapacity(void) const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Retrieves the alignment of every allocation.
+		///
+		/// \retval unsigned int	The alignment in bytes.
+		///
+		////////////////////////////////////////////////////////////
+		unsigned int getAlignment(void) const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Sets the alignment of the following allocations.
+		///
+		/// Uniform buffer ranges have to start at a multiple of 
+		/// GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT.
+		///
+		/// \param alignment	The alignment in bytes, must not be 0.
+		///
+		////////////////////////////////////////////////////////////
+		void setAlignment(const unsigned int alignment);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Rounds a size up to the alignment of the ring.
+		///
+		/// The stride is the distance between consecutive elements
+		/// that each have to be bound at an aligned offset.
+		///
+		/// \param size				The size of an element in bytes.
+		///
+		/// \retval unsigned int	The size rounded up to the alignment.
+		///
+		////////////////////////////////////////////////////////////
+		unsigned int getStride(const unsigned int size) const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Retrieves the amount of times the ring has restarted
+		///		   from the beginning, including when it grew.
+		///
+		/// \retval unsigned int	The amount of wraps.
+		///
+		////////////////////////////////////////////////////////////
+		unsigned int getWrapCount(void) const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Checks if the most recent allocation restarted from
+		///		   the beginning of the ring.
+		///
+		/// When it has, the GPU may still be reading the old contents,
+		/// so the buffer the ring is uploaded to should be given new 
+		/// storage before uploading. This is also the case when the 
+		/// ring has grown.
+		///
+		/// \retval bool	True if the ring wrapped.
+		///
+		////////////////////////////////////////////////////////////
+		bool hasWrapped(void) const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Retrieves the contents of the ring from an offset.
+		///
+		/// \param offset		The offset in bytes.
+		///
+		/// \retval void*		The contents at the offset.
+		///
+		////////////////////////////////////////////////////////////
+		const void* getData(const unsigned int offset) const;
+
+		/*
+		====================
+		Methods
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Allocates a contiguous range from the ring.
+		///
+		/// The range starts after the previous allocation, rounded up
+		/// to the alignment. If it does not fit before the end, the 
+		/// ring wraps and the range starts at the beginning. If it 
+		/// does not fit at all, the ring grows to hold a few frames
+		/// of ranges of that size and starts again.
+		///
+		/// \param size				The size of the range in bytes.
+		///
+		/// \retval unsigned int	The offset of the range.
+		///
+		////////////////////////////////////////////////////////////
+		unsigned int allocate(const unsigned int size);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Copies data into an allocated range.
+		///
+		/// \param offset	The offset to write to, in bytes.
+		/// \param pData	The data to copy.
+		/// \param size		The size of the data in bytes.
+		///
+		////////////////////////////////////////////////////////////
+		void write(const unsigned int offset, const void* pData, const unsigned int size);
+	};
+
+}//namespace sparky
+
+#endif//__SPARKY_UNIFORM_RING_HPP__
+
+////////////////////////////////////////////////////////////
+/// \class sparky::UniformRing
+/// \ingroup rendering
+///
+/// sparky::UniformRing hands out aligned ranges of a buffer in a 
+/// circle, so that the data of each frame is written after the data
+/// of the previous frames instead of over it. The ring only manages
+/// memory on the CPU, the contents are uploaded to a UniformBuffer
+/// of the same capacity, which allows it to be used without a context.
+///
+/// Usage example:
+/// \code
+/// sparky::UniformRing ring(sparky::UniformBuffer::getOffsetAlignment());
+///
+/// // Allocate a range for every draw of the frame.
+/// unsigned int stride = ring.getStride(sizeof(sparky::ObjectData_t));
+/// unsigned int offset = ring.allocate(stride * drawCount);
+///
+/// if (ring.hasWrapped())
+/// {
+///		buffer.allocate(ring.getCapacity());
+/// }
+///
+/// ring.write(offset, &object, sizeof(object));
+/// buffer.upload(offset, ring.getData(offset), stride * drawCount);
+/// \endcode
+///
+////////////////////////////////////////////////////////////
@@ -45,6 +45,7 @@ namespace sparky
 		Vector3f position;		///< Position of the Vertex in 3D space.
 		Vector3f normal;		///< The normal of the vertex.
 		Vector2f uv;			///< The texture co-ordinate of the Vertex.
+		float	 layer;			///< The layer of an array texture the Vertex samples, 0 for other textures.
 
 		/*
 		====================
@@ -54,8 +55,8 @@ namespace sparky
 		////////////////////////////////////////////////////////////
 		/// \brief Default construction of a Vertex object.
 		///
-		/// Sets the position, uv and normals values of the Vertex object to 
-		/// default values - [ 0, 0, 0 ], [0, 0, 0], [ 0, 0 ].
+		/// Sets the position, uv, normals and layer values of the Vertex object 
+		/// to default values - [ 0, 0, 0 ], [0, 0, 0], [ 0, 0 ], 0.
 		///
 		////////////////////////////////////////////////////////////
 		explicit Vertex_t(void);
@@ -73,6 +74,20 @@ namespace sparky
 		////////////////////////////////////////////////////////////
 		explicit Vertex_t(const Vector3f& position, const Vector2f& uv);
 
+		////////////////////////////////////////////////////////////
+		/// \brief Constructs a Vertex object with a position, uv and 
+		///		   texture layer.
+		///
+		/// Used by meshes drawn with an array texture, such as the 
+		/// voxels of a Chunk. The normal is set to [ 0, 0, 0 ].
+		///
+		/// \param position		The positon of the Vertex in 3D space.
+		/// \param uv			The texture co-ordinates of the Vertex.
+		/// \param layer		The layer of the array texture.
+		///
+		////////////////////////////////////////////////////////////
+		explicit Vertex_t(const Vector3f& position, const Vector2f& uv, const float layer);
+
 		////////////////////////////////////////////////////////////
 		/// \brief Constructs a Vertex object with a position, normal and uv.
 		///
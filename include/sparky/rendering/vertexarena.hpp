@@ -0,0 +1,277 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// 
+// Sparky Engine
+// 2016 - Benjamin Carter (benjamin.mark.carter@hotmail.com)
+// 
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+// 
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+// 
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgement
+//    in the product documentation would be appreciated but is not required.
+// 
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+// 
+// 3. This notice may not be removed or altered from any source distribution.
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __SPARKY_VERTEX_ARENA_HPP__
+#define __SPARKY_VERTEX_ARENA_HPP__
+
+/*
+====================
+CPP Includes
+====================
+*/
+#include <vector>							// The vertices and indices of the meshes.
+/*
+====================
+Class Includes
+====================
+*/
+#include <sparky\core\rangeallocator.hpp>	// The vertices and indices are sub-allocated from the shared buffers.
+#include <sparky\rendering\vertex.hpp>		// The layout of the vertex buffer.
+/*
+====================
+Additional Includes
+====================
+*/
+#include <GLEW\glew.h>						// OpenGL functionality.
+
+namespace sparky
+{
+	/*
+	====================
+	Sparky Forward Declarations
+	====================
+	*/
+	class IShaderComponent;
+	class Texture;
+	class Transform;
+
+	class VertexArena final
+	{
+	private:
+		/*
+		====================
+		Structures
+		====================
+		*/
+		struct Mesh_t
+		{
+			unsigned int vertices;	///< The handle of the vertices within the vertex allocator.
+			unsigned int indices;	///< The handle of the indices within the index allocator.
+		};
+
+		/*
+		====================
+		Member Variables
+		====================
+		*/
+		GLuint						m_vao;			///< The vertex array object shared by every mesh.
+		GLuint						m_vbo;			///< The vertex buffer shared by every mesh.
+		GLuint						m_ibo;			///< The index buffer shared by every mesh.
+		RangeAllocator				m_vertices;		///< Divides the vertex buffer, in vertices.
+		RangeAllocator				m_indices;		///< Divides the index buffer, in indices.
+		std::vector<Mesh_t>			m_meshes;		///< Every mesh, indexed by its handle.
+		std::vector<unsigned int>	m_freeMeshes;	///< Mesh handles that can be reused.
+		unsigned int				m_rebuildCount;	///< The amount of times the buffers have been rebuilt.
+
+		/*
+		====================
+		Constant Variables
+		====================
+		*/
+		static const unsigned int INITIAL_VERTICES = 1 << 18;	///< The vertex capacity of the first buffers.
+		static const unsigned int INITIAL_INDICES = 3 << 17;	///< The index capacity of the first buffers.
+
+		/*
+		====================
+		Private Methods
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Defragments the allocators and moves the data into 
+		///		   new buffers of at least the given capacities.
+		///
+		/// \param vertices		The minimum vertex capacity.
+		/// \param indices		The minimum index capacity.
+		///
+		////////////////////////////////////////////////////////////
+		void rebuild(const unsigned int vertices, const unsigned int indices);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Creates a buffer and copies the moved ranges of an 
+		///		   old buffer into it.
+		///
+		/// \param buffer		The old buffer, may be 0.
+		/// \param size			The size of the new buffer in bytes.
+		/// \param moves		The ranges to copy, in elements.
+		/// \param elementSize	The size of an element in bytes.
+		///
+		/// \retval GLuint		The new buffer.
+		///
+		////////////////////////////////////////////////////////////
+		static GLuint copyBuffer(const GLuint buffer, const GLsizeiptr size, const std::vector<RangeMove_t>& moves, const GLsizeiptr elementSize);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Calculates the capacity needed for an allocation.
+		///
+		/// \param allocator		The allocator that is to fit the allocation.
+		/// \param size				The size of the allocation.
+		///
+		/// \retval unsigned int	The capacity, doubled until the allocation fits.
+		///
+		////////////////////////////////////////////////////////////
+		static unsigned int getRequiredCapacity(const RangeAllocator& allocator, const unsigned int size);
+
+	public:
+		/*
+		====================
+		Ctor and Dtor
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Default construction of the VertexArena object.
+		///
+		/// No OpenGL objects are created until the first mesh is 
+		/// allocated, so the arena can be constructed without a context.
+		///
+		////////////////////////////////////////////////////////////
+		explicit VertexArena(void);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Destruction of the VertexArena object, deleting the
+		///		   shared buffers.
+		////////////////////////////////////////////////////////////
+		~VertexArena(void);
+
+		/*
+		====================
+		Getters and Setters
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Retrieves the ID of the shared vertex array object.
+		///
+		/// \retval GLuint	The vertex array object, 0 if nothing is allocated.
+		///
+		////////////////////////////////////////////////////////////
+		GLuint getID(void) const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Retrieves the usage and fragmentation of the vertex buffer.
+		///
+		/// \retval RangeStats_t	The statistics, in vertices.
+		///
+		////////////////////////////////////////////////////////////
+		RangeStats_t getVertexStats(void) const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Retrieves the usage and fragmentation of the index buffer.
+		///
+		/// \retval RangeStats_t	The statistics, in indices.
+		///
+		////////////////////////////////////////////////////////////
+		RangeStats_t getIndexStats(void) const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Retrieves the amount of times the buffers have been
+		///		   defragmented or grown.
+		///
+		/// \retval unsigned int	The amount of rebuilds.
+		///
+		////////////////////////////////////////////////////////////
+		unsigned int getRebuildCount(void) const;
+
+		/*
+		====================
+		Methods
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Uploads a mesh into the shared buffers.
+		///
+		/// The indices are relative to the first vertex of the mesh,
+		/// so they do not change when the mesh is moved. When there is
+		/// no free range large enough, the buffers are defragmented 
+		/// and grown if needed. Must be called from the thread that 
+		/// owns the OpenGL context.
+		///
+		/// \param vertices			The vertices of the mesh.
+		/// \param indices			The indices of the mesh.
+		///
+		/// \retval unsigned int	The handle of the mesh, or INVALID_MESH if it is empty.
+		///
+		////////////////////////////////////////////////////////////
+		unsigned int allocate(const std::vector<Vertex_t>& vertices, const std::vector<GLuint>& indices);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Frees the ranges of a mesh for reuse.
+		///
+		/// \param mesh		The handle of the mesh.
+		///
+		////////////////////////////////////////////////////////////
+		void free(const unsigned int mesh);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Records a draw of a mesh into the RenderQueue.
+		///
+		/// Every mesh of the arena shares a vertex array, the draw 
+		/// selects its mesh with a first index and base vertex.
+		///
+		/// \param mesh			The handle of the mesh.
+		/// \param pShader		The shader to draw with.
+		/// \param pTexture		The texture to bind to the first unit, may be null.
+		/// \param transform	The transform of the object being drawn.
+		///
+		////////////////////////////////////////////////////////////
+		void queue(const unsigned int mesh, IShaderComponent* pShader, const Texture* pTexture, const Transform& transform) const;
+
+		/*
+		====================
+		Constant Variables
+		====================
+		*/
+		static const unsigned int INVALID_MESH = RangeAllocator::INVALID_HANDLE;	///< The handle of no mesh.
+	};
+
+}//namespace sparky
+
+#endif//__SPARKY_VERTEX_ARENA_HPP__
+
+////////////////////////////////////////////////////////////
+/// \class sparky::VertexArena
+/// \ingroup rendering
+///
+/// sparky::VertexArena holds many small meshes, such as the meshes
+/// of every Chunk within a World, inside one vertex buffer and one
+/// index buffer. This replaces thousands of small buffers with a 
+/// few large ones, and consecutive draws from the arena no longer
+/// need to switch vertex arrays.
+///
+/// The buffers are divided with a RangeAllocator each, whose 
+/// statistics show how fragmented the buffers have become.
+///
+/// Usage example:
+/// \code
+/// sparky::VertexArena arena;
+///
+/// // Upload a mesh, keeping the handle.
+/// unsigned int mesh = arena.allocate(pMesh->getVertices(), pMesh->getIndices());
+///
+/// // Draw it.
+/// arena.queue(mesh, pShader, pTexture, transform);
+///
+/// // Return its ranges once it is no longer needed.
+/// arena.free(mesh);
+/// \endcode
+///
+////////////////////////////////////////////////////////////
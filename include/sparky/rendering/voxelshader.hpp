@@ -0,0 +1,108 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// 
+// Sparky Engine
+// 2016 - Benjamin Carter (benjamin.mark.carter@hotmail.com)
+// 
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+// 
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+// 
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgement
+//    in the product documentation would be appreciated but is not required.
+// 
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+// 
+// 3. This notice may not be removed or altered from any source distribution.
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __SPARKY_VOXEL_SHADER_HPP__
+#define __SPARKY_VOXEL_SHADER_HPP__
+
+/*
+====================
+Class Includes
+====================
+*/
+#include <sparky\rendering\ishader.hpp>	// VoxelShader is a type of Shader component.
+
+namespace sparky
+{
+	class VoxelShader final : public IShaderComponent
+	{
+	private:
+		/*
+		====================
+		Member Variables
+		====================
+		*/
+		GLint m_texturesLocation;	///< The location of the material array sampler.
+
+	public:
+		/*
+		====================
+		Ctor and Dtor
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Default constructor for the VoxelShader object.
+		///
+		/// Compiles the voxel shaders, which write the same GBuffer
+		/// outputs as the DeferredShader but sample an array texture
+		/// with the layer of each vertex.
+		///
+		////////////////////////////////////////////////////////////
+		explicit VoxelShader(void);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Default destructor of the VoxelShader object.
+		////////////////////////////////////////////////////////////
+		~VoxelShader(void) = default;
+
+		/*
+		====================
+		Methods
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Reads the sampler location and connects the frame
+		///		   and object uniform blocks.
+		////////////////////////////////////////////////////////////
+		void loadUniforms(void) override;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Points the material sampler at the first texture unit.
+		///
+		/// \param transform	The Transform of the currently rendering object.
+		///
+		////////////////////////////////////////////////////////////
+		void update(const Transform& transform) override;
+	};
+
+}//namespace sparky
+
+#endif//__SPARKY_VOXEL_SHADER_HPP__
+
+////////////////////////////////////////////////////////////
+/// \class sparky::VoxelShader
+/// \ingroup rendering
+/// 
+/// sparky::VoxelShader fills the GBuffer for the chunks of a World.
+/// Every voxel type is a layer of the MaterialRegistry's array 
+/// texture, so a Chunk of mixed voxels is a single draw.
+///
+/// Usage example:
+/// \code
+/// sparky::ResourceManager::getInstance().addShader("voxel", new sparky::VoxelShader());
+///
+/// // Chunks are queued with the shader and the material texture.
+/// pWorld->render(sparky::ResourceManager::getInstance().getShader("voxel"));
+/// \endcode
+///
+////////////////////////////////////////////////////////////
\ No newline at end of file
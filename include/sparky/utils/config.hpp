@@ -25,30 +25,37 @@
 #ifndef __SPARKY_CONFIG_FILE_HPP__
 #define __SPARKY_CONFIG_FILE_HPP__
 
-/*
-====================
-CPP Includes
-====================
-*/
-#include <map>						// The values of the configuration file are stored and retrieved from a map.
 /*
 ====================
 Class Includes
 ====================
 */
-#include <sparky\utils\string.hpp>	// Needed for searching for variables within the configuration file.
+#include <sparky\utils\flathashmap.hpp>	// The values of the configuration file are stored and retrieved from a map.
+#include <sparky\utils\string.hpp>		// Values are stored as the text read from the file.
+#include <sparky\utils\stringid.hpp>		// Needed for searching for variables within the configuration file.
 
 namespace sparky
 {
 	class ConfigFile final
 	{
 	private:
+		/*
+		====================
+		Structures
+		====================
+		*/
+		struct ConfigValue_t
+		{
+			StringId datatype;	///< The declared datatype of the variable.
+			String	 value;		///< The value of the variable, as it was written in the file.
+		};
+
 		/*
 		====================
 		Member Variables
 		====================
 		*/
-		std::map<std::pair<String, String>, String> m_values;	///< The mapped values which are read and then stored from the configuration file.
+		FlatHashMap<StringId, ConfigValue_t> m_values;	///< The mapped values which are read and then stored from the configuration file, keyed by variable name.
 
 	private:
 		/*
@@ -68,6 +75,22 @@ namespace sparky
 		////////////////////////////////////////////////////////////
 		void removeComments(String& line);
 
+		////////////////////////////////////////////////////////////
+		/// \brief Retrieves the stored value of a variable.
+		///
+		/// If the variable is not found, or was declared with a
+		/// different datatype, a warning message is presented to 
+		/// the console window.
+		///
+		/// \param variable		The name of the variable within the file.
+		/// \param datatype		The datatype the variable is expected to have.
+		///
+		/// \retval String*		The value of the variable, or a null pointer
+		///						if it could not be found.
+		///
+		////////////////////////////////////////////////////////////
+		const String* getValue(const StringId& variable, const StringId& datatype) const;
+
 	public:
 		////////////////////////////////////////////////////////////
 		/// \brief Default construction of the Config file.
@@ -105,7 +128,7 @@ namespace sparky
 		/// \retval int			The value of the variable.
 		///
 		////////////////////////////////////////////////////////////
-		int getInt(const String& variable) const;
+		int getInt(const StringId& variable) const;
 
 		////////////////////////////////////////////////////////////
 		/// \brief Retrieves an unsigned int variable from the config file.
@@ -120,7 +143,7 @@ namespace sparky
 		/// \retval unsigned int  The value of the variable.
 		///
 		////////////////////////////////////////////////////////////
-		unsigned int getUInt(const String& variable) const;
+		unsigned int getUInt(const StringId& variable) const;
 
 		////////////////////////////////////////////////////////////
 		/// \brief Retrieves an boolean variable from the config file.
@@ -135,7 +158,7 @@ namespace sparky
 		/// \retval bool		The value of the variable.
 		///
 		////////////////////////////////////////////////////////////
-		bool getBoolean(const String& variable) const;
+		bool getBoolean(const StringId& variable) const;
 
 		////////////////////////////////////////////////////////////
 		/// \brief Retrieves a float variable from the config file.
@@ -150,7 +173,7 @@ namespace sparky
 		/// \retval float		The value of the variable.
 		///
 		////////////////////////////////////////////////////////////
-		float getFloat(const String& variable) const;
+		float getFloat(const StringId& variable) const;
 
 		////////////////////////////////////////////////////////////
 		/// \brief Retrieves an double variable from the config file.
@@ -165,7 +188,7 @@ namespace sparky
 		/// \retval double		The value of the variable.
 		///
 		////////////////////////////////////////////////////////////
-		double getDouble(const String& variable) const;
+		double getDouble(const StringId& variable) const;
 
 		////////////////////////////////////////////////////////////
 		/// \brief Retrieves an string variable from the config file.
@@ -180,7 +203,7 @@ namespace sparky
 		/// \retval String		The value of the variable.
 		///
 		////////////////////////////////////////////////////////////
-		String getString(const String& variable) const;
+		String getString(const StringId& variable) const;
 
 		/*
 		====================
@@ -32,9 +32,10 @@ CPP Includes
 */
 #ifdef _WIN32
 #include <Windows.h>	// Window specific functionality. Used to change the colour of console statements.
+#include <conio.h>		// Window specific console input.
 #endif
 #include <iostream>		// Printing messages to the console window.
-#include <conio.h>		// Awaiting keyboard input from user.
+#include <cstdio>		// Awaiting keyboard input from user.
 #include <cstdlib>		// Exiting the application.
 
 namespace sparky
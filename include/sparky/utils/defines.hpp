@@ -25,6 +25,33 @@
 #ifndef __SPARKY_DEFINES_HPP__
 #define __SPARKY_DEFINES_HPP__
 
+#if defined(_DEBUG)
 #define SPARKY_DEBUG 1
+#else
+#define SPARKY_DEBUG 0
+#endif
+
+// VS2013 does not support the C++11 thread_local keyword, only the POD-restricted __declspec(thread).
+#if defined(_MSC_VER) && _MSC_VER < 1900
+#define SPARKY_THREAD_LOCAL __declspec(thread)
+#else
+#define SPARKY_THREAD_LOCAL thread_local
+#endif
+
+// VS2013 supports neither constexpr nor user-defined literals, so these fall back to plain inline functions.
+#if defined(_MSC_VER) && _MSC_VER < 1900
+#define SPARKY_CONSTEXPR inline
+#define SPARKY_HAS_LITERALS 0
+#else
+#define SPARKY_CONSTEXPR constexpr
+#define SPARKY_HAS_LITERALS 1
+#endif
+
+// SSE is part of every x64 target, x86 targets only have it when the compiler is told to use it.
+#if defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1) || defined(__SSE__)
+#define SPARKY_SSE 1
+#else
+#define SPARKY_SSE 0
+#endif
 
 #endif//__SPARKY_DEFINES_HPP__
\ No newline at end of file
@@ -0,0 +1,212 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// 
+// Sparky Engine
+// 2016 - Benjamin Carter (benjamin.mark.carter@hotmail.com)
+// 
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+// 
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+// 
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgement
+//    in the product documentation would be appreciated but is not required.
+// 
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+// 
+// 3. This notice may not be removed or altered from any source distribution.
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __SPARKY_FILE_WATCHER_HPP__
+#define __SPARKY_FILE_WATCHER_HPP__
+
+/*
+====================
+CPP Includes
+====================
+*/
+#include <vector>						// The watched directories and the queued changes.
+#include <thread>						// The directories are watched on a background thread.
+#include <mutex>						// Guards the queued changes between the threads.
+#include <atomic>						// Stops the background thread.
+#include <ctime>						// The modification times of the polled files.
+/*
+====================
+Class Includes
+====================
+*/
+#include <sparky\utils\string.hpp>		// The paths of the changed files.
+#include <sparky\utils\flathashmap.hpp>	// The modification times of the polled files.
+#include <sparky\utils\stringid.hpp>	// Polled files are keyed by the hash of their path.
+
+namespace sparky
+{
+	class FileWatcher final
+	{
+	private:
+		/*
+		====================
+		Member Variables
+		====================
+		*/
+		std::vector<String>		m_directories;	///< The watched directories, each ending in a slash.
+		std::vector<String>		m_changes;		///< The files changed since the last poll, without duplicates.
+		std::mutex				m_mutex;		///< Guards the changes, which are written by the background thread.
+		std::thread				m_thread;		///< Waits for changes to the watched directories.
+		std::atomic<bool>		m_running;		///< Whether the background thread should keep waiting.
+#if __linux__
+		int						m_inotify;		///< The inotify instance that the directories are added to.
+		std::vector<int>		m_watches;		///< The inotify watch of each directory.
+#else
+		FlatHashMap<StringId, std::time_t> m_times;	///< The last modification time of every file, compared on each scan.
+#endif
+
+	private:
+		/*
+		====================
+		Private Methods
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Waits for changes until the watcher is stopped.
+		///
+		/// Run on the background thread. With inotify the thread sleeps
+		/// until a file is written, on other platforms the directories
+		/// are scanned a few times a second.
+		///
+		////////////////////////////////////////////////////////////
+		void run(void);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Queues a changed file for the next poll.
+		///
+		/// \param path		The path of the file.
+		///
+		////////////////////////////////////////////////////////////
+		void addChange(const String& path);
+
+#if !__linux__
+		////////////////////////////////////////////////////////////
+		/// \brief Compares the modification time of every watched file
+		///		   with the previous scan.
+		///
+		/// \param notify	Whether changed files are queued, false for the first scan.
+		///
+		////////////////////////////////////////////////////////////
+		void scan(const bool notify);
+#endif
+
+	public:
+		/*
+		====================
+		Ctor and Dtor
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Default construction of the FileWatcher object.
+		////////////////////////////////////////////////////////////
+		explicit FileWatcher(void);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Destruction of the FileWatcher object.
+		///
+		/// Stops and joins the background thread.
+		///
+		////////////////////////////////////////////////////////////
+		~FileWatcher(void);
+
+		/*
+		====================
+		Getters and Setters
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Retrieves whether the background thread is running.
+		///
+		/// \retval bool	True if the watcher has been started.
+		///
+		////////////////////////////////////////////////////////////
+		bool isRunning(void) const;
+
+		/*
+		====================
+		Methods
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Adds a directory to be watched.
+		///
+		/// Only the files directly within the directory are watched,
+		/// sub-directories have to be added separately. Directories
+		/// must be added before the watcher is started.
+		///
+		/// \param directory	The directory, ending in a slash.
+		///
+		/// \retval bool	True if the directory can be watched.
+		///
+		////////////////////////////////////////////////////////////
+		bool watch(const String& directory);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Starts watching the directories on a background thread.
+		////////////////////////////////////////////////////////////
+		void start(void);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Stops the background thread and waits for it to finish.
+		////////////////////////////////////////////////////////////
+		void stop(void);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Takes the files changed since the last poll.
+		///
+		/// Called from the main thread between frames, so that the
+		/// changes can be applied while nothing is rendering. Each
+		/// file is reported once, however many times it was written.
+		///
+		/// \param changes	The paths of the changed files, the directory followed by the file name.
+		///
+		////////////////////////////////////////////////////////////
+		void poll(std::vector<String>& changes);
+	};
+
+}//namespace sparky
+
+#endif//__SPARKY_FILE_WATCHER_HPP__
+
+////////////////////////////////////////////////////////////
+/// \class sparky::FileWatcher
+/// \ingroup utils
+///
+/// sparky::FileWatcher reports files that are written within a set 
+/// of directories. On Linux it uses inotify, so the background thread
+/// sleeps until a file is closed after writing or moved into place,
+/// which is how most editors save. Elsewhere the modification times 
+/// are polled instead.
+///
+/// Changes are queued by the background thread and taken by the 
+/// main thread, which is where anything using OpenGL has to reload.
+///
+/// Usage example:
+/// \code
+/// sparky::FileWatcher watcher;
+///
+/// watcher.watch("shaders/");
+/// watcher.start();
+///
+/// // Once a frame.
+/// std::vector<sparky::String> changes;
+/// watcher.poll(changes);
+///
+/// for (const auto& file : changes)
+/// {
+///		sparky::ResourceManager::getInstance().reload(file);
+/// }
+/// \endcode
+///
+////////////////////////////////////////////////////////////
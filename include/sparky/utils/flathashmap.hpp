@@ -0,0 +1,277 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// 
+// Sparky Engine
+// 2016 - Benjamin Carter (benjamin.mark.carter@hotmail.com)
+// 
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+// 
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+// 
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgement
+//    in the product documentation would be appreciated but is not required.
+// 
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+// 
+// 3. This notice may not be removed or altered from any source distribution.
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __SPARKY_FLAT_HASH_MAP_HPP__
+#define __SPARKY_FLAT_HASH_MAP_HPP__
+
+/*
+====================
+CPP Includes
+====================
+*/
+#include <functional>	// Default hash function for the keys.
+#include <utility>		// Moving slots when the table grows or entries are erased.
+#include <vector>		// Contiguous storage of the slots.
+
+namespace sparky
+{
+	template <typename Key, typename Value, typename Hash = std::hash<Key>>
+	class FlatHashMap final
+	{
+	private:
+		/*
+		====================
+		Structures
+		====================
+		*/
+		struct Slot_t
+		{
+			Key		key;		///< The key of the entry in the slot.
+			Value	value;		///< The value of the entry in the slot.
+			bool	occupied;	///< If the slot currently holds an entry.
+		};
+
+		/*
+		====================
+		Member Variables
+		====================
+		*/
+		std::vector<Slot_t> m_slots;	///< Open addressed slots, the amount is always zero or a power of two.
+		unsigned int		m_size;		///< The amount of occupied slots.
+		Hash				m_hash;		///< Hashes the keys into slot indices.
+
+		/*
+		====================
+		Constant Variables
+		====================
+		*/
+		static const unsigned int m_sMinimumCapacity = 16;	///< The amount of slots allocated for the first insertion.
+
+	private:
+		/*
+		====================
+		Private Methods
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Retrieves the slot a key would ideally be stored in.
+		///
+		/// \param key		The key to hash.
+		///
+		/// \retval unsigned int	The index of the ideal slot.
+		///
+		////////////////////////////////////////////////////////////
+		unsigned int getHome(const Key& key) const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Finds the slot that is storing a key.
+		///
+		/// Slots are probed linearly from the key's ideal slot until
+		/// either the key or an empty slot is found.
+		///
+		/// \param key		The key to search for.
+		///
+		/// \retval int		The index of the slot, or -1 if the key 
+		///					is not stored.
+		///
+		////////////////////////////////////////////////////////////
+		int findSlot(const Key& key) const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Rebuilds the table with a different amount of slots.
+		///
+		/// \param capacity		The new amount of slots, must be a power of two.
+		///
+		////////////////////////////////////////////////////////////
+		void rehash(const unsigned int capacity);
+
+	public:
+		/*
+		====================
+		Ctor and Dtor
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Constructs an empty FlatHashMap.
+		///
+		/// No memory is allocated until the first insertion.
+		///
+		////////////////////////////////////////////////////////////
+		explicit FlatHashMap(void);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Default destructor of the FlatHashMap object.
+		////////////////////////////////////////////////////////////
+		~FlatHashMap(void) = default;
+
+		/*
+		====================
+		Getters and Setters
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Retrieves the amount of entries in the map.
+		///
+		/// \retval unsigned int	The amount of entries.
+		///
+		////////////////////////////////////////////////////////////
+		unsigned int getSize(void) const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Checks if the map has any entries.
+		///
+		/// \retval true	If the map is empty.
+		/// \retval false	If the map has entries.
+		///
+		////////////////////////////////////////////////////////////
+		bool isEmpty(void) const;
+
+		/*
+		====================
+		Methods
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Finds the value associated with a key.
+		///
+		/// \param key		The key to search for.
+		///
+		/// \retval Value*	The stored value, or a null pointer if the
+		///					key is not in the map.
+		///
+		////////////////////////////////////////////////////////////
+		Value* find(const Key& key);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Finds the value associated with a key.
+		///
+		/// \param key		The key to search for.
+		///
+		/// \retval Value*	The stored value, or a null pointer if the
+		///					key is not in the map.
+		///
+		////////////////////////////////////////////////////////////
+		const Value* find(const Key& key) const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Adds an entry to the map.
+		///
+		/// If the key is already in the map the stored value is kept.
+		///
+		/// \param key		The key of the entry.
+		/// \param value	The value of the entry.
+		///
+		/// \retval true	If the entry was added.
+		/// \retval false	If the key was already in the map.
+		///
+		////////////////////////////////////////////////////////////
+		bool insert(const Key& key, const Value& value);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Removes an entry from the map.
+		///
+		/// The following entries of the probe sequence are shifted 
+		/// back, so no tombstones are left behind to slow down lookups.
+		///
+		/// \param key		The key of the entry to remove.
+		///
+		/// \retval true	If the entry was removed.
+		/// \retval false	If the key was not in the map.
+		///
+		////////////////////////////////////////////////////////////
+		bool erase(const Key& key);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Removes every entry from the map.
+		///
+		/// The slots are kept, so refilling the map does not allocate.
+		///
+		////////////////////////////////////////////////////////////
+		void clear(void);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Allocates enough slots to store an amount of entries.
+		///
+		/// \param count	The amount of entries to make room for.
+		///
+		////////////////////////////////////////////////////////////
+		void reserve(const unsigned int count);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Calls a function for every entry in the map.
+		///
+		/// The entries are visited in slot order, not insertion order.
+		/// The map must not be modified from within the function.
+		///
+		/// \param function		Called with the key and value of each entry.
+		///
+		////////////////////////////////////////////////////////////
+		template <typename Function>
+		void forEach(Function function);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Calls a function for every entry in the map.
+		///
+		/// The entries are visited in slot order, not insertion order.
+		///
+		/// \param function		Called with the key and value of each entry.
+		///
+		////////////////////////////////////////////////////////////
+		template <typename Function>
+		void forEach(Function function) const;
+	};
+
+	#include <sparky\utils\flathashmap.inl>
+
+}//namespace sparky
+
+#endif//__SPARKY_FLAT_HASH_MAP_HPP__
+
+////////////////////////////////////////////////////////////
+/// \class sparky::FlatHashMap
+/// \ingroup utils
+///
+/// sparky::FlatHashMap is an open addressed hash map which
+/// stores its entries in a single contiguous array, so a lookup
+/// is a hash followed by a short linear scan of neighbouring
+/// slots rather than a tree or linked list traversal.
+///
+/// It is intended to be keyed by sparky::StringId, whose hash
+/// is the id itself. Keys and values must be default and copy
+/// constructible.
+///
+/// Usage example:
+/// \code
+/// sparky::FlatHashMap<sparky::StringId, int> map;
+///
+/// map.insert("width", 1280);
+///
+/// // Find returns null if the key is not stored.
+/// if (int* pWidth = map.find("width"))
+/// {
+///		std::cout << *pWidth << std::endl;
+/// }
+/// \endcode
+///
+////////////////////////////////////////////////////////////
@@ -0,0 +1,238 @@
+/*
+====================
+Ctor and Dtor
+====================
+*/
+////////////////////////////////////////////////////////////
+template <typename Key, typename Value, typename Hash>
+FlatHashMap<Key, Value, Hash>::FlatHashMap(void)
+	: m_slots(), m_size(0), m_hash()
+{
+}
+
+/*
+====================
+Private Methods
+====================
+*/
+////////////////////////////////////////////////////////////
+template <typename Key, typename Value, typename Hash>
+unsigned int FlatHashMap<Key, Value, Hash>::getHome(const Key& key) const
+{
+	return static_cast<unsigned int>(m_hash(key)) & static_cast<unsigned int>(m_slots.size() - 1);
+}
+
+////////////////////////////////////////////////////////////
+template <typename Key, typename Value, typename Hash>
+int FlatHashMap<Key, Value, Hash>::findSlot(const Key& key) const
+{
+	if (m_slots.empty())
+	{
+		return -1;
+	}
+
+	const unsigned int mask = static_cast<unsigned int>(m_slots.size() - 1);
+	
+	//the load factor is kept below one, so an empty slot is always reached
+	for (unsigned int i = getHome(key); m_slots[i].occupied; i = (i + 1) & mask)
+	{
+		if (m_slots[i].key == key)
+		{
+			return static_cast<int>(i);
+		}
+	}
+
+	return -1;
+}
+
+////////////////////////////////////////////////////////////
+template <typename Key, typename Value, typename Hash>
+void FlatHashMap<Key, Value, Hash>::rehash(const unsigned int capacity)
+{
+	std::vector<Slot_t> slots(capacity);
+	slots.swap(m_slots);
+
+	const unsigned int mask = capacity - 1;
+
+	for (auto& slot : slots)
+	{
+		if (slot.occupied)
+		{
+			unsigned int i = getHome(slot.key);
+
+			while (m_slots[i].occupied)
+			{
+				i = (i + 1) & mask;
+			}
+
+			m_slots[i].key		= std::move(slot.key);
+			m_slots[i].value	= std::move(slot.value);
+			m_slots[i].occupied = true;
+		}
+	}
+}
+
+/*
+====================
+Getters and Setters
+====================
+*/
+////////////////////////////////////////////////////////////
+template <typename Key, typename Value, typename Hash>
+unsigned int FlatHashMap<Key, Value, Hash>::getSize(void) const
+{
+	return m_size;
+}
+
+////////////////////////////////////////////////////////////
+template <typename Key, typename Value, typename Hash>
+bool FlatHashMap<Key, Value, Hash>::isEmpty(void) const
+{
+	return m_size == 0;
+}
+
+/*
+====================
+Methods
+====================
+*/
+////////////////////////////////////////////////////////////
+template <typename Key, typename Value, typename Hash>
+Value* FlatHashMap<Key, Value, Hash>::find(const Key& key)
+{
+	const int slot = findSlot(key);
+
+	return slot < 0 ? nullptr : &m_slots[slot].value;
+}
+
+////////////////////////////////////////////////////////////
+template <typename Key, typename Value, typename Hash>
+const Value* FlatHashMap<Key, Value, Hash>::find(const Key& key) const
+{
+	const int slot = findSlot(key);
+
+	return slot < 0 ? nullptr : &m_slots[slot].value;
+}
+
+////////////////////////////////////////////////////////////
+template <typename Key, typename Value, typename Hash>
+bool FlatHashMap<Key, Value, Hash>::insert(const Key& key, const Value& value)
+{
+	if (findSlot(key) >= 0)
+	{
+		return false;
+	}
+	//keep the load factor at or below three quarters so probe sequences stay short
+	if ((m_size + 1) * 4 > m_slots.size() * 3)
+	{
+		rehash(m_slots.empty() ? m_sMinimumCapacity : static_cast<unsigned int>(m_slots.size()) * 2);
+	}
+
+	const unsigned int mask = static_cast<unsigned int>(m_slots.size() - 1);
+	unsigned int i = getHome(key);
+
+	while (m_slots[i].occupied)
+	{
+		i = (i + 1) & mask;
+	}
+
+	m_slots[i].key		= key;
+	m_slots[i].value	= value;
+	m_slots[i].occupied = true;
+	m_size++;
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////
+template <typename Key, typename Value, typename Hash>
+bool FlatHashMap<Key, Value, Hash>::erase(const Key& key)
+{
+	const int slot = findSlot(key);
+
+	if (slot < 0)
+	{
+		return false;
+	}
+
+	const unsigned int mask = static_cast<unsigned int>(m_slots.size() - 1);
+	unsigned int hole = static_cast<unsigned int>(slot);
+
+	//shift back any following entries that could not be stored in their ideal slot
+	for (unsigned int i = (hole + 1) & mask; m_slots[i].occupied; i = (i + 1) & mask)
+	{
+		//distances are measured cyclically from the entry's ideal slot
+		const unsigned int home = getHome(m_slots[i].key);
+
+		if (((i - home) & mask) >= ((i - hole) & mask))
+		{
+			m_slots[hole].key	= std::move(m_slots[i].key);
+			m_slots[hole].value = std::move(m_slots[i].value);
+			hole = i;
+		}
+	}
+
+	m_slots[hole].key		= Key();
+	m_slots[hole].value		= Value();
+	m_slots[hole].occupied	= false;
+	m_size--;
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////
+template <typename Key, typename Value, typename Hash>
+void FlatHashMap<Key, Value, Hash>::clear(void)
+{
+	for (auto& slot : m_slots)
+	{
+		slot = Slot_t();
+	}
+
+	m_size = 0;
+}
+
+////////////////////////////////////////////////////////////
+template <typename Key, typename Value, typename Hash>
+void FlatHashMap<Key, Value, Hash>::reserve(const unsigned int count)
+{
+	unsigned int capacity = m_slots.empty() ? m_sMinimumCapacity : static_cast<unsigned int>(m_slots.size());
+
+	while (count * 4 > capacity * 3)
+	{
+		capacity *= 2;
+	}
+
+	if (capacity != m_slots.size())
+	{
+		rehash(capacity);
+	}
+}
+
+////////////////////////////////////////////////////////////
+template <typename Key, typename Value, typename Hash>
+template <typename Function>
+void FlatHashMap<Key, Value, Hash>::forEach(Function function)
+{
+	for (auto& slot : m_slots)
+	{
+		if (slot.occupied)
+		{
+			function(static_cast<const Key&>(slot.key), slot.value);
+		}
+	}
+}
+
+////////////////////////////////////////////////////////////
+template <typename Key, typename Value, typename Hash>
+template <typename Function>
+void FlatHashMap<Key, Value, Hash>::forEach(Function function) const
+{
+	for (const auto& slot : m_slots)
+	{
+		if (slot.occupied)
+		{
+			function(slot.key, slot.value);
+		}
+	}
+}
@@ -34,9 +34,216 @@ Additional Includes
 
 namespace sparky
 {
+	////////////////////////////////////////////////////////////
+	/// \brief The OpenGL entry points used by the engine.
+	///
+	/// Calls are made through this table rather than directly 
+	/// through GLEW, so that the functions can be replaced by
+	/// counting or recording stubs when there is no context, see
+	/// sparky::GLRecorder. Replacement functions must use the 
+	/// GLAPIENTRY convention.
+	///
+	////////////////////////////////////////////////////////////
+	struct GLFunctions_t
+	{
+		PFNGLCREATEPROGRAMPROC		createProgram;		///< glCreateProgram.
+		PFNGLDELETEPROGRAMPROC		deleteProgram;		///< glDeleteProgram.
+		PFNGLATTACHSHADERPROC		attachShader;		///< glAttachShader.
+		PFNGLDETACHSHADERPROC		detachShader;		///< glDetachShader.
+		PFNGLLINKPROGRAMPROC		linkProgram;		///< glLinkProgram.
+		PFNGLUSEPROGRAMPROC			useProgram;			///< glUseProgram.
+		PFNGLGETPROGRAMIVPROC		getProgramiv;		///< glGetProgramiv.
+		PFNGLGETPROGRAMINFOLOGPROC	getProgramInfoLog;	///< glGetProgramInfoLog.
+		PFNGLPROGRAMPARAMETERIPROC	programParameteri;	///< glProgramParameteri, null without ARB_get_program_binary.
+		PFNGLGETPROGRAMBINARYPROC	getProgramBinary;	///< glGetProgramBinary, null without ARB_get_program_binary.
+		PFNGLPROGRAMBINARYPROC		programBinary;		///< glProgramBinary, null without ARB_get_program_binary.
+		PFNGLGETACTIVEUNIFORMPROC	getActiveUniform;	///< glGetActiveUniform.
+		PFNGLGETUNIFORMLOCATIONPROC getUniformLocation;	///< glGetUniformLocation.
+		PFNGLUNIFORM1IPROC			uniform1i;			///< glUniform1i.
+		PFNGLUNIFORM2IPROC			uniform2i;			///< glUniform2i.
+		PFNGLUNIFORM3IPROC			uniform3i;			///< glUniform3i.
+		PFNGLUNIFORM4IPROC			uniform4i;			///< glUniform4i.
+		PFNGLUNIFORM1FPROC			uniform1f;			///< glUniform1f.
+		PFNGLUNIFORM2FPROC			uniform2f;			///< glUniform2f.
+		PFNGLUNIFORM3FPROC			uniform3f;			///< glUniform3f.
+		PFNGLUNIFORM4FPROC			uniform4f;			///< glUniform4f.
+		PFNGLUNIFORMMATRIX4FVPROC	uniformMatrix4fv;	///< glUniformMatrix4fv.
+		PFNGLGETUNIFORMBLOCKINDEXPROC getUniformBlockIndex;	///< glGetUniformBlockIndex.
+		PFNGLUNIFORMBLOCKBINDINGPROC uniformBlockBinding;	///< glUniformBlockBinding.
+		PFNGLBINDVERTEXARRAYPROC	bindVertexArray;	///< glBindVertexArray.
+		PFNGLACTIVETEXTUREPROC		activeTexture;		///< glActiveTexture.
+
+		void (GLAPIENTRY* bindTexture)(GLenum, GLuint);	///< glBindTexture.
+		void (GLAPIENTRY* enable)(GLenum);				///< glEnable.
+		void (GLAPIENTRY* disable)(GLenum);				///< glDisable.
+		void (GLAPIENTRY* depthMask)(GLboolean);		///< glDepthMask.
+
+		PFNGLCREATESHADERPROC		createShader;		///< glCreateShader.
+		PFNGLDELETESHADERPROC		deleteShader;		///< glDeleteShader.
+		PFNGLSHADERSOURCEPROC		shaderSource;		///< glShaderSource.
+		PFNGLCOMPILESHADERPROC		compileShader;		///< glCompileShader.
+		PFNGLGETSHADERIVPROC		getShaderiv;		///< glGetShaderiv.
+		PFNGLGETSHADERINFOLOGPROC	getShaderInfoLog;	///< glGetShaderInfoLog.
+
+		PFNGLGENBUFFERSPROC			genBuffers;			///< glGenBuffers.
+		PFNGLDELETEBUFFERSPROC		deleteBuffers;		///< glDeleteBuffers.
+		PFNGLBINDBUFFERPROC			bindBuffer;			///< glBindBuffer.
+		PFNGLBUFFERDATAPROC			bufferData;			///< glBufferData.
+		PFNGLBUFFERSUBDATAPROC		bufferSubData;		///< glBufferSubData.
+		PFNGLCOPYBUFFERSUBDATAPROC	copyBufferSubData;	///< glCopyBufferSubData.
+		PFNGLBINDBUFFERBASEPROC		bindBufferBase;		///< glBindBufferBase.
+		PFNGLBINDBUFFERRANGEPROC	bindBufferRange;	///< glBindBufferRange.
+		PFNGLTEXBUFFERPROC			texBuffer;			///< glTexBuffer.
+
+		PFNGLGENVERTEXARRAYSPROC	genVertexArrays;	///< glGenVertexArrays.
+		PFNGLDELETEVERTEXARRAYSPROC deleteVertexArrays;	///< glDeleteVertexArrays.
+		PFNGLVERTEXATTRIBPOINTERPROC vertexAttribPointer;	///< glVertexAttribPointer.
+		PFNGLENABLEVERTEXATTRIBARRAYPROC enableVertexAttribArray;	///< glEnableVertexAttribArray.
+		PFNGLDISABLEVERTEXATTRIBARRAYPROC disableVertexAttribArray;	///< glDisableVertexAttribArray.
+
+		void (GLAPIENTRY* genTextures)(GLsizei, GLuint*);			///< glGenTextures.
+		void (GLAPIENTRY* deleteTextures)(GLsizei, const GLuint*);	///< glDeleteTextures.
+		void (GLAPIENTRY* texParameteri)(GLenum, GLenum, GLint);	///< glTexParameteri.
+		void (GLAPIENTRY* texImage2D)(GLenum, GLint, GLint, GLsizei, GLsizei, GLint, GLenum, GLenum, const GLvoid*);	///< glTexImage2D.
+		PFNGLCOMPRESSEDTEXIMAGE2DPROC compressedTexImage2D;	///< glCompressedTexImage2D.
+		PFNGLTEXIMAGE3DPROC			texImage3D;			///< glTexImage3D.
+		PFNGLCOMPRESSEDTEXIMAGE3DPROC compressedTexImage3D;	///< glCompressedTexImage3D.
+		PFNGLGENERATEMIPMAPPROC		generateMipmap;		///< glGenerateMipmap.
+
+		PFNGLGENFRAMEBUFFERSPROC	genFramebuffers;	///< glGenFramebuffers.
+		PFNGLDELETEFRAMEBUFFERSPROC deleteFramebuffers;	///< glDeleteFramebuffers.
+		PFNGLBINDFRAMEBUFFERPROC	bindFramebuffer;	///< glBindFramebuffer.
+		PFNGLFRAMEBUFFERTEXTURE2DPROC framebufferTexture2D;	///< glFramebufferTexture2D.
+		PFNGLCHECKFRAMEBUFFERSTATUSPROC checkFramebufferStatus;	///< glCheckFramebufferStatus.
+		PFNGLGENRENDERBUFFERSPROC	genRenderbuffers;	///< glGenRenderbuffers.
+		PFNGLBINDRENDERBUFFERPROC	bindRenderbuffer;	///< glBindRenderbuffer.
+		PFNGLRENDERBUFFERSTORAGEPROC renderbufferStorage;	///< glRenderbufferStorage.
+		PFNGLFRAMEBUFFERRENDERBUFFERPROC framebufferRenderbuffer;	///< glFramebufferRenderbuffer.
+		PFNGLDRAWBUFFERSPROC		drawBuffers;		///< glDrawBuffers.
+
+		void (GLAPIENTRY* getIntegerv)(GLenum, GLint*);						///< glGetIntegerv.
+		const GLubyte* (GLAPIENTRY* getString)(GLenum);						///< glGetString.
+		void (GLAPIENTRY* clear)(GLbitfield);								///< glClear.
+		void (GLAPIENTRY* clearColor)(GLfloat, GLfloat, GLfloat, GLfloat);	///< glClearColor.
+		void (GLAPIENTRY* scissor)(GLint, GLint, GLsizei, GLsizei);			///< glScissor.
+		void (GLAPIENTRY* blendFunc)(GLenum, GLenum);						///< glBlendFunc.
+		void (GLAPIENTRY* cullFace)(GLenum);								///< glCullFace.
+		void (GLAPIENTRY* polygonMode)(GLenum, GLenum);						///< glPolygonMode.
+		void (GLAPIENTRY* drawElements)(GLenum, GLsizei, GLenum, const GLvoid*);	///< glDrawElements.
+		PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC drawElementsInstancedBaseVertex;	///< glDrawElementsInstancedBaseVertex.
+	};
+
+	struct GLStats_t
+	{
+		unsigned int issuedCalls;	///< The amount of state changes passed on to OpenGL.
+		unsigned int filteredCalls;	///< The amount of state changes dropped because the state was already set.
+	};
+
 	class GLDevice final
 	{
+	private:
+		/*
+		====================
+		Structures
+		====================
+		*/
+		struct TextureUnit_t
+		{
+			GLenum	target;		///< The target the texture was last bound to.
+			GLuint	texture;	///< The texture bound to the unit.
+		};
+
+		struct State_t
+		{
+			static const unsigned int MAX_UNITS = 16;	///< The amount of texture units shadowed.
+
+			GLuint			program;				///< The program in use.
+			GLuint			vao;					///< The bound vertex array object.
+			GLuint			activeUnit;				///< The active texture unit.
+			TextureUnit_t	textures[MAX_UNITS];	///< The texture bound to each unit.
+			bool			blend;					///< Whether GL_BLEND is enabled.
+			bool			depthTest;				///< Whether GL_DEPTH_TEST is enabled.
+			bool			cullFace;				///< Whether GL_CULL_FACE is enabled.
+			bool			depthMask;				///< Whether depth writes are enabled.
+		};
+
+		/*
+		====================
+		Private Methods
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Retrieves the shadowed flag of a capability.
+		///
+		/// \param mode		The capability to look up.
+		///
+		/// \retval bool*	The shadowed flag, or null when the capability
+		///					is not shadowed.
+		///
+		////////////////////////////////////////////////////////////
+		static bool* getFlag(GLenum mode);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Records whether a state change was issued or filtered.
+		///
+		/// \param issue	True if the call is passed on to OpenGL.
+		///
+		/// \retval bool	The value of issue.
+		///
+		////////////////////////////////////////////////////////////
+		static bool count(const bool issue);
+
+		/*
+		====================
+		Static Fields
+		====================
+		*/
+		static GLFunctions_t	m_sFunctions;	///< The OpenGL functions currently in use.
+		static State_t			m_sState;		///< The state OpenGL was last left in.
+		static GLStats_t		m_sStats;		///< The issued and filtered state changes since the last reset.
+
 	public:
+		/*
+		====================
+		Getters and Setters
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Retrieves the table of OpenGL functions in use.
+		///
+		/// The table is filled from GLEW by init, until then every
+		/// entry is a null pointer.
+		///
+		/// \retval GLFunctions_t	The OpenGL function table.
+		///
+		////////////////////////////////////////////////////////////
+		static const GLFunctions_t& getFunctions(void);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Replaces the table of OpenGL functions.
+		///
+		/// This allows the OpenGL calls of Program and Uniform to be
+		/// intercepted, for example to count them without a context.
+		///
+		/// \param functions	The functions to use from now on.
+		///
+		////////////////////////////////////////////////////////////
+		static void setFunctions(const GLFunctions_t& functions);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Retrieves the amount of issued and filtered state
+		///		   changes since the statistics were last reset.
+		///
+		/// \retval GLStats_t	The state change statistics.
+		///
+		////////////////////////////////////////////////////////////
+		static const GLStats_t& getStats(void);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Sets the state change statistics back to zero.
+		////////////////////////////////////////////////////////////
+		static void resetStats(void);
+
 		/*
 		====================
 		Methods
@@ -48,11 +255,94 @@ namespace sparky
 		/// Before any OpenGL functionality can be utilised within the
 		/// application, GLEW has to be initialised so that it can 
 		/// operate. The initlialisation must be called after the 
-		/// context has been created with the sparky::Window.
+		/// context has been created with the sparky::Window. The 
+		/// OpenGL function table is filled from GLEW at the same time.
 		///
 		////////////////////////////////////////////////////////////
 		static void init(void);
 
+		////////////////////////////////////////////////////////////
+		/// \brief Initialise the device without OpenGL.
+		///
+		/// The function table is filled with the stubs of the
+		/// sparky::GLRecorder, which hand out object names and count
+		/// the calls and uploaded bytes instead of rendering. This 
+		/// allows the frame loop to run on machines without a GPU.
+		///
+		////////////////////////////////////////////////////////////
+		static void initHeadless(void);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Forgets the shadowed state, assuming OpenGL is in its
+		///		   default state.
+		///
+		/// This must be called if the state is changed behind the back 
+		/// of GLDevice, otherwise changes may be wrongly filtered.
+		///
+		////////////////////////////////////////////////////////////
+		static void resetState(void);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Uses a program, unless it is already in use.
+		///
+		/// \param program	The ID of the program, 0 for none.
+		///
+		////////////////////////////////////////////////////////////
+		static void useProgram(GLuint program);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Binds a vertex array object, unless it is already bound.
+		///
+		/// \param vao		The ID of the vertex array object, 0 for none.
+		///
+		////////////////////////////////////////////////////////////
+		static void bindVertexArray(GLuint vao);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Binds a texture to a unit, unless it is already bound.
+		///
+		/// The active unit is only changed if the texture has to be 
+		/// bound. Units beyond the shadowed range are always bound.
+		///
+		/// \param target	The target to bind to (i.e GL_TEXTURE_2D).
+		/// \param unit		The texture unit, starting from 0.
+		/// \param texture	The ID of the texture, 0 for none.
+		///
+		////////////////////////////////////////////////////////////
+		static void bindTexture(GLenum target, GLuint unit, GLuint texture);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Enables or disables depth writes, unless they already are.
+		///
+		/// \param enabled	True to write to the depth buffer.
+		///
+		////////////////////////////////////////////////////////////
+		static void setDepthMask(const bool enabled);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Forgets a program that is about to be deleted.
+		///
+		/// \param program	The ID of the program.
+		///
+		////////////////////////////////////////////////////////////
+		static void releaseProgram(GLuint program);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Forgets a vertex array object that is about to be deleted.
+		///
+		/// \param vao		The ID of the vertex array object.
+		///
+		////////////////////////////////////////////////////////////
+		static void releaseVertexArray(GLuint vao);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Forgets a texture that is about to be deleted.
+		///
+		/// \param texture	The ID of the texture.
+		///
+		////////////////////////////////////////////////////////////
+		static void releaseTexture(GLuint texture);
+
 		////////////////////////////////////////////////////////////
 		/// \brief Changes all of the objects within a scene to only render
 		///		   their wireframe.
@@ -61,11 +351,19 @@ namespace sparky
 
 		////////////////////////////////////////////////////////////
 		/// \brief Enables a mode within OpenGL.
+		///
+		/// GL_BLEND, GL_DEPTH_TEST and GL_CULL_FACE are shadowed and 
+		/// only enabled if they are not already.
+		///
 		////////////////////////////////////////////////////////////
 		static void enable(GLenum mode);
 
 		////////////////////////////////////////////////////////////
 		/// \brief Disables a mode within OpenGL.
+		///
+		/// GL_BLEND, GL_DEPTH_TEST and GL_CULL_FACE are shadowed and 
+		/// only disabled if they are not already.
+		///
 		////////////////////////////////////////////////////////////
 		static void disable(GLenum mode);
 	};
@@ -83,4 +381,34 @@ namespace sparky
 /// different flags of OpenGL. It also contains utility methods
 /// for rendering the scene using a wireframe.
 ///
+/// GLDevice shadows the program, vertex array, texture units,
+/// common capabilities and depth mask that OpenGL was last left
+/// in, so binding something that is already bound costs nothing.
+/// As a result nothing has to be unbound after drawing. The cache
+/// is only valid on the thread that owns the context.
+///
+/// The OpenGL functions used for linking programs and setting
+/// uniforms are called through a replaceable table, so that the
+/// rendering code can be exercised without a context:
+///
+/// Usage example:
+/// \code
+/// // Count the uniform location queries made by a program.
+/// static int queries = 0;
+///
+/// GLint GLAPIENTRY countLocation(GLuint, const GLchar*) { ++queries; return 0; }
+///
+/// sparky::GLFunctions_t functions = sparky::GLDevice::getFunctions();
+/// functions.getUniformLocation = countLocation;
+///
+/// sparky::GLDevice::setFunctions(functions);
+///
+/// // Only the first bind reaches OpenGL.
+/// sparky::GLDevice::resetStats();
+/// sparky::GLDevice::bindTexture(GL_TEXTURE_2D, 0, pTexture->getID());
+/// sparky::GLDevice::bindTexture(GL_TEXTURE_2D, 0, pTexture->getID());
+///
+/// sparky::DebugLog::message("Filtered:", sparky::GLDevice::getStats().filteredCalls);
+/// \endcode
+///
 ////////////////////////////////////////////////////////////
\ No newline at end of file
@@ -0,0 +1,119 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// 
+// Sparky Engine
+// 2016 - Benjamin Carter (benjamin.mark.carter@hotmail.com)
+// 
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+// 
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+// 
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgement
+//    in the product documentation would be appreciated but is not required.
+// 
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+// 
+// 3. This notice may not be removed or altered from any source distribution.
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __SPARKY_GLRECORDER_HPP__
+#define __SPARKY_GLRECORDER_HPP__
+
+/*
+====================
+Class Includes
+====================
+*/
+#include <sparky\utils\gldevice.hpp>	// The recorder fills the OpenGL function table of GLDevice.
+
+namespace sparky
+{
+	struct GLRecordStats_t
+	{
+		unsigned int		calls;			///< The amount of OpenGL functions called.
+		unsigned int		buffers;		///< The amount of buffers created.
+		unsigned int		textures;		///< The amount of textures created.
+		unsigned int		vertexArrays;	///< The amount of vertex array objects created.
+		unsigned int		framebuffers;	///< The amount of framebuffers and renderbuffers created.
+		unsigned int		shaders;		///< The amount of shaders created.
+		unsigned int		programs;		///< The amount of programs created.
+		unsigned int		drawCalls;		///< The amount of draw calls issued.
+		unsigned long long	indices;		///< The amount of indices drawn, counted once per instance.
+		unsigned long long	bufferBytes;	///< The bytes of buffer storage allocated.
+		unsigned long long	textureBytes;	///< The bytes of texture and renderbuffer storage allocated.
+		unsigned long long	uploadBytes;	///< The bytes sent from the CPU into buffers and textures.
+	};
+
+	class GLRecorder final
+	{
+	public:
+		/*
+		====================
+		Getters and Setters
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Retrieves the table of recording functions.
+		///
+		/// Object names are handed out from a counter, programs and 
+		/// shaders always compile and link, and every query returns
+		/// a usable default. Nothing is drawn.
+		///
+		/// \retval GLFunctions_t	The recording function table.
+		///
+		////////////////////////////////////////////////////////////
+		static GLFunctions_t getFunctions(void);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Retrieves the calls recorded since the statistics
+		///		   were last reset.
+		///
+		/// Texture sizes are taken from the format and type of the
+		/// data, so they are an estimate of the storage used.
+		///
+		/// \retval GLRecordStats_t	The recorded statistics.
+		///
+		////////////////////////////////////////////////////////////
+		static const GLRecordStats_t& getStats(void);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Sets the recorded statistics back to zero.
+		////////////////////////////////////////////////////////////
+		static void resetStats(void);
+	};
+
+}//namespace sparky
+
+#endif//__SPARKY_GLRECORDER_HPP__
+
+////////////////////////////////////////////////////////////
+/// \class sparky::GLRecorder
+/// \ingroup utils
+///
+/// sparky::GLRecorder is a null OpenGL backend. Its functions are
+/// installed into sparky::GLDevice in place of the real entry 
+/// points, so that the engine can create its buffers, textures and
+/// programs and issue its draws without a context or a GPU. Each
+/// call is counted along with the bytes it allocates or uploads,
+/// which makes frames deterministic to benchmark on build machines.
+///
+/// Usage example:
+/// \code
+/// // Without a context, initialise the device with the recorder.
+/// sparky::GLDevice::initHeadless();
+///
+/// // Run a frame and read back what it would have cost.
+/// sparky::GLRecorder::resetStats();
+/// sparky::GameManager::getInstance().run();
+///
+/// const sparky::GLRecordStats_t& stats = sparky::GLRecorder::getStats();
+/// sparky::DebugLog::message("Draws:", stats.drawCalls, "Uploaded:", stats.uploadBytes);
+/// \endcode
+///
+////////////////////////////////////////////////////////////
@@ -0,0 +1,166 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// 
+// Sparky Engine
+// 2016 - Benjamin Carter (benjamin.mark.carter@hotmail.com)
+// 
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+// 
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+// 
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgement
+//    in the product documentation would be appreciated but is not required.
+// 
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+// 
+// 3. This notice may not be removed or altered from any source distribution.
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __SPARKY_MAPPED_FILE_HPP__
+#define __SPARKY_MAPPED_FILE_HPP__
+
+/*
+====================
+CPP Includes
+====================
+*/
+#include <cstddef>						// The size of the mapped file.
+/*
+====================
+Class Includes
+====================
+*/
+#include <sparky\utils\string.hpp>		// The path of the mapped file.
+
+namespace sparky
+{
+	class MappedFile final
+	{
+	private:
+		/*
+		====================
+		Member Variables
+		====================
+		*/
+		const unsigned char*	m_pData;	///< The first byte of the mapped view, null if nothing is mapped.
+		std::size_t				m_size;		///< The size of the mapped view in bytes.
+#if _WIN32
+		void*					m_file;		///< The handle of the opened file.
+		void*					m_mapping;	///< The handle of the file mapping the view belongs to.
+#endif
+
+	public:
+		/*
+		====================
+		Ctor and Dtor
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Default construction of the MappedFile object.
+		////////////////////////////////////////////////////////////
+		explicit MappedFile(void);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Copy constructor, the mapping is owned by one
+		///		   object only.
+		////////////////////////////////////////////////////////////
+		explicit MappedFile(const MappedFile& other) = delete;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Destruction of the MappedFile object.
+		///
+		/// Unmaps the view if one is still open.
+		///
+		////////////////////////////////////////////////////////////
+		~MappedFile(void);
+
+		/*
+		====================
+		Getters and Setters
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Retrieves whether a file is mapped.
+		///
+		/// \retval bool	True if open has succeeded and close has not been called.
+		///
+		////////////////////////////////////////////////////////////
+		bool isOpen(void) const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Retrieves the contents of the mapped file.
+		///
+		/// The pointer is aligned to a page, and is only valid until
+		/// the file is closed.
+		///
+		/// \retval const unsigned char*	The first byte of the file, null if nothing is mapped.
+		///
+		////////////////////////////////////////////////////////////
+		const unsigned char* getData(void) const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Retrieves the size of the mapped file.
+		///
+		/// \retval std::size_t		The size in bytes.
+		///
+		////////////////////////////////////////////////////////////
+		std::size_t getSize(void) const;
+
+		/*
+		====================
+		Methods
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Maps a file into memory for reading.
+		///
+		/// The pages are read by the operating system when they are
+		/// first touched, so nothing is copied into the process.
+		/// Empty files cannot be mapped. A file that is already
+		/// open is closed first.
+		///
+		/// \param filename		The file to map.
+		///
+		/// \retval bool	True if the file was mapped.
+		///
+		////////////////////////////////////////////////////////////
+		bool open(const String& filename);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Unmaps the view and closes the file.
+		////////////////////////////////////////////////////////////
+		void close(void);
+	};
+
+}//namespace sparky
+
+#endif//__SPARKY_MAPPED_FILE_HPP__
+
+////////////////////////////////////////////////////////////
+/// \class sparky::MappedFile
+/// \ingroup utils
+///
+/// sparky::MappedFile maps a whole file read-only into the
+/// address space of the process, through MapViewOfFile on
+/// Windows and mmap elsewhere. It is used for cached files
+/// that are handed straight to OpenGL, so that loading them
+/// does not need a buffer of their own.
+///
+/// Usage example:
+/// \code
+/// sparky::MappedFile file;
+///
+/// if (file.open("data/cache/model.smesh"))
+/// {
+///		// Read the file through file.getData() and file.getSize().
+///		file.close();
+/// }
+/// \endcode
+///
+////////////////////////////////////////////////////////////
\ No newline at end of file
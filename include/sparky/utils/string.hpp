@@ -30,8 +30,14 @@
 CPP Includes
 ====================
 */
-#include <vector>	// Storage type for each character in the string.
-#include <iostream>	// Printing out the string to the console screen.
+#include <iostream>						// Printing out the string to the console screen.
+#include <atomic>						// Counting the Strings which had to use the heap.
+/*
+====================
+Class Includes
+====================
+*/
+#include <sparky\utils\stringview.hpp>	// Appending, comparing and slicing without copying.
 
 namespace sparky
 {
@@ -64,19 +70,63 @@ namespace sparky
 		Member Variables
 		====================
 		*/
-		std::vector<char> m_data;	///< Raw data of each character within the string.
+		static const unsigned int m_sInlineCapacity = 22;	///< Strings up to this length are stored without allocating.
+
+		struct HeapData_t
+		{
+			char*		 pData;		///< The null terminated characters of a String too long to be stored inline.
+			unsigned int capacity;	///< The amount of characters the heap allocation can hold, excluding the null terminator.
+		};
+
+		union
+		{
+			char	   m_inline[m_sInlineCapacity + 1];	///< The null terminated characters of a short String.
+			HeapData_t m_heap;							///< The characters of a long String.
+		};
+
+		unsigned int m_length;							///< The amount of characters, excluding the null terminator.
+		bool		 m_isHeap;							///< Whether the characters are stored within m_heap.
+
+		static std::atomic<unsigned int> m_sHeapAllocations;	///< The amount of heap allocations made by all Strings.
 
 	private:
 		////////////////////////////////////////////////////////////
-		/// \brief Inserts a null terminator.
+		/// \brief Gets the writable characters of the String.
+		///
+		/// \retval char*	The inline or heap characters.
+		///
+		////////////////////////////////////////////////////////////
+		char* getData(void);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Replaces the characters of the String.
+		///
+		/// \param pData	The characters to copy.
+		/// \param length	The amount of characters to copy.
+		///
+		////////////////////////////////////////////////////////////
+		void assign(const char* pData, const unsigned int length);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Concatenates the remaining arguments of concat.
+		///
+		/// \param target	The String being concatenated onto.
+		/// \param first	The next object to concatenate.
+		///
+		////////////////////////////////////////////////////////////
+		template <typename T>
+		static void concatInto(String& target, const T& first);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Concatenates the remaining arguments of concat.
 		///
-		/// This will insert a null termination character at the end
-		/// of the current String object. Whenever the size or contents
-		/// of the string is manipulated, this method is subsequently
-		/// called to ensure correct termination.
+		/// \param target	The String being concatenated onto.
+		/// \param first	The next object to concatenate.
+		/// \param args		The variadic objects to concatenate.
 		///
 		////////////////////////////////////////////////////////////
-		void nullTerminator(void);
+		template <typename T, typename... Args>
+		static void concatInto(String& target, const T& first, const Args&... args);
 
 	public:
 		/*
@@ -106,11 +156,46 @@ namespace sparky
 		////////////////////////////////////////////////////////////
 		String(const char* pData);
 
+		////////////////////////////////////////////////////////////
+		/// \brief Constructs a String object with a range of characters.
+		///
+		/// \param pData	The first character to copy.
+		/// \param length	The amount of characters to copy.
+		///
+		////////////////////////////////////////////////////////////
+		String(const char* pData, const unsigned int length);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Constructs a String object by copying the characters of a StringView.
+		///
+		/// This is explicit so that copying a view is always visible.
+		///
+		/// \param view		The characters to copy.
+		///
+		////////////////////////////////////////////////////////////
+		explicit String(const StringView& view);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Constructs a String object as a copy of another.
+		///
+		/// \param string	The String to copy.
+		///
+		////////////////////////////////////////////////////////////
+		String(const String& string);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Constructs a String object by taking the characters of another.
+		///
+		/// \param string	The String to move from, left empty.
+		///
+		////////////////////////////////////////////////////////////
+		String(String&& string);
+
 		////////////////////////////////////////////////////////////
 		/// \brief Default destruction of the String object.
 		///
-		/// The String object destructor will clear the current
-		/// character array and de-allocate the memory.
+		/// The String object destructor will de-allocate the memory
+		/// of the characters, if they were not stored inline.
 		///
 		////////////////////////////////////////////////////////////
 		~String(void);
@@ -130,6 +215,26 @@ namespace sparky
 		////////////////////////////////////////////////////////////
 		String& operator=(const char* pStr);
 
+		////////////////////////////////////////////////////////////
+		/// \brief Copies the characters of another String.
+		/// 
+		/// \param string	The String to copy.
+		///
+		/// \retval String&	A reference to this String object.
+		///
+		////////////////////////////////////////////////////////////
+		String& operator=(const String& string);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Takes the characters of another String.
+		/// 
+		/// \param string	The String to move from, left empty.
+		///
+		/// \retval String&	A reference to this String object.
+		///
+		////////////////////////////////////////////////////////////
+		String& operator=(String&& string);
+
 		////////////////////////////////////////////////////////////
 		/// \brief Performs a member-wise concatenation of two Strings.
 		/// 
@@ -329,6 +434,26 @@ namespace sparky
 		////////////////////////////////////////////////////////////
 		const char* getCString(void) const;
 
+		////////////////////////////////////////////////////////////
+		/// \brief Gets the amount of characters the String can hold without allocating.
+		///
+		/// \retval uint	The capacity, excluding the null terminator.
+		///
+		////////////////////////////////////////////////////////////
+		unsigned int getCapacity(void) const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Gets the amount of heap allocations made by all Strings.
+		///
+		/// Short Strings are stored inline, this is used to measure
+		/// how many Strings during startup and each frame were too 
+		/// long to do so.
+		///
+		/// \retval uint	The amount of heap allocations.
+		///
+		////////////////////////////////////////////////////////////
+		static unsigned int getHeapAllocations(void);
+
 		////////////////////////////////////////////////////////////
 		/// \brief Reads a line from a standard I/O file and assigns it to 
 		///        the target String object.
@@ -376,11 +501,20 @@ namespace sparky
 		/// \brief Clears the current String object of all characters.
 		///
 		/// Clearing allows for the re-use of String objects, without
-		/// having to create new instances on the stack or heap.
+		/// having to create new instances on the stack or heap. The 
+		/// capacity of the String is kept.
 		///
 		////////////////////////////////////////////////////////////
 		void clear(void);
 
+		////////////////////////////////////////////////////////////
+		/// \brief Ensures the String can hold an amount of characters without allocating.
+		///
+		/// \param capacity	The amount of characters, excluding the null terminator.
+		///
+		////////////////////////////////////////////////////////////
+		void reserve(const unsigned int capacity);
+
 		////////////////////////////////////////////////////////////
 		/// \brief Identical to the Addition operators. Will append a String
 		///		   onto this String object.
@@ -390,10 +524,11 @@ namespace sparky
 		/// this provides a more clear indication on what is occuring to the
 		/// String object.
 		///
-		/// \param string	The string to be appended
+		/// \param string	The characters to be appended, Strings and 
+		///					"c-style" strings convert implicitly.
 		///
 		////////////////////////////////////////////////////////////
-		void append(const String& string);
+		void append(const StringView& string);
 
 		////////////////////////////////////////////////////////////
 		/// \brief Forces all characters in the String object to become lower-case.
@@ -434,7 +569,7 @@ namespace sparky
 		///					False if not.
 		///
 		////////////////////////////////////////////////////////////
-		bool beginsWith(const String& string) const;
+		bool beginsWith(const StringView& string) const;
 
 		////////////////////////////////////////////////////////////
 		/// \brief Checks to see if the String object ends with a sequence of
@@ -449,7 +584,7 @@ namespace sparky
 		///					False if not.
 		///
 		////////////////////////////////////////////////////////////
-		bool endsWith(const String& string) const;
+		bool endsWith(const StringView& string) const;
 
 		////////////////////////////////////////////////////////////
 		/// \brief Extracts a String from the String object.
@@ -528,9 +663,9 @@ namespace sparky
 	///
 	////////////////////////////////////////////////////////////
 	template <typename T>
-	static String String::concat(const T& first)
+	String String::concat(const T& first)
 	{
-		return String(first);
+		return String(StringView(first));
 	}
 
 	////////////////////////////////////////////////////////////
@@ -539,6 +674,8 @@ namespace sparky
 	/// Concatenation is similar to appending, the String is added
 	/// onto the assigned object, the differences is that infinite
 	/// amounts of string can be concatenated onto the returned object.
+	/// Every object is appended onto a single String, so no temporary
+	/// Strings are created.
 	///
 	/// \param first	The first object to concatenated.
 	/// \param args		The variadic objects to concatenate.
@@ -547,9 +684,27 @@ namespace sparky
 	///
 	////////////////////////////////////////////////////////////
 	template <typename T, typename... Args>
-	static String String::concat(const T& first, const Args&... args)
+	String String::concat(const T& first, const Args&... args)
+	{
+		String result;
+		concatInto(result, first, args...);
+
+		return result;
+	}
+
+	////////////////////////////////////////////////////////////
+	template <typename T>
+	void String::concatInto(String& target, const T& first)
+	{
+		target.append(StringView(first));
+	}
+
+	////////////////////////////////////////////////////////////
+	template <typename T, typename... Args>
+	void String::concatInto(String& target, const T& first, const Args&... args)
 	{
-		return String(first) + concat(args...);
+		target.append(StringView(first));
+		concatInto(target, args...);
 	}
 
 }//namespace sparky
@@ -562,9 +717,12 @@ namespace sparky
 ///
 /// sparky::String is a basic re-implementation of C++ string
 /// class specifically made for easily functionality with
-/// Sparky. A sparky::String is container for a vector of
-/// characters that can be easily manipulated without dynamic
-/// allocation.
+/// Sparky. A sparky::String is container of characters that
+/// can be easily manipulated. Strings of up to 22 characters, 
+/// such as uniform and light names, are stored inline without
+/// dynamic allocation. A String of zeroed memory is a valid
+/// empty String, so descriptions containing Strings may still
+/// be cleared with memset.
 ///
 /// sparky::String contains several methods for simple
 /// manipulation of characters; such as concatenation, easy
@@ -0,0 +1,316 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// 
+// Sparky Engine
+// 2016 - Benjamin Carter (benjamin.mark.carter@hotmail.com)
+// 
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+// 
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+// 
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgement
+//    in the product documentation would be appreciated but is not required.
+// 
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+// 
+// 3. This notice may not be removed or altered from any source distribution.
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __SPARKY_STRING_ID_HPP__
+#define __SPARKY_STRING_ID_HPP__
+
+/*
+====================
+CPP Includes
+====================
+*/
+#include <cstddef>						// Length type of the string literal operator.
+#include <functional>					// Specialising std::hash so ids can key standard containers.
+#include <iostream>						// Printing out the id to the console screen.
+/*
+====================
+Class Includes
+====================
+*/
+#include <sparky\utils\defines.hpp>		// Portable constexpr and the debug flag for the reverse lookup.
+#include <sparky\utils\string.hpp>		// Ids can be created from, and reversed back into, Strings.
+#include <sparky\utils\stringview.hpp>	// Ids are hashed from views so no copies are needed.
+
+namespace sparky
+{
+	/*
+	====================
+	Sparky Forward Declarations
+	====================
+	*/
+	class StringId;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Operator for printing the StringId to the console.
+	///
+	/// In debug builds the original string is printed, otherwise
+	/// only the hash is available.
+	/// 
+	/// \param os		The stream that the id is being streamed into.
+	/// \param id		The id to be streamed into the buffer.
+	/// 
+	/// \retval ostream A reference to the buffer stream.
+	///
+	////////////////////////////////////////////////////////////
+	std::ostream& operator<<(std::ostream& os, const StringId& id);
+
+	class StringId final
+	{
+	private:
+		/*
+		====================
+		Member Variables
+		====================
+		*/
+		unsigned int m_hash;	///< The FNV-1a hash of the string.
+
+	private:
+		/*
+		====================
+		Private Methods
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Records the string behind the id for debug output.
+		///
+		/// Only does any work in debug builds, where it also warns 
+		/// if two different strings collide on the same hash. Each 
+		/// thread remembers the hashes it has registered, so only the
+		/// first use of a string on a thread takes the table's lock.
+		///
+		/// \param view		The string that was hashed.
+		///
+		////////////////////////////////////////////////////////////
+		void registerName(const StringView& view) const;
+
+	public:
+		/*
+		====================
+		Ctor and Dtor
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Constructs the id of an empty string.
+		////////////////////////////////////////////////////////////
+		StringId(void);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Constructs an id from an already computed hash.
+		///
+		/// \param hash		The FNV-1a hash of the string.
+		///
+		////////////////////////////////////////////////////////////
+		SPARKY_CONSTEXPR explicit StringId(const unsigned int hash)
+			: m_hash(hash)
+		{
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Hashes a "c-style" string into an id.
+		///
+		/// \param pStr		The null terminated string to hash.
+		///
+		////////////////////////////////////////////////////////////
+		StringId(const char* pStr);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Hashes a String into an id.
+		///
+		/// \param string	The String to hash.
+		///
+		////////////////////////////////////////////////////////////
+		StringId(const String& string);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Hashes the characters of a view into an id.
+		///
+		/// \param view		The view to hash.
+		///
+		////////////////////////////////////////////////////////////
+		StringId(const StringView& view);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Default destructor of the StringId object.
+		////////////////////////////////////////////////////////////
+		~StringId(void) = default;
+
+		/*
+		====================
+		Operators
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Checks if two ids were hashed from the same string.
+		///
+		/// \param id		The id to compare against.
+		///
+		/// \retval true	If both ids have the same hash.
+		/// \retval false	If the ids have different hashes.
+		///
+		////////////////////////////////////////////////////////////
+		bool operator==(const StringId& id) const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Checks if two ids were hashed from different strings.
+		///
+		/// \param id		The id to compare against.
+		///
+		/// \retval true	If the ids have different hashes.
+		/// \retval false	If both ids have the same hash.
+		///
+		////////////////////////////////////////////////////////////
+		bool operator!=(const StringId& id) const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Orders ids by their hash, for use in ordered containers.
+		///
+		/// \param id		The id to compare against.
+		///
+		/// \retval true	If this hash is less than the other.
+		/// \retval false	If this hash is greater or equal to the other.
+		///
+		////////////////////////////////////////////////////////////
+		bool operator<(const StringId& id) const;
+
+		/*
+		====================
+		Getters and Setters
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Retrieves the hash of the id.
+		///
+		/// \retval unsigned int	The FNV-1a hash.
+		///
+		////////////////////////////////////////////////////////////
+		SPARKY_CONSTEXPR unsigned int getHash(void) const
+		{
+			return m_hash;
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Retrieves the string the id was hashed from.
+		///
+		/// The reverse lookup table is only kept in debug builds, so
+		/// release builds (and ids made from literals or raw hashes
+		/// that were never registered) return the hash as "#hash".
+		///
+		/// \retval String	The original string, or the hash.
+		///
+		////////////////////////////////////////////////////////////
+		String getString(void) const;
+
+		/*
+		====================
+		Methods
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Hashes a range of characters with 32-bit FNV-1a.
+		///
+		/// A plain loop, used for every string hashed at runtime, so
+		/// long strings such as shader sources never recurse.
+		///
+		/// \param pStr		The characters to hash.
+		/// \param length	The amount of characters to hash.
+		/// \param seed		The hash of the preceding characters.
+		///
+		/// \retval unsigned int	The hash of the characters.
+		///
+		////////////////////////////////////////////////////////////
+		static unsigned int hash(const char* pStr, const std::size_t length, const unsigned int seed = 2166136261u);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Hashes a string literal with 32-bit FNV-1a.
+		///
+		/// This is written as a single expression so that compilers 
+		/// with constexpr support can evaluate it at compile time. It
+		/// recurses once per character, so it is only meant for short
+		/// literals, anything else goes through hash.
+		///
+		/// \param pStr		The characters to hash.
+		/// \param length	The amount of characters to hash.
+		/// \param seed		The hash of the preceding characters.
+		///
+		/// \retval unsigned int	The hash of the characters.
+		///
+		////////////////////////////////////////////////////////////
+		static SPARKY_CONSTEXPR unsigned int hashLiteral(const char* pStr, const std::size_t length, const unsigned int seed = 2166136261u)
+		{
+			return length == 0 ? seed : hashLiteral(pStr + 1, length - 1, (seed ^ static_cast<unsigned char>(*pStr)) * 16777619u);
+		}
+	};
+
+#if SPARKY_HAS_LITERALS
+	////////////////////////////////////////////////////////////
+	/// \brief Hashes a string literal into an id at compile time.
+	///
+	/// \param pStr		The string literal.
+	/// \param length	The length of the literal.
+	///
+	/// \retval StringId	The id of the literal.
+	///
+	////////////////////////////////////////////////////////////
+	SPARKY_CONSTEXPR StringId operator"" _id(const char* pStr, std::size_t length)
+	{
+		return StringId(StringId::hashLiteral(pStr, length));
+	}
+#endif
+
+}//namespace sparky
+
+namespace std
+{
+	////////////////////////////////////////////////////////////
+	/// \brief The hash of a StringId is the id itself.
+	////////////////////////////////////////////////////////////
+	template <>
+	struct hash<sparky::StringId>
+	{
+		std::size_t operator()(const sparky::StringId& id) const
+		{
+			return id.getHash();
+		}
+	};
+
+}//namespace std
+
+#endif//__SPARKY_STRING_ID_HPP__
+
+////////////////////////////////////////////////////////////
+/// \class sparky::StringId
+/// \ingroup utils
+///
+/// sparky::StringId is a 32-bit FNV-1a hash of a string, used
+/// in place of Strings as the key of lookups on hot paths. 
+/// Comparing two ids is a single integer comparison and no
+/// memory is allocated when creating one.
+///
+/// In debug builds every hashed string is recorded so that
+/// the id can be printed, and collisions between different
+/// strings are reported as warnings.
+///
+/// Usage example:
+/// \code
+/// // Hash a name once, and reuse the id for every lookup.
+/// sparky::StringId id("u_mvp");
+///
+/// // Ids from the same string are always equal.
+/// if (id == sparky::StringId(sparky::String("u_mvp")))
+/// {
+///		std::cout << id << std::endl;
+/// }
+/// \endcode
+///
+////////////////////////////////////////////////////////////
@@ -0,0 +1,259 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// 
+// Sparky Engine
+// 2016 - Benjamin Carter (benjamin.mark.carter@hotmail.com)
+// 
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+// 
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+// 
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgement
+//    in the product documentation would be appreciated but is not required.
+// 
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+// 
+// 3. This notice may not be removed or altered from any source distribution.
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __SPARKY_STRING_VIEW_HPP__
+#define __SPARKY_STRING_VIEW_HPP__
+
+/*
+====================
+CPP Includes
+====================
+*/
+#include <iostream>	// Printing out the view to the console screen.
+
+namespace sparky
+{
+	/*
+	====================
+	Sparky Forward Declarations
+	====================
+	*/
+	class String;
+	class StringView;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Operator for printing the characters of the StringView to the console.
+	/// 
+	/// \param os		The stream that the view is being streamed into.
+	/// \param view		The view to be streamed into the buffer.
+	/// 
+	/// \retval ostream A reference to the buffer stream.
+	///
+	////////////////////////////////////////////////////////////
+	std::ostream& operator<<(std::ostream& os, const StringView& view);
+
+	class StringView final
+	{
+	private:
+		/*
+		====================
+		Member Variables
+		====================
+		*/
+		const char*  m_pData;	///< The first character of the view, not necessarily null terminated.
+		unsigned int m_length;	///< The amount of characters within the view.
+
+	public:
+		/*
+		====================
+		Ctor and Dtor
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Constructs an empty StringView.
+		////////////////////////////////////////////////////////////
+		StringView(void);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Constructs a StringView of a "c-style" string.
+		///
+		/// \param pData	The null terminated characters to view.
+		///
+		////////////////////////////////////////////////////////////
+		StringView(const char* pData);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Constructs a StringView of a range of characters.
+		///
+		/// \param pData	The first character to view.
+		/// \param length	The amount of characters to view.
+		///
+		////////////////////////////////////////////////////////////
+		StringView(const char* pData, const unsigned int length);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Constructs a StringView of a String.
+		///
+		/// The view is only valid for as long as the String is alive 
+		/// and unmodified.
+		///
+		/// \param string	The String to view.
+		///
+		////////////////////////////////////////////////////////////
+		StringView(const String& string);
+
+		/*
+		====================
+		Operators
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Gets a character within the StringView.
+		///
+		/// \param index	The index.
+		///
+		///	\retval char	A character at the specified index.
+		///
+		////////////////////////////////////////////////////////////
+		char operator[](const unsigned int index) const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Equality operator between two StringViews.
+		///
+		/// \param view		The view to compare against.
+		///
+		/// \retval bool	True if the characters of both views are identical.
+		///
+		////////////////////////////////////////////////////////////
+		bool operator==(const StringView& view) const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Non-equality operator between two StringViews.
+		///
+		/// \param view		The view to compare against.
+		///
+		/// \retval bool	True if the characters of the views differ.
+		///
+		////////////////////////////////////////////////////////////
+		bool operator!=(const StringView& view) const;
+
+		/*
+		====================
+		Getters and Setters
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Gets the characters of the StringView.
+		///
+		/// The characters are not guaranteed to be null terminated.
+		///
+		/// \retval char*	The first character of the view.
+		///
+		////////////////////////////////////////////////////////////
+		const char* getData(void) const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Gets the amount of characters within the StringView.
+		///
+		/// \retval uint	The length of the view.
+		///
+		////////////////////////////////////////////////////////////
+		unsigned int getLength(void) const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Checks whether the StringView has no characters.
+		///
+		/// \retval bool	True if the view is empty.
+		///
+		////////////////////////////////////////////////////////////
+		bool isEmpty(void) const;
+
+		/*
+		====================
+		Methods
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Finds the first occurrence of a character.
+		///
+		/// \param character	The character to search for.
+		/// \param start		The index to start searching from.
+		///
+		/// \retval int		The index of the character, -1 if it was not found.
+		///
+		////////////////////////////////////////////////////////////
+		int find(const char character, const unsigned int start = 0) const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Views a range of the StringView without copying.
+		///
+		/// If the end point is beyond the scope of the view, the end
+		/// point will be the end of the view.
+		///
+		/// \param start	The start point of the range.
+		/// \param end		The end point of the range, exclusive.
+		///
+		/// \retval StringView	The view of the range.
+		///
+		////////////////////////////////////////////////////////////
+		StringView substring(const unsigned int start, const unsigned int end) const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Views the StringView without leading and trailing whitespace.
+		///
+		/// Unlike String::trim, whitespace between other characters 
+		/// is kept, as the view cannot remove characters in-place.
+		///
+		/// \retval StringView	The trimmed view.
+		///
+		////////////////////////////////////////////////////////////
+		StringView trim(void) const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Checks to see if the StringView begins with a sequence of characters.
+		///
+		/// \param view		The characters that the view may begin with.
+		///
+		/// \retval bool	True if the view begins with the characters.
+		///
+		////////////////////////////////////////////////////////////
+		bool beginsWith(const StringView& view) const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Checks to see if the StringView ends with a sequence of characters.
+		///
+		/// \param view		The characters that the view may end with.
+		///
+		/// \retval bool	True if the view ends with the characters.
+		///
+		////////////////////////////////////////////////////////////
+		bool endsWith(const StringView& view) const;
+	};
+
+}//namespace sparky
+
+#endif//__SPARKY_STRING_VIEW_HPP__
+
+////////////////////////////////////////////////////////////
+/// \class sparky::StringView
+/// \ingroup utils
+///
+/// sparky::StringView is a non-owning reference to a range of
+/// characters. It allows parsing code to slice and compare 
+/// Strings without copying them, only converting the slices that
+/// need to be kept into a String.
+///
+/// Usage example:
+/// \code
+/// sparky::String line = "resolution:int = 720";
+///
+/// // Slice the line without copying it.
+/// sparky::StringView view(line);
+/// int colon = view.find(':');
+///
+/// // Only the variable name is copied.
+/// sparky::String variable(view.substring(0, colon).trim());
+/// \endcode
+///
+////////////////////////////////////////////////////////////
@@ -0,0 +1,251 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// 
+// Sparky Engine
+// 2016 - Benjamin Carter (benjamin.mark.carter@hotmail.com)
+// 
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+// 
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+// 
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgement
+//    in the product documentation would be appreciated but is not required.
+// 
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+// 
+// 3. This notice may not be removed or altered from any source distribution.
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __SPARKY_TASK_HPP__
+#define __SPARKY_TASK_HPP__
+
+/*
+====================
+CPP Includes
+====================
+*/
+#include <cstddef>		// Size of the inline buffer.
+#include <new>			// Placement new into the inline buffer.
+#include <utility>		// Moving and forwarding the callable.
+#include <type_traits>	// Deciding whether a callable fits within the inline buffer.
+#include <atomic>		// Counting the tasks which had to use the heap.
+
+namespace sparky
+{
+	class Task
+	{
+	private:
+		enum eTaskOperation
+		{
+			TASK_INVOKE,
+			TASK_MOVE,
+			TASK_DESTROY
+		};
+
+		typedef void (*Manager_t)(eTaskOperation operation, void* pDestination, void* pSource);
+
+		/*
+		====================
+		Constant Variables
+		====================
+		*/
+		static const std::size_t m_sBufferSize = 48;	///< Callables up to this size are stored without allocating.
+
+		/*
+		====================
+		Member Variables
+		====================
+		*/
+		std::aligned_storage<m_sBufferSize>::type m_buffer;		///< Storage for the callable, or a pointer to it if it did not fit.
+		Manager_t								  m_pManager;	///< Invokes, moves and destroys the stored callable, null if empty.
+
+		static std::atomic<unsigned int>		  m_sHeapAllocations;	///< The amount of callables that did not fit within the buffer.
+
+	private:
+		/*
+		====================
+		Private Methods
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Manages a callable stored within the inline buffer.
+		///
+		/// \param operation	The operation to perform on the callable.
+		/// \param pDestination	The buffer to move into, or the buffer to invoke and destroy.
+		/// \param pSource		The buffer to move from.
+		///
+		////////////////////////////////////////////////////////////
+		template <typename F>
+		static void manageInline(eTaskOperation operation, void* pDestination, void* pSource);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Manages a callable that was too large for the inline buffer.
+		///
+		/// \param operation	The operation to perform on the callable.
+		/// \param pDestination	The buffer to move into, or the buffer to invoke and destroy.
+		/// \param pSource		The buffer to move from.
+		///
+		////////////////////////////////////////////////////////////
+		template <typename F>
+		static void manageHeap(eTaskOperation operation, void* pDestination, void* pSource);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Stores a callable that fits within the inline buffer.
+		///
+		/// \param function	The callable to store.
+		///
+		////////////////////////////////////////////////////////////
+		template <typename F>
+		void construct(F&& function, std::true_type);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Stores a callable on the heap as it is too large for the inline buffer.
+		///
+		/// \param function	The callable to store.
+		///
+		////////////////////////////////////////////////////////////
+		template <typename F>
+		void construct(F&& function, std::false_type);
+
+	public:
+		/*
+		====================
+		Ctor and Dtor
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Constructs an empty Task.
+		////////////////////////////////////////////////////////////
+		Task(void);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Constructs a Task from any callable that returns void.
+		///
+		/// This constructor is intentionally implicit so that lambdas
+		/// and the results of std::bind can be passed straight to the
+		/// ThreadPool. Callables which fit within the inline buffer 
+		/// are stored without allocating.
+		///
+		/// \param function	The callable to execute.
+		///
+		////////////////////////////////////////////////////////////
+		template <typename F, typename = typename std::enable_if<!std::is_same<typename std::decay<F>::type, Task>::value>::type>
+		Task(F&& function);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Moves the callable of another Task into this Task.
+		///
+		/// \param other	The Task to move from, left empty.
+		///
+		////////////////////////////////////////////////////////////
+		Task(Task&& other);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Deletes the copy constructor, Tasks are move-only.
+		///
+		/// \param other	The other Task that will not be copied.
+		///
+		////////////////////////////////////////////////////////////
+		Task(const Task& other) = delete;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Destroys the stored callable.
+		////////////////////////////////////////////////////////////
+		~Task(void);
+
+		/*
+		====================
+		Operators
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Moves the callable of another Task into this Task.
+		///
+		/// \param other	The Task to move from, left empty.
+		///
+		/// \retval Task&	This Task.
+		///
+		////////////////////////////////////////////////////////////
+		Task& operator=(Task&& other);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Deletes the copy assignment, Tasks are move-only.
+		///
+		/// \param other	The other Task that will not be copied.
+		///
+		////////////////////////////////////////////////////////////
+		Task& operator=(const Task& other) = delete;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Executes the stored callable.
+		////////////////////////////////////////////////////////////
+		void operator()(void);
+
+		/*
+		====================
+		Getters and Setters
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Checks whether the Task holds a callable.
+		///
+		/// \retval bool	True if there is no callable to execute.
+		///
+		////////////////////////////////////////////////////////////
+		bool isEmpty(void) const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Gets the amount of Tasks which had to allocate.
+		///
+		/// Used to verify that the common tasks, such as meshing a
+		/// Chunk, are enqueued without touching the heap.
+		///
+		/// \retval unsigned int	The amount of heap allocated callables.
+		///
+		////////////////////////////////////////////////////////////
+		static unsigned int getHeapAllocations(void);
+
+		/*
+		====================
+		Methods
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Destroys the stored callable, leaving the Task empty.
+		////////////////////////////////////////////////////////////
+		void reset(void);
+	};
+
+	#include <sparky\utils\task.inl>
+
+}//namespace sparky
+
+#endif//__SPARKY_TASK_HPP__
+
+////////////////////////////////////////////////////////////
+/// \class sparky::Task
+/// \ingroup utils
+///
+/// sparky::Task is a move-only wrapper for a callable that 
+/// returns void. Unlike std::function, it never copies the
+/// callable and stores it within an inline buffer, so typical
+/// closures such as a bound member function are handed to the
+/// ThreadPool without allocating. Larger callables fall back
+/// to the heap and are counted by getHeapAllocations.
+///
+/// Usage example:
+/// \code
+/// // Bind a Chunk to its meshing method.
+/// sparky::Task task(std::bind(&sparky::Chunk::greedy, pChunk));
+///
+/// // Hand the task to the ThreadManager.
+/// sparky::ThreadManager::getInstance().addTask(std::move(task));
+/// \endcode
+///
+////////////////////////////////////////////////////////////
@@ -0,0 +1,84 @@
+/*
+====================
+Private Methods
+====================
+*/
+////////////////////////////////////////////////////////////
+template <typename F>
+void Task::manageInline(eTaskOperation operation, void* pDestination, void* pSource)
+{
+	switch (operation)
+	{
+	case TASK_INVOKE:
+		(*static_cast<F*>(pDestination))();
+		break;
+
+	case TASK_MOVE:
+		new (pDestination) F(std::move(*static_cast<F*>(pSource)));
+		static_cast<F*>(pSource)->~F();
+		break;
+
+	case TASK_DESTROY:
+		static_cast<F*>(pDestination)->~F();
+		break;
+	}
+}
+
+////////////////////////////////////////////////////////////
+template <typename F>
+void Task::manageHeap(eTaskOperation operation, void* pDestination, void* pSource)
+{
+	switch (operation)
+	{
+	case TASK_INVOKE:
+		(**static_cast<F**>(pDestination))();
+		break;
+
+	case TASK_MOVE:
+		*static_cast<F**>(pDestination) = *static_cast<F**>(pSource);
+		break;
+
+	case TASK_DESTROY:
+		delete *static_cast<F**>(pDestination);
+		break;
+	}
+}
+
+////////////////////////////////////////////////////////////
+template <typename F>
+void Task::construct(F&& function, std::true_type)
+{
+	typedef typename std::decay<F>::type Callable;
+
+	new (&m_buffer) Callable(std::forward<F>(function));
+	m_pManager = &Task::manageInline<Callable>;
+}
+
+////////////////////////////////////////////////////////////
+template <typename F>
+void Task::construct(F&& function, std::false_type)
+{
+	typedef typename std::decay<F>::type Callable;
+
+	*reinterpret_cast<Callable**>(&m_buffer) = new Callable(std::forward<F>(function));
+	m_pManager = &Task::manageHeap<Callable>;
+
+	m_sHeapAllocations.fetch_add(1, std::memory_order_relaxed);
+}
+
+/*
+====================
+Ctor and Dtor
+====================
+*/
+////////////////////////////////////////////////////////////
+template <typename F, typename>
+Task::Task(F&& function)
+	: m_buffer(), m_pManager(nullptr)
+{
+	typedef typename std::decay<F>::type Callable;
+	typedef std::integral_constant<bool, sizeof(Callable) <= m_sBufferSize && 
+		std::alignment_of<Callable>::value <= std::alignment_of<std::aligned_storage<m_sBufferSize>::type>::value> Fits;
+
+	this->construct(std::forward<F>(function), Fits());
+}
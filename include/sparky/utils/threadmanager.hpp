@@ -87,10 +87,10 @@ namespace sparky
 		/// allows for completely modular behaviour and tasks to be
 		/// added to the task queue.
 		///
-		/// \param function		The function to execute on the threads.
+		/// \param task		The task to execute on the threads.
 		///
 		////////////////////////////////////////////////////////////
-		void addTask(const std::function<void()>& function);
+		void addTask(Task task);
 	};
 
 }//namespace sparky
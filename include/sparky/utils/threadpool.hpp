@@ -34,8 +34,12 @@ CPP Includes
 #include <thread>				// Used for multi-threading the application.
 #include <mutex>				// Mutually-exclusive. Stops memory from being changed at the same time by locking it.
 #include <condition_variable>	// The amount of threads to use, depending on specific conditions.
-#include <queue>				// STL container for all of the tasks that the threads have to process.
-#include <functional>
+/*
+====================
+Class Includes
+====================
+*/
+#include <sparky\utils\task.hpp>	// The move-only tasks that the threads have to process.
 
 namespace sparky
 {
@@ -48,7 +52,9 @@ namespace sparky
 		====================
 		*/
 		std::vector<std::thread>	      m_workers;	///< The amount of threads that this Pool will utilise.
-		std::queue<std::function<void()>> m_tasks;		///< The tasks to be processed by the individual threads.
+		std::vector<Task>				  m_tasks;		///< Ring buffer of the tasks to be processed by the individual threads.
+		std::size_t						  m_head;		///< The index of the next task to be processed.
+		std::size_t						  m_count;		///< The amount of tasks waiting to be processed.
 
 		std::mutex						  m_mutex;		///< Stops Data race and memory being changed at the same time.
 		std::condition_variable			  m_condition;	///< Controls the flow of threads to be utilised by the Pool, depending on parameters.
@@ -68,6 +74,7 @@ namespace sparky
 		/// When the pool is assigned a task, the pool will locate any threads that are 
 		/// currently in-active and assign it the task. The thread will be notified and run this
 		/// task. When the task is complete, the thread will go back to sleep until used again. 
+		/// Once the pool has stopped, the remaining tasks are finished before returning.
 		///
 		////////////////////////////////////////////////////////////
 		void run(void);
@@ -84,7 +91,8 @@ namespace sparky
 		/// Default constructor of the Thread Pool object instance. The amount of 
 		/// threads that the pool will utilise is set by default to the maximum 
 		/// that the hardware can utilise. The user can specify if they wish 
-		/// to use less threads for the pool.
+		/// to use less threads for the pool. The pool always has at least
+		/// one thread, even when the hardware reports none.
 		/// 
 		/// \param threads	The amount of threads that the pool will utilise.
 		///
@@ -111,14 +119,14 @@ namespace sparky
 		/// 
 		/// Adds a task to the queue of tasks that are to be executed by the 
 		/// threads within the pool. If no threads are currently available,
-		/// it is added to a queue and executed as soon as possible.
+		/// it is added to a queue and executed as soon as possible. The
+		/// task is moved through the pool and is never copied, the queue
+		/// only allocates when it needs to grow.
 		/// 
-		/// \param function		The function that the threads will execute.
-		///
-		/// \retval future		The future result of the added task.
+		/// \param task		The task that the threads will execute.
 		///
 		////////////////////////////////////////////////////////////
-		void addTask(const std::function<void()>& function);
+		void addTask(Task task);
 
 		////////////////////////////////////////////////////////////
 		/// \brief Joins each thread back to the main thread.
@@ -155,7 +163,7 @@ namespace sparky
 /// 
 /// // Add a task using a lambda function.
 /// int number = 5;
-/// pool.addTask([&number](int num) { number = num; });
+/// pool.addTask([&number] { number = 10; });
 ///
 /// // Join the pool to the main thread.
 /// pool.join();
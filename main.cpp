@@ -1,13 +1,20 @@
 #define SDL_MAIN_HANDLED
 #include <SDL2\SDL.h>
 
+#include <cstdlib>
+#include <cstring>
+
 #include <sparky\core\window.hpp>
 #include <sparky\utils\gldevice.hpp>
+#include <sparky\utils\glrecorder.hpp>
+#include <sparky\utils\debug.hpp>
 #include <sparky\utils\config.hpp>
 #include <sparky\rendering\deferredshader.hpp>
-#include <sparky\rendering\ambientshader.hpp>
-#include <sparky\rendering\directionalshader.hpp>
-#include <sparky\rendering\pointshader.hpp>
+#include <sparky\rendering\voxelshader.hpp>
+#include <sparky\rendering\shaderregistry.hpp>
+#include <sparky\rendering\texturebaker.hpp>
+#include <sparky\rendering\model.hpp>
+#include <sparky\rendering\meshrenderer.hpp>
 #include <sparky\core\camera.hpp>
 #include <sparky\core\resourcemanager.hpp>
 #include <sparky\core\gamemanager.hpp>
@@ -19,21 +26,55 @@ using namespace sparky;
 int main(int argc, char** argv)
 {
 	SDL_SetMainReady();
-	SDL_Init(SDL_INIT_VIDEO);
+
+	// "--bake <source> <destination> [bc1|bc3]" compresses an image into a KTX file and exits.
+	if (argc > 3 && std::strcmp(argv[1], "--bake") == 0)
+	{
+		const eBlockFormat format = argc > 4 && std::strcmp(argv[4], "bc1") == 0 ? eBlockFormat::BC1 : eBlockFormat::BC3;
+
+		return TextureBaker::bake(argv[2], argv[3], format) ? 0 : 1;
+	}
+
+	// "--headless <frames>" runs a fixed amount of frames without a display or GPU.
+	const bool headless = argc > 1 && std::strcmp(argv[1], "--headless") == 0;
+	const int frames = argc > 2 ? std::atoi(argv[2]) : 100;
+
+	SDL_Init(headless ? SDL_INIT_EVENTS : SDL_INIT_VIDEO);
 
 	ConfigFile file;
 	file.open("data/config.scfg");
 
 	Window window;
-	window.create(file);
-	window.setMousePosition(Vector2i::zero());
+
+	if (headless)
+	{
+		window.createHeadless(file);
+	}
+	else
+	{
+		window.create(file);
+		window.setMousePosition(Vector2i::zero());
+	}
+
+	// Linked programs are kept between runs, so only the first run compiles them.
+	ShaderRegistry::getInstance().setBinaryCache(file.getString("Shaders.binary_cache"));
+	// Imported models are kept between runs too, so only the first run reads them through Assimp.
+	Model::setCache(file.getString("Models.cache"));
+	// Coarser copies of every model are generated on import and picked by their size on the screen.
+	Model::setLevels(file.getUInt("Models.lod_levels"), file.getFloat("Models.lod_ratio"));
+	MeshRenderer::setLevelScreenSize(file.getFloat("Models.lod_screen_size"));
 
 	GameManager::getInstance().init();
 
-	ResourceManager::getInstance().addShader("deferred",    new DeferredShader());
-	ResourceManager::getInstance().addShader("ambient",     new AmbientShader());
-	ResourceManager::getInstance().addShader("directional", new DirectionalShader());
-	ResourceManager::getInstance().addShader("point",       new PointShader());
+	// The lighting shaders are registered by the GameManager.
+	ResourceManager::getInstance().addShader("deferred", new DeferredShader());
+	ResourceManager::getInstance().addShader("voxel", new VoxelShader());
+
+	const ShaderRegistryStats_t& shaders = ShaderRegistry::getInstance().getStats();
+
+	DebugLog::message("Programs:", shaders.programs, "Shared:", shaders.sharedPrograms, "Files read:", shaders.filesRead);
+	// Run once with an empty binary cache and once with a full one to compare cold and warm starts.
+	DebugLog::message("Shader startup:", shaders.startupMilliseconds, "ms (", shaders.binaryMisses, "compiled,", shaders.binaryHits, "from binaries )");
 
 	Camera camera;
 	camera.create(file);
@@ -41,9 +82,25 @@ int main(int argc, char** argv)
 	camera.getTransform().setPosition(Vector3f(0.0f, 0.0f, -5.0f));
 	GameManager::getInstance().pushScene(new Game());
 
+	int frame = 0;
+
 	while (window.isRunning())
 	{
 		GameManager::getInstance().run();
+
+		if (headless && ++frame >= frames)
+		{
+			window.close();
+		}
+	}
+
+	if (headless)
+	{
+		const GLRecordStats_t& stats = GLRecorder::getStats();
+
+		DebugLog::message("Frames:", frames, "GL calls:", stats.calls, "Draw calls:", stats.drawCalls, "Indices:", stats.indices);
+		DebugLog::message("Buffers:", stats.buffers, "Textures:", stats.textures, "Programs:", stats.programs);
+		DebugLog::message("Buffer bytes:", stats.bufferBytes, "Texture bytes:", stats.textureBytes, "Uploaded bytes:", stats.uploadBytes);
 	}
 
 	SDL_Quit();
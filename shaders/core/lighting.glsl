@@ -52,6 +52,66 @@ struct PointLight
 	float 		range;
 };
 
+// Must match sparky::MAX_POINT_LIGHTS and sparky::MAX_DIRECTIONAL_LIGHTS.
+#define MAX_POINT_LIGHTS 		256
+#define MAX_DIRECTIONAL_LIGHTS 	8
+
+// Written by the sparky::LightRegistry whenever a light changes, see sparky::LightData_t.
+layout (std140) uniform Lights
+{
+	vec4  u_light_position_range[MAX_POINT_LIGHTS];
+	vec4  u_light_colour_intensity[MAX_POINT_LIGHTS];
+	vec4  u_light_attenuation[MAX_POINT_LIGHTS];
+	vec4  u_directional_direction[MAX_DIRECTIONAL_LIGHTS];
+	vec4  u_directional_colour_intensity[MAX_DIRECTIONAL_LIGHTS];
+	uvec4 u_light_counts;	// x is the amount of point lights, y the amount of directional lights.
+};
+
+////////////////////////////////////////////////////////////
+/// \name 	sparky_GetDirectionalLight
+/// \brief 	Unpacks a directional light from the Lights uniform block.
+/// 
+/// \param index			The index of the light within the block.
+/// 
+/// \retval dir_light		The directional light at the index.
+///
+////////////////////////////////////////////////////////////
+DirectionalLight sparky_GetDirectionalLight(uint index)
+{
+	DirectionalLight dir_light;
+	
+	dir_light.base.position  = vec3(0.0);
+	dir_light.base.colour 	 = u_directional_colour_intensity[index].rgb;
+	dir_light.base.intensity = u_directional_colour_intensity[index].a;
+	dir_light.direction 	 = u_directional_direction[index].xyz;
+	
+	return dir_light;
+}
+
+////////////////////////////////////////////////////////////
+/// \name 	sparky_GetPointLight
+/// \brief 	Unpacks a point light from the Lights uniform block.
+/// 
+/// \param index			The index of the light within the block.
+/// 
+/// \retval point_light		The point light at the index.
+///
+////////////////////////////////////////////////////////////
+PointLight sparky_GetPointLight(uint index)
+{
+	PointLight point_light;
+	
+	point_light.base.position 		  = u_light_position_range[index].xyz;
+	point_light.base.colour 		  = u_light_colour_intensity[index].rgb;
+	point_light.base.intensity 		  = u_light_colour_intensity[index].a;
+	point_light.attenuation.constant = u_light_attenuation[index].x;
+	point_light.attenuation.linear   = u_light_attenuation[index].y;
+	point_light.attenuation.exponent = u_light_attenuation[index].z;
+	point_light.range 				  = u_light_position_range[index].w;
+	
+	return point_light;
+}
+
 ////////////////////////////////////////////////////////////
 /// \name 	sparky_CalculateLight
 /// \brief 	Calculates the effect that the parent base light of each light object will have on a particular fragment.
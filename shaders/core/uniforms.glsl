@@ -0,0 +1,46 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// 
+// Sparky Engine
+// 2016 - Benjamin Carter (benjamin.mark.carter@hotmail.com)
+// 
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+// 
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+// 
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgement
+//    in the product documentation would be appreciated but is not required.
+// 
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+// 
+// 3. This notice may not be removed or altered from any source distribution.
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __SPARKY_UNIFORMS_GLSL__
+#define __SPARKY_UNIFORMS_GLSL__
+
+// Written once per frame, see sparky::FrameData_t.
+layout (std140) uniform FrameData
+{
+	mat4 u_view;
+	mat4 u_projection;
+	mat4 u_view_projection;
+	vec4 u_camera_position;
+};
+
+// Must match sparky::MAX_INSTANCES.
+#define MAX_INSTANCES 256
+
+// Written once per instance, see sparky::ObjectData_t.
+layout (std140) uniform ObjectData
+{
+	mat4 u_models[MAX_INSTANCES];
+};
+
+#endif//__SPARKY_UNIFORMS_GLSL__
\ No newline at end of file
@@ -1,5 +1,7 @@
 #version 400
 
+#include "core/uniforms.glsl"
+
 /*
 ====================
 Layouts
@@ -9,14 +11,6 @@ layout (location = 0) in vec3 position;
 layout (location = 1) in vec3 normal;
 layout (location = 2) in vec2 uv;
 
-/*
-====================
-Uniform Variables
-====================
-*/
-uniform mat4 u_mvp;
-uniform mat4 u_model;
-
 /*
 ====================
 Out Variables
@@ -37,9 +31,11 @@ Functions
 */
 void main()
 {
-	vs_out.world_position = (u_model * vec4(position, 1.0)).xyz;
-	vs_out.world_normal   = transpose(inverse(mat3(u_model))) * normal;
+	mat4 model = u_models[gl_InstanceID];
+
+	vs_out.world_position = (model * vec4(position, 1.0)).xyz;
+	vs_out.world_normal   = transpose(inverse(mat3(model))) * normal;
 	vs_out.uv		      = uv;
 		
-	gl_Position = u_mvp * vec4(position, 1.0);
+	gl_Position = u_view_projection * model * vec4(position, 1.0);
 }
\ No newline at end of file
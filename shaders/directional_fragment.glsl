@@ -34,8 +34,6 @@ Uniform Variables
 uniform sampler2D u_normal;
 uniform sampler2D u_diffuse;
 
-uniform DirectionalLight u_light;
-
 /*
 ====================
 In Variables
@@ -64,7 +62,12 @@ void main()
 	vec3 g_normals  = texture(u_normal,   fs_in.uv_coords).rgb;
 	vec3 g_diffuse  = texture(u_diffuse,  fs_in.uv_coords).rgb;
 	
-	vec3 lighting = g_diffuse * sparky_CalculateDirectionalLight(u_light, g_normals).xyz;
+	vec3 lighting = vec3(0.0);
+	
+	for (uint i = 0u; i < u_light_counts.y; i++)
+	{
+		lighting += sparky_CalculateDirectionalLight(sparky_GetDirectionalLight(i), g_normals).xyz;
+	}
 	
-	o_fragColour = vec4(lighting, 1.0);
+	o_fragColour = vec4(g_diffuse * lighting, 1.0);
 }
\ No newline at end of file
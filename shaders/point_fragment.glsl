@@ -24,6 +24,7 @@
 
 #version 400
 
+#include "core/uniforms.glsl"
 #include "core/lighting.glsl"
 
 /*
@@ -31,10 +32,14 @@
 Uniform Variables
 ====================
 */
-uniform sampler2D  u_position;
-uniform sampler2D  u_normal;
-uniform sampler2D  u_diffuse;
-uniform PointLight u_light;
+uniform sampler2D 	   u_position;
+uniform sampler2D 	   u_normal;
+uniform sampler2D 	   u_diffuse;
+uniform usamplerBuffer u_clusters;			// The offset and count of each cluster's lights, see sparky::Cluster_t.
+uniform usamplerBuffer u_light_indices;		// The light index lists of every cluster.
+uniform ivec3		   u_cluster_grid;		// The amount of tiles across and down the screen, and of depth slices.
+uniform vec2		   u_cluster_tile_size;	// The size of a tile in pixels.
+uniform vec2		   u_cluster_slice;		// Turns the logarithm of a view space depth into a slice.
 
 /*
 ====================
@@ -65,7 +70,23 @@ void main()
 	vec3 g_normals  = texture(u_normal,   fs_in.uv_coords).rgb;
 	vec3 g_diffuse  = texture(u_diffuse,  fs_in.uv_coords).rgb;
 	
-	vec3 lighting = g_diffuse * sparky_CalculatePointLight(u_light, g_position, g_normals).xyz;
+	// Find the cluster the fragment falls within, the slices are spaced exponentially along the view depth.
+	float depth = max((u_view * vec4(g_position, 1.0)).z, 0.0001);
+	ivec2 tile  = min(ivec2(gl_FragCoord.xy / u_cluster_tile_size), u_cluster_grid.xy - 1);
+	int   slice = clamp(int(log(depth) * u_cluster_slice.x + u_cluster_slice.y), 0, u_cluster_grid.z - 1);
 	
-	o_fragColour = vec4(lighting, 1.0);
+	int cluster = (slice * u_cluster_grid.y + tile.y) * u_cluster_grid.x + tile.x;
+	
+	// Only the lights that reach the cluster are shaded.
+	uvec2 lights   = texelFetch(u_clusters, cluster).xy;
+	vec3  lighting = vec3(0.0);
+	
+	for (uint i = 0u; i < lights.y; i++)
+	{
+		uint index = texelFetch(u_light_indices, int(lights.x + i)).r;
+		
+		lighting += sparky_CalculatePointLight(sparky_GetPointLight(index), g_position, g_normals).xyz;
+	}
+	
+	o_fragColour = vec4(g_diffuse * lighting, 1.0);
 }
\ No newline at end of file
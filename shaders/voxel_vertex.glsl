@@ -0,0 +1,42 @@
+#version 400
+
+#include "core/uniforms.glsl"
+
+/*
+====================
+Layouts
+====================
+*/
+layout (location = 0) in vec3 position;
+layout (location = 1) in vec3 normal;
+layout (location = 2) in vec2 uv;
+layout (location = 3) in float layer;
+
+/*
+====================
+Out Variables
+====================
+*/
+out VS_OUT
+{
+	vec3 world_position;
+	vec3 world_normal;
+	vec3 uv;
+	
+} vs_out;
+	
+/*
+====================
+Functions
+====================
+*/
+void main()
+{
+	mat4 model = u_models[gl_InstanceID];
+
+	vs_out.world_position = (model * vec4(position, 1.0)).xyz;
+	vs_out.world_normal   = transpose(inverse(mat3(model))) * normal;
+	vs_out.uv		      = vec3(uv, layer);
+		
+	gl_Position = u_view_projection * model * vec4(position, 1.0);
+}
\ No newline at end of file
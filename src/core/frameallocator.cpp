@@ -0,0 +1,121 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// 
+// Sparky Engine
+// 2016 - Benjamin Carter (benjamin.mark.carter@hotmail.com)
+// 
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+// 
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+// 
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgement
+//    in the product documentation would be appreciated but is not required.
+// 
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+// 
+// 3. This notice may not be removed or altered from any source distribution.
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+====================
+Class Includes
+====================
+*/
+#include <sparky\core\frameallocator.hpp>	// Class definition.
+
+namespace sparky
+{
+	/*
+	====================
+	Static Fields
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	SPARKY_THREAD_LOCAL FrameArena_t* FrameAllocator::m_sLocalArena = nullptr;
+
+	/*
+	====================
+	Private Ctor
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	FrameAllocator::FrameAllocator(void)
+		: m_arenas(), m_mutex(), m_frame(0)
+	{
+	}
+
+	/*
+	====================
+	Getters and Setters
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	FrameAllocator& FrameAllocator::getInstance(void)
+	{
+		static FrameAllocator* pInstance = new FrameAllocator();
+		return *pInstance;
+	}
+
+	////////////////////////////////////////////////////////////
+	unsigned int FrameAllocator::getFrame(void) const
+	{
+		return m_frame.load(std::memory_order_acquire);
+	}
+
+	////////////////////////////////////////////////////////////
+	std::size_t FrameAllocator::getLocalUsed(void)
+	{
+		const unsigned int frame = this->getFrame();
+
+		if (!m_sLocalArena || m_sLocalArena->frame != frame)
+		{
+			return 0;
+		}
+
+		return m_sLocalArena->buffers[frame & 1].getUsed();
+	}
+
+	/*
+	====================
+	Methods
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	void* FrameAllocator::allocate(std::size_t size, std::size_t alignment)
+	{
+		if (!m_sLocalArena)
+		{
+			std::unique_ptr<FrameArena_t> pArena(new FrameArena_t());
+			pArena->frame = this->getFrame();
+			m_sLocalArena = pArena.get();
+
+			std::lock_guard<std::mutex> guard(m_mutex);
+			m_arenas.push_back(std::move(pArena));
+		}
+
+		const unsigned int frame = this->getFrame();
+		LinearAllocator& allocator = m_sLocalArena->buffers[frame & 1];
+
+		if (m_sLocalArena->frame != frame)
+		{
+			// This buffer was last used at least two frames ago, so nothing can still reference it.
+			allocator.reset();
+			m_sLocalArena->frame = frame;
+		}
+
+		return allocator.allocate(size, alignment);
+	}
+
+	////////////////////////////////////////////////////////////
+	void FrameAllocator::endFrame(void)
+	{
+		m_frame.fetch_add(1, std::memory_order_release);
+	}
+
+}//namespace sparky
@@ -22,6 +22,13 @@
 //
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
+/*
+====================
+CPP Includes
+====================
+*/
+#include <cmath>								  // Rounding the scissor rectangle out to whole pixels.
+#include <chrono>								  // Timing each hot reload.
 /*
 ====================
 Class Includes
@@ -32,14 +39,23 @@ Class Includes
 #include <sparky\rendering\ambientshader.hpp>	  // Global ambience.
 #include <sparky\rendering\directionalshader.hpp> // The directional shader that renders the directional lights.
 #include <sparky\rendering\pointshader.hpp>		  // The point shader that renders the point lights.
+#include <sparky\lighting\lightregistry.hpp>	  // The packed lights are uploaded once a frame.
+#include <sparky\rendering\shaderregistry.hpp>	  // The programs of the lighting shaders.
+#include <sparky\rendering\textureloader.hpp>	  // Decoded textures are uploaded once a frame.
+#include <sparky\core\resourcemanager.hpp>		  // The lighting shaders are shared with the rest of the engine.
 #include <sparky\rendering\meshdata.hpp>		  // The mesh that the scene rendering is rendered onto.
 #include <sparky\math\frustum.hpp>				  // The frustum needs to be constructed before rendering.
+#include <sparky\rendering\renderqueue.hpp>		  // The draws recorded by the scene are sorted and submitted.
 #include <sparky\core\window.hpp>				  // Window needs to be cleared and swapped.
 #include <sparky\input\eventmanager.hpp>		  // Events need to be polled and handled.
 #include <sparky\core\pool.hpp>					  // Releases un-referenced dynamic objects.
 #include <sparky\utils\gldevice.hpp>			  // Glew initialisation.
 #include <sparky\math\transform.hpp>			  // Making default Transform objects.
 #include <sparky\core\time.hpp>					  // Calculating delta time.
+#include <sparky\core\camera.hpp>				  // The camera matrices of the frame.
+#include <sparky\core\frameallocator.hpp>		  // Frame memory is recycled at the end of the frame.
+#include <sparky\utils\config.hpp>				  // The config is read again when it changes.
+#include <sparky\utils\debug.hpp>				  // Reporting each hot reload.
 
 namespace sparky
 {
@@ -51,13 +67,21 @@ namespace sparky
 	////////////////////////////////////////////////////////////
 	GameManager::GameManager(void)
 		: Singleton<GameManager>(), m_scenes(), m_pAmbient(nullptr), m_pDirectional(nullptr), m_pPoint(nullptr), m_pQuad(nullptr),
-			m_directionalLights(), m_pointLights(), m_buffer()
+			m_buffer(), m_frameData(), m_clusters(), m_clusterData(), m_lightIndices(), m_watcher()
 	{
+		//lights remove themselves from the registry when the scenes are released, so it has to outlive the game manager
+		LightRegistry::getInstance();
+		//the shaders give their programs back when they are released, so the shader registry has to outlive them too
+		ShaderRegistry::getInstance();
+		//textures still decoding are released by the loader, after the scenes that hold them
+		TextureLoader::getInstance();
 	}
 
 	////////////////////////////////////////////////////////////
 	GameManager::~GameManager(void)
 	{
+		m_watcher.stop();
+
 		Ref::release(m_pQuad);
 		Ref::release(m_pAmbient);
 		Ref::release(m_pDirectional);
@@ -69,6 +93,92 @@ namespace sparky
 		}
 	}
 
+	/*
+	====================
+	Private Methods
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	void GameManager::renderPointLights(void)
+	{
+		const LightRegistry& registry = LightRegistry::getInstance();
+		const unsigned int count = registry.getCount(eLightType::POINT);
+
+		if (!count)
+		{
+			return;
+		}
+		//the lights are static, but the clusters follow the camera so they are rebuilt every frame
+		m_clusters.build(Camera::getMain(), registry.getData().positionRange, count);
+		//none of the lights reach the screen, so there is nothing to shade
+		if (!m_clusters.getStats().visibleLights)
+		{
+			return;
+		}
+
+		const std::vector<Cluster_t>& clusters = m_clusters.getClusters();
+		const std::vector<unsigned short>& indices = m_clusters.getIndices();
+
+		m_clusterData.allocate(clusters.size() * sizeof(Cluster_t), clusters.data());
+		m_lightIndices.allocate(indices.size() * sizeof(unsigned short), indices.data());
+
+		m_clusterData.bind(3);
+		m_lightIndices.bind(4);
+
+		m_pPoint->bind();
+		m_pPoint->update(Transform());
+		//pixels outside of every light's projected sphere receive no light, so they are not shaded
+		const Rectf& bounds = m_clusters.getScreenBounds();
+		//the bounds are mapped through the viewport actually rendered to, which need not match the camera's dimensions
+		GLint viewport[4];
+		GLDevice::getFunctions().getIntegerv(GL_VIEWPORT, viewport);
+
+		const GLint left = viewport[0] + static_cast<GLint>(std::floor((bounds.position.x + 1.0f) * 0.5f * viewport[2]));
+		const GLint bottom = viewport[1] + static_cast<GLint>(std::floor((bounds.position.y + 1.0f) * 0.5f * viewport[3]));
+		const GLint right = viewport[0] + static_cast<GLint>(std::ceil((bounds.position.x + bounds.size.x + 1.0f) * 0.5f * viewport[2]));
+		const GLint top = viewport[1] + static_cast<GLint>(std::ceil((bounds.position.y + bounds.size.y + 1.0f) * 0.5f * viewport[3]));
+
+		GLDevice::getFunctions().scissor(left, bottom, right - left, top - bottom);
+		GLDevice::enable(GL_SCISSOR_TEST);
+
+		m_pQuad->render();
+
+		GLDevice::disable(GL_SCISSOR_TEST);
+	}
+
+	////////////////////////////////////////////////////////////
+	void GameManager::reloadChanges(void)
+	{
+		std::vector<String> changes;
+		m_watcher.poll(changes);
+
+		for (const auto& file : changes)
+		{
+			const auto start = std::chrono::high_resolution_clock::now();
+			bool reloaded = false;
+
+			if (file.endsWith(".scfg"))
+			{
+				ConfigFile config;
+				reloaded = config.open(file);
+				//only the camera settings can change without recreating the window and context
+				if (reloaded)
+				{
+					Camera::getMain().create(config);
+				}
+			}
+			else
+			{
+				reloaded = ResourceManager::getInstance().reload(file);
+			}
+
+			if (reloaded)
+			{
+				DebugLog::message("Reloaded", file, "in", std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count(), "ms");
+			}
+		}
+	}
+
 	/*
 	====================
 	Methods
@@ -77,7 +187,15 @@ namespace sparky
 	////////////////////////////////////////////////////////////
 	void GameManager::init(void)
 	{
-		GLDevice::init();
+		//without a context the calls are recorded rather than rendered
+		if (Window::getMain().isHeadless())
+		{
+			GLDevice::initHeadless();
+		}
+		else
+		{
+			GLDevice::init();
+		}
 
 		m_pAmbient = new AmbientShader();
 		m_pAmbient->addRef();
@@ -87,6 +205,10 @@ namespace sparky
 
 		m_pPoint = new PointShader();
 		m_pPoint->addRef();
+		//registered here rather than constructed again by the application
+		ResourceManager::getInstance().addShader("ambient", m_pAmbient);
+		ResourceManager::getInstance().addShader("directional", m_pDirectional);
+		ResourceManager::getInstance().addShader("point", m_pPoint);
 
 		m_pQuad = new MeshData();
 		m_pQuad->addRef();
@@ -96,22 +218,28 @@ namespace sparky
 
 		m_buffer.generate();
 
-		glCullFace(GL_BACK);
+		m_frameData.generate();
+		m_frameData.allocate(sizeof(FrameData_t));
+		m_frameData.bindBase(UNIFORM_BINDING_FRAME);
 
-		GLDevice::enable(GL_DEPTH_TEST);
-		GLDevice::enable(GL_DEPTH_CLAMP);
-	}
+		m_clusterData.generate(GL_RG32UI);
+		m_lightIndices.generate(GL_R16UI);
 
-	////////////////////////////////////////////////////////////
-	void GameManager::addLight(DirectionalLight* pLight)
-	{
-		m_directionalLights.push_back(pLight);
-	}
+		m_pPoint->setClusters(&m_clusters);
 
-	////////////////////////////////////////////////////////////
-	void GameManager::addLight(PointLight* pLight)
-	{
-		m_pointLights.push_back(pLight);
+		GLDevice::getFunctions().cullFace(GL_BACK);
+
+		GLDevice::enable(GL_DEPTH_TEST);
+		GLDevice::enable(GL_DEPTH_CLAMP);
+		//a headless run has nothing to look at, so there is nothing to iterate on
+		if (!Window::getMain().isHeadless())
+		{
+			m_watcher.watch("shaders/");
+			m_watcher.watch("shaders/core/");
+			m_watcher.watch("assets/");
+			m_watcher.watch("data/");
+			m_watcher.start();
+		}
 	}
 
 	////////////////////////////////////////////////////////////
@@ -137,10 +265,26 @@ namespace sparky
 	{
 		Time::start();
 
+		reloadChanges();
+		//decoded textures replace their placeholders, as many as fit in the budget of the frame
+		TextureLoader::getInstance().upload();
+
 		if (!m_scenes.empty())
 		{
 			Frustum::construct();
-			glDepthMask(GL_TRUE);
+			GLDevice::resetStats();
+			GLDevice::setDepthMask(true);
+
+			Camera& camera = Camera::getMain();
+			//the projection is rebuilt from the field-of-view, so it is only done once a frame rather than for every draw
+			FrameData_t frame;
+			frame.view = camera.getView();
+			frame.projection = camera.getProjection();
+			frame.viewProjection = frame.view * frame.projection;
+			const Vector3f position = camera.getTransform().getPosition();
+			frame.cameraPosition = Vector4f(position.x, position.y, position.z, 1.0f);
+
+			m_frameData.allocate(sizeof(FrameData_t), &frame);
 
 			Scene* pScene = m_scenes.back();
 
@@ -148,64 +292,47 @@ namespace sparky
 			Window::getMain().clear();
 
 			pScene->render();
+			RenderQueue::getInstance().submit();
 
 			m_buffer.unbind();
 
 			pScene->update();
+			//only the lights that changed during the update are packed and uploaded
+			LightRegistry::getInstance().upload();
 
 			Window::getMain().clear();
 
 			m_buffer.bindTextures();
 
 			GLDevice::enable(GL_BLEND);
-			glBlendFunc(GL_ONE, GL_ONE);
-			glDepthMask(GL_FALSE);
+			GLDevice::getFunctions().blendFunc(GL_ONE, GL_ONE);
+			GLDevice::setDepthMask(false);
 
 			m_pAmbient->bind();
 			m_pAmbient->update(Transform());
 
 			m_pQuad->render();
 
-			m_pAmbient->unbind();
-
-			m_pDirectional->bind();
-
-			for (const auto& light : m_directionalLights)
+			if (LightRegistry::getInstance().getCount(eLightType::DIRECTIONAL))
 			{
-				m_pDirectional->setActiveLight(light);
+				m_pDirectional->bind();
 				m_pDirectional->update(Transform());
 
 				m_pQuad->render();
 			}
 
-			m_pDirectional->unbind();
-
-			m_pPoint->bind();
-
-			for (const auto& light : m_pointLights)
-			{
-				m_pPoint->setActiveLight(light);
-				m_pPoint->update(Transform());
-
-				m_pQuad->render();
-			}
-
-			m_pPoint->unbind();
-
-			m_buffer.unbindTextures();
+			renderPointLights();
 
-			glDepthMask(GL_FALSE);
 			GLDevice::disable(GL_BLEND);
 
 			Window::getMain().swap();
 
 			EventManager::getInstance().poll();
 			PoolManager::getInstance().flush();
-
-			m_directionalLights.clear();
-			m_pointLights.clear();
 		}
 
+		FrameAllocator::getInstance().endFrame();
+
 		Time::stop();
 	}
 
@@ -29,7 +29,6 @@ Class Includes
 */
 #include <sparky\core\gameobject.hpp>	// Class definition.
 #include <sparky\rendering\irender.hpp>	// The renderable component need to render.
-#include <sparky\rendering\ishader.hpp>	// The shader will need to be updated with the GameObject transform.
 
 namespace sparky
 {
@@ -100,11 +99,9 @@ namespace sparky
 	////////////////////////////////////////////////////////////
 	void GameObject::render(IShaderComponent* pShader)
 	{
-		pShader->update(m_transform);
-
 		for (const auto& renderable : m_renderables)
 		{
-			renderable->render();
+			renderable->render(pShader, m_transform);
 		}
 	}
 
@@ -0,0 +1,137 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// 
+// Sparky Engine
+// 2016 - Benjamin Carter (benjamin.mark.carter@hotmail.com)
+// 
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+// 
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+// 
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgement
+//    in the product documentation would be appreciated but is not required.
+// 
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+// 
+// 3. This notice may not be removed or altered from any source distribution.
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+====================
+CPP Includes
+====================
+*/
+#include <new>								// Allocating the block from the heap.
+/*
+====================
+Class Includes
+====================
+*/
+#include <sparky\core\linearallocator.hpp>	// Class definition.
+
+namespace sparky
+{
+	/*
+	====================
+	Ctor and Dtor
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	LinearAllocator::LinearAllocator(void)
+		: m_pBlock(nullptr), m_capacity(0), m_offset(0), m_requested(0), m_overflow()
+	{
+	}
+
+	////////////////////////////////////////////////////////////
+	LinearAllocator::LinearAllocator(std::size_t capacity)
+		: m_pBlock(static_cast<char*>(::operator new(capacity))), m_capacity(capacity), m_offset(0), m_requested(0), m_overflow()
+	{
+	}
+
+	////////////////////////////////////////////////////////////
+	LinearAllocator::~LinearAllocator(void)
+	{
+		for (auto pBlock : m_overflow)
+		{
+			::operator delete(pBlock);
+		}
+
+		::operator delete(m_pBlock);
+	}
+
+	/*
+	====================
+	Getters and Setters
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	std::size_t LinearAllocator::getCapacity(void) const
+	{
+		return m_capacity;
+	}
+
+	////////////////////////////////////////////////////////////
+	std::size_t LinearAllocator::getUsed(void) const
+	{
+		return m_requested;
+	}
+
+	/*
+	====================
+	Methods
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	void* LinearAllocator::allocate(std::size_t size, std::size_t alignment)
+	{
+		const std::size_t offset = (m_offset + alignment - 1) & ~(alignment - 1);
+		m_requested += size + alignment - 1;
+
+		if (m_pBlock && offset + size <= m_capacity)
+		{
+			m_offset = offset + size;
+			return m_pBlock + offset;
+		}
+
+		char* pBlock = static_cast<char*>(::operator new(size + alignment - 1));
+		m_overflow.push_back(pBlock);
+
+		return reinterpret_cast<void*>((reinterpret_cast<std::size_t>(pBlock) + alignment - 1) & ~(alignment - 1));
+	}
+
+	////////////////////////////////////////////////////////////
+	void LinearAllocator::reset(void)
+	{
+		if (!m_overflow.empty())
+		{
+			for (auto pBlock : m_overflow)
+			{
+				::operator delete(pBlock);
+			}
+
+			m_overflow.clear();
+
+			// Grow the block to fit the previous workload, so the next one is served without the heap.
+			std::size_t capacity = (m_capacity > 0) ? m_capacity : 4096;
+
+			while (capacity < m_requested)
+			{
+				capacity *= 2;
+			}
+
+			::operator delete(m_pBlock);
+			m_pBlock = static_cast<char*>(::operator new(capacity));
+			m_capacity = capacity;
+		}
+
+		m_offset = 0;
+		m_requested = 0;
+	}
+
+}//namespace sparky
@@ -3,7 +3,7 @@
 CPP Includes
 ====================
 */
-#include <algorithm>				// Finding objects within a vector without a for-loop.
+#include <chrono>					// Timing each flush of the pool.
 /*
 ====================
 Class Includes
@@ -11,9 +11,18 @@ Class Includes
 */
 #include <sparky\core\pool.hpp>		// Class definition.
 #include <sparky\core\ref.hpp>		// Objects need to be released upon flushing the current pool.
+#include <sparky\core\frameallocator.hpp>	// The pools to flush are gathered without the heap.
 
 namespace sparky
 {
+	/*
+	====================
+	Static Fields
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	SPARKY_THREAD_LOCAL AutoreleasePool_t* PoolManager::m_sLocalPool = nullptr;
+
 	/*
 	====================
 	Ctor and Dtor
@@ -21,7 +30,7 @@ namespace sparky
 	*/
 	////////////////////////////////////////////////////////////
 	PoolManager::PoolManager(void)
-		: Singleton<PoolManager>(), m_objects()
+		: Singleton<PoolManager>(), m_pools(), m_mutex(), m_lastFlushCount(0), m_lastFlushTime(0.0)
 	{
 	}
 
@@ -31,6 +40,39 @@ namespace sparky
 		this->flush();
 	}
 
+	/*
+	====================
+	Getters and Setters
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	unsigned int PoolManager::getPendingCount(void) const
+	{
+		std::lock_guard<std::mutex> guard(m_mutex);
+
+		unsigned int count = 0;
+
+		for (auto& pool : m_pools)
+		{
+			std::lock_guard<std::mutex> poolGuard(pool->mutex);
+			count += pool->buffers[pool->generation & 1].size();
+		}
+
+		return count;
+	}
+
+	////////////////////////////////////////////////////////////
+	unsigned int PoolManager::getLastFlushCount(void) const
+	{
+		return m_lastFlushCount;
+	}
+
+	////////////////////////////////////////////////////////////
+	double PoolManager::getLastFlushTime(void) const
+	{
+		return m_lastFlushTime;
+	}
+
 	/*
 	====================
 	Methods
@@ -39,30 +81,120 @@ namespace sparky
 	////////////////////////////////////////////////////////////
 	void PoolManager::addObject(Ref* pObject)
 	{
-		m_objects.push_back(pObject);
+		AutoreleasePool_t& pool = this->getLocalPool();
+
+		std::lock_guard<std::mutex> guard(pool.mutex);
+		std::vector<Ref*>& objects = pool.buffers[pool.generation & 1];
+
+		pObject->m_autoreleaseGeneration = pool.generation;
+		pObject->m_autoreleaseIndex = objects.size();
+		pObject->m_pAutoreleasePool.store(&pool, std::memory_order_release);
+
+		objects.push_back(pObject);
 	}
 
 	////////////////////////////////////////////////////////////
 	bool PoolManager::contains(Ref* pObject) const
 	{
-		return std::find(std::begin(m_objects), std::end(m_objects), pObject) != std::end(m_objects);
+		return pObject->m_pAutoreleasePool.load(std::memory_order_acquire) != nullptr;
+	}
+
+	////////////////////////////////////////////////////////////
+	bool PoolManager::removeObject(Ref* pObject)
+	{
+		AutoreleasePool_t* pPool = pObject->m_pAutoreleasePool.load(std::memory_order_acquire);
+
+		if (!pPool)
+		{
+			return false;
+		}
+
+		std::lock_guard<std::mutex> guard(pPool->mutex);
+
+		// A Ref of a retired generation is already being released by flush.
+		if (pObject->m_pAutoreleasePool.load(std::memory_order_relaxed) != pPool || pObject->m_autoreleaseGeneration != pPool->generation)
+		{
+			return false;
+		}
+
+		std::vector<Ref*>& objects = pPool->buffers[pPool->generation & 1];
+
+		Ref* pLast = objects.back();
+		pLast->m_autoreleaseIndex = pObject->m_autoreleaseIndex;
+		objects[pObject->m_autoreleaseIndex] = pLast;
+		objects.pop_back();
+
+		pObject->m_pAutoreleasePool.store(nullptr, std::memory_order_release);
+
+		return true;
 	}
 
 	////////////////////////////////////////////////////////////
 	void PoolManager::flush(void)
 	{
-		if (!m_objects.empty())
+		const auto start = std::chrono::high_resolution_clock::now();
+
+		FrameVector<AutoreleasePool_t*> pools;
+
+		{
+			// Pools are never destroyed before the manager, so they can be flushed without holding the registry lock.
+			std::lock_guard<std::mutex> guard(m_mutex);
+			pools.reserve(m_pools.size());
+
+			for (auto& pool : m_pools)
+			{
+				pools.push_back(pool.get());
+			}
+		}
+
+		unsigned int count = 0;
+
+		for (auto pPool : pools)
 		{
-			std::vector<Ref*> releases;
-			releases.swap(m_objects);
+			std::vector<Ref*>* pReleases = nullptr;
 
-			for (auto& r : releases)
 			{
+				// Retire the current generation, Refs created while releasing are kept for the next frame.
+				std::lock_guard<std::mutex> guard(pPool->mutex);
+				pReleases = &pPool->buffers[pPool->generation & 1];
+				++pPool->generation;
+			}
+
+			for (auto& r : *pReleases)
+			{
+				r->m_pAutoreleasePool.store(nullptr, std::memory_order_relaxed);
 				Ref::release(r);
 			}
 
-			releases.clear();
+			count += pReleases->size();
+
+			// Clearing keeps the capacity of the buffer for the next time it is filled.
+			pReleases->clear();
 		}
+
+		m_lastFlushCount = count;
+		m_lastFlushTime = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+	}
+
+	/*
+	====================
+	Private Methods
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	AutoreleasePool_t& PoolManager::getLocalPool(void)
+	{
+		if (!m_sLocalPool)
+		{
+			std::unique_ptr<AutoreleasePool_t> pPool(new AutoreleasePool_t());
+			pPool->generation = 0;
+			m_sLocalPool = pPool.get();
+
+			std::lock_guard<std::mutex> guard(m_mutex);
+			m_pools.push_back(std::move(pPool));
+		}
+
+		return *m_sLocalPool;
 	}
 
-}//namespace sparky
\ No newline at end of file
+}//namespace sparky
@@ -0,0 +1,274 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// 
+// Sparky Engine
+// 2016 - Benjamin Carter (benjamin.mark.carter@hotmail.com)
+// 
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+// 
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+// 
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgement
+//    in the product documentation would be appreciated but is not required.
+// 
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+// 
+// 3. This notice may not be removed or altered from any source distribution.
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+====================
+CPP Includes
+====================
+*/
+#include <algorithm>						// Ordering the allocations by their offsets.
+#include <iterator>							// Stepping to the previous free range.
+/*
+====================
+Class Includes
+====================
+*/
+#include <sparky\core\rangeallocator.hpp>	// Class definition.
+
+namespace sparky
+{
+	/*
+	====================
+	Ctor and Dtor
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	RangeAllocator::RangeAllocator(const unsigned int capacity/*= 0*/)
+		: m_allocations(), m_freeHandles(), m_freeRanges(), m_freeSizes(), m_capacity(0), m_used(0)
+	{
+		this->grow(capacity);
+	}
+
+	/*
+	====================
+	Private Methods
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	void RangeAllocator::insertFree(unsigned int offset, unsigned int size)
+	{
+		auto next = m_freeRanges.lower_bound(offset);
+
+		if (next != m_freeRanges.begin())
+		{
+			auto previous = std::prev(next);
+
+			if (previous->first + previous->second == offset)
+			{
+				offset = previous->first;
+				size += previous->second;
+
+				eraseSize(previous->first, previous->second);
+				m_freeRanges.erase(previous);
+			}
+		}
+
+		if (next != m_freeRanges.end() && offset + size == next->first)
+		{
+			size += next->second;
+
+			eraseSize(next->first, next->second);
+			m_freeRanges.erase(next);
+		}
+
+		m_freeRanges[offset] = size;
+		m_freeSizes.insert(std::make_pair(size, offset));
+	}
+
+	////////////////////////////////////////////////////////////
+	void RangeAllocator::eraseSize(const unsigned int offset, const unsigned int size)
+	{
+		auto range = m_freeSizes.equal_range(size);
+
+		for (auto itr = range.first; itr != range.second; ++itr)
+		{
+			if (itr->second == offset)
+			{
+				m_freeSizes.erase(itr);
+				return;
+			}
+		}
+	}
+
+	/*
+	====================
+	Getters and Setters
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	unsigned int RangeAllocator::getCapacity(void) const
+	{
+		return m_capacity;
+	}
+
+	////////////////////////////////////////////////////////////
+	unsigned int RangeAllocator::getFree(void) const
+	{
+		return m_capacity - m_used;
+	}
+
+	////////////////////////////////////////////////////////////
+	unsigned int RangeAllocator::getOffset(const unsigned int handle) const
+	{
+		return m_allocations[handle].offset;
+	}
+
+	////////////////////////////////////////////////////////////
+	unsigned int RangeAllocator::getSize(const unsigned int handle) const
+	{
+		return m_allocations[handle].size;
+	}
+
+	////////////////////////////////////////////////////////////
+	RangeStats_t RangeAllocator::getStats(void) const
+	{
+		RangeStats_t stats;
+		stats.capacity = m_capacity;
+		stats.used = m_used;
+		stats.freeRanges = m_freeRanges.size();
+		stats.largestFree = m_freeSizes.empty() ? 0 : m_freeSizes.rbegin()->first;
+
+		const unsigned int available = m_capacity - m_used;
+		stats.fragmentation = available ? 1.0f - static_cast<float>(stats.largestFree) / static_cast<float>(available) : 0.0f;
+
+		return stats;
+	}
+
+	/*
+	====================
+	Methods
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	unsigned int RangeAllocator::allocate(const unsigned int size)
+	{
+		auto fit = m_freeSizes.lower_bound(size);
+
+		if (size == 0 || fit == m_freeSizes.end())
+		{
+			return INVALID_HANDLE;
+		}
+
+		const unsigned int offset = fit->second;
+		const unsigned int rangeSize = fit->first;
+
+		m_freeSizes.erase(fit);
+		m_freeRanges.erase(offset);
+		//the remainder stays where it is, it cannot have a free neighbour to merge with
+		if (rangeSize > size)
+		{
+			m_freeRanges[offset + size] = rangeSize - size;
+			m_freeSizes.insert(std::make_pair(rangeSize - size, offset + size));
+		}
+
+		Allocation_t allocation;
+		allocation.offset = offset;
+		allocation.size = size;
+
+		unsigned int handle;
+
+		if (!m_freeHandles.empty())
+		{
+			handle = m_freeHandles.back();
+			m_freeHandles.pop_back();
+
+			m_allocations[handle] = allocation;
+		}
+		else
+		{
+			handle = m_allocations.size();
+			m_allocations.push_back(allocation);
+		}
+
+		m_used += size;
+
+		return handle;
+	}
+
+	////////////////////////////////////////////////////////////
+	void RangeAllocator::free(const unsigned int handle)
+	{
+		Allocation_t& allocation = m_allocations[handle];
+
+		if (allocation.size)
+		{
+			insertFree(allocation.offset, allocation.size);
+			m_used -= allocation.size;
+
+			allocation.size = 0;
+			m_freeHandles.push_back(handle);
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	void RangeAllocator::grow(const unsigned int capacity)
+	{
+		if (capacity > m_capacity)
+		{
+			insertFree(m_capacity, capacity - m_capacity);
+			m_capacity = capacity;
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	std::vector<RangeMove_t> RangeAllocator::defragment(void)
+	{
+		std::vector<unsigned int> handles;
+		handles.reserve(m_allocations.size() - m_freeHandles.size());
+
+		for (unsigned int i = 0; i < m_allocations.size(); i++)
+		{
+			if (m_allocations[i].size)
+			{
+				handles.push_back(i);
+			}
+		}
+
+		std::sort(handles.begin(), handles.end(), [this](unsigned int a, unsigned int b)
+		{
+			return m_allocations[a].offset < m_allocations[b].offset;
+		});
+
+		std::vector<RangeMove_t> moves;
+		moves.reserve(handles.size());
+
+		unsigned int cursor = 0;
+
+		for (const auto& handle : handles)
+		{
+			Allocation_t& allocation = m_allocations[handle];
+
+			RangeMove_t move;
+			move.from = allocation.offset;
+			move.to = cursor;
+			move.size = allocation.size;
+
+			moves.push_back(move);
+
+			allocation.offset = cursor;
+			cursor += allocation.size;
+		}
+
+		m_freeRanges.clear();
+		m_freeSizes.clear();
+
+		if (cursor < m_capacity)
+		{
+			insertFree(cursor, m_capacity - cursor);
+		}
+
+		return moves;
+	}
+
+}//namespace sparky
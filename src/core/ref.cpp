@@ -39,7 +39,7 @@ namespace sparky
 	*/
 	////////////////////////////////////////////////////////////
 	Ref::Ref(void)
-		: m_references(1)
+		: m_references(1), m_pAutoreleasePool(nullptr), m_autoreleaseGeneration(0), m_autoreleaseIndex(0)
 	{
 		PoolManager::getInstance().addObject(this);
 	}
@@ -52,7 +52,7 @@ namespace sparky
 	////////////////////////////////////////////////////////////
 	unsigned int Ref::getRefCount(void) const
 	{
-		return m_references;
+		return m_references.load(std::memory_order_acquire);
 	}
 
 	/*
@@ -63,13 +63,22 @@ namespace sparky
 	////////////////////////////////////////////////////////////
 	void Ref::addRef(void)
 	{
-		++m_references;
+		// A new reference can only be taken from an existing one, so no ordering is required.
+		m_references.fetch_add(1, std::memory_order_relaxed);
 	}
 
 	////////////////////////////////////////////////////////////
-	void Ref::removeRef(void)
+	unsigned int Ref::removeRef(void)
 	{
-		--m_references;
+		const unsigned int references = m_references.fetch_sub(1, std::memory_order_release) - 1;
+
+		if (references == 0)
+		{
+			// Make every write from the other owners visible before the object is destroyed.
+			std::atomic_thread_fence(std::memory_order_acquire);
+		}
+
+		return references;
 	}
 
 }//namespace sparky
\ No newline at end of file
@@ -22,12 +22,19 @@
 //
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
+/*
+====================
+CPP Includes
+====================
+*/
+#include <cstring>							// Comparing the description of a stored texture.
 /*
 ====================
 Class Includes
 ====================
 */
 #include <sparky\core\resourcemanager.hpp>	// Class definition.
+#include <sparky\rendering\shaderregistry.hpp>	// Shader files are reloaded by the programs that depend on them.
 
 namespace sparky
 {
@@ -38,25 +45,85 @@ namespace sparky
 	*/
 	////////////////////////////////////////////////////////////
 	ResourceManager::ResourceManager(void)
-		: Singleton<ResourceManager>(), m_shaders()
+		: Singleton<ResourceManager>(), m_shaders(), m_textures()
 	{
 	}
 
+	/*
+	====================
+	Getters and Setters
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	Texture* ResourceManager::loadTexture(const String& filename, const SPARKY_TEXTURE_DESC& desc)
+	{
+		//the description is hashed on top of the file, its members are all 32 bits so it has no padding
+		unsigned int key = StringId::hash(reinterpret_cast<const char*>(&desc), sizeof(desc), StringId(filename).getHash());
+
+		for (;;)
+		{
+			Texture* pTexture = m_textures.find(StringId(key));
+
+			if (!pTexture)
+			{
+				pTexture = new Texture(filename, desc);
+				m_textures.add(StringId(key), pTexture);
+
+				return pTexture;
+			}
+
+			if (pTexture->getFilename() == filename && std::memcmp(&pTexture->getDescription(), &desc, sizeof(desc)) == 0)
+			{
+				return pTexture;
+			}
+			//another texture hashed to the same key, textures are never removed so the next key in the chain is probed
+			key = StringId::hash(reinterpret_cast<const char*>(&key), sizeof(key), key);
+		}
+	}
+
 	/*
 	====================
 	Methods
 	====================
 	*/
 	////////////////////////////////////////////////////////////
-	void ResourceManager::addShader(const String& name, IShaderComponent* pShader)
+	void ResourceManager::addShader(const StringId& name, IShaderComponent* pShader)
 	{
 		m_shaders.add(name, pShader);
 	}
 
 	////////////////////////////////////////////////////////////
-	void ResourceManager::removeShader(const String& name)
+	void ResourceManager::removeShader(const StringId& name)
 	{
 		m_shaders.remove(name);
 	}
 
+	////////////////////////////////////////////////////////////
+	bool ResourceManager::reload(const String& filename)
+	{
+		if (ShaderRegistry::getInstance().reload(filename) > 0)
+		{
+			//any of the shaders may use a relinked program, reading the locations again is cheap
+			m_shaders.forEach([](const StringId&, IShaderComponent* pShader)
+			{
+				pShader->loadUniforms();
+			});
+
+			return true;
+		}
+
+		bool reloaded = false;
+		//the same file may be stored with several descriptions
+		m_textures.forEach([&](const StringId&, Texture* pTexture)
+		{
+			if (pTexture->getFilename() == filename)
+			{
+				pTexture->reload();
+				reloaded = true;
+			}
+		});
+
+		return reloaded;
+	}
+
 }//namespace sparky
\ No newline at end of file
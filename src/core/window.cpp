@@ -36,6 +36,7 @@ Class Includes
 #include <sparky\core\window.hpp>	// Class definition.
 #include <sparky\utils\config.hpp>  // The configuration of the Window.
 #include <sparky\utils\debug.hpp>	// Provides error printing for any errors in Window creation.
+#include <sparky\utils\gldevice.hpp>	// Clearing the Window through the OpenGL function table.
 /*
 ====================
 Additional Includes
@@ -161,6 +162,12 @@ namespace sparky
 		return m_running;
 	}
 
+	////////////////////////////////////////////////////////////
+	bool Window::isHeadless(void) const
+	{
+		return m_running && !m_pWindow;
+	}
+
 	/*
 	====================
 	Methods
@@ -219,16 +226,37 @@ namespace sparky
 		return this->create(title, pos, size,settings);
 	}
 
+	////////////////////////////////////////////////////////////
+	bool Window::createHeadless(const ConfigFile& config)
+	{
+		m_title = config.getString("Window.title");
+		m_position = Vector2i::zero();
+		m_size = Vector2i(config.getInt("Window.size_x"), config.getInt("Window.size_y"));
+
+		m_running = true;
+
+		// Set the main Window object for the application.
+		if (!m_pMain)
+		{
+			m_pMain = this;
+		}
+
+		return true;
+	}
+
 	////////////////////////////////////////////////////////////
 	void Window::clear(void) const
 	{
-		glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+		GLDevice::getFunctions().clear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 	}
 
 	////////////////////////////////////////////////////////////
 	void Window::swap(void) const
 	{
-		SDL_GL_SwapWindow(m_pWindow);
+		if (m_pWindow)
+		{
+			SDL_GL_SwapWindow(m_pWindow);
+		}
 	}
 
 	////////////////////////////////////////////////////////////
@@ -240,7 +268,10 @@ namespace sparky
 	////////////////////////////////////////////////////////////
 	void Window::setMousePosition(const Vector2i& position) const
 	{
-		SDL_WarpMouseInWindow(m_pWindow, position.x, position.y);
+		if (m_pWindow)
+		{
+			SDL_WarpMouseInWindow(m_pWindow, position.x, position.y);
+		}
 	}
 
 }//namespace sparky
\ No newline at end of file
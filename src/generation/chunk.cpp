@@ -30,10 +30,11 @@ Class Includes
 */
 #include <sparky\generation\chunk.hpp>		// Class Definition.
 #include <sparky\rendering\meshdata.hpp>	// For adding vertices and faces.
-#include <sparky\rendering\ishader.hpp>		// The shader needs to be updated with the transform.
 #include <sparky\math\frustum.hpp>			// Will only render when inside the viewport.
 #include <sparky\utils\GLdevice.hpp>
 #include <sparky\generation\world.hpp>
+#include <sparky\core\slaballocator.hpp>		// Chunks are allocated from slabs.
+#include <sparky\generation\materialregistry.hpp>	// The texture layer of each voxel type.
 
 namespace sparky
 {
@@ -52,8 +53,8 @@ namespace sparky
 	*/
 	////////////////////////////////////////////////////////////
 	Chunk::Chunk(void)
-		: IObject(), m_voxels(), m_pMesh(nullptr), m_pWorld(nullptr), m_isActive(false), m_neighbours(), m_checks(),
-			m_shouldLoad(false)
+		: IObject(), m_voxels(), m_pMesh(nullptr), m_arenaMesh(VertexArena::INVALID_MESH), m_pWorld(nullptr), m_isActive(false), m_neighbours(), 
+			m_checks(), m_shouldLoad(false)
 	{
 		Voxel vox;
 		vox.setType(eVoxelType::DIRT);
@@ -72,9 +73,31 @@ namespace sparky
 	////////////////////////////////////////////////////////////
 	Chunk::~Chunk(void)
 	{
+		if (m_pWorld)
+		{
+			m_pWorld->getArena().free(m_arenaMesh);
+		}
+
 		Ref::release(m_pMesh);
 	}
 
+	/*
+	====================
+	Operators
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	void* Chunk::operator new(std::size_t size)
+	{
+		return SlabAllocator<Chunk>::getInstance().allocate(size);
+	}
+
+	////////////////////////////////////////////////////////////
+	void Chunk::operator delete(void* pMemory, std::size_t size)
+	{
+		SlabAllocator<Chunk>::getInstance().deallocate(pMemory, size);
+	}
+
 	/*
 	====================
 	Getters and Setters
@@ -195,6 +218,7 @@ namespace sparky
 	{
 		Vector3f position(pos);
 		const float RENDER_SIZE = 1.0f;
+		const float layer = MaterialRegistry::getInstance().getLayer(getVoxel(pos)->getType());
 
 		Vector2f uv0(0.0f, 0.0f);
 		Vector2f uv1(1.0f, 0.0f);
@@ -204,20 +228,20 @@ namespace sparky
 		if (m_checks[FACE_FORWARD])
 		{
 			//front face
-			Vertex_t v0(Vector3f(position.x,			   position.y,				 position.z), uv0);
-			Vertex_t v1(Vector3f(position.x + RENDER_SIZE, position.y,				 position.z), uv1);
-			Vertex_t v2(Vector3f(position.x + RENDER_SIZE, position.y + RENDER_SIZE, position.z), uv2);
-			Vertex_t v3(Vector3f(position.x,			   position.y + RENDER_SIZE, position.z), uv3);
+			Vertex_t v0(Vector3f(position.x,			   position.y,				 position.z), uv0, layer);
+			Vertex_t v1(Vector3f(position.x + RENDER_SIZE, position.y,				 position.z), uv1, layer);
+			Vertex_t v2(Vector3f(position.x + RENDER_SIZE, position.y + RENDER_SIZE, position.z), uv2, layer);
+			Vertex_t v3(Vector3f(position.x,			   position.y + RENDER_SIZE, position.z), uv3, layer);
 
 			m_pMesh->addFace(v0, v1, v2, v3, false);
 		}
 
 		if (m_checks[FACE_NORTH])
 		{
-			Vertex_t v0(Vector3f(position.x,			   position.y + RENDER_SIZE, position.z			     ), uv0);
-			Vertex_t v1(Vector3f(position.x + RENDER_SIZE, position.y + RENDER_SIZE, position.z			     ), uv1);
-			Vertex_t v2(Vector3f(position.x + RENDER_SIZE, position.y + RENDER_SIZE, position.z + RENDER_SIZE), uv2);
-			Vertex_t v3(Vector3f(position.x,			   position.y + RENDER_SIZE, position.z + RENDER_SIZE), uv3);
+			Vertex_t v0(Vector3f(position.x,			   position.y + RENDER_SIZE, position.z			     ), uv0, layer);
+			Vertex_t v1(Vector3f(position.x + RENDER_SIZE, position.y + RENDER_SIZE, position.z			     ), uv1, layer);
+			Vertex_t v2(Vector3f(position.x + RENDER_SIZE, position.y + RENDER_SIZE, position.z + RENDER_SIZE), uv2, layer);
+			Vertex_t v3(Vector3f(position.x,			   position.y + RENDER_SIZE, position.z + RENDER_SIZE), uv3, layer);
 
 			m_pMesh->addFace(v0, v1, v2, v3, false);
 		}
@@ -225,10 +249,10 @@ namespace sparky
 		if (m_checks[FACE_BACKWARD])
 		{
 			//back face			
-			Vertex_t v0(Vector3f(position.x				 , position.y			   , position.z + RENDER_SIZE), uv0);
-			Vertex_t v1(Vector3f(position.x + RENDER_SIZE, position.y			   , position.z + RENDER_SIZE), uv1);
-			Vertex_t v2(Vector3f(position.x + RENDER_SIZE, position.y + RENDER_SIZE, position.z + RENDER_SIZE), uv2);
-			Vertex_t v3(Vector3f(position.x				 , position.y + RENDER_SIZE, position.z + RENDER_SIZE), uv3);
+			Vertex_t v0(Vector3f(position.x				 , position.y			   , position.z + RENDER_SIZE), uv0, layer);
+			Vertex_t v1(Vector3f(position.x + RENDER_SIZE, position.y			   , position.z + RENDER_SIZE), uv1, layer);
+			Vertex_t v2(Vector3f(position.x + RENDER_SIZE, position.y + RENDER_SIZE, position.z + RENDER_SIZE), uv2, layer);
+			Vertex_t v3(Vector3f(position.x				 , position.y + RENDER_SIZE, position.z + RENDER_SIZE), uv3, layer);
 
 			m_pMesh->addFace(v0, v1, v2, v3, true);
 		}
@@ -236,10 +260,10 @@ namespace sparky
 		if (m_checks[FACE_SOUTH])
 		{
 			//bottom face
-			Vertex_t v0(Vector3f(position.x			     , position.y, position.z + RENDER_SIZE), uv0);
-			Vertex_t v1(Vector3f(position.x + RENDER_SIZE, position.y, position.z + RENDER_SIZE), uv1);
-			Vertex_t v2(Vector3f(position.x + RENDER_SIZE, position.y, position.z			   ), uv2);
-			Vertex_t v3(Vector3f(position.x				 , position.y, position.z			   ), uv3);
+			Vertex_t v0(Vector3f(position.x			     , position.y, position.z + RENDER_SIZE), uv0, layer);
+			Vertex_t v1(Vector3f(position.x + RENDER_SIZE, position.y, position.z + RENDER_SIZE), uv1, layer);
+			Vertex_t v2(Vector3f(position.x + RENDER_SIZE, position.y, position.z			   ), uv2, layer);
+			Vertex_t v3(Vector3f(position.x				 , position.y, position.z			   ), uv3, layer);
 
 			m_pMesh->addFace(v0, v1, v2, v3, false);
 		}
@@ -247,10 +271,10 @@ namespace sparky
 		if (m_checks[FACE_WEST])
 		{
 			//left face
-			Vertex_t v0(Vector3f(position.x, position.y				 , position.z + RENDER_SIZE), uv0);
-			Vertex_t v1(Vector3f(position.x, position.y				 , position.z			   ), uv1);
-			Vertex_t v2(Vector3f(position.x, position.y + RENDER_SIZE, position.z			   ), uv2);
-			Vertex_t v3(Vector3f(position.x, position.y + RENDER_SIZE, position.z + RENDER_SIZE), uv3);
+			Vertex_t v0(Vector3f(position.x, position.y				 , position.z + RENDER_SIZE), uv0, layer);
+			Vertex_t v1(Vector3f(position.x, position.y				 , position.z			   ), uv1, layer);
+			Vertex_t v2(Vector3f(position.x, position.y + RENDER_SIZE, position.z			   ), uv2, layer);
+			Vertex_t v3(Vector3f(position.x, position.y + RENDER_SIZE, position.z + RENDER_SIZE), uv3, layer);
 
 			m_pMesh->addFace(v0, v1, v2, v3, false);
 		}
@@ -258,10 +282,10 @@ namespace sparky
 		if (m_checks[FACE_EAST])
 		{
 			//right face
-			Vertex_t v0(Vector3f(position.x + RENDER_SIZE, position.y			   , position.z + RENDER_SIZE), uv0);
-			Vertex_t v1(Vector3f(position.x + RENDER_SIZE, position.y			   , position.z				 ), uv1);
-			Vertex_t v2(Vector3f(position.x + RENDER_SIZE, position.y + RENDER_SIZE, position.z				 ), uv2);
-			Vertex_t v3(Vector3f(position.x + RENDER_SIZE, position.y + RENDER_SIZE, position.z + RENDER_SIZE), uv3);
+			Vertex_t v0(Vector3f(position.x + RENDER_SIZE, position.y			   , position.z + RENDER_SIZE), uv0, layer);
+			Vertex_t v1(Vector3f(position.x + RENDER_SIZE, position.y			   , position.z				 ), uv1, layer);
+			Vertex_t v2(Vector3f(position.x + RENDER_SIZE, position.y + RENDER_SIZE, position.z				 ), uv2, layer);
+			Vertex_t v3(Vector3f(position.x + RENDER_SIZE, position.y + RENDER_SIZE, position.z + RENDER_SIZE), uv3, layer);
 
 			m_pMesh->addFace(v0, v1, v2, v3, true);
 		}
@@ -336,17 +360,19 @@ namespace sparky
 						eVoxelType v1 = 0 <= x[axis] ? getVoxel(x[0], x[1], x[2])->getType() : eVoxelType::DIRT;
 						eVoxelType v2 = x[axis] < dimensions[axis] - 1 ? getVoxel(x[0] + q[0], x[1] + q[1], x[2] + q[2])->getType() : eVoxelType::DIRT;
 
-						if (a1 == a2 && v1 == v2)
+						// A face is only needed between an active and an inactive voxel. The mask holds the type of
+						// the active voxel offset by one, so only faces of the same type are merged.
+						if (a1 == a2)
 						{
 							mask[counter] = 0;
 						}
 						else if (a1)
 						{
-							mask[counter] = static_cast<int>(a1);
+							mask[counter] = static_cast<int>(v1) + 1;
 						}
 						else
 						{
-							mask[counter] = -1;
+							mask[counter] = -(static_cast<int>(v2) + 1);
 						}
 					}
 				}
@@ -390,12 +416,15 @@ namespace sparky
 
 							int du[3] = { 0 }, dv[3] = { 0 };
 							bool flip;
+							// The texture co-ordinates span the quad in voxels, so the repeating layer tiles once per voxel.
+							Vector2f span;
 
 							if (c > 0)
 							{
 								flip = true;
 								dv[v] = height;
 								du[u] = width;
+								span = Vector2f(static_cast<float>(width), static_cast<float>(height));
 							}
 							else
 							{
@@ -403,12 +432,15 @@ namespace sparky
 								c = -c;
 								du[v] = height;
 								dv[u] = width;
+								span = Vector2f(static_cast<float>(height), static_cast<float>(width));
 							}
 
-							Vertex_t v1(Vector3f(Vector3i(x[0],                 x[1],                 x[2])),				  Vector2f(0.0f, 0.0f));
-							Vertex_t v2(Vector3f(Vector3i(x[0] + du[0],         x[1] + du[1],         x[2] + du[2])),         Vector2f(1.0f, 0.0f));
-							Vertex_t v3(Vector3f(Vector3i(x[0] + du[0] + dv[0], x[1] + du[1] + dv[1], x[2] + du[2] + dv[2])), Vector2f(1.0f, 1.0f));
-							Vertex_t v4(Vector3f(Vector3i(x[0] + dv[0],         x[1] + dv[1],         x[2] + dv[2])),		  Vector2f(0.0f, 1.0f));
+							const float layer = MaterialRegistry::getInstance().getLayer(static_cast<eVoxelType>(c - 1));
+
+							Vertex_t v1(Vector3f(Vector3i(x[0],                 x[1],                 x[2])),				  Vector2f(0.0f, 0.0f),	  layer);
+							Vertex_t v2(Vector3f(Vector3i(x[0] + du[0],         x[1] + du[1],         x[2] + du[2])),         Vector2f(span.x, 0.0f), layer);
+							Vertex_t v3(Vector3f(Vector3i(x[0] + du[0] + dv[0], x[1] + du[1] + dv[1], x[2] + du[2] + dv[2])), span,				  layer);
+							Vertex_t v4(Vector3f(Vector3i(x[0] + dv[0],         x[1] + dv[1],         x[2] + dv[2])),		  Vector2f(0.0f, span.y), layer);
 
 							m_pMesh->addFace(v1, v2, v3, v4, flip);
 							m_pMesh->calculateFaceNormals(index, flip);
@@ -451,6 +483,9 @@ namespace sparky
 	void Chunk::reset(void)
 	{
 		m_pMesh->reset();
+
+		m_pWorld->getArena().free(m_arenaMesh);
+		m_arenaMesh = VertexArena::INVALID_MESH;
 	}
 
 	////////////////////////////////////////////////////////////
@@ -460,7 +495,11 @@ namespace sparky
 		{
 			if (m_shouldLoad)
 			{
-				m_pMesh->generate(false);
+				VertexArena& arena = m_pWorld->getArena();
+
+				arena.free(m_arenaMesh);
+				m_arenaMesh = arena.allocate(m_pMesh->getVertices(), m_pMesh->getIndices());
+
 				m_shouldLoad = false;
 			}
 		}
@@ -473,8 +512,7 @@ namespace sparky
 		{
 			if (Frustum::checkCube(getTransform().getPosition(), static_cast<float>(m_sSize)))
 			{
-				pShader->update(getTransform());
-				m_pMesh->render();
+				m_pWorld->getArena().queue(m_arenaMesh, pShader, m_pWorld->getTexture(), getTransform());
 			}
 		}
 	}
@@ -0,0 +1,100 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// 
+// Sparky Engine
+// 2016 - Benjamin Carter (benjamin.mark.carter@hotmail.com)
+// 
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+// 
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+// 
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgement
+//    in the product documentation would be appreciated but is not required.
+// 
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+// 
+// 3. This notice may not be removed or altered from any source distribution.
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+====================
+Class Includes
+====================
+*/
+#include <sparky\generation\materialregistry.hpp>	// Class definition.
+#include <sparky\core\resourcemanager.hpp>			// The array texture is shared and hot reloaded.
+#include <sparky\rendering\texture.hpp>				// The array texture of the materials.
+
+namespace sparky
+{
+	/*
+	====================
+	Static Fields
+	====================
+	*/
+	const unsigned int MaterialRegistry::m_sTypeCount;
+
+	/*
+	====================
+	Private Ctor
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	MaterialRegistry::MaterialRegistry(void)
+		: Singleton<MaterialRegistry>(), m_pTexture(nullptr), m_layers()
+	{
+		for (unsigned int i = 0; i < m_sTypeCount; i++)
+		{
+			m_layers[i] = static_cast<float>(i);
+		}
+	}
+
+	/*
+	====================
+	Getters and Setters
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	void MaterialRegistry::setLayer(const eVoxelType type, const unsigned int layer)
+	{
+		m_layers[static_cast<unsigned int>(type)] = static_cast<float>(layer);
+	}
+
+	////////////////////////////////////////////////////////////
+	float MaterialRegistry::getLayer(const eVoxelType type) const
+	{
+		return m_layers[static_cast<unsigned int>(type)];
+	}
+
+	////////////////////////////////////////////////////////////
+	Texture* MaterialRegistry::getTexture(void) const
+	{
+		return m_pTexture;
+	}
+
+	/*
+	====================
+	Methods
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	void MaterialRegistry::load(const String& filename, const unsigned int tileSize)
+	{
+		SPARKY_TEXTURE_DESC desc;
+		desc.target = GL_TEXTURE_2D_ARRAY;
+		desc.internalFormat = GL_RGBA;
+		desc.filter = eTextureFilter::NEAREST;
+		//merged faces run past the edge of the layer, and have to wrap back onto it
+		desc.mode = eTextureWrapMode::REPEAT;
+		desc.tileSize = tileSize;
+
+		m_pTexture = ResourceManager::getInstance().loadTexture(filename, desc);
+	}
+
+}//namespace sparky
\ No newline at end of file
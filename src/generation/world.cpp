@@ -22,6 +22,12 @@
 //
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
+/*
+====================
+CPP Includes
+====================
+*/
+#include <functional>						// Binding the chunk generation methods into tasks.
 /*
 ====================
 Class Includes
@@ -29,7 +35,7 @@ Class Includes
 */
 #include <sparky\generation\world.hpp>		// Class definition.
 #include <sparky\generation\chunk.hpp>		// World is made of chunks.
-#include <sparky\rendering\ishader.hpp>		// All of the chunks within the World is rendered with one shader.
+#include <sparky\rendering\texture.hpp>		// All of the chunks within the World are rendered with one texture.
 #include <sparky\utils\threadmanager.hpp>	// The chunk generation is multi-threaded for quicker execution.
 
 namespace sparky
@@ -41,7 +47,7 @@ namespace sparky
 	*/
 	////////////////////////////////////////////////////////////
 	World::World(void)
-		: m_chunks()
+		: m_chunks(), m_pTexture(nullptr), m_arena()
 	{
 	}
 
@@ -54,6 +60,8 @@ namespace sparky
 		}
 
 		m_chunks.clear();
+
+		Ref::release(m_pTexture);
 	}
 
 	/*
@@ -107,6 +115,30 @@ namespace sparky
 		return nullptr;
 	}
 
+	////////////////////////////////////////////////////////////
+	void World::setTexture(Texture* pTexture)
+	{
+		if (pTexture)
+		{
+			pTexture->addRef();
+		}
+
+		Ref::release(m_pTexture);
+		m_pTexture = pTexture;
+	}
+
+	////////////////////////////////////////////////////////////
+	const Texture* World::getTexture(void) const
+	{
+		return m_pTexture;
+	}
+
+	////////////////////////////////////////////////////////////
+	VertexArena& World::getArena(void)
+	{
+		return m_arena;
+	}
+
 	/*
 	====================
 	Methods
@@ -162,7 +194,6 @@ namespace sparky
 	{
 		for (const auto& chunk : m_chunks)
 		{
-			pShader->update(chunk.second->getTransform());
 			chunk.second->render(pShader);
 		}
 	}
@@ -29,6 +29,7 @@ Class Includes
 */
 #include <sparky\input\eventmanager.hpp>	// Class definition.
 #include <sparky\input\ievent.hpp>			// Updating the events.
+#include <sparky\core\frameallocator.hpp>	// The events to release are copied without the heap.
 
 namespace sparky
 {
@@ -94,8 +95,8 @@ namespace sparky
 	{
 		if (!m_events.empty())
 		{
-			std::vector<IEventComponent*> releases;
-			releases.swap(m_events);
+			FrameVector<IEventComponent*> releases(std::begin(m_events), std::end(m_events));
+			m_events.clear();
 
 			for (auto& r : releases)
 			{
@@ -28,8 +28,7 @@ Class Includes
 ====================
 */
 #include <sparky\lighting\directionallight.hpp>	// Class definition.
-#include <sparky\rendering\uniform.hpp>			// Sending variables to the shader.
-#include <sparky\core\gamemanager.hpp>		    // Add the current light to the game manager.
+#include <sparky\rendering\buffers.hpp>			// The layout of the packed light data.
 
 namespace sparky
 {
@@ -40,7 +39,7 @@ namespace sparky
 	*/
 	////////////////////////////////////////////////////////////
 	DirectionalLight::DirectionalLight(const SPARKY_DIRECTIONAL_LIGHT_DESC& desc)
-		: Light(desc.base), m_direction(desc.direction)
+		: Light(desc.base, eLightType::DIRECTIONAL), m_direction(desc.direction)
 	{
 	}
 
@@ -59,6 +58,7 @@ namespace sparky
 	void DirectionalLight::setDirection(const Vector3f& direction)
 	{
 		m_direction = direction;
+		invalidate();
 	}
 
 	/*
@@ -67,17 +67,12 @@ namespace sparky
 	====================
 	*/
 	////////////////////////////////////////////////////////////
-	void DirectionalLight::setUniforms(Uniform& uniform)
+	void DirectionalLight::pack(LightData_t& data, const unsigned int index) const
 	{
-		Light::setUniforms(uniform, ".base");
+		const Vector3f& colour = getColour();
 
-		uniform.setParameter(String::concat(this->getName(), ".direction"), m_direction);
-	}
-
-	////////////////////////////////////////////////////////////
-	void DirectionalLight::addLight(void)
-	{
-		GameManager::getInstance().addLight(this);
+		data.direction[index] = Vector4f(m_direction.x, m_direction.y, m_direction.z, 0.0f);
+		data.directionalColourIntensity[index] = Vector4f(colour.x, colour.y, colour.z, getIntensity());
 	}
 
 }//namespace sparky
\ No newline at end of file
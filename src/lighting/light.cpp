@@ -27,8 +27,8 @@
 Class Includes
 ====================
 */
-#include <sparky\lighting\light.hpp>	// Class definition.
-#include <sparky\rendering\uniform.hpp>	// Sending light information to the shader.
+#include <sparky\lighting\light.hpp>			// Class definition.
+#include <sparky\lighting\lightregistry.hpp>	// The lights are held by the light registry.
 
 namespace sparky
 {
@@ -38,11 +38,18 @@ namespace sparky
 	====================
 	*/
 	////////////////////////////////////////////////////////////
-	Light::Light(const SPARKY_BASE_LIGHT_DESC& desc)
-		: Ref(), m_name(desc.name), m_position(desc.position), m_colour(desc.colour), m_intensity(desc.intensity)
+	Light::Light(const SPARKY_BASE_LIGHT_DESC& desc, const eLightType type)
+		: Ref(), m_name(desc.name), m_position(desc.position), m_colour(desc.colour), m_intensity(desc.intensity), 
+		  m_type(type), m_handle(LightRegistry::INVALID_HANDLE)
 	{
 	}
 
+	////////////////////////////////////////////////////////////
+	Light::~Light(void)
+	{
+		removeLight();
+	}
+
 	/*
 	====================
 	Getters and Setters
@@ -70,6 +77,7 @@ namespace sparky
 	void Light::setPosition(const Vector3f& position)
 	{
 		m_position = position;
+		invalidate();
 	}
 
 	////////////////////////////////////////////////////////////
@@ -82,6 +90,7 @@ namespace sparky
 	void Light::setColour(const Vector3f& colour)
 	{
 		m_colour = colour;
+		invalidate();
 	}
 
 	////////////////////////////////////////////////////////////
@@ -94,6 +103,43 @@ namespace sparky
 	void Light::setIntensity(const float intensity)
 	{
 		m_intensity = intensity;
+		invalidate();
+	}
+
+	////////////////////////////////////////////////////////////
+	eLightType Light::getType(void) const
+	{
+		return m_type;
+	}
+
+	////////////////////////////////////////////////////////////
+	unsigned int Light::getHandle(void) const
+	{
+		return m_handle;
+	}
+
+	/*
+	====================
+	Methods
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	void Light::addLight(void)
+	{
+		if (m_handle == LightRegistry::INVALID_HANDLE)
+		{
+			m_handle = LightRegistry::getInstance().add(this);
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	void Light::removeLight(void)
+	{
+		if (m_handle != LightRegistry::INVALID_HANDLE)
+		{
+			LightRegistry::getInstance().remove(m_type, m_handle);
+			m_handle = LightRegistry::INVALID_HANDLE;
+		}
 	}
 
 	/*
@@ -102,11 +148,12 @@ namespace sparky
 	====================
 	*/
 	////////////////////////////////////////////////////////////
-	void Light::setUniforms(Uniform& uniform, const String& extension)
+	void Light::invalidate(void)
 	{
-		uniform.setParameter(String::concat(m_name, extension, ".position"), m_position);
-		uniform.setParameter(String::concat(m_name, extension, ".colour"), m_colour);
-		uniform.setParameter(String::concat(m_name, extension, ".intensity"), m_intensity);
+		if (m_handle != LightRegistry::INVALID_HANDLE)
+		{
+			LightRegistry::getInstance().invalidate(m_type, m_handle);
+		}
 	}
 
 }//namespace sparky
\ No newline at end of file
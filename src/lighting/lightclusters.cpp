@@ -0,0 +1,433 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// 
+// Sparky Engine
+// 2016 - Benjamin Carter (benjamin.mark.carter@hotmail.com)
+// 
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+// 
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+// 
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgement
+//    in the product documentation would be appreciated but is not required.
+// 
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+// 
+// 3. This notice may not be removed or altered from any source distribution.
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+====================
+CPP Includes
+====================
+*/
+#include <algorithm>							// Clamping the slices and bounds.
+#include <cmath>								// The slices are spaced logarithmically.
+#include <thread>								// Yielding while the assigning threads finish.
+/*
+====================
+Class Includes
+====================
+*/
+#include <sparky\lighting\lightclusters.hpp>	// Class definition.
+#include <sparky\core\camera.hpp>				// The view and projection of the grid.
+#include <sparky\math\mathutils.hpp>			// Converting the field of view to radians.
+#include <sparky\math\frustum.hpp>				// Projecting the lights onto the screen.
+#include <sparky\utils\defines.hpp>				// Whether SSE is available.
+#include <sparky\utils\threadmanager.hpp>		// Large amounts of lights are assigned on the worker threads.
+#include <sparky\core\frameallocator.hpp>		// The assigning job lives for the frame.
+/*
+====================
+Additional Includes
+====================
+*/
+#if SPARKY_SSE
+#include <xmmintrin.h>							// Testing four tile columns at a time.
+#endif
+
+namespace sparky
+{
+	/*
+	====================
+	Static Fields
+	====================
+	*/
+	const unsigned int LightClusters::GRID_X;
+	const unsigned int LightClusters::GRID_Y;
+	const unsigned int LightClusters::GRID_Z;
+	const unsigned int LightClusters::MAX_CLUSTER_LIGHTS;
+
+	/*
+	====================
+	Ctor and Dtor
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	LightClusters::LightClusters(void)
+		: m_spheres(), m_boundsX(GRID_Z * GRID_X * 2), m_boundsY(GRID_Z * GRID_Y * 2), m_depths(GRID_Z + 1),
+		  m_grid(GRID_X * GRID_Y * GRID_Z * MAX_CLUSTER_LIGHTS), m_counts(GRID_X * GRID_Y * GRID_Z), m_clusters(GRID_X * GRID_Y * GRID_Z), m_indices(), m_screenBounds(),
+		  m_fov(0.0f), m_aspectRatio(0.0f), m_nearPlane(0.0f), m_farPlane(0.0f)
+	{
+		m_stats.lights = 0;
+		m_stats.visibleLights = 0;
+		m_stats.references = 0;
+		m_stats.maxLights = 0;
+		m_stats.overflow = 0;
+	}
+
+	/*
+	====================
+	Private Methods
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	void LightClusters::setProjection(const float fov, const float aspectRatio, const float nearPlane, const float farPlane)
+	{
+		if (fov == m_fov && aspectRatio == m_aspectRatio && nearPlane == m_nearPlane && farPlane == m_farPlane)
+		{
+			return;
+		}
+
+		m_fov = fov;
+		m_aspectRatio = aspectRatio;
+		m_nearPlane = nearPlane;
+		m_farPlane = farPlane;
+
+		for (unsigned int z = 0; z <= GRID_Z; z++)
+		{
+			m_depths[z] = nearPlane * std::pow(farPlane / nearPlane, static_cast<float>(z) / GRID_Z);
+		}
+
+		const float tanY = std::tan(MathUtils<float>::toRadians(fov / 2.0f));
+		const float tanX = tanY * aspectRatio;
+		//a tile is a pyramid, so its widest point along x and y is at either the near or far depth of the slice
+		for (unsigned int z = 0; z < GRID_Z; z++)
+		{
+			const float nearDepth = m_depths[z];
+			const float farDepth = m_depths[z + 1];
+
+			float* pMinX = &m_boundsX[z * GRID_X * 2];
+			float* pMaxX = pMinX + GRID_X;
+
+			for (unsigned int x = 0; x < GRID_X; x++)
+			{
+				const float left = (-1.0f + 2.0f * x / GRID_X) * tanX;
+				const float right = (-1.0f + 2.0f * (x + 1) / GRID_X) * tanX;
+
+				pMinX[x] = std::min(left * nearDepth, left * farDepth);
+				pMaxX[x] = std::max(right * nearDepth, right * farDepth);
+			}
+
+			float* pMinY = &m_boundsY[z * GRID_Y * 2];
+			float* pMaxY = pMinY + GRID_Y;
+
+			for (unsigned int y = 0; y < GRID_Y; y++)
+			{
+				const float bottom = (-1.0f + 2.0f * y / GRID_Y) * tanY;
+				const float top = (-1.0f + 2.0f * (y + 1) / GRID_Y) * tanY;
+
+				pMinY[y] = std::min(bottom * nearDepth, bottom * farDepth);
+				pMaxY[y] = std::max(top * nearDepth, top * farDepth);
+			}
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	unsigned int LightClusters::getSlice(const float depth) const
+	{
+		if (depth <= m_nearPlane)
+		{
+			return 0;
+		}
+
+		const float slice = std::log(depth) * getSliceScale() + getSliceBias();
+
+		return std::min(static_cast<unsigned int>(slice), GRID_Z - 1);
+	}
+
+	////////////////////////////////////////////////////////////
+	void LightClusters::assign(const unsigned int slice)
+	{
+		const float nearDepth = m_depths[slice];
+		const float farDepth = m_depths[slice + 1];
+
+		const float* pMinX = &m_boundsX[slice * GRID_X * 2];
+		const float* pMaxX = pMinX + GRID_X;
+		const float* pMinY = &m_boundsY[slice * GRID_Y * 2];
+		const float* pMaxY = pMinY + GRID_Y;
+
+		float distanceX[GRID_X];
+
+		for (unsigned int i = 0; i < m_spheres.size(); i++)
+		{
+			const Sphere_t& sphere = m_spheres[i];
+
+			if (slice < sphere.firstSlice || slice > sphere.lastSlice)
+			{
+				continue;
+			}
+
+			const float dz = std::max(std::max(nearDepth - sphere.z, sphere.z - farDepth), 0.0f);
+			const float remaining = sphere.radius * sphere.radius - dz * dz;
+
+			if (remaining < 0.0f)
+			{
+				continue;
+			}
+
+#if SPARKY_SSE
+			const int columns = ((1 << (sphere.lastColumn + 1)) - 1) & ~((1 << sphere.firstColumn) - 1);
+			const __m128 centre = _mm_set1_ps(sphere.x);
+			const __m128 zero = _mm_setzero_ps();
+
+			for (unsigned int x = 0; x < GRID_X; x += 4)
+			{
+				const __m128 dx = _mm_max_ps(_mm_max_ps(_mm_sub_ps(_mm_loadu_ps(&pMinX[x]), centre), _mm_sub_ps(centre, _mm_loadu_ps(&pMaxX[x]))), zero);
+				_mm_storeu_ps(&distanceX[x], _mm_mul_ps(dx, dx));
+			}
+#else
+			for (unsigned int x = sphere.firstColumn; x <= sphere.lastColumn; x++)
+			{
+				const float dx = std::max(std::max(pMinX[x] - sphere.x, sphere.x - pMaxX[x]), 0.0f);
+				distanceX[x] = dx * dx;
+			}
+#endif
+
+			for (unsigned int y = sphere.firstRow; y <= sphere.lastRow; y++)
+			{
+				const float dy = std::max(std::max(pMinY[y] - sphere.y, sphere.y - pMaxY[y]), 0.0f);
+				const float limit = remaining - dy * dy;
+
+				if (limit < 0.0f)
+				{
+					continue;
+				}
+
+				const unsigned int first = getClusterIndex(0, y, slice);
+
+#if SPARKY_SSE
+				const __m128 limits = _mm_set1_ps(limit);
+
+				for (unsigned int x = 0; x < GRID_X; x += 4)
+				{
+					int mask = _mm_movemask_ps(_mm_cmple_ps(_mm_loadu_ps(&distanceX[x]), limits)) & (columns >> x);
+
+					while (mask)
+					{
+						const unsigned int lane = mask & 1 ? 0 : mask & 2 ? 1 : mask & 4 ? 2 : 3;
+						mask &= mask - 1;
+
+						const unsigned int cluster = first + x + lane;
+
+						if (m_counts[cluster] < MAX_CLUSTER_LIGHTS)
+						{
+							m_grid[cluster * MAX_CLUSTER_LIGHTS + m_counts[cluster]] = static_cast<unsigned short>(i);
+						}
+
+						m_counts[cluster]++;
+					}
+				}
+#else
+				for (unsigned int x = sphere.firstColumn; x <= sphere.lastColumn; x++)
+				{
+					if (distanceX[x] > limit)
+					{
+						continue;
+					}
+
+					const unsigned int cluster = first + x;
+
+					if (m_counts[cluster] < MAX_CLUSTER_LIGHTS)
+					{
+						m_grid[cluster * MAX_CLUSTER_LIGHTS + m_counts[cluster]] = static_cast<unsigned short>(i);
+					}
+
+					m_counts[cluster]++;
+				}
+#endif
+			}
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	void LightClusters::assign(const std::shared_ptr<AssignJob_t>& pJob)
+	{
+		unsigned int slice = pJob->next++;
+
+		while (slice < GRID_Z)
+		{
+			assign(slice);
+			pJob->done++;
+
+			slice = pJob->next++;
+		}
+	}
+
+	/*
+	====================
+	Getters and Setters
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	const std::vector<Cluster_t>& LightClusters::getClusters(void) const
+	{
+		return m_clusters;
+	}
+
+	////////////////////////////////////////////////////////////
+	const std::vector<unsigned short>& LightClusters::getIndices(void) const
+	{
+		return m_indices;
+	}
+
+	////////////////////////////////////////////////////////////
+	const ClusterStats_t& LightClusters::getStats(void) const
+	{
+		return m_stats;
+	}
+
+	////////////////////////////////////////////////////////////
+	const Rectf& LightClusters::getScreenBounds(void) const
+	{
+		return m_screenBounds;
+	}
+
+	////////////////////////////////////////////////////////////
+	float LightClusters::getSliceScale(void) const
+	{
+		return GRID_Z / std::log(m_farPlane / m_nearPlane);
+	}
+
+	////////////////////////////////////////////////////////////
+	float LightClusters::getSliceBias(void) const
+	{
+		return -std::log(m_nearPlane) * getSliceScale();
+	}
+
+	/*
+	====================
+	Methods
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	unsigned int LightClusters::getClusterIndex(const unsigned int x, const unsigned int y, const unsigned int z)
+	{
+		return (z * GRID_Y + y) * GRID_X + x;
+	}
+
+	////////////////////////////////////////////////////////////
+	void LightClusters::build(Camera& camera, const Vector4f* pSpheres, const unsigned int count)
+	{
+		const Vector2f& dimensions = camera.getDimensions();
+		setProjection(camera.getFoV(), dimensions.x / dimensions.y, camera.getNearPlane(), camera.getFarPlane());
+		//the same axes as the view matrix of the camera
+		const Transform& transform = camera.getTransform();
+		const Vector3f position = transform.getPosition();
+		const Vector3f forward = transform.forward().normalised();
+		const Vector3f right = Vector3f::cross(transform.up().normalised(), forward);
+		const Vector3f up = Vector3f::cross(forward, right);
+
+		m_spheres.clear();
+
+		float screenLeft = 1.0f, screenRight = -1.0f, screenBottom = 1.0f, screenTop = -1.0f;
+		unsigned int visible = 0;
+
+		for (unsigned int i = 0; i < count; i++)
+		{
+			const Vector3f offset = Vector3f(pSpheres[i].x, pSpheres[i].y, pSpheres[i].z) - position;
+
+			Sphere_t sphere;
+			sphere.x = Vector3f::dot(offset, right);
+			sphere.y = Vector3f::dot(offset, up);
+			sphere.z = Vector3f::dot(offset, forward);
+			sphere.radius = pSpheres[i].w;
+			//off screen or beyond the far plane, the light does not touch the grid
+			Rectf rect;
+
+			if (sphere.z - sphere.radius > m_farPlane || !Frustum::projectSphere(Vector3f(sphere.x, sphere.y, sphere.z), sphere.radius, m_fov, m_aspectRatio, m_nearPlane, rect))
+			{
+				sphere.firstSlice = GRID_Z;
+				sphere.lastSlice = 0;
+				sphere.firstColumn = sphere.lastColumn = 0;
+				sphere.firstRow = sphere.lastRow = 0;
+			}
+			else
+			{
+				sphere.firstSlice = getSlice(sphere.z - sphere.radius);
+				sphere.lastSlice = getSlice(sphere.z + sphere.radius);
+
+				const float rectRight = rect.position.x + rect.size.x;
+				const float rectTop = rect.position.y + rect.size.y;
+				//the edges are in normalised device coordinates, from -1 to 1
+				sphere.firstColumn = std::min(static_cast<unsigned int>((rect.position.x + 1.0f) * 0.5f * GRID_X), GRID_X - 1);
+				sphere.lastColumn = std::min(static_cast<unsigned int>((rectRight + 1.0f) * 0.5f * GRID_X), GRID_X - 1);
+				sphere.firstRow = std::min(static_cast<unsigned int>((rect.position.y + 1.0f) * 0.5f * GRID_Y), GRID_Y - 1);
+				sphere.lastRow = std::min(static_cast<unsigned int>((rectTop + 1.0f) * 0.5f * GRID_Y), GRID_Y - 1);
+
+				screenLeft = std::min(screenLeft, rect.position.x);
+				screenBottom = std::min(screenBottom, rect.position.y);
+				screenRight = std::max(screenRight, rectRight);
+				screenTop = std::max(screenTop, rectTop);
+
+				visible++;
+			}
+
+			m_spheres.push_back(sphere);
+		}
+
+		std::fill(m_counts.begin(), m_counts.end(), 0);
+
+		//taken from the frame's memory, which is only reused two frames later, long after the workers have let go of it
+		std::shared_ptr<AssignJob_t> pJob = std::allocate_shared<AssignJob_t>(FrameAllocatorAdaptor<AssignJob_t>());
+		pJob->next = 0;
+		pJob->done = 0;
+		//every slice writes only to its own clusters, so the slices can be assigned from any thread
+		if (count >= m_sParallelLights)
+		{
+			const unsigned int tasks = std::min(std::thread::hardware_concurrency(), GRID_Z);
+
+			for (unsigned int i = 1; i < tasks; i++)
+			{
+				ThreadManager::getInstance().addTask([this, pJob]{ assign(pJob); });
+			}
+		}
+
+		assign(pJob);
+		//the remaining slices have been claimed by the workers and are already being assigned
+		while (pJob->done < GRID_Z)
+		{
+			std::this_thread::yield();
+		}
+
+		m_indices.clear();
+
+		m_screenBounds = Rectf(screenLeft, screenBottom, screenRight - screenLeft, screenTop - screenBottom);
+
+		m_stats.lights = count;
+		m_stats.visibleLights = visible;
+		m_stats.maxLights = 0;
+		m_stats.overflow = 0;
+
+		for (unsigned int i = 0; i < m_clusters.size(); i++)
+		{
+			const unsigned int lights = std::min(m_counts[i], MAX_CLUSTER_LIGHTS);
+
+			m_clusters[i].offset = static_cast<unsigned int>(m_indices.size());
+			m_clusters[i].count = lights;
+
+			m_indices.insert(m_indices.end(), &m_grid[i * MAX_CLUSTER_LIGHTS], &m_grid[i * MAX_CLUSTER_LIGHTS] + lights);
+
+			m_stats.maxLights = std::max(m_stats.maxLights, m_counts[i]);
+			m_stats.overflow += m_counts[i] - lights;
+		}
+
+		m_stats.references = static_cast<unsigned int>(m_indices.size());
+	}
+
+}//namespace sparky
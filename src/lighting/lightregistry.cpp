@@ -0,0 +1,269 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// 
+// Sparky Engine
+// 2016 - Benjamin Carter (benjamin.mark.carter@hotmail.com)
+// 
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+// 
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+// 
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgement
+//    in the product documentation would be appreciated but is not required.
+// 
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+// 
+// 3. This notice may not be removed or altered from any source distribution.
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+====================
+CPP Includes
+====================
+*/
+#include <algorithm>							// Growing the dirty range of a table.
+#include <cstddef>								// The offsets of the packed light arrays.
+/*
+====================
+Class Includes
+====================
+*/
+#include <sparky\lighting\lightregistry.hpp>	// Class definition.
+#include <sparky\math\vector4.hpp>				// The size of each packed element.
+#include <sparky\utils\debug.hpp>				// Warning when the registry is full.
+
+namespace sparky
+{
+	/*
+	====================
+	Static Fields
+	====================
+	*/
+	const unsigned int LightRegistry::INVALID_HANDLE;
+	const unsigned int LightRegistry::m_sTypeCount;
+
+	/*
+	====================
+	Private Ctor
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	LightRegistry::LightRegistry(void)
+		: Singleton<LightRegistry>(), m_buffer(), m_countsDirty(true)
+	{
+		for (unsigned int i = 0; i < m_sTypeCount; i++)
+		{
+			m_tables[i].dirtyBegin = 0;
+			m_tables[i].dirtyEnd = 0;
+		}
+
+		m_tables[static_cast<unsigned int>(eLightType::DIRECTIONAL)].capacity = MAX_DIRECTIONAL_LIGHTS;
+		m_tables[static_cast<unsigned int>(eLightType::POINT)].capacity = MAX_POINT_LIGHTS;
+
+		m_data.pointCount = 0;
+		m_data.directionalCount = 0;
+		m_data.padding[0] = 0;
+		m_data.padding[1] = 0;
+
+		m_stats.lights = 0;
+		m_stats.packedLights = 0;
+		m_stats.uploadedBytes = 0;
+	}
+
+	/*
+	====================
+	Private Methods
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	void LightRegistry::markDirty(Table_t& table, const unsigned int index)
+	{
+		if (table.dirtyBegin == table.dirtyEnd)
+		{
+			table.dirtyBegin = index;
+			table.dirtyEnd = index + 1;
+		}
+		else
+		{
+			table.dirtyBegin = std::min(table.dirtyBegin, index);
+			table.dirtyEnd = std::max(table.dirtyEnd, index + 1);
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	void LightRegistry::uploadTable(const eLightType type)
+	{
+		Table_t& table = m_tables[static_cast<unsigned int>(type)];
+		//removing the last lights can leave the range past the end of the table
+		const unsigned int end = std::min(table.dirtyEnd, static_cast<unsigned int>(table.lights.size()));
+		const unsigned int begin = table.dirtyBegin;
+
+		table.dirtyBegin = 0;
+		table.dirtyEnd = 0;
+
+		if (begin >= end)
+		{
+			return;
+		}
+
+		for (unsigned int i = begin; i < end; i++)
+		{
+			table.lights[i]->pack(m_data, i);
+		}
+
+		m_stats.packedLights += end - begin;
+
+		const size_t offset = begin * sizeof(Vector4f);
+		const size_t size = (end - begin) * sizeof(Vector4f);
+
+		if (type == eLightType::POINT)
+		{
+			uploadRange(offsetof(LightData_t, positionRange) + offset, size);
+			uploadRange(offsetof(LightData_t, colourIntensity) + offset, size);
+			uploadRange(offsetof(LightData_t, attenuation) + offset, size);
+		}
+		else
+		{
+			uploadRange(offsetof(LightData_t, direction) + offset, size);
+			uploadRange(offsetof(LightData_t, directionalColourIntensity) + offset, size);
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	void LightRegistry::uploadRange(const size_t offset, const size_t size)
+	{
+		m_buffer.upload(static_cast<GLintptr>(offset), reinterpret_cast<const char*>(&m_data) + offset, static_cast<GLsizeiptr>(size));
+		m_stats.uploadedBytes += static_cast<unsigned int>(size);
+	}
+
+	/*
+	====================
+	Getters and Setters
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	const LightData_t& LightRegistry::getData(void) const
+	{
+		return m_data;
+	}
+
+	////////////////////////////////////////////////////////////
+	unsigned int LightRegistry::getCount(const eLightType type) const
+	{
+		return static_cast<unsigned int>(m_tables[static_cast<unsigned int>(type)].lights.size());
+	}
+
+	////////////////////////////////////////////////////////////
+	const LightRegistryStats_t& LightRegistry::getStats(void) const
+	{
+		return m_stats;
+	}
+
+	/*
+	====================
+	Methods
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	unsigned int LightRegistry::add(Light* pLight)
+	{
+		Table_t& table = m_tables[static_cast<unsigned int>(pLight->getType())];
+
+		if (table.lights.size() >= table.capacity)
+		{
+			DebugLog::warning("The LightRegistry is full, the light", pLight->getName(), "has not been added.");
+			return INVALID_HANDLE;
+		}
+
+		unsigned int handle = static_cast<unsigned int>(table.slots.size());
+
+		if (!table.freeHandles.empty())
+		{
+			handle = table.freeHandles.back();
+			table.freeHandles.pop_back();
+		}
+		else
+		{
+			table.slots.push_back(0);
+		}
+
+		const unsigned int index = static_cast<unsigned int>(table.lights.size());
+
+		table.slots[handle] = index;
+		table.lights.push_back(pLight);
+		table.owners.push_back(handle);
+
+		markDirty(table, index);
+		m_countsDirty = true;
+		m_stats.lights++;
+
+		return handle;
+	}
+
+	////////////////////////////////////////////////////////////
+	void LightRegistry::remove(const eLightType type, const unsigned int handle)
+	{
+		Table_t& table = m_tables[static_cast<unsigned int>(type)];
+
+		const unsigned int index = table.slots[handle];
+		const unsigned int last = static_cast<unsigned int>(table.lights.size()) - 1;
+		//the last light fills the gap, so the lights stay densely packed for the shaders
+		if (index != last)
+		{
+			table.lights[index] = table.lights[last];
+			table.owners[index] = table.owners[last];
+			table.slots[table.owners[index]] = index;
+
+			markDirty(table, index);
+		}
+
+		table.lights.pop_back();
+		table.owners.pop_back();
+		table.freeHandles.push_back(handle);
+
+		m_countsDirty = true;
+		m_stats.lights--;
+	}
+
+	////////////////////////////////////////////////////////////
+	void LightRegistry::invalidate(const eLightType type, const unsigned int handle)
+	{
+		Table_t& table = m_tables[static_cast<unsigned int>(type)];
+
+		markDirty(table, table.slots[handle]);
+	}
+
+	////////////////////////////////////////////////////////////
+	void LightRegistry::upload(void)
+	{
+		m_stats.packedLights = 0;
+		m_stats.uploadedBytes = 0;
+
+		if (!m_buffer.getID())
+		{
+			m_buffer.generate();
+			m_buffer.allocate(sizeof(LightData_t));
+			m_buffer.bindBase(UNIFORM_BINDING_LIGHTS);
+		}
+
+		uploadTable(eLightType::DIRECTIONAL);
+		uploadTable(eLightType::POINT);
+
+		if (m_countsDirty)
+		{
+			m_data.pointCount = getCount(eLightType::POINT);
+			m_data.directionalCount = getCount(eLightType::DIRECTIONAL);
+
+			uploadRange(offsetof(LightData_t, pointCount), 4 * sizeof(unsigned int));
+
+			m_countsDirty = false;
+		}
+	}
+
+}//namespace sparky
\ No newline at end of file
@@ -28,9 +28,7 @@ Class Includes
 ====================
 */
 #include <sparky\lighting\pointlight.hpp>	// Class definition.
-#include <sparky\rendering\uniform.hpp>		// Set the variables within the shader.
-#include <sparky\math\frustum.hpp>			// Check if the point light is within the current frame.
-#include <sparky\core\gamemanager.hpp>		// Add the current light to the game manager.
+#include <sparky\rendering\buffers.hpp>		// The layout of the packed light data.
 
 namespace sparky
 {
@@ -41,7 +39,7 @@ namespace sparky
 	*/
 	////////////////////////////////////////////////////////////
 	PointLight::PointLight(const SPARKY_POINT_LIGHT_DESC& desc)
-		: Light(desc.base), m_attenuation(desc.attenuation), m_range(desc.range)
+		: Light(desc.base, eLightType::POINT), m_attenuation(desc.attenuation), m_range(desc.range)
 	{
 	}
 
@@ -60,6 +58,7 @@ namespace sparky
 	void PointLight::setAttenuation(const Attenuation& attenuation)
 	{
 		m_attenuation = attenuation;
+		invalidate();
 	}
 
 	////////////////////////////////////////////////////////////
@@ -72,6 +71,7 @@ namespace sparky
 	void PointLight::setRange(const float range)
 	{
 		m_range = range;
+		invalidate();
 	}
 
 	/*
@@ -80,24 +80,14 @@ namespace sparky
 	====================
 	*/
 	////////////////////////////////////////////////////////////
-	void PointLight::setUniforms(Uniform& uniform)
+	void PointLight::pack(LightData_t& data, const unsigned int index) const
 	{
-		Light::setUniforms(uniform, ".base");
+		const Vector3f& position = getPosition();
+		const Vector3f& colour = getColour();
 
-		uniform.setParameter(String::concat(this->getName(), ".attenuation.constant"), m_attenuation.constant);
-		uniform.setParameter(String::concat(this->getName(), ".attenuation.linear"),   m_attenuation.linear);
-		uniform.setParameter(String::concat(this->getName(), ".attenuation.exponent"), m_attenuation.exponent);
-
-		uniform.setParameter(String::concat(this->getName(), ".range"), m_range);
-	}
-
-	////////////////////////////////////////////////////////////
-	void PointLight::addLight(void)
-	{
-		if (Frustum::checkSphere(getPosition(), m_range))
-		{
-			GameManager::getInstance().addLight(this);
-		}
+		data.positionRange[index] = Vector4f(position.x, position.y, position.z, m_range);
+		data.colourIntensity[index] = Vector4f(colour.x, colour.y, colour.z, getIntensity());
+		data.attenuation[index] = Vector4f(m_attenuation.constant, m_attenuation.linear, m_attenuation.exponent, 0.0f);
 	}
 
 }//namespace sparky
\ No newline at end of file
@@ -22,6 +22,13 @@
 //
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
+/*
+====================
+CPP Includes
+====================
+*/
+#include <algorithm>					// Clamping the projected area to the screen.
+#include <cmath>						// The tangents of the field of view and sphere.
 /*
 ====================
 Class Includes
@@ -29,6 +36,7 @@ Class Includes
 */
 #include <sparky\math\frustum.hpp>	// Class definition.
 #include <sparky\core\camera.hpp>	// Frustum constructed from the Camera's viewport.
+#include <sparky\math\mathutils.hpp>	// Converting the field of view to radians.
 
 namespace sparky
 {
@@ -39,6 +47,59 @@ namespace sparky
 	*/
 	std::array<FrustumPlane_t, 6> Frustum::m_planes;
 
+	/*
+	====================
+	Private Methods
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	void Frustum::projectCircle(const float u, const float z, const float radius, const float nearPlane, const float tanHalfFoV, float& min, float& max)
+	{
+		const float distanceSqr = u * u + z * z;
+		const float radiusSqr = radius * radius;
+		//the eye is inside the circle, so it covers the whole axis
+		if (distanceSqr <= radiusSqr)
+		{
+			min = -1.0f;
+			max = 1.0f;
+			return;
+		}
+
+		min = 1.0f;
+		max = -1.0f;
+
+		const float tangent = std::sqrt(distanceSqr - radiusSqr);
+		const float scale = tangent / distanceSqr;
+		//the two points where a line from the eye touches the circle
+		const float touchU[2] = { (u * tangent - z * radius) * scale, (u * tangent + z * radius) * scale };
+		const float touchZ[2] = { (u * radius + z * tangent) * scale, (z * tangent - u * radius) * scale };
+
+		bool clipped = false;
+
+		for (unsigned int i = 0; i < 2; i++)
+		{
+			if (touchZ[i] < nearPlane)
+			{
+				clipped = true;
+				continue;
+			}
+
+			const float ndc = touchU[i] / (touchZ[i] * tanHalfFoV);
+
+			min = std::min(min, ndc);
+			max = std::max(max, ndc);
+		}
+		//the edges of the visible part lie on the near plane instead
+		if (clipped)
+		{
+			const float depth = nearPlane - z;
+			const float chord = std::sqrt(std::max(radiusSqr - depth * depth, 0.0f));
+
+			min = std::min(min, (u - chord) / (nearPlane * tanHalfFoV));
+			max = std::max(max, (u + chord) / (nearPlane * tanHalfFoV));
+		}
+	}
+
 	/*
 	====================
 	Methods
@@ -254,4 +315,34 @@ namespace sparky
 
 		return true;
 	}
+	////////////////////////////////////////////////////////////
+	bool Frustum::projectSphere(const Vector3f& centre, const float radius, const float fov, const float aspectRatio, const float nearPlane, Rectf& rect)
+	{
+		if (centre.z + radius < nearPlane)
+		{
+			return false;
+		}
+
+		const float tanY = std::tan(MathUtils<float>::toRadians(fov / 2.0f));
+		const float tanX = tanY * aspectRatio;
+
+		float left, right, bottom, top;
+		projectCircle(centre.x, centre.z, radius, nearPlane, tanX, left, right);
+		projectCircle(centre.y, centre.z, radius, nearPlane, tanY, bottom, top);
+
+		left = std::max(left, -1.0f);
+		bottom = std::max(bottom, -1.0f);
+		right = std::min(right, 1.0f);
+		top = std::min(top, 1.0f);
+
+		if (left >= right || bottom >= top)
+		{
+			return false;
+		}
+
+		rect = Rectf(left, bottom, right - left, top - bottom);
+
+		return true;
+	}
+
 }//namespace sparky
\ No newline at end of file
@@ -22,12 +22,6 @@
 //
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
-/*
-====================
-CPP Includes
-====================
-*/
-#include <fstream>							// Needed for initially opening and reading the text of the shader file.
 /*
 ====================
 Class Includes
@@ -35,6 +29,8 @@ Class Includes
 */
 #include <sparky\rendering\GLSLobject.hpp>	// Class definition.
 #include <sparky\utils\debug.hpp>			// Needed for stating errors that occur during parsing and compilation of shader.
+#include <sparky\rendering\shaderregistry.hpp>	// The preprocessed source of the shader.
+#include <sparky\utils\gldevice.hpp>			// Compiling through the OpenGL function table.
 
 namespace sparky
 {
@@ -45,17 +41,14 @@ namespace sparky
 	*/
 	////////////////////////////////////////////////////////////
 	GLSLObject::GLSLObject(const String& filename, const eShaderType type)
-		: Ref(), m_ID(0), m_filename(filename), m_source(), m_type(), m_compiled(false), m_includes()
+		: Ref(), m_ID(0), m_filename(filename), m_source(), m_type(), m_compiled(false)
 	{
 		if (!m_filename.endsWith(".glsl"))
 		{
 			DebugLog::error("Shader:", m_filename, "has incorrect file extension.");
 		}
 
-		if (!parse(m_filename))
-		{
-			DebugLog::error("Shader:", m_filename, "has failed to parse.");
-		}
+		ShaderRegistry::getInstance().getSource(m_filename, m_source);
 
 		switch (type)
 		{
@@ -72,11 +65,9 @@ namespace sparky
 	////////////////////////////////////////////////////////////
 	GLSLObject::~GLSLObject(void)
 	{
-		m_includes.clear();
-
 		if (m_ID)
 		{
-			glDeleteShader(m_ID);
+			GLDevice::getFunctions().deleteShader(m_ID);
 			m_ID = NULL;
 		}
 	}
@@ -98,81 +89,6 @@ namespace sparky
 		return m_compiled;
 	}
 
-	/*
-	====================
-	Private Methods
-	====================
-	*/
-	////////////////////////////////////////////////////////////
-	bool GLSLObject::parse(const String& filename)
-	{
-		const String include = "#include";
-		std::ifstream file;
-
-		file.open(filename.getCString(), std::ios::in | std::ios::binary);
-
-		if (file.fail())
-		{
-			DebugLog::warning("Failed to load Shader:", filename);
-			return false;
-		}
-
-		String line;
-
-		while (file.good())
-		{
-			//gets the current line from the shader file
-			String::getline(file, line);
-			//store a temporary line of the current line in the file
-			String temp = line;
-			//trim it and cut out all whitespace
-			temp.trim();
-			//checks if the current line is an include
-			if (temp.beginsWith(include))
-			{
-				//get the theoretical location of the opening and closing brackets of the include
-				char start = temp[include.getLength()];
-				char end = temp[temp.getLength() - 1];
-				//checks that the include statement is correctly formatted
-				if (start != '"' || end != '"')
-				{
-					DebugLog::warning("Incorrect include statement in", filename);
-					return false;
-				}
-				//as it is an include statement, we should clear the line before we append, otherwise it will give an
-				//error as #include is not a directive of GLSL and will cause compilation errors
-				line.clear();
-				//get the file name of the include statement
-				String includeFile = temp.substring(include.getLength() + 1, temp.getLength() - 1);
-				//make sure it has the correct file extension
-				if (!includeFile.endsWith(".glsl"))
-				{
-					DebugLog::error(includeFile, "has incorrect file extension");
-				}
-
-				for (const auto& inc : m_includes)
-				{
-					if (includeFile == inc)
-					{
-						DebugLog::warning(includeFile, "has already been included in the current context, clearing include.");
-						includeFile.clear();
-					}
-				}
-
-				if (!includeFile.isEmpty())
-				{
-					m_includes.push_back(includeFile);
-					//get the location of the shaders + the file location of the include statement and recursively parse it
-					parse(String("shaders/") + includeFile);
-				}
-			}
-			//append the line of the shader to the source
-			m_source.append(line);
-		}
-
-		return true;
-	}
-
 	/*
 	====================
 	Methods
@@ -181,33 +97,35 @@ namespace sparky
 	////////////////////////////////////////////////////////////
 	void GLSLObject::compile(void)
 	{
+		const GLFunctions_t& gl = GLDevice::getFunctions();
+
 		if (!m_compiled)
 		{
 			//create a LE_Shader id with the type passed in
-			GLuint ID = glCreateShader(m_type);
+			GLuint ID = gl.createShader(m_type);
 			//convert the file into a char array
 			const GLchar* file = m_source.getCString();
 			//set the LE_Shader source
-			glShaderSource(ID, 1, (const GLchar**)&file, nullptr);
+			gl.shaderSource(ID, 1, (const GLchar**)&file, nullptr);
 			//compile the LE_Shader
-			glCompileShader(ID);
+			gl.compileShader(ID);
 			//error checking
 			GLint status;
-			glGetShaderiv(ID, GL_COMPILE_STATUS, &status);
+			gl.getShaderiv(ID, GL_COMPILE_STATUS, &status);
 
 			if (status != GL_TRUE)
 			{
 				DebugLog::warning("Unable to compile shader:", m_filename);
 
 				GLint logSize = 0;
-				glGetShaderiv(ID, GL_INFO_LOG_LENGTH, &logSize);
+				gl.getShaderiv(ID, GL_INFO_LOG_LENGTH, &logSize);
 
 				std::vector<GLchar> errorLog(logSize);
-				glGetShaderInfoLog(ID, logSize, &logSize, &errorLog[0]);
+				gl.getShaderInfoLog(ID, logSize, &logSize, &errorLog[0]);
 
 				DebugLog::warning(&errorLog[0]);
 
-				glDeleteShader(ID);
+				gl.deleteShader(ID);
 				ID = NULL;
 			}
 			else
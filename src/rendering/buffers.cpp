@@ -34,6 +34,7 @@ Class Includes
 ====================
 */
 #include <sparky\rendering\buffers.hpp>		// Class definitions.
+#include <sparky\utils\gldevice.hpp>		// Vertex array binds are filtered by the device's state cache.
 
 namespace sparky
 {
@@ -45,6 +46,7 @@ namespace sparky
 	////////////////////////////////////////////////////////////
 	const int VERTEX_ELEMENTS = 3;
 	const int TEXTURE_ELEMENTS = 2;
+	const int LAYER_ELEMENTS = 1;
 
 	////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 	/// BUFFER
@@ -63,17 +65,19 @@ namespace sparky
 	////////////////////////////////////////////////////////////
 	Buffer::~Buffer(void)
 	{
+		const GLFunctions_t& gl = GLDevice::getFunctions();
+
 		this->disableAttributes();
 
 		if (m_ibo)
 		{
-			glDeleteBuffers(1, &m_ibo);
+			gl.deleteBuffers(1, &m_ibo);
 			m_ibo = NULL;
 		}
 
 		if (m_vbo)
 		{
-			glDeleteBuffers(1, &m_vbo);
+			gl.deleteBuffers(1, &m_vbo);
 			m_vbo = NULL;
 		}
 	}
@@ -86,38 +90,63 @@ namespace sparky
 	////////////////////////////////////////////////////////////
 	void Buffer::generate(void)
 	{
-		glGenBuffers(1, &m_vbo);
-		glGenBuffers(1, &m_ibo);
+		const GLFunctions_t& gl = GLDevice::getFunctions();
+
+		gl.genBuffers(1, &m_vbo);
+		gl.genBuffers(1, &m_ibo);
 	}
 
 	////////////////////////////////////////////////////////////
 	void Buffer::bind(const std::vector<Vertex_t>& vertices, const std::vector<GLuint>& indices)
 	{
-		glBindBuffer(GL_ARRAY_BUFFER, m_vbo);
-		glBufferData(GL_ARRAY_BUFFER, sizeof(Vertex_t) * vertices.size(), &vertices[0], GL_STATIC_DRAW);
+		this->bind(&vertices[0], vertices.size(), &indices[0], indices.size());
+	}
+
+	////////////////////////////////////////////////////////////
+	void Buffer::bind(const Vertex_t* pVertices, const GLuint vertexCount, const GLuint* pIndices, const GLuint indexCount)
+	{
+		const GLFunctions_t& gl = GLDevice::getFunctions();
+
+		gl.bindBuffer(GL_ARRAY_BUFFER, m_vbo);
+		gl.bufferData(GL_ARRAY_BUFFER, sizeof(Vertex_t) * vertexCount, pVertices, GL_STATIC_DRAW);
 
-		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_ibo);
-		glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(GLuint) * indices.size(), &indices[0], GL_STATIC_DRAW);
+		gl.bindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_ibo);
+		gl.bufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(GLuint) * indexCount, pIndices, GL_STATIC_DRAW);
 
-		glVertexAttribPointer(ATTRIB_LOCATION_VERTEX, VERTEX_ELEMENTS,  GL_FLOAT, GL_FALSE, sizeof(Vertex_t), reinterpret_cast<const GLvoid*>(offsetof(Vertex_t, position)));
-		glVertexAttribPointer(ATTRIB_LOCATION_NORMAL, VERTEX_ELEMENTS,  GL_FLOAT, GL_FALSE, sizeof(Vertex_t), reinterpret_cast<const GLvoid*>(offsetof(Vertex_t, normal)));
-		glVertexAttribPointer(ATTRIB_LOCATION_UV,     TEXTURE_ELEMENTS, GL_FLOAT, GL_FALSE, sizeof(Vertex_t), reinterpret_cast<const GLvoid*>(offsetof(Vertex_t, uv)));
+		setAttributePointers();
+	}
+
+	////////////////////////////////////////////////////////////
+	void Buffer::setAttributePointers(void)
+	{
+		const GLFunctions_t& gl = GLDevice::getFunctions();
+
+		gl.vertexAttribPointer(ATTRIB_LOCATION_VERTEX, VERTEX_ELEMENTS,  GL_FLOAT, GL_FALSE, sizeof(Vertex_t), reinterpret_cast<const GLvoid*>(offsetof(Vertex_t, position)));
+		gl.vertexAttribPointer(ATTRIB_LOCATION_NORMAL, VERTEX_ELEMENTS,  GL_FLOAT, GL_FALSE, sizeof(Vertex_t), reinterpret_cast<const GLvoid*>(offsetof(Vertex_t, normal)));
+		gl.vertexAttribPointer(ATTRIB_LOCATION_UV,     TEXTURE_ELEMENTS, GL_FLOAT, GL_FALSE, sizeof(Vertex_t), reinterpret_cast<const GLvoid*>(offsetof(Vertex_t, uv)));
+		gl.vertexAttribPointer(ATTRIB_LOCATION_LAYER,  LAYER_ELEMENTS,   GL_FLOAT, GL_FALSE, sizeof(Vertex_t), reinterpret_cast<const GLvoid*>(offsetof(Vertex_t, layer)));
 	}
 
 	////////////////////////////////////////////////////////////
 	void Buffer::enableAttributes(void)
 	{
-		glEnableVertexAttribArray(ATTRIB_LOCATION_VERTEX);
-		glEnableVertexAttribArray(ATTRIB_LOCATION_NORMAL);
-		glEnableVertexAttribArray(ATTRIB_LOCATION_UV);
+		const GLFunctions_t& gl = GLDevice::getFunctions();
+
+		gl.enableVertexAttribArray(ATTRIB_LOCATION_VERTEX);
+		gl.enableVertexAttribArray(ATTRIB_LOCATION_NORMAL);
+		gl.enableVertexAttribArray(ATTRIB_LOCATION_UV);
+		gl.enableVertexAttribArray(ATTRIB_LOCATION_LAYER);
 	}
 
 	////////////////////////////////////////////////////////////
 	void Buffer::disableAttributes(void)
 	{
-		glDisableVertexAttribArray(ATTRIB_LOCATION_UV);
-		glEnableVertexAttribArray(ATTRIB_LOCATION_NORMAL);
-		glDisableVertexAttribArray(ATTRIB_LOCATION_VERTEX);
+		const GLFunctions_t& gl = GLDevice::getFunctions();
+
+		gl.disableVertexAttribArray(ATTRIB_LOCATION_LAYER);
+		gl.disableVertexAttribArray(ATTRIB_LOCATION_UV);
+		gl.enableVertexAttribArray(ATTRIB_LOCATION_NORMAL);
+		gl.disableVertexAttribArray(ATTRIB_LOCATION_VERTEX);
 	}
 
 
@@ -140,27 +169,226 @@ namespace sparky
 	{
 		if (m_vao)
 		{
-			glDeleteVertexArrays(1, &m_vao);
+			GLDevice::releaseVertexArray(m_vao);
+			GLDevice::getFunctions().deleteVertexArrays(1, &m_vao);
 			m_vao = NULL;
 		}
 	}
 
+	/*
+	====================
+	Getters and Setters
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	GLuint ArrayBuffer::getID(void) const
+	{
+		return m_vao;
+	}
+
+	/*
+	====================
+	Methods
+	====================
+	*/
 	////////////////////////////////////////////////////////////
 	void ArrayBuffer::generate(void)
 	{
-		glGenVertexArrays(1, &m_vao);
+		GLDevice::getFunctions().genVertexArrays(1, &m_vao);
 	}
 
 	////////////////////////////////////////////////////////////
 	void ArrayBuffer::bind(void)
 	{
-		glBindVertexArray(m_vao);
+		GLDevice::bindVertexArray(m_vao);
 	}
 
 	////////////////////////////////////////////////////////////
 	void ArrayBuffer::unbind(void)
 	{
-		glBindVertexArray(NULL);
+		GLDevice::bindVertexArray(NULL);
+	}
+
+
+	////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// UNIFORM BUFFER
+	////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/*
+	====================
+	Ctor and Dtor
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	UniformBuffer::UniformBuffer(void)
+		: m_ubo(0), m_size(0)
+	{
+	}
+
+	////////////////////////////////////////////////////////////
+	UniformBuffer::~UniformBuffer(void)
+	{
+		if (m_ubo)
+		{
+			GLDevice::getFunctions().deleteBuffers(1, &m_ubo);
+			m_ubo = NULL;
+		}
+	}
+
+	/*
+	====================
+	Getters and Setters
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	GLuint UniformBuffer::getID(void) const
+	{
+		return m_ubo;
+	}
+
+	////////////////////////////////////////////////////////////
+	GLsizeiptr UniformBuffer::getSize(void) const
+	{
+		return m_size;
+	}
+
+	////////////////////////////////////////////////////////////
+	unsigned int UniformBuffer::getOffsetAlignment(void)
+	{
+		static GLint alignment = 0;
+
+		if (!alignment)
+		{
+			GLDevice::getFunctions().getIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment);
+		}
+
+		return alignment > 0 ? static_cast<unsigned int>(alignment) : 1;
+	}
+
+	/*
+	====================
+	Methods
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	void UniformBuffer::generate(void)
+	{
+		GLDevice::getFunctions().genBuffers(1, &m_ubo);
+	}
+
+	////////////////////////////////////////////////////////////
+	void UniformBuffer::allocate(const GLsizeiptr size, const void* pData/*= nullptr*/)
+	{
+		const GLFunctions_t& gl = GLDevice::getFunctions();
+
+		gl.bindBuffer(GL_UNIFORM_BUFFER, m_ubo);
+		gl.bufferData(GL_UNIFORM_BUFFER, size, pData, GL_STREAM_DRAW);
+
+		m_size = size;
+	}
+
+	////////////////////////////////////////////////////////////
+	void UniformBuffer::upload(const GLintptr offset, const void* pData, const GLsizeiptr size)
+	{
+		const GLFunctions_t& gl = GLDevice::getFunctions();
+
+		gl.bindBuffer(GL_UNIFORM_BUFFER, m_ubo);
+		gl.bufferSubData(GL_UNIFORM_BUFFER, offset, size, pData);
+	}
+
+	////////////////////////////////////////////////////////////
+	void UniformBuffer::bindBase(const GLuint binding) const
+	{
+		GLDevice::getFunctions().bindBufferBase(GL_UNIFORM_BUFFER, binding, m_ubo);
+	}
+
+	////////////////////////////////////////////////////////////
+	void UniformBuffer::bindRange(const GLuint binding, const GLintptr offset, const GLsizeiptr size) const
+	{
+		GLDevice::getFunctions().bindBufferRange(GL_UNIFORM_BUFFER, binding, m_ubo, offset, size);
+	}
+
+	////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// TEXTURE BUFFER
+	////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/*
+	====================
+	Ctor and Dtor
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	TextureBuffer::TextureBuffer(void)
+		: m_buffer(0), m_texture(0), m_size(0)
+	{
+	}
+
+	////////////////////////////////////////////////////////////
+	TextureBuffer::~TextureBuffer(void)
+	{
+		const GLFunctions_t& gl = GLDevice::getFunctions();
+
+		if (m_texture)
+		{
+			GLDevice::releaseTexture(m_texture);
+			gl.deleteTextures(1, &m_texture);
+			m_texture = NULL;
+		}
+
+		if (m_buffer)
+		{
+			gl.deleteBuffers(1, &m_buffer);
+			m_buffer = NULL;
+		}
+	}
+
+	/*
+	====================
+	Getters and Setters
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	GLuint TextureBuffer::getTexture(void) const
+	{
+		return m_texture;
+	}
+
+	////////////////////////////////////////////////////////////
+	GLsizeiptr TextureBuffer::getSize(void) const
+	{
+		return m_size;
+	}
+
+	/*
+	====================
+	Methods
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	void TextureBuffer::generate(const GLenum format)
+	{
+		const GLFunctions_t& gl = GLDevice::getFunctions();
+
+		gl.genBuffers(1, &m_buffer);
+		gl.genTextures(1, &m_texture);
+		//the texture keeps reading the buffer object when its storage is replaced, so it is only attached once
+		GLDevice::bindTexture(GL_TEXTURE_BUFFER, 0, m_texture);
+		gl.texBuffer(GL_TEXTURE_BUFFER, format, m_buffer);
+	}
+
+	////////////////////////////////////////////////////////////
+	void TextureBuffer::allocate(const GLsizeiptr size, const void* pData)
+	{
+		const GLFunctions_t& gl = GLDevice::getFunctions();
+
+		gl.bindBuffer(GL_TEXTURE_BUFFER, m_buffer);
+		gl.bufferData(GL_TEXTURE_BUFFER, size, pData, GL_STREAM_DRAW);
+
+		m_size = size;
+	}
+
+	////////////////////////////////////////////////////////////
+	void TextureBuffer::bind(const GLuint unit) const
+	{
+		GLDevice::bindTexture(GL_TEXTURE_BUFFER, unit, m_texture);
 	}
 
 }//namespace sparky
\ No newline at end of file
@@ -28,26 +28,32 @@ Class Includes
 ====================
 */
 #include <sparky\rendering\deferredshader.hpp>	// Class definition.
-#include <sparky\math\transform.hpp>			// The Transform functionality of the rendering object.
-#include <sparky\core\camera.hpp>				// Calculating the model, view, projection matrix.
+#include <sparky\rendering\buffers.hpp>		// The bindings of the uniform blocks.
+#include <sparky\utils\string.hpp>			// Naming the uniform blocks.
 
 namespace sparky
 {
 	////////////////////////////////////////////////////////////
 	DeferredShader::DeferredShader(void)
-		: IShaderComponent("shaders/deferred_vertex.glsl", "shaders/deferred_fragment.glsl")
+		: IShaderComponent("shaders/deferred_vertex.glsl", "shaders/deferred_fragment.glsl"), 
+		  m_textureLocation(-1)
 	{
+		loadUniforms();
 	}
 	
 	////////////////////////////////////////////////////////////
-	void DeferredShader::update(const Transform& transform)
+	void DeferredShader::loadUniforms(void)
 	{
-		Matrix4f mvp = transform.getTransformation() * Camera::getMain().getViewProjection();
+		m_pProgram->setBlockBinding("FrameData", UNIFORM_BINDING_FRAME);
+		m_pProgram->setBlockBinding("ObjectData", UNIFORM_BINDING_OBJECT);
 
-		m_uniform.setParameter("u_mvp", mvp);
-		m_uniform.setParameter("u_model", transform.getTransformation());
+		m_textureLocation = m_uniform.getLocation("u_texture");
+	}
 
-		m_uniform.setParameter("u_texture", 0);
+	////////////////////////////////////////////////////////////
+	void DeferredShader::update(const Transform& transform)
+	{
+		m_uniform.setParameter(m_textureLocation, 0);
 	}
 
 }//namespace sparky
\ No newline at end of file
@@ -28,9 +28,8 @@ Class Includes
 ====================
 */
 #include <sparky\rendering\directionalshader.hpp> // Class definition.
+#include <sparky\rendering\buffers.hpp>		  // The binding of the Lights uniform block.
 #include <sparky\math\transform.hpp>		      // Setting uniform variables.
-#include <sparky\core\camera.hpp>			      // Needed for view and projection matrices.
-#include <sparky\lighting\directionallight.hpp>   // Update the uniforms of the light.
 
 namespace sparky
 {
@@ -41,8 +40,9 @@ namespace sparky
 	*/
 	////////////////////////////////////////////////////////////
 	DirectionalShader::DirectionalShader(void)
-		: IShaderComponent("shaders/directional_vertex.glsl", "shaders/directional_fragment.glsl"), m_pLight(nullptr)
+		: IShaderComponent("shaders/directional_vertex.glsl", "shaders/directional_fragment.glsl"), m_normalLocation(-1), m_diffuseLocation(-1)
 	{
+		loadUniforms();
 	}
 
 	/*
@@ -51,19 +51,20 @@ namespace sparky
 	====================
 	*/
 	////////////////////////////////////////////////////////////
-	void DirectionalShader::setActiveLight(DirectionalLight* pLight)
+	void DirectionalShader::loadUniforms(void)
 	{
-		m_pLight = pLight;
+		m_pProgram->setBlockBinding("Lights", UNIFORM_BINDING_LIGHTS);
+
+		m_normalLocation = m_uniform.getLocation("u_normal");
+		m_diffuseLocation = m_uniform.getLocation("u_diffuse");
 	}
 
 	////////////////////////////////////////////////////////////
 	void DirectionalShader::update(const Transform& transform)
 	{
 		// Fragment uniforms.
-		m_uniform.setParameter("u_normal",   1);
-		m_uniform.setParameter("u_diffuse",  2);
-
-		m_pLight->setUniforms(m_uniform);
+		m_uniform.setParameter(m_normalLocation,  1);
+		m_uniform.setParameter(m_diffuseLocation, 2);
 	}
 
 }//namespace sparky
\ No newline at end of file
@@ -36,6 +36,7 @@ Class Includes
 #include <sparky\rendering\gbuffer.hpp>		// Class definition.
 #include <sparky\core\window.hpp>			// Generating the buffer to the size of the Window.
 #include <sparky\utils\debug.hpp>			// Print debug messages if gbuffer failed to create.
+#include <sparky\utils\gldevice.hpp>		// Texture binds are filtered by the device's state cache.
 
 namespace sparky
 {
@@ -54,11 +55,18 @@ namespace sparky
 	////////////////////////////////////////////////////////////
 	GBuffer::~GBuffer(void)
 	{
-		glDeleteTextures(MAX_AMOUNT, &m_textures[0]);
+		const GLFunctions_t& gl = GLDevice::getFunctions();
+
+		for (const auto& texture : m_textures)
+		{
+			GLDevice::releaseTexture(texture);
+		}
+
+		gl.deleteTextures(MAX_AMOUNT, &m_textures[0]);
 
 		if (m_fbo)
 		{
-			glDeleteFramebuffers(1, &m_fbo);
+			gl.deleteFramebuffers(1, &m_fbo);
 		}
 	}
 
@@ -70,22 +78,24 @@ namespace sparky
 	////////////////////////////////////////////////////////////
 	void GBuffer::generate(void)
 	{
-		glGenFramebuffers(1, &m_fbo);
-		glBindFramebuffer(GL_FRAMEBUFFER, m_fbo);
+		const GLFunctions_t& gl = GLDevice::getFunctions();
+
+		gl.genFramebuffers(1, &m_fbo);
+		gl.bindFramebuffer(GL_FRAMEBUFFER, m_fbo);
 
 		std::vector<GLuint> buffers;
 
-		auto addTexture = [&buffers](GLuint& texture, GLuint attachment, GLenum internalFormat, GLenum format, GLenum type)
+		auto addTexture = [&buffers, &gl](GLuint& texture, GLuint attachment, GLenum internalFormat, GLenum format, GLenum type)
 		{
-			glGenTextures(1, &texture);
-			glBindTexture(GL_TEXTURE_2D, texture);
+			gl.genTextures(1, &texture);
+			GLDevice::bindTexture(GL_TEXTURE_2D, 0, texture);
 
-			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+			gl.texParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+			gl.texParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
 
-			glTexImage2D(GL_TEXTURE_2D, 0, internalFormat, Window::getMain().getSize().x, Window::getMain().getSize().y, 0, format, type, NULL);
+			gl.texImage2D(GL_TEXTURE_2D, 0, internalFormat, Window::getMain().getSize().x, Window::getMain().getSize().y, 0, format, type, NULL);
 
-			glFramebufferTexture2D(GL_FRAMEBUFFER, attachment, GL_TEXTURE_2D, texture, 0);
+			gl.framebufferTexture2D(GL_FRAMEBUFFER, attachment, GL_TEXTURE_2D, texture, 0);
 
 			if (attachment != GL_DEPTH_ATTACHMENT)
 			{
@@ -99,15 +109,15 @@ namespace sparky
 		addTexture(m_textures[DIFFUSE],  GL_COLOR_ATTACHMENT2, GL_RGB32F, GL_RGB, GL_FLOAT);
 
 		// Draws the buffers set by the textures.
-		glDrawBuffers(buffers.size(), &buffers[0]);
+		gl.drawBuffers(buffers.size(), &buffers[0]);
 		// Generates and binds the depth buffer 
-		glGenRenderbuffers(1, &m_depth);
-		glBindRenderbuffer(GL_RENDERBUFFER, m_depth);
+		gl.genRenderbuffers(1, &m_depth);
+		gl.bindRenderbuffer(GL_RENDERBUFFER, m_depth);
 		// Sets the information of the depth buffer
-		glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT, Window::getMain().getSize().x, Window::getMain().getSize().y);
-		glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, m_depth);
+		gl.renderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT, Window::getMain().getSize().x, Window::getMain().getSize().y);
+		gl.framebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, m_depth);
 		// Checks to see if the frame buffer initialised correctly without errors
-		if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+		if (gl.checkFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
 		{
 			DebugLog::warning("GBuffer frame buffer has failed to generate.");
 		}
@@ -115,19 +125,19 @@ namespace sparky
 		this->unbindTextures();
 		this->unbind();
 
-		glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
+		gl.clearColor(0.0f, 0.0f, 0.0f, 0.0f);
 	}
 
 	////////////////////////////////////////////////////////////
 	void GBuffer::bind(void) const
 	{
-		glBindFramebuffer(GL_FRAMEBUFFER, m_fbo);
+		GLDevice::getFunctions().bindFramebuffer(GL_FRAMEBUFFER, m_fbo);
 	}
 
 	////////////////////////////////////////////////////////////
 	void GBuffer::unbind(void) const
 	{
-		glBindFramebuffer(GL_FRAMEBUFFER, NULL);
+		GLDevice::getFunctions().bindFramebuffer(GL_FRAMEBUFFER, NULL);
 	}
 
 	////////////////////////////////////////////////////////////
@@ -135,15 +145,17 @@ namespace sparky
 	{
 		for (unsigned int i = 0; i < MAX_AMOUNT; i++)
 		{
-			glActiveTexture(GL_TEXTURE0 + i);
-			glBindTexture(GL_TEXTURE_2D, m_textures.at(i));
+			GLDevice::bindTexture(GL_TEXTURE_2D, i, m_textures.at(i));
 		}
 	}
 
 	////////////////////////////////////////////////////////////
 	void GBuffer::unbindTextures(void) const
 	{
-		glBindTexture(GL_TEXTURE_2D, NULL);
+		for (unsigned int i = 0; i < MAX_AMOUNT; i++)
+		{
+			GLDevice::bindTexture(GL_TEXTURE_2D, i, NULL);
+		}
 	}
 
 }//namespace sparky
\ No newline at end of file
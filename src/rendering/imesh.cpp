@@ -29,6 +29,8 @@ Class Includes
 */
 #include <sparky\rendering\imesh.hpp>	// Class definition.
 #include <sparky\utils\debug.hpp>		// Used if the indices are incorrect for vertex normal generation.
+#include <sparky\rendering\renderqueue.hpp>	// Draws are recorded into the render queue.
+#include <sparky\rendering\meshoptimiser.hpp>	// Reordering the vertices and indices for the vertex cache.
 
 namespace sparky
 {
@@ -39,7 +41,7 @@ namespace sparky
 	*/
 	////////////////////////////////////////////////////////////
 	IMeshComponent::IMeshComponent(void)
-		: Ref(), m_vertices(), m_indices(), m_buffer(), m_arrayBuffer(), m_generated(false)
+		: Ref(), m_vertices(), m_indices(), m_buffer(), m_arrayBuffer(), m_indexCount(0), m_minimum(), m_maximum(), m_generated(false)
 	{
 	}
 
@@ -72,6 +74,36 @@ namespace sparky
 		return m_indices.size();
 	}
 
+	////////////////////////////////////////////////////////////
+	const std::vector<Vertex_t>& IMeshComponent::getVertices(void) const
+	{
+		return m_vertices;
+	}
+
+	////////////////////////////////////////////////////////////
+	const std::vector<GLuint>& IMeshComponent::getIndices(void) const
+	{
+		return m_indices;
+	}
+
+	////////////////////////////////////////////////////////////
+	const Vector3f& IMeshComponent::getMinimum(void) const
+	{
+		return m_minimum;
+	}
+
+	////////////////////////////////////////////////////////////
+	const Vector3f& IMeshComponent::getMaximum(void) const
+	{
+		return m_maximum;
+	}
+
+	////////////////////////////////////////////////////////////
+	unsigned int IMeshComponent::getLevelCount(void) const
+	{
+		return 1;
+	}
+
 	/*
 	====================
 	Methods
@@ -133,18 +165,24 @@ namespace sparky
 	////////////////////////////////////////////////////////////
 	void IMeshComponent::calculateNormals(void)
 	{
-		if (m_indices.size() % 3 != 0)
+		calculateNormals(m_vertices, m_indices);
+	}
+
+	////////////////////////////////////////////////////////////
+	void IMeshComponent::calculateNormals(std::vector<Vertex_t>& vertices, const std::vector<GLuint>& indices)
+	{
+		if (indices.size() % 3 != 0)
 		{
 			DebugLog::warning("The indices of the Mesh are not divisable by 3. Normals not generated.");
 			return;
 		}
 
-		for (GLuint i = 0; i < m_indices.size(); i += 3)
+		for (GLuint i = 0; i < indices.size(); i += 3)
 		{
 			// create a reference to the three vertices so the information can be altered
-			Vertex_t& v0 = m_vertices[m_indices[i + 0]];
-			Vertex_t& v1 = m_vertices[m_indices[i + 1]];
-			Vertex_t& v2 = m_vertices[m_indices[i + 2]];
+			Vertex_t& v0 = vertices[indices[i + 0]];
+			Vertex_t& v1 = vertices[indices[i + 1]];
+			Vertex_t& v2 = vertices[indices[i + 2]];
 			// work out the delta of the three vertices
 			Vector3f vect1 = Vector3f(v0.position.x - v1.position.x, v0.position.y - v1.position.y, v0.position.z - v1.position.z);
 			Vector3f vect2 = Vector3f(v1.position.x - v2.position.x, v1.position.y - v2.position.y, v1.position.z - v2.position.z);
@@ -156,7 +194,7 @@ namespace sparky
 			v2.normal += cross;
 		}
 
-		for (auto& vertex : m_vertices)
+		for (auto& vertex : vertices)
 		{
 			vertex.normal = vertex.normal.normalised();
 		}
@@ -197,6 +235,12 @@ namespace sparky
 		}
 	}
 
+	////////////////////////////////////////////////////////////
+	void IMeshComponent::optimise(void)
+	{
+		MeshOptimiser::optimise(m_vertices, m_indices);
+	}
+
 	////////////////////////////////////////////////////////////
 	void IMeshComponent::clear(void)
 	{
@@ -208,6 +252,7 @@ namespace sparky
 	void IMeshComponent::reset(void)
 	{
 		this->clear();
+		m_indexCount = 0;
 		m_generated = false;
 	}
 
@@ -216,27 +261,61 @@ namespace sparky
 	{
 		if (!m_generated)
 		{
-			if (!m_vertices.empty())
+			if (genNormals && !m_vertices.empty())
 			{
-				if (genNormals)
-				{
-					this->calculateNormals();
-				}
+				this->calculateNormals();
+			}
+
+			this->generate(m_vertices.empty() ? nullptr : &m_vertices[0], m_vertices.size(), m_indices.empty() ? nullptr : &m_indices[0], m_indices.size());
+		}
+	}
 
+	////////////////////////////////////////////////////////////
+	void IMeshComponent::generate(const Vertex_t* pVertices, const GLuint vertexCount, const GLuint* pIndices, const GLuint indexCount)
+	{
+		if (!m_generated)
+		{
+			if (vertexCount > 0)
+			{
 				m_arrayBuffer.generate();
 				m_arrayBuffer.bind();
 
 				m_buffer.generate();
 
-				m_buffer.bind(m_vertices, m_indices);
+				m_buffer.bind(pVertices, vertexCount, pIndices, indexCount);
 
 				m_buffer.enableAttributes();
 
 				m_arrayBuffer.unbind();
+
+				m_minimum = pVertices[0].position;
+				m_maximum = pVertices[0].position;
+
+				for (GLuint i = 1; i < vertexCount; i++)
+				{
+					m_minimum = Vector3f::minimum(m_minimum, pVertices[i].position);
+					m_maximum = Vector3f::maximum(m_maximum, pVertices[i].position);
+				}
 			}
 
+			m_indexCount = indexCount;
 			m_generated = true;
 		}
 	}
 
+	////////////////////////////////////////////////////////////
+	void IMeshComponent::queue(IShaderComponent* pShader, const Texture* pTexture, const Transform& transform)
+	{
+		if (m_generated)
+		{
+			RenderQueue::getInstance().push(eRenderPass::GEOMETRY, pShader, pTexture, m_arrayBuffer.getID(), static_cast<GLsizei>(m_indexCount), transform);
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	void IMeshComponent::queueLevel(IShaderComponent* pShader, const Texture* pTexture, const Transform& transform, const unsigned int)
+	{
+		this->queue(pShader, pTexture, transform);
+	}
+
 }//namespace sparky
\ No newline at end of file
@@ -28,7 +28,7 @@ Class Includes
 ====================
 */
 #include <sparky\rendering\ishader.hpp>		// Class definition.
-#include <sparky\rendering\GLSLobject.hpp>	// Individual GLSL shaders.
+#include <sparky\rendering\shaderregistry.hpp>	// The Program is shared between shaders with the same sources.
 
 namespace sparky
 {
@@ -38,19 +38,27 @@ namespace sparky
 	====================
 	*/
 	////////////////////////////////////////////////////////////
-	IShaderComponent::IShaderComponent(void)
-		: Ref(), m_program(), m_uniform(&m_program)
+	IShaderComponent::IShaderComponent(const String& vertexShader, const String& fragmentShader)
+		: Ref(), m_pProgram(ShaderRegistry::getInstance().acquireProgram(vertexShader, fragmentShader)), m_uniform(m_pProgram)
 	{
 	}
 
 	////////////////////////////////////////////////////////////
-	IShaderComponent::IShaderComponent(const String& vertexShader, const String& fragmentShader)
-		: Ref(), m_program(), m_uniform(&m_program)
+	IShaderComponent::~IShaderComponent(void)
 	{
-		m_program.attachShader(new GLSLObject(vertexShader, eShaderType::VERTEX));
-		m_program.attachShader(new GLSLObject(fragmentShader, eShaderType::FRAGMENT));
+		ShaderRegistry::getInstance().releaseProgram(m_pProgram);
+		m_pProgram = nullptr;
+	}
 
-		m_program.link();
+	/*
+	====================
+	Getters and Setters
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	const Program& IShaderComponent::getProgram(void) const
+	{
+		return *m_pProgram;
 	}
 
 	/*
@@ -61,13 +69,18 @@ namespace sparky
 	////////////////////////////////////////////////////////////
 	void IShaderComponent::bind(void) const
 	{
-		m_program.bind();
+		m_pProgram->bind();
 	}
 
 	////////////////////////////////////////////////////////////
 	void IShaderComponent::unbind(void) const
 	{
-		m_program.unbind();
+		m_pProgram->unbind();
+	}
+
+	////////////////////////////////////////////////////////////
+	void IShaderComponent::loadUniforms(void)
+	{
 	}
 
 }//namespace sparky
\ No newline at end of file
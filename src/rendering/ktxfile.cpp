@@ -0,0 +1,297 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// 
+// Sparky Engine
+// 2016 - Benjamin Carter (benjamin.mark.carter@hotmail.com)
+// 
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+// 
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+// 
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgement
+//    in the product documentation would be appreciated but is not required.
+// 
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+// 
+// 3. This notice may not be removed or altered from any source distribution.
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+====================
+CPP Includes
+====================
+*/
+#include <algorithm>						// The dimensions of each level.
+#include <cstring>							// Comparing the identifier of the file.
+#include <fstream>							// Reading and writing the file.
+/*
+====================
+Class Includes
+====================
+*/
+#include <sparky\rendering\ktxfile.hpp>		// Class definition.
+#include <sparky\utils\debug.hpp>			// Warnings for files that cannot be written.
+
+namespace sparky
+{
+	/*
+	====================
+	KTX Files
+	====================
+	*/
+	struct KTXHeader_t
+	{
+		unsigned char	identifier[12];			///< Always KTX_IDENTIFIER.
+		unsigned int	endianness;				///< 0x04030201 when written on a machine of the same endianness.
+		unsigned int	glType;					///< 0 for compressed images.
+		unsigned int	glTypeSize;				///< 1 for compressed images.
+		unsigned int	glFormat;				///< 0 for compressed images.
+		unsigned int	glInternalFormat;		///< The compressed format.
+		unsigned int	glBaseInternalFormat;	///< The uncompressed equivalent of the format.
+		unsigned int	pixelWidth;				///< The width of the first level.
+		unsigned int	pixelHeight;			///< The height of the first level.
+		unsigned int	pixelDepth;				///< 0 for 2D images.
+		unsigned int	numberOfArrayElements;	///< 0 for images that are not arrays.
+		unsigned int	numberOfFaces;			///< 1 for images that are not cubemaps.
+		unsigned int	numberOfMipmapLevels;	///< The amount of levels that follow.
+		unsigned int	bytesOfKeyValueData;	///< The metadata between the header and the first level.
+	};
+
+	static const unsigned char KTX_IDENTIFIER[12] = { 0xAB, 'K', 'T', 'X', ' ', '1', '1', 0xBB, '\r', '\n', 0x1A, '\n' };
+	static const unsigned int KTX_ENDIANNESS = 0x04030201;
+
+	////////////////////////////////////////////////////////////
+	static unsigned int getBlockSize(const GLenum internalFormat)
+	{
+		switch (internalFormat)
+		{
+			case GL_COMPRESSED_RGB_S3TC_DXT1_EXT:
+			case GL_COMPRESSED_RGBA_S3TC_DXT1_EXT:
+				return 8;
+			case GL_COMPRESSED_RGBA_S3TC_DXT3_EXT:
+			case GL_COMPRESSED_RGBA_S3TC_DXT5_EXT:
+				return 16;
+			default:
+				return 0;
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	static unsigned long long getExpectedSize(const unsigned int blockSize, const unsigned int width, const unsigned int height, 
+		const unsigned int level)
+	{
+		const unsigned long long levelWidth = std::max(width >> level, 1u);
+		const unsigned long long levelHeight = std::max(height >> level, 1u);
+
+		return ((levelWidth + 3) / 4) * ((levelHeight + 3) / 4) * blockSize;
+	}
+
+	/*
+	====================
+	Ctor and Dtor
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	KTXFile::KTXFile(void)
+		: m_internalFormat(0), m_dimensions(), m_levels(), m_data()
+	{
+	}
+
+	/*
+	====================
+	Getters and Setters
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	GLenum KTXFile::getInternalFormat(void) const
+	{
+		return m_internalFormat;
+	}
+
+	////////////////////////////////////////////////////////////
+	const Vector2u& KTXFile::getDimensions(void) const
+	{
+		return m_dimensions;
+	}
+
+	////////////////////////////////////////////////////////////
+	unsigned int KTXFile::getLevelCount(void) const
+	{
+		return static_cast<unsigned int>(m_levels.size());
+	}
+
+	////////////////////////////////////////////////////////////
+	const unsigned char* KTXFile::getLevel(const unsigned int level) const
+	{
+		return &m_data[m_levels[level].offset];
+	}
+
+	////////////////////////////////////////////////////////////
+	unsigned int KTXFile::getLevelSize(const unsigned int level) const
+	{
+		return m_levels[level].size;
+	}
+
+	////////////////////////////////////////////////////////////
+	unsigned int KTXFile::getSize(void) const
+	{
+		return static_cast<unsigned int>(m_data.size());
+	}
+
+	/*
+	====================
+	Methods
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	void KTXFile::create(const GLenum internalFormat, const unsigned int width, const unsigned int height)
+	{
+		m_internalFormat = internalFormat;
+		m_dimensions.x = width;
+		m_dimensions.y = height;
+
+		m_levels.clear();
+		m_data.clear();
+	}
+
+	////////////////////////////////////////////////////////////
+	void KTXFile::addLevel(const void* pData, const unsigned int size)
+	{
+		Level_t level;
+		level.offset = static_cast<unsigned int>(m_data.size());
+		level.size = size;
+
+		m_levels.push_back(level);
+		m_data.insert(m_data.end(), static_cast<const unsigned char*>(pData), static_cast<const unsigned char*>(pData) + size);
+	}
+
+	////////////////////////////////////////////////////////////
+	bool KTXFile::open(const String& filename)
+	{
+		create(0, 0, 0);
+
+		std::ifstream file(filename.getCString(), std::ios::in | std::ios::binary);
+
+		if (file.fail())
+		{
+			return false;
+		}
+
+		file.seekg(0, std::ios::end);
+		const unsigned long long fileSize = static_cast<unsigned long long>(file.tellg());
+		file.seekg(0, std::ios::beg);
+
+		KTXHeader_t header;
+		file.read(reinterpret_cast<char*>(&header), sizeof(header));
+		//files written on a machine of the other endianness would need every field swapped, the baker never writes them
+		if (!file.good() || std::memcmp(header.identifier, KTX_IDENTIFIER, sizeof(KTX_IDENTIFIER)) != 0 || header.endianness != KTX_ENDIANNESS ||
+			header.glType != 0 || header.pixelDepth != 0 || header.numberOfArrayElements != 0 || header.numberOfFaces != 1 || header.pixelWidth == 0 || header.pixelHeight == 0)
+		{
+			return false;
+		}
+
+		const unsigned int blockSize = getBlockSize(header.glInternalFormat);
+		//a chain longer than the halvings down to a single pixel cannot match its dimensions
+		unsigned int maximumLevels = 1;
+
+		while ((std::max(header.pixelWidth, header.pixelHeight) >> maximumLevels) > 0)
+		{
+			maximumLevels++;
+		}
+
+		if (blockSize == 0 || header.numberOfMipmapLevels > maximumLevels || 
+			header.bytesOfKeyValueData > fileSize - sizeof(header))
+		{
+			return false;
+		}
+
+		file.seekg(header.bytesOfKeyValueData, std::ios::cur);
+
+		m_internalFormat = header.glInternalFormat;
+		m_dimensions.x = header.pixelWidth;
+		m_dimensions.y = header.pixelHeight;
+		//a level count of 0 asks for the mipmaps to be generated on load, which compressed formats cannot do
+		const unsigned int levels = header.numberOfMipmapLevels ? header.numberOfMipmapLevels : 1;
+
+		for (unsigned int i = 0; i < levels; i++)
+		{
+			unsigned int size = 0;
+			file.read(reinterpret_cast<char*>(&size), sizeof(size));
+
+			//the sizes are checked before anything is allocated, so a corrupted file is rejected rather than trusted
+			const unsigned long long remaining = fileSize - static_cast<unsigned long long>(file.tellg());
+
+			if (!file.good() || size != getExpectedSize(blockSize, header.pixelWidth, header.pixelHeight, i) || size > remaining)
+			{
+				create(0, 0, 0);
+				return false;
+			}
+
+			Level_t level;
+			level.offset = static_cast<unsigned int>(m_data.size());
+			level.size = size;
+
+			m_levels.push_back(level);
+			m_data.resize(m_data.size() + size);
+			file.read(reinterpret_cast<char*>(&m_data[level.offset]), size);
+			//every level is padded to 4 bytes
+			file.seekg(3 - ((size + 3) % 4), std::ios::cur);
+
+			if (!file.good())
+			{
+				create(0, 0, 0);
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	////////////////////////////////////////////////////////////
+	bool KTXFile::save(const String& filename) const
+	{
+		std::ofstream file(filename.getCString(), std::ios::out | std::ios::binary | std::ios::trunc);
+
+		if (file.fail())
+		{
+			DebugLog::warning("Unable to write KTX file:", filename);
+			return false;
+		}
+
+		KTXHeader_t header;
+		std::memcpy(header.identifier, KTX_IDENTIFIER, sizeof(KTX_IDENTIFIER));
+		header.endianness = KTX_ENDIANNESS;
+		header.glType = 0;
+		header.glTypeSize = 1;
+		header.glFormat = 0;
+		header.glInternalFormat = m_internalFormat;
+		header.glBaseInternalFormat = m_internalFormat == GL_COMPRESSED_RGB_S3TC_DXT1_EXT ? GL_RGB : GL_RGBA;
+		header.pixelWidth = m_dimensions.x;
+		header.pixelHeight = m_dimensions.y;
+		header.pixelDepth = 0;
+		header.numberOfArrayElements = 0;
+		header.numberOfFaces = 1;
+		header.numberOfMipmapLevels = getLevelCount();
+		header.bytesOfKeyValueData = 0;
+
+		file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+		const char padding[3] = { 0, 0, 0 };
+
+		for (const auto& level : m_levels)
+		{
+			file.write(reinterpret_cast<const char*>(&level.size), sizeof(level.size));
+			file.write(reinterpret_cast<const char*>(&m_data[level.offset]), level.size);
+			file.write(padding, 3 - ((level.size + 3) % 4));
+		}
+
+		return file.good();
+	}
+
+}//namespace sparky
\ No newline at end of file
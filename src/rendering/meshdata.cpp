@@ -23,6 +23,8 @@
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include <sparky\rendering\meshdata.hpp>	// Class definition.
+#include <sparky\core\slaballocator.hpp>		// MeshData is allocated from slabs.
+#include <sparky\utils\gldevice.hpp>			// Drawing through the OpenGL function table.
 
 namespace sparky
 {
@@ -37,6 +39,23 @@ namespace sparky
 	{
 	}
 
+	/*
+	====================
+	Operators
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	void* MeshData::operator new(std::size_t size)
+	{
+		return SlabAllocator<MeshData>::getInstance().allocate(size);
+	}
+
+	////////////////////////////////////////////////////////////
+	void MeshData::operator delete(void* pMemory, std::size_t size)
+	{
+		SlabAllocator<MeshData>::getInstance().deallocate(pMemory, size);
+	}
+
 	/*
 	====================
 	Methods
@@ -48,8 +67,7 @@ namespace sparky
 		if (m_generated)
 		{
 			m_arrayBuffer.bind();
-			glDrawElements(GL_TRIANGLES, m_indices.size(), GL_UNSIGNED_INT, nullptr);
-			m_arrayBuffer.unbind();
+			GLDevice::getFunctions().drawElements(GL_TRIANGLES, m_indexCount, GL_UNSIGNED_INT, nullptr);
 		}
 	}
 
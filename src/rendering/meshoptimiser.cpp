@@ -0,0 +1,538 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// 
+// Sparky Engine
+// 2016 - Benjamin Carter (benjamin.mark.carter@hotmail.com)
+// 
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+// 
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+// 
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgement
+//    in the product documentation would be appreciated but is not required.
+// 
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+// 
+// 3. This notice may not be removed or altered from any source distribution.
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+====================
+CPP Includes
+====================
+*/
+#include <algorithm>							// Sorting vertices to weld and clusters to draw.
+#include <cmath>								// The decay of the vertex scores.
+#include <cstring>								// Comparing vertices bit for bit.
+/*
+====================
+Class Includes
+====================
+*/
+#include <sparky\rendering\meshoptimiser.hpp>	// Class definition.
+
+namespace sparky
+{
+	/*
+	====================
+	Vertex Scoring
+	====================
+	*/
+	static const float CACHE_DECAY_POWER = 1.5f;		///< How quickly the score falls towards the back of the cache.
+	static const float LAST_TRIANGLE_SCORE = 0.75f;		///< The score of the vertices of the last triangle, lower so they are not reused immediately.
+	static const float VALENCE_BOOST_SCALE = 2.0f;		///< How much vertices with few triangles left are preferred.
+	static const float VALENCE_BOOST_POWER = 0.5f;		///< How quickly that preference falls with the triangles left.
+
+	////////////////////////////////////////////////////////////
+	static void setRatios(VertexCacheStats_t& stats)
+	{
+		stats.acmr = stats.triangles > 0 ? static_cast<float>(stats.transforms) / static_cast<float>(stats.triangles) : 0.0f;
+		stats.atvr = stats.vertices > 0 ? static_cast<float>(stats.transforms) / static_cast<float>(stats.vertices) : 0.0f;
+	}
+
+	/*
+	====================
+	Static Fields
+	====================
+	*/
+	const unsigned int MeshOptimiser::CACHE_SIZE;
+	const unsigned int MeshOptimiser::SCORE_CACHE_SIZE;
+
+	/*
+	====================
+	Private Methods
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	float MeshOptimiser::getVertexScore(const int cachePosition, const unsigned int valence)
+	{
+		if (valence == 0)
+		{
+			//nothing is left to draw with the vertex
+			return -1.0f;
+		}
+
+		float score = 0.0f;
+
+		if (cachePosition >= 0)
+		{
+			if (cachePosition < 3)
+			{
+				score = LAST_TRIANGLE_SCORE;
+			}
+			else
+			{
+				const float scale = 1.0f / static_cast<float>(SCORE_CACHE_SIZE - 3);
+				score = std::pow(1.0f - static_cast<float>(cachePosition - 3) * scale, CACHE_DECAY_POWER);
+			}
+		}
+
+		return score + VALENCE_BOOST_SCALE * std::pow(static_cast<float>(valence), -VALENCE_BOOST_POWER);
+	}
+
+	////////////////////////////////////////////////////////////
+	unsigned int MeshOptimiser::simulate(const GLuint* pTriangle, const unsigned int cacheSize, std::vector<unsigned int>& timestamps, unsigned int& time)
+	{
+		unsigned int misses = 0;
+
+		for (unsigned int i = 0; i < 3; i++)
+		{
+			unsigned int& timestamp = timestamps[pTriangle[i]];
+
+			if (time - timestamp > cacheSize)
+			{
+				timestamp = time++;
+				misses++;
+			}
+		}
+
+		return misses;
+	}
+
+	/*
+	====================
+	Methods
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	VertexCacheStats_t MeshOptimiser::analyse(const std::vector<GLuint>& indices, const unsigned int cacheSize/*= CACHE_SIZE*/)
+	{
+		VertexCacheStats_t stats = {};
+
+		if (indices.size() < 3)
+		{
+			return stats;
+		}
+
+		const unsigned int vertexCount = *std::max_element(indices.begin(), indices.end()) + 1;
+
+		std::vector<unsigned int> timestamps(vertexCount, 0);
+		std::vector<bool> referenced(vertexCount, false);
+		unsigned int time = cacheSize + 1;
+
+		stats.triangles = indices.size() / 3;
+
+		for (unsigned int i = 0; i < stats.triangles; i++)
+		{
+			stats.transforms += simulate(&indices[i * 3], cacheSize, timestamps, time);
+		}
+
+		for (const auto& index : indices)
+		{
+			if (!referenced[index])
+			{
+				referenced[index] = true;
+				stats.vertices++;
+			}
+		}
+
+		setRatios(stats);
+
+		return stats;
+	}
+
+	////////////////////////////////////////////////////////////
+	VertexCacheStats_t MeshOptimiser::combine(const VertexCacheStats_t& first, const VertexCacheStats_t& second)
+	{
+		VertexCacheStats_t stats = {};
+		stats.triangles = first.triangles + second.triangles;
+		stats.vertices = first.vertices + second.vertices;
+		stats.transforms = first.transforms + second.transforms;
+
+		setRatios(stats);
+
+		return stats;
+	}
+
+	////////////////////////////////////////////////////////////
+	void MeshOptimiser::weld(std::vector<Vertex_t>& vertices, std::vector<GLuint>& indices)
+	{
+		if (vertices.empty())
+		{
+			return;
+		}
+
+		std::vector<GLuint> order(vertices.size());
+
+		for (GLuint i = 0; i < order.size(); i++)
+		{
+			order[i] = i;
+		}
+		//identical vertices end up next to each other, the earliest of them first
+		std::sort(order.begin(), order.end(), [&vertices](const GLuint a, const GLuint b)
+		{
+			const int comparison = std::memcmp(&vertices[a], &vertices[b], sizeof(Vertex_t));
+			return comparison < 0 || (comparison == 0 && a < b);
+		});
+
+		std::vector<GLuint> first(vertices.size());
+
+		for (GLuint i = 0; i < order.size(); i++)
+		{
+			const bool duplicate = i > 0 && std::memcmp(&vertices[order[i - 1]], &vertices[order[i]], sizeof(Vertex_t)) == 0;
+			first[order[i]] = duplicate ? first[order[i - 1]] : order[i];
+		}
+		//the welded vertices keep the order they were first seen in
+		std::vector<GLuint> remap(vertices.size());
+		std::vector<Vertex_t> welded;
+		welded.reserve(vertices.size());
+
+		for (GLuint i = 0; i < vertices.size(); i++)
+		{
+			if (first[i] == i)
+			{
+				remap[i] = welded.size();
+				welded.push_back(vertices[i]);
+			}
+			else
+			{
+				remap[i] = remap[first[i]];
+			}
+		}
+
+		for (auto& index : indices)
+		{
+			index = remap[index];
+		}
+
+		vertices.swap(welded);
+	}
+
+	////////////////////////////////////////////////////////////
+	void MeshOptimiser::optimiseVertexCache(std::vector<GLuint>& indices, const unsigned int vertexCount)
+	{
+		const unsigned int triangleCount = indices.size() / 3;
+
+		if (triangleCount == 0)
+		{
+			return;
+		}
+		//the triangles of each vertex, packed one vertex after another
+		std::vector<unsigned int> valences(vertexCount, 0);
+		std::vector<unsigned int> offsets(vertexCount + 1, 0);
+		std::vector<unsigned int> adjacency(triangleCount * 3);
+
+		for (unsigned int i = 0; i < triangleCount * 3; i++)
+		{
+			valences[indices[i]]++;
+		}
+
+		for (unsigned int i = 0; i < vertexCount; i++)
+		{
+			offsets[i + 1] = offsets[i] + valences[i];
+		}
+
+		std::vector<unsigned int> filled(offsets.begin(), offsets.end() - 1);
+
+		for (unsigned int i = 0; i < triangleCount * 3; i++)
+		{
+			adjacency[filled[indices[i]]++] = i / 3;
+		}
+
+		std::vector<int> cachePositions(vertexCount, -1);
+		std::vector<float> vertexScores(vertexCount);
+		std::vector<float> triangleScores(triangleCount, 0.0f);
+		std::vector<bool> emitted(triangleCount, false);
+
+		for (unsigned int i = 0; i < vertexCount; i++)
+		{
+			vertexScores[i] = getVertexScore(-1, valences[i]);
+		}
+
+		int best = 0;
+
+		for (unsigned int i = 0; i < triangleCount; i++)
+		{
+			triangleScores[i] = vertexScores[indices[i * 3]] + vertexScores[indices[i * 3 + 1]] + vertexScores[indices[i * 3 + 2]];
+
+			if (triangleScores[i] > triangleScores[best])
+			{
+				best = i;
+			}
+		}
+
+		std::vector<GLuint> result;
+		result.reserve(indices.size());
+
+		std::vector<GLuint> cache;
+		std::vector<GLuint> nextCache;
+		cache.reserve(SCORE_CACHE_SIZE + 3);
+		nextCache.reserve(SCORE_CACHE_SIZE + 3);
+
+		unsigned int next = 0;
+
+		while (result.size() < indices.size())
+		{
+			if (best < 0)
+			{
+				//none of the cached vertices have triangles left, so the search starts over
+				while (emitted[next])
+				{
+					next++;
+				}
+
+				best = next;
+			}
+
+			const GLuint* pTriangle = &indices[best * 3];
+			emitted[best] = true;
+			nextCache.clear();
+
+			for (unsigned int i = 0; i < 3; i++)
+			{
+				const GLuint vertex = pTriangle[i];
+				result.push_back(vertex);
+
+				if (std::find(nextCache.begin(), nextCache.end(), vertex) == nextCache.end())
+				{
+					nextCache.push_back(vertex);
+				}
+				//the drawn triangle is swapped past the end of the vertex's remaining triangles
+				unsigned int* pTriangles = &adjacency[offsets[vertex]];
+
+				for (unsigned int j = 0; j < valences[vertex]; j++)
+				{
+					if (pTriangles[j] == static_cast<unsigned int>(best))
+					{
+						std::swap(pTriangles[j], pTriangles[valences[vertex] - 1]);
+						valences[vertex]--;
+						break;
+					}
+				}
+			}
+
+			for (const auto& vertex : cache)
+			{
+				if (std::find(nextCache.begin(), nextCache.end(), vertex) == nextCache.end())
+				{
+					nextCache.push_back(vertex);
+				}
+			}
+			//vertices pushed past the end of the cache are evicted, but still rescored
+			for (unsigned int i = 0; i < nextCache.size(); i++)
+			{
+				const GLuint vertex = nextCache[i];
+				const int position = i < SCORE_CACHE_SIZE ? static_cast<int>(i) : -1;
+				const float score = getVertexScore(position, valences[vertex]);
+				const float delta = score - vertexScores[vertex];
+
+				cachePositions[vertex] = position;
+				vertexScores[vertex] = score;
+
+				for (unsigned int j = 0; j < valences[vertex]; j++)
+				{
+					triangleScores[adjacency[offsets[vertex] + j]] += delta;
+				}
+			}
+
+			nextCache.resize(std::min<std::size_t>(nextCache.size(), SCORE_CACHE_SIZE));
+			cache.swap(nextCache);
+
+			best = -1;
+			float bestScore = 0.0f;
+
+			for (const auto& vertex : cache)
+			{
+				for (unsigned int j = 0; j < valences[vertex]; j++)
+				{
+					const unsigned int triangle = adjacency[offsets[vertex] + j];
+
+					if (best < 0 || triangleScores[triangle] > bestScore)
+					{
+						best = triangle;
+						bestScore = triangleScores[triangle];
+					}
+				}
+			}
+		}
+
+		indices.swap(result);
+	}
+
+	////////////////////////////////////////////////////////////
+	void MeshOptimiser::optimiseOverdraw(const std::vector<Vertex_t>& vertices, std::vector<GLuint>& indices, const float threshold/*= 1.05f*/)
+	{
+		const unsigned int triangleCount = indices.size() / 3;
+
+		if (triangleCount < 2)
+		{
+			return;
+		}
+
+		std::vector<unsigned int> timestamps(vertices.size(), 0);
+		std::vector<unsigned int> misses(triangleCount);
+		std::vector<unsigned int> hardBoundaries;
+		unsigned int time = CACHE_SIZE + 1;
+		//a triangle that misses every vertex starts over with an empty cache, so nothing is lost by moving it
+		for (unsigned int i = 0; i < triangleCount; i++)
+		{
+			misses[i] = simulate(&indices[i * 3], CACHE_SIZE, timestamps, time);
+
+			if (i == 0 || misses[i] == 3)
+			{
+				hardBoundaries.push_back(i);
+			}
+		}
+
+		hardBoundaries.push_back(triangleCount);
+
+		std::vector<unsigned int> clusters;
+
+		for (unsigned int i = 0; i + 1 < hardBoundaries.size(); i++)
+		{
+			const unsigned int start = hardBoundaries[i];
+			const unsigned int end = hardBoundaries[i + 1];
+
+			unsigned int clusterMisses = 0;
+
+			for (unsigned int j = start; j < end; j++)
+			{
+				clusterMisses += misses[j];
+			}
+
+			const float limit = threshold * static_cast<float>(clusterMisses) / static_cast<float>(end - start);
+			//a cut is made once the triangles since the last cut, drawn from a cold cache, are within the limit
+			unsigned int first = start;
+			unsigned int coldMisses = 0;
+			time += CACHE_SIZE;
+			clusters.push_back(start);
+
+			for (unsigned int j = start; j < end; j++)
+			{
+				coldMisses += simulate(&indices[j * 3], CACHE_SIZE, timestamps, time);
+
+				if (j + 1 < end && static_cast<float>(coldMisses) <= limit * static_cast<float>(j + 1 - first))
+				{
+					first = j + 1;
+					coldMisses = 0;
+					time += CACHE_SIZE;
+					clusters.push_back(first);
+				}
+			}
+		}
+
+		clusters.push_back(triangleCount);
+		//clusters facing away from the centre of the mesh are drawn first, as they tend to hide the rest
+		std::vector<Vector3f> centroids(clusters.size() - 1);
+		std::vector<Vector3f> normals(clusters.size() - 1);
+		Vector3f centre;
+		float area = 0.0f;
+
+		for (unsigned int i = 0; i + 1 < clusters.size(); i++)
+		{
+			float clusterArea = 0.0f;
+
+			for (unsigned int j = clusters[i]; j < clusters[i + 1]; j++)
+			{
+				const Vector3f& a = vertices[indices[j * 3]].position;
+				const Vector3f& b = vertices[indices[j * 3 + 1]].position;
+				const Vector3f& c = vertices[indices[j * 3 + 2]].position;
+				//the length of the cross product is twice the area, so larger triangles count for more
+				const Vector3f normal = Vector3f::cross(b - a, c - a);
+				const float triangleArea = normal.magnitude();
+
+				centroids[i] += (a + b + c) * (triangleArea / 3.0f);
+				normals[i] += normal;
+				clusterArea += triangleArea;
+			}
+
+			centre += centroids[i];
+			area += clusterArea;
+
+			if (clusterArea > 0.0f)
+			{
+				centroids[i] /= clusterArea;
+			}
+		}
+
+		if (area > 0.0f)
+		{
+			centre /= area;
+		}
+
+		std::vector<float> keys(clusters.size() - 1);
+		std::vector<unsigned int> order(clusters.size() - 1);
+
+		for (unsigned int i = 0; i < keys.size(); i++)
+		{
+			const float length = normals[i].magnitude();
+
+			keys[i] = length > 0.0f ? Vector3f::dot(centroids[i] - centre, normals[i]) / length : 0.0f;
+			order[i] = i;
+		}
+
+		std::stable_sort(order.begin(), order.end(), [&keys](const unsigned int a, const unsigned int b)
+		{
+			return keys[a] > keys[b];
+		});
+
+		std::vector<GLuint> result;
+		result.reserve(indices.size());
+
+		for (const auto& cluster : order)
+		{
+			result.insert(result.end(), indices.begin() + clusters[cluster] * 3, indices.begin() + clusters[cluster + 1] * 3);
+		}
+
+		indices.swap(result);
+	}
+
+	////////////////////////////////////////////////////////////
+	void MeshOptimiser::optimiseVertexFetch(std::vector<Vertex_t>& vertices, std::vector<GLuint>& indices)
+	{
+		const GLuint unused = static_cast<GLuint>(-1);
+
+		std::vector<GLuint> remap(vertices.size(), unused);
+		std::vector<Vertex_t> fetched;
+		fetched.reserve(vertices.size());
+
+		for (auto& index : indices)
+		{
+			if (remap[index] == unused)
+			{
+				remap[index] = fetched.size();
+				fetched.push_back(vertices[index]);
+			}
+
+			index = remap[index];
+		}
+
+		vertices.swap(fetched);
+	}
+
+	////////////////////////////////////////////////////////////
+	void MeshOptimiser::optimise(std::vector<Vertex_t>& vertices, std::vector<GLuint>& indices)
+	{
+		weld(vertices, indices);
+		optimiseVertexCache(indices, vertices.size());
+		optimiseOverdraw(vertices, indices);
+		optimiseVertexFetch(vertices, indices);
+	}
+
+}//namespace sparky
\ No newline at end of file
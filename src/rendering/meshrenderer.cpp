@@ -22,6 +22,13 @@
 //
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
+/*
+====================
+CPP Includes
+====================
+*/
+#include <algorithm>							// Clamping the detail level.
+#include <cmath>								// Every halving of the screen size is a detail level.
 /*
 ====================
 Class Includes
@@ -29,10 +36,20 @@ Class Includes
 */
 #include <sparky\rendering\meshrenderer.hpp>	// Class definition.
 #include <sparky\rendering\imesh.hpp>			// Mesh needs to be rendered.
-#include <sparky\rendering\texture.hpp>			// Texture needs to be bound.
+#include <sparky\rendering\texture.hpp>			// Texture is retained and released.
+#include <sparky\core\camera.hpp>				// The detail level depends on the distance to the main camera.
+#include <sparky\math\mathutils.hpp>			// Converting the field of view to radians.
+#include <sparky\math\transform.hpp>			// The position and scale of the mesh's bounds.
 
 namespace sparky
 {
+	/*
+	====================
+	Static Fields
+	====================
+	*/
+	float MeshRenderer::m_sLevelScreenSize = 0.5f;
+
 	/*
 	====================
 	Ctor and Dtor
@@ -58,17 +75,65 @@ namespace sparky
 
 	/*
 	====================
-	Methods
+	Private Methods
 	====================
 	*/
 	////////////////////////////////////////////////////////////
-	void MeshRenderer::render(void)
+	unsigned int MeshRenderer::getLevel(const Transform& transform, const unsigned int levels) const
 	{
-		m_pTexture->bind();
+		const Vector3f scale = transform.getScale();
+		//the rotation is ignored, the sphere around the scaled box only moves with the pivot
+		const Vector3f centre = transform.getPosition() + (m_pMesh->getMinimum() + m_pMesh->getMaximum()) * scale * 0.5f;
+		const float radius = ((m_pMesh->getMaximum() - m_pMesh->getMinimum()) * scale * 0.5f).magnitude();
 
-		m_pMesh->render();
+		Camera& camera = Camera::getMain();
+		const float distance = (centre - camera.getTransform().getPosition()).magnitude();
 
-		m_pTexture->unbind();
+		if (distance <= radius)
+		{
+			return 0;
+		}
+
+		const float size = radius / (distance * std::tan(MathUtils<float>::toRadians(camera.getFoV() / 2.0f)));
+
+		if (size >= m_sLevelScreenSize)
+		{
+			return 0;
+		}
+
+		const float level = std::ceil(std::log(m_sLevelScreenSize / size) / std::log(2.0f));
+		return std::min(static_cast<unsigned int>(level), levels - 1);
+	}
+
+	/*
+	====================
+	Getters and Setters
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	void MeshRenderer::setLevelScreenSize(const float size)
+	{
+		m_sLevelScreenSize = size;
+	}
+
+	/*
+	====================
+	Methods
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	void MeshRenderer::render(IShaderComponent* pShader, const Transform& transform)
+	{
+		const unsigned int levels = m_pMesh->getLevelCount();
+
+		if (levels > 1)
+		{
+			m_pMesh->queueLevel(pShader, m_pTexture, transform, this->getLevel(transform, levels));
+		}
+		else
+		{
+			m_pMesh->queue(pShader, m_pTexture, transform);
+		}
 	}
 
 }//namespace sparky
\ No newline at end of file
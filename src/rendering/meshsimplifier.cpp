@@ -0,0 +1,523 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// 
+// Sparky Engine
+// 2016 - Benjamin Carter (benjamin.mark.carter@hotmail.com)
+// 
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+// 
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+// 
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgement
+//    in the product documentation would be appreciated but is not required.
+// 
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+// 
+// 3. This notice may not be removed or altered from any source distribution.
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+====================
+CPP Includes
+====================
+*/
+#include <algorithm>							// Sorting the collapses by their cost.
+#include <cstring>								// Comparing positions bit for bit.
+#include <utility>								// The edges that are counted to find borders.
+/*
+====================
+Class Includes
+====================
+*/
+#include <sparky\rendering\meshsimplifier.hpp>	// Class definition.
+#include <sparky\rendering\meshoptimiser.hpp>	// Every level is optimised for the vertex cache.
+#include <sparky\rendering\imesh.hpp>			// Calculating the normals of each level.
+
+namespace sparky
+{
+	/*
+	====================
+	Quadrics
+	====================
+	*/
+	static const double ATTRIBUTE_WEIGHT = 1.0;		///< The weight of the uv and normal error against the position error.
+	static const float FLIP_THRESHOLD = 0.25f;		///< The smallest cosine between a triangle's normal before and after a collapse.
+
+	struct Quadric_t
+	{
+		double a00, a01, a02, a03;	///< The first row of the symmetric 4x4 matrix.
+		double a11, a12, a13;		///< The second row, from the diagonal.
+		double a22, a23;			///< The third row, from the diagonal.
+		double a33;					///< The last element of the diagonal.
+	};
+
+	struct Collapse_t
+	{
+		GLuint from;	///< The vertex that is removed.
+		GLuint to;		///< The vertex it is collapsed onto.
+		double cost;	///< The error the collapse adds.
+	};
+
+	////////////////////////////////////////////////////////////
+	static void addPlane(Quadric_t& quadric, const Vector3f& p0, const Vector3f& p1, const Vector3f& p2)
+	{
+		const Vector3f normal = Vector3f::cross(p1 - p0, p2 - p0);
+		const double length = normal.magnitude();
+
+		if (length <= 0.0)
+		{
+			return;
+		}
+
+		const double a = normal.x / length;
+		const double b = normal.y / length;
+		const double c = normal.z / length;
+		const double d = -(a * p0.x + b * p0.y + c * p0.z);
+		//weighted by the area of the triangle, so that slivers do not outweigh the faces around them
+		const double weight = length * 0.5;
+
+		quadric.a00 += weight * a * a; quadric.a01 += weight * a * b; quadric.a02 += weight * a * c; quadric.a03 += weight * a * d;
+		quadric.a11 += weight * b * b; quadric.a12 += weight * b * c; quadric.a13 += weight * b * d;
+		quadric.a22 += weight * c * c; quadric.a23 += weight * c * d;
+		quadric.a33 += weight * d * d;
+	}
+
+	////////////////////////////////////////////////////////////
+	static void addQuadric(Quadric_t& quadric, const Quadric_t& other)
+	{
+		quadric.a00 += other.a00; quadric.a01 += other.a01; quadric.a02 += other.a02; quadric.a03 += other.a03;
+		quadric.a11 += other.a11; quadric.a12 += other.a12; quadric.a13 += other.a13;
+		quadric.a22 += other.a22; quadric.a23 += other.a23;
+		quadric.a33 += other.a33;
+	}
+
+	////////////////////////////////////////////////////////////
+	static double getError(const Quadric_t& quadric, const Vector3f& position)
+	{
+		const double x = position.x;
+		const double y = position.y;
+		const double z = position.z;
+
+		return quadric.a00 * x * x + 2.0 * quadric.a01 * x * y + 2.0 * quadric.a02 * x * z + 2.0 * quadric.a03 * x +
+			quadric.a11 * y * y + 2.0 * quadric.a12 * y * z + 2.0 * quadric.a13 * y +
+			quadric.a22 * z * z + 2.0 * quadric.a23 * z + quadric.a33;
+	}
+
+	////////////////////////////////////////////////////////////
+	static double getAttributeError(const Vertex_t& from, const Vertex_t& to)
+	{
+		const Vector2f uv = from.uv - to.uv;
+		const Vector3f normal = from.normal - to.normal;
+
+		return static_cast<double>(uv.x * uv.x + uv.y * uv.y) + static_cast<double>(normal.magnitudeSqr());
+	}
+
+	/*
+	====================
+	Private Methods
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	void MeshSimplifier::expand(const std::vector<Vertex_t>& vertices, const std::vector<GLuint>& indices, MeshLevel_t& level)
+	{
+		level.vertices.clear();
+		level.indices.clear();
+		level.vertices.reserve(indices.size());
+		level.indices.reserve(indices.size());
+
+		for (const auto& index : indices)
+		{
+			level.indices.push_back(level.vertices.size());
+			level.vertices.push_back(vertices[index]);
+		}
+	}
+
+	/*
+	====================
+	Methods
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	void MeshSimplifier::simplify(const std::vector<Vertex_t>& vertices, const std::vector<GLuint>& indices, const unsigned int targetIndexCount, 
+		std::vector<GLuint>& result)
+	{
+		result.assign(indices.begin(), indices.end() - indices.size() % 3);
+
+		if (result.size() <= targetIndexCount)
+		{
+			return;
+		}
+
+		const GLuint vertexCount = vertices.size();
+		const GLuint invalid = static_cast<GLuint>(-1);
+		//the positions are scaled into a unit box, so the error does not depend on the size of the mesh
+		Vector3f minimum = vertices[0].position;
+		Vector3f maximum = vertices[0].position;
+
+		for (const auto& vertex : vertices)
+		{
+			minimum = Vector3f::minimum(minimum, vertex.position);
+			maximum = Vector3f::maximum(maximum, vertex.position);
+		}
+
+		const Vector3f extent = maximum - minimum;
+		const float largest = std::max(extent.x, std::max(extent.y, extent.z));
+		const float scale = largest > 0.0f ? 1.0f / largest : 1.0f;
+
+		std::vector<Vector3f> positions(vertexCount);
+
+		for (GLuint i = 0; i < vertexCount; i++)
+		{
+			positions[i] = (vertices[i].position - minimum) * scale;
+		}
+		//vertices with the same position form a group, the first of which stands for the group
+		std::vector<GLuint> order(vertexCount);
+		std::vector<GLuint> groups(vertexCount);
+		std::vector<GLuint> siblings(vertexCount);
+
+		for (GLuint i = 0; i < vertexCount; i++)
+		{
+			order[i] = i;
+		}
+
+		std::sort(order.begin(), order.end(), [&vertices](const GLuint a, const GLuint b)
+		{
+			const int comparison = std::memcmp(&vertices[a].position, &vertices[b].position, sizeof(Vector3f));
+			return comparison < 0 || (comparison == 0 && a < b);
+		});
+
+		for (GLuint i = 0; i < vertexCount; i++)
+		{
+			const bool shared = i > 0 && std::memcmp(&vertices[order[i - 1]].position, &vertices[order[i]].position, sizeof(Vector3f)) == 0;
+			groups[order[i]] = shared ? groups[order[i - 1]] : order[i];
+			//each group is a ring of siblings, so that every vertex of a seam can be visited
+			siblings[order[i]] = order[i];
+
+			if (shared)
+			{
+				siblings[order[i]] = siblings[order[i - 1]];
+				siblings[order[i - 1]] = order[i];
+			}
+		}
+
+		std::vector<Quadric_t> quadrics(vertexCount, Quadric_t());
+		std::vector<double> areas(vertexCount, 0.0);
+		std::vector<std::pair<GLuint, GLuint>> edges;
+		edges.reserve(result.size());
+
+		for (GLuint i = 0; i < result.size(); i += 3)
+		{
+			const GLuint* pTriangle = &result[i];
+			const double area = Vector3f::cross(positions[pTriangle[1]] - positions[pTriangle[0]], positions[pTriangle[2]] - positions[pTriangle[0]]).magnitude() * 0.5;
+
+			for (unsigned int j = 0; j < 3; j++)
+			{
+				addPlane(quadrics[groups[pTriangle[j]]], positions[pTriangle[0]], positions[pTriangle[1]], positions[pTriangle[2]]);
+				areas[pTriangle[j]] += area / 3.0;
+
+				const GLuint a = groups[pTriangle[j]];
+				const GLuint b = groups[pTriangle[(j + 1) % 3]];
+
+				if (a != b)
+				{
+					edges.push_back(std::make_pair(std::min(a, b), std::max(a, b)));
+				}
+			}
+		}
+		//an edge without exactly two triangles is on a border, and its positions are kept
+		std::vector<bool> locked(vertexCount, false);
+		std::sort(edges.begin(), edges.end());
+
+		for (std::size_t i = 0; i < edges.size();)
+		{
+			std::size_t j = i + 1;
+
+			while (j < edges.size() && edges[j] == edges[i])
+			{
+				j++;
+			}
+
+			if (j - i != 2)
+			{
+				locked[edges[i].first] = true;
+				locked[edges[i].second] = true;
+			}
+
+			i = j;
+		}
+
+		std::vector<GLuint> remap(vertexCount);
+		std::vector<unsigned int> valences(vertexCount);
+		std::vector<unsigned int> offsets(vertexCount + 1);
+		std::vector<unsigned int> adjacency;
+		std::vector<Collapse_t> collapses;
+		std::vector<bool> touched(vertexCount);
+		std::vector<std::pair<GLuint, GLuint>> pairs;
+		std::vector<GLuint> next;
+
+		for (GLuint i = 0; i < vertexCount; i++)
+		{
+			remap[i] = i;
+		}
+
+		while (result.size() > targetIndexCount)
+		{
+			const unsigned int triangleCount = result.size() / 3;
+			//the triangles around each vertex, rebuilt after every pass
+			std::fill(valences.begin(), valences.end(), 0);
+			std::fill(offsets.begin(), offsets.end(), 0);
+			adjacency.resize(result.size());
+
+			for (const auto& index : result)
+			{
+				valences[index]++;
+			}
+
+			for (GLuint i = 0; i < vertexCount; i++)
+			{
+				offsets[i + 1] = offsets[i] + valences[i];
+			}
+
+			std::fill(valences.begin(), valences.end(), 0);
+
+			for (GLuint i = 0; i < result.size(); i++)
+			{
+				adjacency[offsets[result[i]] + valences[result[i]]++] = i / 3;
+			}
+
+			collapses.clear();
+
+			for (GLuint i = 0; i < result.size(); i++)
+			{
+				const GLuint a = result[i];
+				const GLuint b = result[i - i % 3 + (i + 1) % 3];
+				const GLuint ends[2][2] = { { a, b }, { b, a } };
+
+				for (unsigned int j = 0; j < 2; j++)
+				{
+					const GLuint from = ends[j][0];
+					const GLuint to = ends[j][1];
+
+					if (groups[from] == groups[to] || locked[groups[from]])
+					{
+						continue;
+					}
+
+					Collapse_t collapse;
+					collapse.from = from;
+					collapse.to = to;
+					collapse.cost = getError(quadrics[groups[from]], positions[to]) + ATTRIBUTE_WEIGHT * areas[from] * getAttributeError(vertices[from], vertices[to]);
+
+					collapses.push_back(collapse);
+				}
+			}
+			//ties are broken by the vertices, so the order never depends on the sort
+			std::sort(collapses.begin(), collapses.end(), [](const Collapse_t& a, const Collapse_t& b)
+			{
+				return a.cost < b.cost || (a.cost == b.cost && (a.from < b.from || (a.from == b.from && a.to < b.to)));
+			});
+
+			std::fill(touched.begin(), touched.end(), false);
+			unsigned int removed = 0;
+
+			for (const auto& collapse : collapses)
+			{
+				if (result.size() - removed * 3 <= targetIndexCount)
+				{
+					break;
+				}
+
+				const GLuint from = groups[collapse.from];
+				const GLuint to = groups[collapse.to];
+
+				if (touched[from] || touched[to])
+				{
+					continue;
+				}
+				//every vertex of the group must have a vertex at the other end to collapse onto
+				bool valid = true;
+				unsigned int collapsed = 0;
+				pairs.clear();
+
+				GLuint vertex = from;
+
+				do
+				{
+					if (valences[vertex] > 0)
+					{
+						GLuint target = invalid;
+
+						for (unsigned int i = 0; i < valences[vertex]; i++)
+						{
+							const GLuint* pTriangle = &result[adjacency[offsets[vertex] + i] * 3];
+
+							for (unsigned int j = 0; j < 3; j++)
+							{
+								if (groups[pTriangle[j]] == to)
+								{
+									target = std::min(target, pTriangle[j]);
+									collapsed++;
+									break;
+								}
+							}
+						}
+
+						if (target == invalid)
+						{
+							valid = false;
+							break;
+						}
+
+						pairs.push_back(std::make_pair(vertex, target));
+					}
+
+					vertex = siblings[vertex];
+				}
+				while (vertex != from);
+				//the triangles that are kept must not fold over
+				for (std::size_t i = 0; valid && i < pairs.size(); i++)
+				{
+					const GLuint moved = pairs[i].first;
+
+					for (unsigned int j = 0; valid && j < valences[moved]; j++)
+					{
+						const GLuint* pTriangle = &result[adjacency[offsets[moved] + j] * 3];
+
+						if (groups[pTriangle[0]] == to || groups[pTriangle[1]] == to || groups[pTriangle[2]] == to)
+						{
+							continue;
+						}
+
+						Vector3f corners[3] = { positions[pTriangle[0]], positions[pTriangle[1]], positions[pTriangle[2]] };
+						const Vector3f before = Vector3f::cross(corners[1] - corners[0], corners[2] - corners[0]);
+
+						for (unsigned int k = 0; k < 3; k++)
+						{
+							if (pTriangle[k] == moved)
+							{
+								corners[k] = positions[pairs[i].second];
+							}
+						}
+
+						const Vector3f after = Vector3f::cross(corners[1] - corners[0], corners[2] - corners[0]);
+
+						if (Vector3f::dot(before, after) <= FLIP_THRESHOLD * before.magnitude() * after.magnitude())
+						{
+							valid = false;
+						}
+					}
+				}
+
+				if (!valid || pairs.empty())
+				{
+					continue;
+				}
+				//the neighbourhood has changed, so nothing around it is collapsed again until the next pass
+				for (const auto& pair : pairs)
+				{
+					for (unsigned int i = 0; i < valences[pair.first]; i++)
+					{
+						const GLuint* pTriangle = &result[adjacency[offsets[pair.first] + i] * 3];
+
+						touched[groups[pTriangle[0]]] = true;
+						touched[groups[pTriangle[1]]] = true;
+						touched[groups[pTriangle[2]]] = true;
+					}
+
+					remap[pair.first] = pair.second;
+					areas[pair.second] += areas[pair.first];
+				}
+
+				addQuadric(quadrics[to], quadrics[from]);
+				removed += collapsed;
+			}
+
+			if (removed == 0)
+			{
+				break;
+			}
+
+			next.clear();
+			next.reserve(result.size() - removed * 3);
+
+			for (unsigned int i = 0; i < triangleCount; i++)
+			{
+				const GLuint a = remap[result[i * 3]];
+				const GLuint b = remap[result[i * 3 + 1]];
+				const GLuint c = remap[result[i * 3 + 2]];
+
+				if (groups[a] != groups[b] && groups[b] != groups[c] && groups[c] != groups[a])
+				{
+					next.push_back(a);
+					next.push_back(b);
+					next.push_back(c);
+				}
+			}
+
+			result.swap(next);
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	void MeshSimplifier::buildLevels(const std::vector<Vertex_t>& vertices, const std::vector<GLuint>& indices, const unsigned int levelCount, 
+		const float ratio, std::vector<MeshLevel_t>& levels)
+	{
+		levels.clear();
+		levels.resize(std::max(levelCount, 1u));
+		//the first level is the mesh as it was imported, its normals are averaged over the triangles sharing each welded vertex
+		levels[0].vertices = vertices;
+		levels[0].indices = indices;
+
+		IMeshComponent::calculateNormals(levels[0].vertices, levels[0].indices);
+		MeshOptimiser::optimise(levels[0].vertices, levels[0].indices);
+
+		if (levels.size() == 1 || vertices.empty())
+		{
+			return;
+		}
+		//a mesh that gives every corner its own vertex is flat shaded, so its levels are too
+		bool flat = vertices.size() == indices.size();
+		std::vector<bool> referenced(vertices.size(), false);
+
+		for (std::size_t i = 0; flat && i < indices.size(); i++)
+		{
+			flat = !referenced[indices[i]];
+			referenced[indices[i]] = true;
+		}
+		//the corners are welded first, so the simplifier sees which triangles are connected
+		std::vector<Vertex_t> welded(vertices);
+		std::vector<GLuint> weldedIndices(indices);
+		MeshOptimiser::weld(welded, weldedIndices);
+
+		float fraction = 1.0f;
+		std::vector<GLuint> simplified;
+
+		for (std::size_t i = 1; i < levels.size(); i++)
+		{
+			fraction *= ratio;
+
+			const unsigned int target = static_cast<unsigned int>(static_cast<float>(weldedIndices.size() / 3) * fraction) * 3;
+			simplify(welded, weldedIndices, target, simplified);
+
+			if (flat)
+			{
+				expand(welded, simplified, levels[i]);
+			}
+			else
+			{
+				levels[i].vertices = welded;
+				levels[i].indices = simplified;
+			}
+
+			IMeshComponent::calculateNormals(levels[i].vertices, levels[i].indices);
+			MeshOptimiser::optimise(levels[i].vertices, levels[i].indices);
+		}
+	}
+
+}//namespace sparky
\ No newline at end of file
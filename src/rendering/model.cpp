@@ -22,6 +22,18 @@
 //
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
+/*
+====================
+CPP Includes
+====================
+*/
+#include <chrono>						// Timing imports and cache loads.
+#include <condition_variable>			// Waiting for the meshes loaded on the ThreadManager.
+#include <fstream>						// Writing mesh cache files.
+#include <iomanip>						// Padding the hash within the name of a cache file.
+#include <mutex>						// Counting down the meshes loaded on the ThreadManager.
+#include <sstream>						// Naming the cache files by their hashes.
+#include <sys/stat.h>					// The size and modification time a cache file must match.
 /*
 ====================
 Class Includes
@@ -29,6 +41,9 @@ Class Includes
 */
 #include <sparky\rendering\model.hpp>	// Class definition.
 #include <sparky\utils\debug.hpp>		// Prints an error message to the screen if the model path is in-correct.
+#include <sparky\utils\mappedfile.hpp>	// Cache files are mapped and uploaded without a copy.
+#include <sparky\utils\stringid.hpp>	// Cache files are named by the hash of the model's path.
+#include <sparky\utils\threadmanager.hpp>	// The meshes of a model are loaded at the same time.
 
 /*
 ====================
@@ -41,6 +56,69 @@ Additional Includes
 
 namespace sparky
 {
+	/*
+	====================
+	Cache Files
+	====================
+	*/
+	struct MeshCacheHeader_t
+	{
+		unsigned int	   magic;		///< Always Model::m_sCacheMagic.
+		unsigned int	   version;		///< The layout of the file.
+		unsigned int	   vertexSize;	///< The size of Vertex_t when the file was written.
+		unsigned int	   meshCount;	///< The amount of meshes of each detail level.
+		unsigned long long sourceSize;	///< The size of the imported model file.
+		unsigned long long sourceTime;	///< The modification time of the imported model file.
+		unsigned int	   levelCount;	///< The amount of detail levels, there are meshCount * levelCount ranges following the header.
+		float			   levelRatio;	///< The fraction of triangles kept from one detail level to the next.
+		unsigned int	   vertexCount;	///< The amount of vertices following the ranges.
+		unsigned int	   indexCount;	///< The amount of indices following the vertices.
+		float			   minimum[3];	///< The smallest corner of the box around every mesh.
+		float			   maximum[3];	///< The largest corner of the box around every mesh.
+	};
+
+	struct MeshCacheRange_t
+	{
+		unsigned int firstVertex;	///< The first vertex of the mesh within the vertices.
+		unsigned int vertexCount;	///< The amount of vertices of the mesh.
+		unsigned int firstIndex;	///< The first index of the mesh within the indices.
+		unsigned int indexCount;	///< The amount of indices of the mesh, relative to its first vertex.
+	};
+
+	////////////////////////////////////////////////////////////
+	static double getMilliseconds(const std::chrono::high_resolution_clock::time_point& start)
+	{
+		return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+	}
+
+	////////////////////////////////////////////////////////////
+	static bool getSourceStamp(const String& filename, unsigned long long& size, unsigned long long& time)
+	{
+		struct stat info;
+
+		if (stat(filename.getCString(), &info) != 0)
+		{
+			return false;
+		}
+
+		size = static_cast<unsigned long long>(info.st_size);
+		time = static_cast<unsigned long long>(info.st_mtime);
+
+		return true;
+	}
+
+	/*
+	====================
+	Static Fields
+	====================
+	*/
+	const unsigned int Model::m_sCacheMagic;
+	const unsigned int Model::m_sCacheVersion;
+
+	String		 Model::m_sCache;
+	unsigned int Model::m_sLevelCount = 1;
+	float		 Model::m_sLevelRatio = 0.5f;
+
 	/*
 	====================
 	Ctor and Dtor
@@ -48,8 +126,24 @@ namespace sparky
 	*/
 	////////////////////////////////////////////////////////////
 	Model::Model(const String& filename)
-		: IMeshComponent(), m_meshes()
+		: IMeshComponent(), m_levels()
 	{
+		const auto start = std::chrono::high_resolution_clock::now();
+
+		unsigned long long sourceSize = 0;
+		unsigned long long sourceTime = 0;
+		//without a cache directory, or a readable source to compare against, the model is always imported
+		const bool cached = !m_sCache.isEmpty() && getSourceStamp(filename, sourceSize, sourceTime);
+		const String cachePath = cached ? getCachePath(filename) : String();
+
+		if (cached && this->loadCache(cachePath, sourceSize, sourceTime))
+		{
+			DebugLog::message(filename, "loaded from cache in", getMilliseconds(start), "ms");
+
+			m_generated = true;
+			return;
+		}
+
 		Assimp::Importer importer;
 		const aiScene* pScene = importer.ReadFile(filename.getCString(), aiProcess_Triangulate | aiProcess_FlipUVs);
 
@@ -59,7 +153,61 @@ namespace sparky
 			return;
 		}
 
-		this->loadNode(pScene->mRootNode, pScene);
+		std::vector<Import_t> imports;
+		loadNode(pScene->mRootNode, pScene, imports);
+		//the meshes are converted and simplified on the workers, and only uploaded here
+		std::mutex mutex;
+		std::condition_variable condition;
+		std::size_t loading = imports.size();
+
+		for (auto& import : imports)
+		{
+			Import_t* pImport = &import;
+
+			ThreadManager::getInstance().addTask([pImport, &mutex, &condition, &loading]
+			{
+				loadMesh(*pImport);
+				//notified while locked, so the constructor cannot return before the worker is done with the condition
+				std::lock_guard<std::mutex> lock(mutex);
+				loading--;
+				condition.notify_one();
+			});
+		}
+
+		std::unique_lock<std::mutex> lock(mutex);
+		condition.wait(lock, [&loading]{ return loading == 0; });
+		lock.unlock();
+
+		VertexCacheStats_t before = {};
+		VertexCacheStats_t after = {};
+		m_levels.resize(m_sLevelCount);
+
+		for (const auto& import : imports)
+		{
+			before = MeshOptimiser::combine(before, import.before);
+			after = MeshOptimiser::combine(after, import.after);
+
+			for (unsigned int i = 0; i < m_sLevelCount; i++)
+			{
+				const MeshLevel_t& level = import.levels[i];
+				this->addMesh(i, level.vertices.data(), static_cast<GLuint>(level.vertices.size()), level.indices.data(), 
+					static_cast<GLuint>(level.indices.size()));
+			}
+		}
+
+		for (std::size_t i = 0; i < m_levels[0].size(); i++)
+		{
+			m_minimum = i == 0 ? m_levels[0][i]->getMinimum() : Vector3f::minimum(m_minimum, m_levels[0][i]->getMinimum());
+			m_maximum = i == 0 ? m_levels[0][i]->getMaximum() : Vector3f::maximum(m_maximum, m_levels[0][i]->getMaximum());
+		}
+
+		if (cached)
+		{
+			this->saveCache(cachePath, sourceSize, sourceTime, imports);
+		}
+
+		DebugLog::message(filename, "imported in", getMilliseconds(start), "ms with", m_sLevelCount, "levels, ACMR", before.acmr, "->", 
+			after.acmr, "ATVR", before.atvr, "->", after.atvr);
 
 		m_generated = true;
 	}
@@ -67,12 +215,15 @@ namespace sparky
 	////////////////////////////////////////////////////////////
 	Model::~Model(void)
 	{
-		for (auto& mesh : m_meshes)
+		for (auto& level : m_levels)
 		{
-			Ref::release(mesh);
+			for (auto& mesh : level)
+			{
+				Ref::release(mesh);
+			}
 		}
 
-		m_meshes.clear();
+		m_levels.clear();
 	}
 
 	/*
@@ -81,23 +232,31 @@ namespace sparky
 	====================
 	*/
 	////////////////////////////////////////////////////////////
-	void Model::loadNode(aiNode* pNode, const aiScene* pScene)
+	void Model::loadNode(aiNode* pNode, const aiScene* pScene, std::vector<Import_t>& imports)
 	{
 		for (unsigned int i = 0; i < pNode->mNumMeshes; i++)
 		{
-			m_meshes.push_back(this->loadMesh(pScene->mMeshes[pNode->mMeshes[i]], pScene));
+			Import_t import;
+			import.pMesh = pScene->mMeshes[pNode->mMeshes[i]];
+
+			imports.push_back(import);
 		}
 
 		for (unsigned int i = 0; i < pNode->mNumChildren; i++)
 		{
-			this->loadNode(pNode->mChildren[i], pScene);
+			loadNode(pNode->mChildren[i], pScene, imports);
 		}
 	}
 
 	////////////////////////////////////////////////////////////
-	MeshData* Model::loadMesh(aiMesh* pMesh, const aiScene* pScene)
+	void Model::loadMesh(Import_t& import)
 	{
-		MeshData* pSparkyMesh = new MeshData();
+		const aiMesh* pMesh = import.pMesh;
+
+		std::vector<Vertex_t> vertices;
+		std::vector<GLuint> indices;
+		vertices.reserve(pMesh->mNumVertices);
+		indices.reserve(pMesh->mNumFaces * 3);
 
 		for (unsigned int i = 0; i < pMesh->mNumVertices; i++)
 		{
@@ -124,28 +283,218 @@ namespace sparky
 				vertex.uv = Vector2f::zero();
 			}
 
-			pSparkyMesh->addVertex(vertex);
+			vertices.push_back(vertex);
 		}
 
 		for (unsigned int i = 0; i < pMesh->mNumFaces; i++)
 		{
-			aiFace face = pMesh->mFaces[i];
+			const aiFace& face = pMesh->mFaces[i];
 
 			for (unsigned int j = 0; j < face.mNumIndices; j++)
 			{
-				pSparkyMesh->addIndex(face.mIndices[j]);
+				indices.push_back(face.mIndices[j]);
+			}
+		}
+
+		//the normals are still zero, so corners are merged by position and uv, and the normals calculated next are smoothed across them
+		MeshOptimiser::weld(vertices, indices);
+		//measured on the welded buffer, so the figures before and after only differ by the reordering
+		import.before = MeshOptimiser::analyse(indices);
+		//every level is simplified and reordered here, so only the upload is left for the main thread
+		MeshSimplifier::buildLevels(vertices, indices, m_sLevelCount, m_sLevelRatio, import.levels);
+
+		import.after = MeshOptimiser::analyse(import.levels[0].indices);
+	}
+
+	////////////////////////////////////////////////////////////
+	void Model::addMesh(const unsigned int level, const Vertex_t* pVertices, const GLuint vertexCount, const GLuint* pIndices, const GLuint indexCount)
+	{
+		MeshData* pMesh = new MeshData();
+		pMesh->addRef();
+		pMesh->generate(pVertices, vertexCount, pIndices, indexCount);
+
+		m_levels[level].push_back(pMesh);
+	}
+
+	////////////////////////////////////////////////////////////
+	String Model::getCachePath(const String& filename)
+	{
+		std::stringstream ss;
+		ss << std::hex << std::setfill('0') << std::setw(8) << StringId(filename).getHash() << ".smesh";
+
+		return String::concat(m_sCache, ss.str().c_str());
+	}
+
+	////////////////////////////////////////////////////////////
+	bool Model::loadCache(const String& path, const unsigned long long sourceSize, const unsigned long long sourceTime)
+	{
+		MappedFile file;
+
+		if (!file.open(path) || file.getSize() < sizeof(MeshCacheHeader_t))
+		{
+			return false;
+		}
+
+		const MeshCacheHeader_t* pHeader = reinterpret_cast<const MeshCacheHeader_t*>(file.getData());
+		//a cache of an older layout, of a model that has since been edited, or with other levels, is imported again and overwritten
+		if (pHeader->magic != m_sCacheMagic || pHeader->version != m_sCacheVersion || pHeader->vertexSize != sizeof(Vertex_t) ||
+			pHeader->sourceSize != sourceSize || pHeader->sourceTime != sourceTime || pHeader->levelCount != m_sLevelCount || 
+			pHeader->levelRatio != m_sLevelRatio)
+		{
+			return false;
+		}
+
+		//the counts come from the file, so the sizes are computed in 64 bits where a corrupt count cannot wrap around
+		const unsigned long long rangeCount = static_cast<unsigned long long>(pHeader->meshCount) * pHeader->levelCount;
+		const unsigned long long rangesSize = rangeCount * sizeof(MeshCacheRange_t);
+		const unsigned long long verticesSize = static_cast<unsigned long long>(pHeader->vertexCount) * sizeof(Vertex_t);
+		const unsigned long long indicesSize = static_cast<unsigned long long>(pHeader->indexCount) * sizeof(GLuint);
+
+		if (file.getSize() != sizeof(MeshCacheHeader_t) + rangesSize + verticesSize + indicesSize)
+		{
+			return false;
+		}
+
+		//the whole file is mapped, so it fits in the address space and the sizes fit in a size_t
+		const MeshCacheRange_t* pRanges = reinterpret_cast<const MeshCacheRange_t*>(file.getData() + sizeof(MeshCacheHeader_t));
+		const Vertex_t* pVertices = reinterpret_cast<const Vertex_t*>(file.getData() + sizeof(MeshCacheHeader_t) + static_cast<std::size_t>(rangesSize));
+		const GLuint* pIndices = reinterpret_cast<const GLuint*>(file.getData() + sizeof(MeshCacheHeader_t) + static_cast<std::size_t>(rangesSize + verticesSize));
+
+		for (unsigned long long i = 0; i < rangeCount; i++)
+		{
+			const MeshCacheRange_t& range = pRanges[i];
+
+			if (static_cast<unsigned long long>(range.firstVertex) + range.vertexCount > pHeader->vertexCount || 
+				static_cast<unsigned long long>(range.firstIndex) + range.indexCount > pHeader->indexCount)
+			{
+				return false;
+			}
+			//indices are relative to their range, one past it would read another mesh's vertices or past the buffer
+			for (unsigned int j = 0; j < range.indexCount; j++)
+			{
+				if (pIndices[range.firstIndex + j] >= range.vertexCount)
+				{
+					return false;
+				}
+			}
+		}
+
+		m_levels.resize(pHeader->levelCount);
+		//the ranges are stored mesh by mesh, with every level of a mesh next to each other
+		for (unsigned int i = 0; i < static_cast<unsigned int>(rangeCount); i++)
+		{
+			const MeshCacheRange_t& range = pRanges[i];
+			//uploaded straight from the mapping, which is released once every mesh has been generated
+			this->addMesh(i % pHeader->levelCount, pVertices + range.firstVertex, range.vertexCount, pIndices + range.firstIndex, range.indexCount);
+		}
+
+		m_minimum = Vector3f(pHeader->minimum[0], pHeader->minimum[1], pHeader->minimum[2]);
+		m_maximum = Vector3f(pHeader->maximum[0], pHeader->maximum[1], pHeader->maximum[2]);
+
+		return true;
+	}
+
+	////////////////////////////////////////////////////////////
+	void Model::saveCache(const String& path, const unsigned long long sourceSize, const unsigned long long sourceTime, const std::vector<Import_t>& imports) const
+	{
+		std::ofstream file(path.getCString(), std::ios::out | std::ios::binary | std::ios::trunc);
+
+		if (file.fail())
+		{
+			DebugLog::warning("Unable to write mesh cache:", path);
+			return;
+		}
+
+		MeshCacheHeader_t header;
+		header.magic = m_sCacheMagic;
+		header.version = m_sCacheVersion;
+		header.vertexSize = sizeof(Vertex_t);
+		header.meshCount = static_cast<unsigned int>(imports.size());
+		header.sourceSize = sourceSize;
+		header.sourceTime = sourceTime;
+		header.levelCount = m_sLevelCount;
+		header.levelRatio = m_sLevelRatio;
+		header.vertexCount = 0;
+		header.indexCount = 0;
+		header.minimum[0] = m_minimum.x;
+		header.minimum[1] = m_minimum.y;
+		header.minimum[2] = m_minimum.z;
+		header.maximum[0] = m_maximum.x;
+		header.maximum[1] = m_maximum.y;
+		header.maximum[2] = m_maximum.z;
+
+		std::vector<MeshCacheRange_t> ranges;
+		ranges.reserve(imports.size() * m_sLevelCount);
+
+		for (const auto& import : imports)
+		{
+			for (const auto& level : import.levels)
+			{
+				MeshCacheRange_t range;
+				range.firstVertex = header.vertexCount;
+				range.vertexCount = static_cast<unsigned int>(level.vertices.size());
+				range.firstIndex = header.indexCount;
+				range.indexCount = static_cast<unsigned int>(level.indices.size());
+
+				header.vertexCount += range.vertexCount;
+				header.indexCount += range.indexCount;
+
+				ranges.push_back(range);
+			}
+		}
+
+		file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+		if (!ranges.empty())
+		{
+			file.write(reinterpret_cast<const char*>(&ranges[0]), ranges.size() * sizeof(MeshCacheRange_t));
+		}
+
+		for (const auto& import : imports)
+		{
+			for (const auto& level : import.levels)
+			{
+				if (!level.vertices.empty())
+				{
+					file.write(reinterpret_cast<const char*>(&level.vertices[0]), level.vertices.size() * sizeof(Vertex_t));
+				}
 			}
 		}
 
-		pSparkyMesh->addRef();
+		for (const auto& import : imports)
+		{
+			for (const auto& level : import.levels)
+			{
+				if (!level.indices.empty())
+				{
+					file.write(reinterpret_cast<const char*>(&level.indices[0]), level.indices.size() * sizeof(GLuint));
+				}
+			}
+		}
+	}
 
-		//if (!pMesh->HasNormals())
-		//{
-		//	pSparkyMesh->generate(true);
-		//}
+	/*
+	====================
+	Getters and Setters
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	unsigned int Model::getLevelCount(void) const
+	{
+		return m_levels.empty() ? 1 : static_cast<unsigned int>(m_levels.size());
+	}
 
-		pSparkyMesh->generate(true);
-		return pSparkyMesh;
+	////////////////////////////////////////////////////////////
+	void Model::setCache(const String& directory)
+	{
+		m_sCache = directory;
+	}
+
+	////////////////////////////////////////////////////////////
+	void Model::setLevels(const unsigned int count, const float ratio)
+	{
+		m_sLevelCount = count > 0 ? count : 1;
+		m_sLevelRatio = ratio;
 	}
 
 	/*
@@ -156,10 +505,35 @@ namespace sparky
 	////////////////////////////////////////////////////////////
 	void Model::render(void)
 	{
-		for (const auto& mesh : m_meshes)
+		if (m_levels.empty())
+		{
+			return;
+		}
+
+		for (const auto& mesh : m_levels[0])
 		{
 			mesh->render();
 		}
 	}
 
+	////////////////////////////////////////////////////////////
+	void Model::queue(IShaderComponent* pShader, const Texture* pTexture, const Transform& transform)
+	{
+		this->queueLevel(pShader, pTexture, transform, 0);
+	}
+
+	////////////////////////////////////////////////////////////
+	void Model::queueLevel(IShaderComponent* pShader, const Texture* pTexture, const Transform& transform, const unsigned int level)
+	{
+		if (m_levels.empty())
+		{
+			return;
+		}
+
+		for (const auto& mesh : m_levels[std::min<std::size_t>(level, m_levels.size() - 1)])
+		{
+			mesh->queue(pShader, pTexture, transform);
+		}
+	}
+
 }//namespace sparky
\ No newline at end of file
@@ -27,8 +27,11 @@
 Class Includes
 ====================
 */
-#include <sparky\rendering\pointshader.hpp>	// Class definition.
-#include <sparky\lighting\pointlight.hpp>	// Set the point lights uniforms.
+#include <sparky\rendering\pointshader.hpp>		// Class definition.
+#include <sparky\rendering\buffers.hpp>			// The bindings of the uniform blocks.
+#include <sparky\lighting\lightclusters.hpp>	// The layout of the light clusters.
+#include <sparky\core\camera.hpp>				// The tiles are sized from the main camera.
+#include <sparky\utils\string.hpp>				// Naming the uniform blocks.
 
 namespace sparky
 {
@@ -39,8 +42,11 @@ namespace sparky
 	*/
 	////////////////////////////////////////////////////////////
 	PointShader::PointShader(void)
-		: IShaderComponent("shaders/point_vertex.glsl", "shaders/point_fragment.glsl"), m_pLight(nullptr)
+		: IShaderComponent("shaders/point_vertex.glsl", "shaders/point_fragment.glsl"), m_pClusters(nullptr),
+		  m_positionLocation(-1), m_normalLocation(-1), m_diffuseLocation(-1), m_clustersLocation(-1), m_indicesLocation(-1),
+		  m_gridLocation(-1), m_tileSizeLocation(-1), m_sliceLocation(-1)
 	{
+		loadUniforms();
 	}
 
 	/*
@@ -49,19 +55,41 @@ namespace sparky
 	====================
 	*/
 	////////////////////////////////////////////////////////////
-	void PointShader::setActiveLight(PointLight* pLight)
+	void PointShader::setClusters(const LightClusters* pClusters)
 	{
-		m_pLight = pLight;
+		m_pClusters = pClusters;
+	}
+
+	////////////////////////////////////////////////////////////
+	void PointShader::loadUniforms(void)
+	{
+		m_pProgram->setBlockBinding("FrameData", UNIFORM_BINDING_FRAME);
+		m_pProgram->setBlockBinding("Lights", UNIFORM_BINDING_LIGHTS);
+
+		m_positionLocation = m_uniform.getLocation("u_position");
+		m_normalLocation = m_uniform.getLocation("u_normal");
+		m_diffuseLocation = m_uniform.getLocation("u_diffuse");
+		m_clustersLocation = m_uniform.getLocation("u_clusters");
+		m_indicesLocation = m_uniform.getLocation("u_light_indices");
+		m_gridLocation = m_uniform.getLocation("u_cluster_grid");
+		m_tileSizeLocation = m_uniform.getLocation("u_cluster_tile_size");
+		m_sliceLocation = m_uniform.getLocation("u_cluster_slice");
 	}
 
 	////////////////////////////////////////////////////////////
 	void PointShader::update(const Transform& transform)
 	{
-		m_uniform.setParameter("u_position", 0);
-		m_uniform.setParameter("u_normal",   1);
-		m_uniform.setParameter("u_diffuse",  2);
+		const Vector2f& dimensions = Camera::getMain().getDimensions();
+
+		m_uniform.setParameter(m_positionLocation, 0);
+		m_uniform.setParameter(m_normalLocation,   1);
+		m_uniform.setParameter(m_diffuseLocation,  2);
+		m_uniform.setParameter(m_clustersLocation, 3);
+		m_uniform.setParameter(m_indicesLocation,  4);
 
-		m_pLight->setUniforms(m_uniform);
+		m_uniform.setParameter(m_gridLocation, static_cast<int>(LightClusters::GRID_X), static_cast<int>(LightClusters::GRID_Y), static_cast<int>(LightClusters::GRID_Z));
+		m_uniform.setParameter(m_tileSizeLocation, dimensions.x / LightClusters::GRID_X, dimensions.y / LightClusters::GRID_Y);
+		m_uniform.setParameter(m_sliceLocation, m_pClusters->getSliceScale(), m_pClusters->getSliceBias());
 	}
 
 }//namespace sparky
\ No newline at end of file
@@ -22,6 +22,13 @@
 //
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
+/*
+====================
+CPP Includes
+====================
+*/
+#include <string>						// Formatting the index of uniform array elements.
+#include <utility>						// Exchanging the linked state of two programs.
 /*
 ====================
 Class Includes
@@ -30,6 +37,8 @@ Class Includes
 #include <sparky\rendering\program.hpp>	// Class definitions.
 #include <sparky\core\ref.hpp>			// For safe releasing.
 #include <sparky\utils\debug.hpp>		// For printing out any potential errors to the console buffer.
+#include <sparky\utils\gldevice.hpp>		// OpenGL calls are made through the device's function table.
+#include <sparky\utils\string.hpp>		// Building the names of uniform array elements.
 
 namespace sparky
 {
@@ -40,15 +49,13 @@ namespace sparky
 	*/
 	////////////////////////////////////////////////////////////
 	Program::Program(void)
-		: m_ID(0), m_shaders()
+		: m_ID(0), m_shaders(), m_uniforms()
 	{
 	}
 
 	////////////////////////////////////////////////////////////
 	Program::~Program(void)
 	{
-		unbind();
-
 		for (auto& shader : m_shaders)
 		{
 			Ref::release(shader);
@@ -56,11 +63,64 @@ namespace sparky
 
 		if (m_ID)
 		{
-			glDeleteProgram(m_ID);
+			GLDevice::releaseProgram(m_ID);
+			GLDevice::getFunctions().deleteProgram(m_ID);
 			m_ID = NULL;
 		}
 	}
 
+	/*
+	====================
+	Private Methods
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	void Program::loadUniforms(void)
+	{
+		const GLFunctions_t& gl = GLDevice::getFunctions();
+
+		GLint count = 0;
+		GLint maxLength = 0;
+
+		gl.getProgramiv(m_ID, GL_ACTIVE_UNIFORMS, &count);
+		gl.getProgramiv(m_ID, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxLength);
+
+		m_uniforms.clear();
+		m_uniforms.reserve(count);
+
+		std::vector<GLchar> name(maxLength > 0 ? maxLength : 1);
+
+		for (GLint i = 0; i < count; i++)
+		{
+			GLsizei length = 0;
+			GLint size = 0;
+			GLenum type = 0;
+
+			gl.getActiveUniform(m_ID, i, static_cast<GLsizei>(name.size()), &length, &size, &type, &name[0]);
+
+			StringView view(&name[0], length);
+			//arrays are reported once as "name[0]", the remaining elements have to be queried individually
+			if (view.endsWith("[0]"))
+			{
+				StringView base = view.substring(0, view.getLength() - 3);
+				const GLint location = gl.getUniformLocation(m_ID, &name[0]);
+
+				m_uniforms.insert(base, location);
+				m_uniforms.insert(view, location);
+
+				for (GLint element = 1; element < size; element++)
+				{
+					String elementName = String::concat(base, "[", std::to_string(element).c_str(), "]");
+					m_uniforms.insert(elementName, gl.getUniformLocation(m_ID, elementName.getCString()));
+				}
+			}
+			else
+			{
+				m_uniforms.insert(view, gl.getUniformLocation(m_ID, &name[0]));
+			}
+		}
+	}
+
 	/*
 	====================
 	Getters and Setters
@@ -72,6 +132,20 @@ namespace sparky
 		return m_ID;
 	}
 
+	////////////////////////////////////////////////////////////
+	GLint Program::getUniformLocation(const StringId& name) const
+	{
+		const GLint* pLocation = m_uniforms.find(name);
+
+		return pLocation ? *pLocation : -1;
+	}
+
+	////////////////////////////////////////////////////////////
+	unsigned int Program::getUniformCount(void) const
+	{
+		return m_uniforms.getSize();
+	}
+
 	/*
 	====================
 	Methods
@@ -88,9 +162,16 @@ namespace sparky
 	}
 
 	////////////////////////////////////////////////////////////
-	void Program::link(void)
+	void Program::link(const bool retrievable)
 	{
-		m_ID = glCreateProgram();
+		const GLFunctions_t& gl = GLDevice::getFunctions();
+
+		m_ID = gl.createProgram();
+
+		if (retrievable && gl.programParameteri)
+		{
+			gl.programParameteri(m_ID, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+		}
 
 		for (auto& shader : m_shaders)
 		{
@@ -99,48 +180,130 @@ namespace sparky
 				shader->compile();
 			}
 
-			glAttachShader(m_ID, shader->getID());
+			gl.attachShader(m_ID, shader->getID());
 		}
 
-		glLinkProgram(m_ID);
+		gl.linkProgram(m_ID);
 
 		GLint linked;
-		glGetProgramiv(m_ID, GL_LINK_STATUS, &linked);
+		gl.getProgramiv(m_ID, GL_LINK_STATUS, &linked);
 
 		if (linked != GL_TRUE)
 		{
 			GLint logLength;
 
-			glGetProgramiv(m_ID, GL_INFO_LOG_LENGTH, &logLength);
+			gl.getProgramiv(m_ID, GL_INFO_LOG_LENGTH, &logLength);
 			std::vector<char> errorLog(logLength);
-			glGetProgramInfoLog(m_ID, logLength, &logLength, &errorLog[0]);
+			gl.getProgramInfoLog(m_ID, logLength, &logLength, &errorLog[0]);
 
 			DebugLog::warning("Unable to link Program", m_ID, ". ", &errorLog[0]);
 			//delete Program if failed 
-			glDeleteProgram(m_ID);
-			//release shaders
+			gl.deleteProgram(m_ID);
+			//release shaders, they are no longer attached to a program so do not need detaching
 			for (auto& shader : m_shaders)
 			{
 				Ref::release(shader);
 			}
+
+			m_shaders.clear();
+			m_ID = NULL;
+
+			return;
 		}
 
+		loadUniforms();
+
 		for (const auto& shader : m_shaders)
 		{
-			glDetachShader(m_ID, shader->getID());
+			gl.detachShader(m_ID, shader->getID());
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	bool Program::loadBinary(const GLenum format, const void* pBinary, const GLsizei length)
+	{
+		const GLFunctions_t& gl = GLDevice::getFunctions();
+
+		if (!gl.programBinary)
+		{
+			return false;
+		}
+
+		m_ID = gl.createProgram();
+		gl.programBinary(m_ID, format, pBinary, length);
+
+		GLint linked;
+		gl.getProgramiv(m_ID, GL_LINK_STATUS, &linked);
+
+		if (linked != GL_TRUE)
+		{
+			gl.deleteProgram(m_ID);
+			m_ID = NULL;
+
+			return false;
+		}
+
+		loadUniforms();
+
+		return true;
+	}
+
+	////////////////////////////////////////////////////////////
+	bool Program::getBinary(GLenum& format, std::vector<char>& binary) const
+	{
+		const GLFunctions_t& gl = GLDevice::getFunctions();
+
+		if (!m_ID || !gl.getProgramBinary)
+		{
+			return false;
+		}
+
+		GLint length = 0;
+		gl.getProgramiv(m_ID, GL_PROGRAM_BINARY_LENGTH, &length);
+
+		if (length <= 0)
+		{
+			return false;
+		}
+
+		binary.resize(length);
+		gl.getProgramBinary(m_ID, length, &length, &format, &binary[0]);
+		binary.resize(length);
+
+		return length > 0;
+	}
+
+	////////////////////////////////////////////////////////////
+	void Program::swap(Program& other)
+	{
+		//the previous state is deleted along with the other Program
+		std::swap(m_ID, other.m_ID);
+		std::swap(m_shaders, other.m_shaders);
+		std::swap(m_uniforms, other.m_uniforms);
+	}
+
+	////////////////////////////////////////////////////////////
+	void Program::setBlockBinding(const String& name, const GLuint binding) const
+	{
+		const GLFunctions_t& gl = GLDevice::getFunctions();
+		const GLuint index = gl.getUniformBlockIndex(m_ID, name.getCString());
+
+		if (index != GL_INVALID_INDEX)
+		{
+			gl.uniformBlockBinding(m_ID, index, binding);
 		}
 	}
 
 	////////////////////////////////////////////////////////////
 	void Program::bind(void) const
 	{
-		glUseProgram(m_ID);
+		GLDevice::useProgram(m_ID);
 	}
 
 	////////////////////////////////////////////////////////////
 	void Program::unbind(void) const
 	{
-		glUseProgram(NULL);
+		GLDevice::useProgram(NULL);
 	}
 
 }//namespace sparky
\ No newline at end of file
@@ -0,0 +1,406 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// 
+// Sparky Engine
+// 2016 - Benjamin Carter (benjamin.mark.carter@hotmail.com)
+// 
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+// 
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+// 
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgement
+//    in the product documentation would be appreciated but is not required.
+// 
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+// 
+// 3. This notice may not be removed or altered from any source distribution.
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+====================
+CPP Includes
+====================
+*/
+#include <cstring>								// Reading the bits of the depth.
+#include <thread>								// Yielding while the packing threads finish.
+/*
+====================
+Class Includes
+====================
+*/
+#include <sparky\rendering\renderqueue.hpp>		// Class definition.
+#include <sparky\rendering\ishader.hpp>			// Binding and updating the shader of each draw.
+#include <sparky\rendering\texture.hpp>			// Binding the texture of each draw.
+#include <sparky\math\transform.hpp>			// The position of each draw is used for depth sorting.
+#include <sparky\core\camera.hpp>				// Depth is measured from the main camera.
+#include <sparky\utils\gldevice.hpp>			// Vertex array binds are filtered by the device's state cache.
+#include <sparky\utils\threadmanager.hpp>		// Large frames are packed on the worker threads.
+#include <sparky\core\frameallocator.hpp>		// The packing job lives for the frame.
+
+namespace sparky
+{
+	/*
+	====================
+	Static Fields
+	====================
+	*/
+	SPARKY_THREAD_LOCAL RenderQueue::CommandBuffer_t* RenderQueue::m_sLocalBuffer = nullptr;
+
+	/*
+	====================
+	Private Ctor
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	RenderQueue::RenderQueue(void)
+		: Singleton<RenderQueue>(), m_buffers(), m_mutex(), m_commands(), m_entries(), m_scratch(), m_batches(), m_objectRing(), m_objects()
+	{
+		m_stats.drawCalls = 0;
+		m_stats.instances = 0;
+		m_stats.stateChanges = 0;
+		m_stats.unsortedStateChanges = 0;
+	}
+
+	/*
+	====================
+	Private Methods
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	RenderQueue::CommandBuffer_t& RenderQueue::getLocalBuffer(void)
+	{
+		if (!m_sLocalBuffer)
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+
+			m_buffers.emplace_back(new CommandBuffer_t());
+			m_sLocalBuffer = m_buffers.back().get();
+		}
+
+		return *m_sLocalBuffer;
+	}
+
+	////////////////////////////////////////////////////////////
+	void RenderQueue::sort(void)
+	{
+		const std::size_t count = m_entries.size();
+		m_scratch.resize(count);
+
+		for (unsigned int shift = 0; shift < 64; shift += 8)
+		{
+			std::size_t offsets[256] = {};
+
+			for (const auto& entry : m_entries)
+			{
+				offsets[(entry.key >> shift) & 0xFF]++;
+			}
+			//every key has the same digit, so this pass would not move anything
+			if (offsets[(m_entries[0].key >> shift) & 0xFF] == count)
+			{
+				continue;
+			}
+
+			std::size_t total = 0;
+
+			for (auto& offset : offsets)
+			{
+				const std::size_t amount = offset;
+				offset = total;
+				total += amount;
+			}
+
+			for (const auto& entry : m_entries)
+			{
+				m_scratch[offsets[(entry.key >> shift) & 0xFF]++] = entry;
+			}
+
+			m_entries.swap(m_scratch);
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	void RenderQueue::batch(void)
+	{
+		m_batches.clear();
+
+		for (unsigned int i = 0; i < m_entries.size(); i++)
+		{
+			const DrawCommand_t& command = m_commands[m_entries[i].index];
+
+			if (!m_batches.empty())
+			{
+				InstanceBatch_t& last = m_batches.back();
+				const DrawCommand_t& first = m_commands[m_entries[last.first].index];
+
+				if (last.count < MAX_INSTANCES && command.pShader == first.pShader && command.pTexture == first.pTexture && command.vao == first.vao &&
+					command.indexCount == first.indexCount && command.firstIndex == first.firstIndex && command.baseVertex == first.baseVertex)
+				{
+					last.count++;
+					continue;
+				}
+			}
+
+			InstanceBatch_t batch;
+			batch.first = i;
+			batch.count = 1;
+			batch.offset = 0;
+
+			m_batches.push_back(batch);
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	void RenderQueue::pack(const InstanceBatch_t& batch)
+	{
+		ObjectData_t object;
+
+		for (unsigned int i = 0; i < batch.count; i++)
+		{
+			object.model = m_commands[m_entries[batch.first + i].index].pTransform->getTransformation();
+			m_objectRing.write(batch.offset + i * sizeof(ObjectData_t), &object, sizeof(ObjectData_t));
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	void RenderQueue::pack(const std::shared_ptr<PackJob_t>& pJob)
+	{
+		unsigned int index = pJob->next++;
+
+		while (index < pJob->count)
+		{
+			pack(m_batches[index]);
+			pJob->done++;
+
+			index = pJob->next++;
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	unsigned int RenderQueue::packObjects(unsigned int& size)
+	{
+		size = 0;
+		//every batch is bound on its own, so each has to start at an aligned offset
+		for (auto& batch : m_batches)
+		{
+			batch.offset = size;
+			size += m_objectRing.getStride(batch.count * sizeof(ObjectData_t));
+		}
+
+		const unsigned int offset = m_objectRing.allocate(size);
+
+		for (auto& batch : m_batches)
+		{
+			batch.offset += offset;
+		}
+
+		//taken from the frame's memory, which is only reused two frames later, long after the workers have let go of it
+		std::shared_ptr<PackJob_t> pJob = std::allocate_shared<PackJob_t>(FrameAllocatorAdaptor<PackJob_t>());
+		pJob->next = 0;
+		pJob->done = 0;
+		pJob->count = m_batches.size();
+		//the ring is not resized while packing, so the batches can be written from any thread
+		if (m_entries.size() >= m_sParallelInstances)
+		{
+			const unsigned int tasks = std::thread::hardware_concurrency();
+
+			for (unsigned int i = 1; i < tasks; i++)
+			{
+				ThreadManager::getInstance().addTask([this, pJob]{ pack(pJob); });
+			}
+		}
+
+		pack(pJob);
+		//the remaining batches have been claimed by the workers and are already being packed
+		while (pJob->done < pJob->count)
+		{
+			std::this_thread::yield();
+		}
+
+		return offset;
+	}
+
+	////////////////////////////////////////////////////////////
+	void RenderQueue::uploadObjects(void)
+	{
+		if (!m_objects.getID())
+		{
+			m_objects.generate();
+			m_objectRing.setAlignment(UniformBuffer::getOffsetAlignment());
+		}
+
+		unsigned int size = 0;
+		const unsigned int offset = packObjects(size);
+		//the draws of previous frames may still be reading the old storage, so it is orphaned instead of overwritten
+		if (m_objectRing.hasWrapped())
+		{
+			//the whole block is bound for every batch, so the last batch needs a full block of storage after it
+			m_objects.allocate(m_objectRing.getCapacity() + MAX_INSTANCES * sizeof(ObjectData_t));
+		}
+
+		m_objects.upload(offset, m_objectRing.getData(offset), size);
+	}
+
+	/*
+	====================
+	Getters and Setters
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	const RenderStats_t& RenderQueue::getStats(void) const
+	{
+		return m_stats;
+	}
+
+	////////////////////////////////////////////////////////////
+	const std::vector<InstanceBatch_t>& RenderQueue::getBatches(void) const
+	{
+		return m_batches;
+	}
+
+	////////////////////////////////////////////////////////////
+	const ObjectData_t* RenderQueue::getObjectData(const InstanceBatch_t& batch) const
+	{
+		return static_cast<const ObjectData_t*>(m_objectRing.getData(batch.offset));
+	}
+
+	/*
+	====================
+	Methods
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	unsigned long long RenderQueue::makeKey(const eRenderPass pass, const GLuint program, const GLuint texture, const float depth, const GLuint vao)
+	{
+		//the bits of a positive float increase with its value, so the upper bits can be sorted as an integer
+		unsigned int depthBits = 0;
+		std::memcpy(&depthBits, &depth, sizeof(depthBits));
+		depthBits = depth > 0.0f ? (depthBits >> 7) & 0xFFFFFF : 0;
+		const unsigned long long state = (static_cast<unsigned long long>(pass)			 << 62) |
+										 (static_cast<unsigned long long>(program & 0xFFF) << 50) |
+										 (static_cast<unsigned long long>(texture & 0xFFF) << 38);
+		//translucent geometry is blended, so it has to be drawn from back to front whatever its mesh
+		if (pass == eRenderPass::TRANSLUCENT)
+		{
+			depthBits = ~depthBits & 0xFFFFFF;
+
+			return state | (static_cast<unsigned long long>(depthBits) << 14) | (vao & 0x3FFF);
+		}
+		//opaque geometry is grouped by mesh first so that it can be instanced, still front to back within each mesh
+		return state | (static_cast<unsigned long long>(vao & 0x3FFF) << 24) | depthBits;
+	}
+
+	////////////////////////////////////////////////////////////
+	void RenderQueue::push(const eRenderPass pass, IShaderComponent* pShader, const Texture* pTexture, const GLuint vao, const GLsizei indexCount, const Transform& transform,
+		const GLuint firstIndex/*= 0*/, const GLint baseVertex/*= 0*/)
+	{
+		const float depth = Vector3f::distanceSqr(Camera::getMain().getTransform().getPosition(), transform.getPosition());
+
+		DrawCommand_t command;
+		command.key			= makeKey(pass, pShader->getProgram().getID(), pTexture ? pTexture->getID() : 0, depth, vao);
+		command.pShader		= pShader;
+		command.pTexture	= pTexture;
+		command.pTransform	= &transform;
+		command.vao			= vao;
+		command.indexCount	= indexCount;
+		command.firstIndex	= firstIndex;
+		command.baseVertex	= baseVertex;
+
+		getLocalBuffer().commands.push_back(command);
+	}
+
+	////////////////////////////////////////////////////////////
+	void RenderQueue::submit(void)
+	{
+		m_commands.clear();
+		m_entries.clear();
+
+		for (auto& buffer : m_buffers)
+		{
+			m_commands.insert(m_commands.end(), buffer->commands.begin(), buffer->commands.end());
+			buffer->commands.clear();
+		}
+
+		m_stats.drawCalls = 0;
+		m_stats.instances = 0;
+		m_stats.stateChanges = 0;
+		m_stats.unsortedStateChanges = 0;
+
+		if (m_commands.empty())
+		{
+			m_batches.clear();
+			return;
+		}
+
+		const IShaderComponent* pLastShader = nullptr;
+		GLuint lastTexture = 0;
+		GLuint lastVao = 0;
+		//count the binds the draws would have needed in the order they were recorded
+		for (unsigned int i = 0; i < m_commands.size(); i++)
+		{
+			const DrawCommand_t& command = m_commands[i];
+			const GLuint texture = command.pTexture ? command.pTexture->getID() : 0;
+
+			m_stats.unsortedStateChanges += (command.pShader != pLastShader) + (texture != lastTexture) + (command.vao != lastVao);
+
+			pLastShader = command.pShader;
+			lastTexture = texture;
+			lastVao = command.vao;
+
+			SortEntry_t entry;
+			entry.key = command.key;
+			entry.index = i;
+
+			m_entries.push_back(entry);
+		}
+
+		sort();
+		batch();
+		uploadObjects();
+
+		IShaderComponent* pShader = nullptr;
+		//nothing is unbound after drawing, so the first draw has to bind its texture and vertex array whatever they are
+		lastTexture = static_cast<GLuint>(-1);
+		lastVao = static_cast<GLuint>(-1);
+
+		for (const auto& batch : m_batches)
+		{
+			const DrawCommand_t& command = m_commands[m_entries[batch.first].index];
+			const GLuint texture = command.pTexture ? command.pTexture->getID() : 0;
+
+			if (command.pShader != pShader)
+			{
+				pShader = command.pShader;
+				pShader->bind();
+				pShader->update(*command.pTransform);
+				m_stats.stateChanges++;
+			}
+
+			if (texture != lastTexture)
+			{
+				GLDevice::bindTexture(command.pTexture ? command.pTexture->getTarget() : GL_TEXTURE_2D, 0, texture);
+				lastTexture = texture;
+				m_stats.stateChanges++;
+			}
+
+			m_objects.bindRange(UNIFORM_BINDING_OBJECT, batch.offset, MAX_INSTANCES * sizeof(ObjectData_t));
+
+			if (command.vao != lastVao)
+			{
+				GLDevice::bindVertexArray(command.vao);
+				lastVao = command.vao;
+				m_stats.stateChanges++;
+			}
+
+			GLDevice::getFunctions().drawElementsInstancedBaseVertex(GL_TRIANGLES, command.indexCount, GL_UNSIGNED_INT, reinterpret_cast<const GLvoid*>(command.firstIndex * sizeof(GLuint)), batch.count, command.baseVertex);
+			m_stats.drawCalls++;
+			m_stats.instances += batch.count;
+		}
+	}
+
+}//namespace sparky
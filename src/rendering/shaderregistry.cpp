@@ -0,0 +1,596 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// 
+// Sparky Engine
+// 2016 - Benjamin Carter (benjamin.mark.carter@hotmail.com)
+// 
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+// 
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+// 
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgement
+//    in the product documentation would be appreciated but is not required.
+// 
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+// 
+// 3. This notice may not be removed or altered from any source distribution.
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+====================
+CPP Includes
+====================
+*/
+#include <chrono>								// Timing the startup of the registry.
+#include <fstream>								// Reading shader files and program binaries.
+#include <iomanip>								// Padding the hashes within the name of a binary.
+#include <sstream>								// Naming the binaries by their hashes.
+/*
+====================
+Class Includes
+====================
+*/
+#include <sparky\rendering\shaderregistry.hpp>	// Class definition.
+#include <sparky\rendering\program.hpp>			// The programs that are shared.
+#include <sparky\rendering\GLSLobject.hpp>		// The shaders compiled when there is no binary.
+#include <sparky\utils\stringview.hpp>			// Inspecting each line of a shader without copying it.
+#include <sparky\utils\gldevice.hpp>			// Asking the driver for binary support.
+#include <sparky\utils\debug.hpp>				// Warnings for files that cannot be read.
+
+namespace sparky
+{
+	/*
+	====================
+	Binary Files
+	====================
+	*/
+	struct BinaryHeader_t
+	{
+		unsigned int		magic;			///< Always ShaderRegistry::m_sBinaryMagic.
+		unsigned int		version;		///< The layout of the file.
+		unsigned int		driverHash;		///< The driver the binary was retrieved from.
+		unsigned int		format;			///< The format reported by the driver.
+		unsigned long long	vertexHash;		///< The closure hash of the vertex shader.
+		unsigned long long	fragmentHash;	///< The closure hash of the fragment shader.
+		unsigned int		vertexLength;	///< The length of the preprocessed vertex shader.
+		unsigned int		fragmentLength;	///< The length of the preprocessed fragment shader.
+		unsigned int		length;			///< The size of the binary following the header.
+	};
+
+	////////////////////////////////////////////////////////////
+	static unsigned long long hashSource(const String& source)
+	{
+		//64 bit FNV-1a, binaries outlive a run so a 32 bit collision between two versions of a shader is too likely
+		const char* pSource = source.getCString();
+		unsigned long long hash = 14695981039346656037ull;
+
+		for (unsigned int i = 0; i < source.getLength(); i++)
+		{
+			hash ^= static_cast<unsigned char>(pSource[i]);
+			hash *= 1099511628211ull;
+		}
+
+		return hash;
+	}
+
+	////////////////////////////////////////////////////////////
+	static double getMilliseconds(const std::chrono::high_resolution_clock::time_point& start)
+	{
+		return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+	}
+
+	/*
+	====================
+	Static Fields
+	====================
+	*/
+	const unsigned int ShaderRegistry::m_sBinaryMagic;
+	const unsigned int ShaderRegistry::m_sBinaryVersion;
+
+	/*
+	====================
+	Private Ctor
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	ShaderRegistry::ShaderRegistry(void)
+		: Singleton<ShaderRegistry>(), m_files(), m_sources(), m_programs(), m_binaryCache(), m_driverHash(0), m_driverChecked(false),
+		m_start(std::chrono::high_resolution_clock::now())
+	{
+		m_stats.programs = 0;
+		m_stats.sharedPrograms = 0;
+		m_stats.filesRead = 0;
+		m_stats.sourcesReused = 0;
+		m_stats.binaryHits = 0;
+		m_stats.binaryMisses = 0;
+		m_stats.startupMilliseconds = 0.0;
+	}
+
+	/*
+	====================
+	Dtor
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	ShaderRegistry::~ShaderRegistry(void)
+	{
+		for (auto& entry : m_programs)
+		{
+			delete entry.pProgram;
+		}
+
+		m_programs.clear();
+	}
+
+	/*
+	====================
+	Private Methods
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	const String* ShaderRegistry::readFile(const String& filename)
+	{
+		const String* pContents = m_files.find(filename);
+
+		if (pContents)
+		{
+			return pContents;
+		}
+
+		std::ifstream file(filename.getCString(), std::ios::in | std::ios::binary | std::ios::ate);
+
+		if (file.fail())
+		{
+			DebugLog::warning("Failed to load Shader:", filename);
+			return nullptr;
+		}
+
+		std::vector<char> contents(static_cast<size_t>(file.tellg()));
+
+		file.seekg(0, std::ios::beg);
+
+		if (!contents.empty())
+		{
+			file.read(&contents[0], contents.size());
+		}
+
+		m_stats.filesRead++;
+		m_files.insert(filename, contents.empty() ? String() : String(&contents[0], static_cast<unsigned int>(contents.size())));
+
+		return m_files.find(filename);
+	}
+
+	////////////////////////////////////////////////////////////
+	bool ShaderRegistry::expand(const String& filename, String& source, std::vector<StringId>& includes)
+	{
+		const StringView include = "#include";
+		const String* pContents = readFile(filename);
+
+		if (!pContents)
+		{
+			return false;
+		}
+
+		//copied, as reading the includes may grow the file table and move its contents
+		const String file(*pContents);
+		const StringView contents(file);
+		unsigned int begin = 0;
+
+		while (begin < contents.getLength())
+		{
+			const int newline = contents.find('\n', begin);
+			const unsigned int end = newline < 0 ? contents.getLength() : static_cast<unsigned int>(newline) + 1;
+
+			const StringView line = contents.substring(begin, end);
+			const StringView directive = line.trim();
+
+			begin = end;
+
+			if (!directive.beginsWith(include))
+			{
+				source.append(line);
+				continue;
+			}
+			//the path follows the directive, with any whitespace in between removed
+			StringView path = directive.substring(include.getLength(), directive.getLength()).trim();
+			//checks that the include statement is correctly formatted
+			if (path.getLength() < 2 || path[0] != '"' || path[path.getLength() - 1] != '"')
+			{
+				DebugLog::warning("Incorrect include statement in", filename);
+				return false;
+			}
+			//the include statement itself is dropped, #include is not a directive of GLSL
+			path = path.substring(1, path.getLength() - 1);
+			//make sure it has the correct file extension
+			if (!path.endsWith(".glsl"))
+			{
+				DebugLog::error(path, "has incorrect file extension");
+			}
+
+			//get the location of the shaders + the file location of the include statement
+			const String includeFile = String::concat("shaders/", path);
+			const StringId id(includeFile);
+			bool included = false;
+
+			for (const auto& previous : includes)
+			{
+				if (previous == id)
+				{
+					included = true;
+				}
+			}
+
+			if (included)
+			{
+				DebugLog::warning(path, "has already been included in the current context, clearing include.");
+				continue;
+			}
+
+			includes.push_back(id);
+			expand(includeFile, source, includes);
+		}
+
+		return true;
+	}
+
+	////////////////////////////////////////////////////////////
+	const ShaderRegistry::Source_t* ShaderRegistry::preprocess(const String& filename)
+	{
+		const Source_t* pSource = m_sources.find(filename);
+
+		if (pSource)
+		{
+			m_stats.sourcesReused++;
+			return pSource;
+		}
+
+		Source_t source;
+		source.files.push_back(filename);
+
+		if (!expand(filename, source.source, source.files))
+		{
+			DebugLog::error("Shader:", filename, "has failed to parse.");
+			return nullptr;
+		}
+		//the expanded source holds every file of the closure, so its hash changes whenever any of them do
+		source.hash = hashSource(source.source);
+
+		m_sources.insert(filename, source);
+
+		return m_sources.find(filename);
+	}
+
+	////////////////////////////////////////////////////////////
+	bool ShaderRegistry::isSameSource(const String& first, const String& second) const
+	{
+		if (first == second)
+		{
+			return true;
+		}
+
+		const Source_t* pFirst = m_sources.find(first);
+		const Source_t* pSecond = m_sources.find(second);
+
+		if (!pFirst || !pSecond)
+		{
+			return pFirst == pSecond;
+		}
+
+		return pFirst->source == pSecond->source;
+	}
+
+	////////////////////////////////////////////////////////////
+	bool ShaderRegistry::isBinaryCacheEnabled(void)
+	{
+		if (m_binaryCache.isEmpty())
+		{
+			return false;
+		}
+
+		if (!m_driverChecked)
+		{
+			const GLFunctions_t& gl = GLDevice::getFunctions();
+
+			GLint formats = 0;
+			gl.getIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+
+			m_driverChecked = true;
+
+			if (!gl.programBinary || formats <= 0)
+			{
+				DebugLog::message("Program binaries are not supported by the driver, shaders will be compiled from source.");
+				m_binaryCache.clear();
+
+				return false;
+			}
+			//a driver update changes the version string, which invalidates every binary
+			String driver = String::concat(reinterpret_cast<const char*>(gl.getString(GL_VENDOR)), 
+				reinterpret_cast<const char*>(gl.getString(GL_RENDERER)), reinterpret_cast<const char*>(gl.getString(GL_VERSION)));
+
+			m_driverHash = StringId::hash(driver.getCString(), driver.getLength());
+		}
+
+		return true;
+	}
+
+	////////////////////////////////////////////////////////////
+	String ShaderRegistry::getBinaryPath(const unsigned long long vertexHash, const unsigned long long fragmentHash) const
+	{
+		std::stringstream ss;
+		ss << std::hex << std::setfill('0') << std::setw(16) << vertexHash << std::setw(16) << fragmentHash << ".spb";
+
+		return String::concat(m_binaryCache, ss.str().c_str());
+	}
+
+	////////////////////////////////////////////////////////////
+	bool ShaderRegistry::loadBinary(Program* pProgram, const Entry_t& entry) const
+	{
+		std::ifstream file(getBinaryPath(entry.vertexHash, entry.fragmentHash).getCString(), std::ios::in | std::ios::binary);
+
+		if (file.fail())
+		{
+			return false;
+		}
+
+		BinaryHeader_t header;
+		file.read(reinterpret_cast<char*>(&header), sizeof(header));
+		//a binary from another driver, or of sources with the same name but different contents, is recompiled
+		if (!file.good() || header.magic != m_sBinaryMagic || header.version != m_sBinaryVersion || header.driverHash != m_driverHash ||
+			header.vertexHash != entry.vertexHash || header.fragmentHash != entry.fragmentHash ||
+			header.vertexLength != entry.vertexLength || header.fragmentLength != entry.fragmentLength || header.length == 0)
+		{
+			return false;
+		}
+
+		std::vector<char> binary(header.length);
+		file.read(&binary[0], header.length);
+
+		if (!file.good())
+		{
+			return false;
+		}
+		//the driver may still reject the binary, in which case it is compiled from source and overwritten
+		return pProgram->loadBinary(header.format, &binary[0], static_cast<GLsizei>(binary.size()));
+	}
+
+	////////////////////////////////////////////////////////////
+	void ShaderRegistry::compile(Program* pProgram, const Entry_t& entry, const bool cached)
+	{
+		pProgram->attachShader(new GLSLObject(entry.vertexShader, eShaderType::VERTEX));
+		pProgram->attachShader(new GLSLObject(entry.fragmentShader, eShaderType::FRAGMENT));
+
+		pProgram->link(cached);
+
+		if (cached)
+		{
+			m_stats.binaryMisses++;
+			saveBinary(pProgram, entry);
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	void ShaderRegistry::saveBinary(const Program* pProgram, const Entry_t& entry) const
+	{
+		GLenum format = 0;
+		std::vector<char> binary;
+
+		if (!pProgram->getBinary(format, binary))
+		{
+			return;
+		}
+
+		const String path = getBinaryPath(entry.vertexHash, entry.fragmentHash);
+		std::ofstream file(path.getCString(), std::ios::out | std::ios::binary | std::ios::trunc);
+
+		if (file.fail())
+		{
+			DebugLog::warning("Unable to write program binary:", path);
+			return;
+		}
+
+		BinaryHeader_t header;
+		header.magic = m_sBinaryMagic;
+		header.version = m_sBinaryVersion;
+		header.driverHash = m_driverHash;
+		header.vertexHash = entry.vertexHash;
+		header.fragmentHash = entry.fragmentHash;
+		header.vertexLength = entry.vertexLength;
+		header.fragmentLength = entry.fragmentLength;
+		header.format = format;
+		header.length = static_cast<unsigned int>(binary.size());
+
+		file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+		file.write(&binary[0], binary.size());
+	}
+
+	/*
+	====================
+	Getters and Setters
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	bool ShaderRegistry::getSource(const String& filename, String& source)
+	{
+		const Source_t* pSource = preprocess(filename);
+
+		if (!pSource)
+		{
+			return false;
+		}
+
+		source = pSource->source;
+
+		return true;
+	}
+
+	////////////////////////////////////////////////////////////
+	void ShaderRegistry::setBinaryCache(const String& directory)
+	{
+		m_binaryCache = directory;
+		m_driverChecked = false;
+	}
+
+	////////////////////////////////////////////////////////////
+	const ShaderRegistryStats_t& ShaderRegistry::getStats(void) const
+	{
+		return m_stats;
+	}
+
+	/*
+	====================
+	Methods
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	Program* ShaderRegistry::acquireProgram(const String& vertexShader, const String& fragmentShader)
+	{
+		Entry_t entry;
+		entry.pProgram = nullptr;
+		entry.vertexShader = vertexShader;
+		entry.fragmentShader = fragmentShader;
+		entry.references = 1;
+		//the hashes are read straight away, preprocessing the next shader may grow the source table
+		const Source_t* pVertex = preprocess(vertexShader);
+		entry.vertexHash = pVertex ? pVertex->hash : 0;
+		entry.vertexLength = pVertex ? pVertex->source.getLength() : 0;
+
+		const Source_t* pFragment = preprocess(fragmentShader);
+		entry.fragmentHash = pFragment ? pFragment->hash : 0;
+		entry.fragmentLength = pFragment ? pFragment->source.getLength() : 0;
+		//programs are shared by content, so shaders with different paths but identical sources link once
+		for (auto& existing : m_programs)
+		{
+			if (existing.vertexHash != entry.vertexHash || existing.fragmentHash != entry.fragmentHash ||
+				existing.vertexLength != entry.vertexLength || existing.fragmentLength != entry.fragmentLength)
+			{
+				continue;
+			}
+			//the hashes only narrow the search, the sources themselves decide
+			if (isSameSource(existing.vertexShader, vertexShader) && isSameSource(existing.fragmentShader, fragmentShader))
+			{
+				existing.references++;
+				m_stats.sharedPrograms++;
+
+				return existing.pProgram;
+			}
+		}
+
+		entry.pProgram = new Program();
+
+		const bool cached = isBinaryCacheEnabled();
+
+		if (cached && loadBinary(entry.pProgram, entry))
+		{
+			m_stats.binaryHits++;
+		}
+		else
+		{
+			compile(entry.pProgram, entry, cached);
+		}
+		//measured to the last link rather than summed per program, so reading files and everything else at startup is included
+		m_stats.startupMilliseconds = getMilliseconds(m_start);
+
+		m_stats.programs++;
+		m_programs.push_back(entry);
+
+		return entry.pProgram;
+	}
+
+	////////////////////////////////////////////////////////////
+	void ShaderRegistry::releaseProgram(Program* pProgram)
+	{
+		for (unsigned int i = 0; i < m_programs.size(); i++)
+		{
+			if (m_programs[i].pProgram == pProgram)
+			{
+				if (--m_programs[i].references == 0)
+				{
+					delete pProgram;
+
+					m_programs[i] = m_programs.back();
+					m_programs.pop_back();
+					m_stats.programs--;
+				}
+
+				return;
+			}
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	unsigned int ShaderRegistry::reload(const String& filename)
+	{
+		const StringId file(filename);
+		//files that were never read are not part of any shader
+		if (!m_files.erase(file))
+		{
+			return 0;
+		}
+
+		std::vector<StringId> stale;
+
+		m_sources.forEach([&](const StringId& shader, const Source_t& source)
+		{
+			for (const auto& include : source.files)
+			{
+				if (include == file)
+				{
+					stale.push_back(shader);
+					break;
+				}
+			}
+		});
+
+		for (const auto& shader : stale)
+		{
+			m_sources.erase(shader);
+		}
+
+		const bool cached = isBinaryCacheEnabled();
+		unsigned int relinked = 0;
+
+		for (auto& entry : m_programs)
+		{
+			if (m_sources.find(entry.vertexShader) && m_sources.find(entry.fragmentShader))
+			{
+				continue;
+			}
+
+			Entry_t updated = entry;
+
+			const Source_t* pVertex = preprocess(entry.vertexShader);
+			updated.vertexHash = pVertex ? pVertex->hash : 0;
+			updated.vertexLength = pVertex ? pVertex->source.getLength() : 0;
+
+			const Source_t* pFragment = preprocess(entry.fragmentShader);
+			updated.fragmentHash = pFragment ? pFragment->hash : 0;
+			updated.fragmentLength = pFragment ? pFragment->source.getLength() : 0;
+			//linked separately, so a mistake in the edited file leaves the running program untouched
+			Program program;
+			compile(&program, updated, cached);
+
+			if (!program.getID())
+			{
+				DebugLog::warning("Keeping the previous program of", entry.vertexShader, "and", entry.fragmentShader);
+				continue;
+			}
+
+			entry.pProgram->swap(program);
+			entry.vertexHash = updated.vertexHash;
+			entry.fragmentHash = updated.fragmentHash;
+			entry.vertexLength = updated.vertexLength;
+			entry.fragmentLength = updated.fragmentLength;
+
+			relinked++;
+		}
+
+		return relinked;
+	}
+
+}//namespace sparky
\ No newline at end of file
@@ -24,18 +24,23 @@
 
 /*
 ====================
-Class Includes
+CPP Includes
 ====================
 */
-#include <sparky\rendering\texture.hpp>	// Class definition.
-#include <sparky\utils\string.hpp>		// Loading the texture from a file directory.
-#include <sparky\utils\debug.hpp>		// Printing any potential issues.
+#include <algorithm>					// The dimensions of each mipmap level.
+#include <cstring>						// Copying the tiles of an array texture.
+#include <vector>						// The layers of an array texture.
 /*
 ====================
-Additional Includes
+Class Includes
 ====================
 */
-#include <SDL_image\SDL_image.h>		// Loading the texture using the SDL2 library.
+#include <sparky\rendering\texture.hpp>	// Class definition.
+#include <sparky\utils\string.hpp>		// Loading the texture from a file directory.
+#include <sparky\utils\gldevice.hpp>	// Texture binds are filtered by the device's state cache.
+#include <sparky\rendering\textureloader.hpp>	// The file is decoded in the background.
+#include <sparky\rendering\ktxfile.hpp>		// Uploading baked levels.
+#include <sparky\utils\debug.hpp>		// Baked tilesheets whose tiles cannot be cut along the blocks.
 
 namespace sparky
 {
@@ -46,35 +51,30 @@ namespace sparky
 	*/
 	////////////////////////////////////////////////////////////
 	Texture::Texture(const String& filename, const SPARKY_TEXTURE_DESC& desc)
-		: Ref(), m_ID(0), m_dimensions(), m_pTexels(nullptr)
+		: Ref(), m_ID(0), m_dimensions(), m_filename(filename), m_desc(desc), m_loaded(false)
 	{
-		SDL_Surface* pSurface = IMG_Load(filename.getCString());
-
-		if (!pSurface)
-		{
-			DebugLog::warning("Failed to load texture:", filename, IMG_GetError());
-			return;
-		}
+		const GLFunctions_t& gl = GLDevice::getFunctions();
 
-		m_dimensions.x = pSurface->w;
-		m_dimensions.y = pSurface->h;
+		gl.genTextures(1, &m_ID);
+		GLDevice::bindTexture(desc.target, 0, m_ID);
 
-		m_pTexels = pSurface->pixels;
+		gl.texParameteri(desc.target, GL_TEXTURE_MIN_FILTER, static_cast<GLint>(desc.filter));
+		gl.texParameteri(desc.target, GL_TEXTURE_MAG_FILTER, static_cast<GLint>(desc.filter));
+		gl.texParameteri(desc.target, GL_TEXTURE_WRAP_S,	    static_cast<GLint>(desc.mode));
+		gl.texParameteri(desc.target, GL_TEXTURE_WRAP_T,	    static_cast<GLint>(desc.mode));
+		//drawn with a plain white texel until the file has been decoded and uploaded
+		const unsigned char placeholder[4] = { 255, 255, 255, 255 };
 
-		glGenTextures(1, &m_ID);
-		glBindTexture(desc.target, m_ID);
-
-		glTexParameteri(desc.target, GL_TEXTURE_MIN_FILTER, static_cast<GLint>(desc.filter));
-		glTexParameteri(desc.target, GL_TEXTURE_MAG_FILTER, static_cast<GLint>(desc.filter));
-		glTexParameteri(desc.target, GL_TEXTURE_WRAP_S,	    static_cast<GLint>(desc.mode));
-		glTexParameteri(desc.target, GL_TEXTURE_WRAP_T,	    static_cast<GLint>(desc.mode));
-
-		glTexImage2D(desc.target, 0, GL_RGBA, m_dimensions.x, m_dimensions.y, 0, desc.internalFormat, GL_UNSIGNED_BYTE, m_pTexels);
-		glGenerateMipmap(desc.target);
-
-		glBindTexture(desc.target, NULL);
+		if (desc.target == GL_TEXTURE_2D_ARRAY)
+		{
+			gl.texImage3D(desc.target, 0, desc.internalFormat, 1, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, placeholder);
+		}
+		else
+		{
+			gl.texImage2D(desc.target, 0, desc.internalFormat, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, placeholder);
+		}
 
-		SDL_FreeSurface(pSurface);
+		TextureLoader::getInstance().load(this);
 	}
 
 	////////////////////////////////////////////////////////////
@@ -82,7 +82,8 @@ namespace sparky
 	{
 		if (m_ID)
 		{
-			glDeleteTextures(1, &m_ID);
+			GLDevice::releaseTexture(m_ID);
+			GLDevice::getFunctions().deleteTextures(1, &m_ID);
 			m_ID = NULL;
 		}
 	}
@@ -98,6 +99,12 @@ namespace sparky
 		return m_ID;
 	}
 
+	////////////////////////////////////////////////////////////
+	GLenum Texture::getTarget(void) const
+	{
+		return m_desc.target;
+	}
+
 	////////////////////////////////////////////////////////////
 	const Vector2u& Texture::getDimensions(void) const
 	{
@@ -105,22 +112,166 @@ namespace sparky
 	}
 
 	////////////////////////////////////////////////////////////
-	void* Texture::getTexels(void) const
+	const String& Texture::getFilename(void) const
+	{
+		return m_filename;
+	}
+
+	////////////////////////////////////////////////////////////
+	const SPARKY_TEXTURE_DESC& Texture::getDescription(void) const
+	{
+		return m_desc;
+	}
+
+	////////////////////////////////////////////////////////////
+	bool Texture::isLoaded(void) const
+	{
+		return m_loaded;
+	}
+
+	/*
+	====================
+	Methods
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	void Texture::upload(const unsigned int width, const unsigned int height, const void* pTexels)
+	{
+		const GLFunctions_t& gl = GLDevice::getFunctions();
+
+		m_dimensions.x = width;
+		m_dimensions.y = height;
+
+		GLDevice::bindTexture(m_desc.target, 0, m_ID);
+
+		if (m_desc.target == GL_TEXTURE_2D_ARRAY)
+		{
+			const unsigned int tile = m_desc.tileSize ? m_desc.tileSize : width;
+			const unsigned int columns = std::max(width / tile, 1u);
+			const unsigned int rows = std::max(height / tile, 1u);
+			const unsigned int row = tile * 4;
+			//each tile is copied out of the sheet so the layers lie one after another
+			std::vector<unsigned char> layers(row * tile * columns * rows);
+			unsigned char* pLayer = &layers[0];
+
+			for (unsigned int y = 0; y < rows; y++)
+			{
+				for (unsigned int x = 0; x < columns; x++)
+				{
+					for (unsigned int line = 0; line < tile; line++, pLayer += row)
+					{
+						std::memcpy(pLayer, static_cast<const unsigned char*>(pTexels) + ((y * tile + line) * width + x * tile) * 4, row);
+					}
+				}
+			}
+
+			m_dimensions.x = tile;
+			m_dimensions.y = tile;
+
+			gl.texImage3D(m_desc.target, 0, m_desc.internalFormat, tile, tile, columns * rows, 0, GL_RGBA, GL_UNSIGNED_BYTE, &layers[0]);
+		}
+		else
+		{
+			gl.texImage2D(m_desc.target, 0, m_desc.internalFormat, m_dimensions.x, m_dimensions.y, 0, GL_RGBA, GL_UNSIGNED_BYTE, pTexels);
+		}
+		//the layers of an array are filtered separately, so their mipmaps never bleed into each other
+		gl.generateMipmap(m_desc.target);
+
+		m_loaded = true;
+	}
+
+	////////////////////////////////////////////////////////////
+	void Texture::upload(const KTXFile& file)
+	{
+		const GLFunctions_t& gl = GLDevice::getFunctions();
+
+		const Vector2u& dimensions = file.getDimensions();
+		unsigned int levels = file.getLevelCount();
+
+		if (m_desc.target == GL_TEXTURE_2D_ARRAY)
+		{
+			const unsigned int tile = m_desc.tileSize ? m_desc.tileSize : dimensions.x;
+			//blocks cannot be split, so a tile has to start and end on a block at every level that is uploaded
+			if (tile % 4 != 0 || tile > dimensions.x || tile > dimensions.y)
+			{
+				DebugLog::warning("Baked tile size is not a multiple of 4:", m_filename);
+				return;
+			}
+
+			const unsigned int columns = dimensions.x / tile;
+			const unsigned int rows = dimensions.y / tile;
+
+			GLDevice::bindTexture(m_desc.target, 0, m_ID);
+
+			std::vector<unsigned char> layers;
+			unsigned int level = 0;
+
+			for (; level < levels && tile % (4u << level) == 0; level++)
+			{
+				const unsigned int blocksAcross = (std::max(dimensions.x >> level, 1u) + 3) / 4;
+				const unsigned int blocksDown = (std::max(dimensions.y >> level, 1u) + 3) / 4;
+				const unsigned int blockSize = file.getLevelSize(level) / (blocksAcross * blocksDown);
+				const unsigned int tileBlocks = (tile >> level) / 4;
+				const unsigned int row = tileBlocks * blockSize;
+				//each tile is copied out of the level a row of blocks at a time, so the layers lie one after another
+				layers.resize(row * tileBlocks * columns * rows);
+				unsigned char* pLayer = &layers[0];
+
+				for (unsigned int y = 0; y < rows; y++)
+				{
+					for (unsigned int x = 0; x < columns; x++)
+					{
+						for (unsigned int line = 0; line < tileBlocks; line++, pLayer += row)
+						{
+							std::memcpy(pLayer, file.getLevel(level) + ((y * tileBlocks + line) * blocksAcross + x * tileBlocks) * blockSize, row);
+						}
+					}
+				}
+
+				gl.compressedTexImage3D(m_desc.target, level, file.getInternalFormat(), tile >> level, tile >> level, columns * rows, 0, 
+					static_cast<GLsizei>(layers.size()), &layers[0]);
+			}
+
+			m_dimensions.x = tile;
+			m_dimensions.y = tile;
+			levels = level;
+		}
+		else
+		{
+			m_dimensions = dimensions;
+
+			GLDevice::bindTexture(m_desc.target, 0, m_ID);
+
+			for (unsigned int i = 0; i < levels; i++)
+			{
+				const GLsizei width = std::max(m_dimensions.x >> i, 1u);
+				const GLsizei height = std::max(m_dimensions.y >> i, 1u);
+
+				gl.compressedTexImage2D(m_desc.target, i, file.getInternalFormat(), width, height, 0, file.getLevelSize(i), file.getLevel(i));
+			}
+		}
+		//a file without its full chain must not leave the texture incomplete
+		gl.texParameteri(m_desc.target, GL_TEXTURE_MAX_LEVEL, levels - 1);
+
+		m_loaded = true;
+	}
+
+	////////////////////////////////////////////////////////////
+	void Texture::reload(void)
 	{
-		return m_pTexels;
+		TextureLoader::getInstance().load(this);
 	}
 
 	////////////////////////////////////////////////////////////
 	void Texture::bind(const GLuint location/*= 0*/) const
 	{
-		glActiveTexture(GL_TEXTURE0 + location);
-		glBindTexture(GL_TEXTURE_2D, m_ID);
+		GLDevice::bindTexture(m_desc.target, location, m_ID);
 	}
 
 	////////////////////////////////////////////////////////////
-	void Texture::unbind(void) const
+	void Texture::unbind(const GLuint location/*= 0*/) const
 	{
-		glBindTexture(GL_TEXTURE_2D, NULL);
+		GLDevice::bindTexture(m_desc.target, location, NULL);
 	}
 
 }//namespace sparky
\ No newline at end of file
@@ -0,0 +1,672 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// 
+// Sparky Engine
+// 2016 - Benjamin Carter (benjamin.mark.carter@hotmail.com)
+// 
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+// 
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+// 
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgement
+//    in the product documentation would be appreciated but is not required.
+// 
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+// 
+// 3. This notice may not be removed or altered from any source distribution.
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+====================
+CPP Includes
+====================
+*/
+#include <algorithm>							// Clamping the texels and endpoints.
+#include <cfloat>								// The starting error of each texel.
+#include <chrono>								// Timing each bake.
+#include <cmath>								// Normalising the principal axis.
+#include <cstring>								// Copying the rows of the source image.
+/*
+====================
+Class Includes
+====================
+*/
+#include <sparky\rendering\texturebaker.hpp>	// Class definition.
+#include <sparky\rendering\ktxfile.hpp>			// The container the levels are written to.
+#include <sparky\utils\defines.hpp>				// Whether SSE is available.
+#include <sparky\utils\debug.hpp>				// Reporting each bake.
+/*
+====================
+Additional Includes
+====================
+*/
+#include <SDL_image\SDL_image.h>				// Decoding the source images.
+
+#if SPARKY_SSE
+#include <xmmintrin.h>							// Matching four texels to the palette at a time.
+#endif
+
+namespace sparky
+{
+	/*
+	====================
+	Colour Packing
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	static unsigned short packColour(const float* pColour)
+	{
+		const unsigned int r = static_cast<unsigned int>(std::min(std::max(pColour[0], 0.0f), 255.0f) * 31.0f / 255.0f + 0.5f);
+		const unsigned int g = static_cast<unsigned int>(std::min(std::max(pColour[1], 0.0f), 255.0f) * 63.0f / 255.0f + 0.5f);
+		const unsigned int b = static_cast<unsigned int>(std::min(std::max(pColour[2], 0.0f), 255.0f) * 31.0f / 255.0f + 0.5f);
+
+		return static_cast<unsigned short>((r << 11) | (g << 5) | b);
+	}
+
+	////////////////////////////////////////////////////////////
+	static void unpackColour(const unsigned short colour, float* pColour)
+	{
+		const unsigned int r = (colour >> 11) & 31;
+		const unsigned int g = (colour >> 5) & 63;
+		const unsigned int b = colour & 31;
+		//the decoder widens by repeating the top bits
+		pColour[0] = static_cast<float>((r << 3) | (r >> 2));
+		pColour[1] = static_cast<float>((g << 2) | (g >> 4));
+		pColour[2] = static_cast<float>((b << 3) | (b >> 2));
+	}
+
+	////////////////////////////////////////////////////////////
+	static bool normalise(float* pAxis)
+	{
+		const float length = std::sqrt(pAxis[0] * pAxis[0] + pAxis[1] * pAxis[1] + pAxis[2] * pAxis[2]);
+
+		if (length < 1e-6f)
+		{
+			return false;
+		}
+
+		pAxis[0] /= length;
+		pAxis[1] /= length;
+		pAxis[2] /= length;
+
+		return true;
+	}
+
+	////////////////////////////////////////////////////////////
+	static double getMilliseconds(const std::chrono::high_resolution_clock::time_point& start)
+	{
+		return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+	}
+
+	/*
+	====================
+	Static Fields
+	====================
+	*/
+	const unsigned int TextureBaker::BLOCK_DIMENSION;
+
+	/*
+	====================
+	Private Methods
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	void TextureBaker::fetchBlock(const unsigned int width, const unsigned int height, const unsigned char* pTexels, 
+		const unsigned int x, const unsigned int y, Block_t& block)
+	{
+		for (unsigned int j = 0; j < BLOCK_DIMENSION; j++)
+		{
+			const unsigned int row = std::min(y + j, height - 1);
+
+			for (unsigned int i = 0; i < BLOCK_DIMENSION; i++)
+			{
+				const unsigned char* pTexel = pTexels + (row * width + std::min(x + i, width - 1)) * 4;
+				const unsigned int index = j * BLOCK_DIMENSION + i;
+
+				block.r[index] = pTexel[0];
+				block.g[index] = pTexel[1];
+				block.b[index] = pTexel[2];
+				block.a[index] = pTexel[3];
+			}
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	float TextureBaker::selectColours(const Block_t& block, const float palette[3][4], unsigned char* pIndices)
+	{
+		float error = 0.0f;
+
+#if SPARKY_SSE
+		for (unsigned int t = 0; t < 16; t += 4)
+		{
+			const __m128 r = _mm_loadu_ps(&block.r[t]);
+			const __m128 g = _mm_loadu_ps(&block.g[t]);
+			const __m128 b = _mm_loadu_ps(&block.b[t]);
+
+			__m128 best = _mm_set1_ps(FLT_MAX);
+			__m128 closest = _mm_setzero_ps();
+
+			for (unsigned int p = 0; p < 4; p++)
+			{
+				const __m128 dr = _mm_sub_ps(r, _mm_set1_ps(palette[0][p]));
+				const __m128 dg = _mm_sub_ps(g, _mm_set1_ps(palette[1][p]));
+				const __m128 db = _mm_sub_ps(b, _mm_set1_ps(palette[2][p]));
+				const __m128 distance = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dr, dr), _mm_mul_ps(dg, dg)), _mm_mul_ps(db, db));
+				//ties keep the lower index
+				const __m128 closer = _mm_cmplt_ps(distance, best);
+
+				best = _mm_min_ps(distance, best);
+				closest = _mm_or_ps(_mm_and_ps(closer, _mm_set1_ps(static_cast<float>(p))), _mm_andnot_ps(closer, closest));
+			}
+
+			float indices[4];
+			float errors[4];
+			_mm_storeu_ps(indices, closest);
+			_mm_storeu_ps(errors, best);
+
+			for (unsigned int i = 0; i < 4; i++)
+			{
+				pIndices[t + i] = static_cast<unsigned char>(indices[i]);
+				error += errors[i];
+			}
+		}
+#else
+		for (unsigned int t = 0; t < 16; t++)
+		{
+			float best = FLT_MAX;
+
+			for (unsigned int p = 0; p < 4; p++)
+			{
+				const float dr = block.r[t] - palette[0][p];
+				const float dg = block.g[t] - palette[1][p];
+				const float db = block.b[t] - palette[2][p];
+				const float distance = dr * dr + dg * dg + db * db;
+
+				if (distance < best)
+				{
+					best = distance;
+					pIndices[t] = static_cast<unsigned char>(p);
+				}
+			}
+
+			error += best;
+		}
+#endif
+
+		return error;
+	}
+
+	////////////////////////////////////////////////////////////
+	void TextureBaker::selectAlphas(const Block_t& block, const float palette[8], unsigned char* pIndices)
+	{
+#if SPARKY_SSE
+		for (unsigned int t = 0; t < 16; t += 4)
+		{
+			const __m128 a = _mm_loadu_ps(&block.a[t]);
+
+			__m128 best = _mm_set1_ps(FLT_MAX);
+			__m128 closest = _mm_setzero_ps();
+
+			for (unsigned int p = 0; p < 8; p++)
+			{
+				const __m128 da = _mm_sub_ps(a, _mm_set1_ps(palette[p]));
+				const __m128 distance = _mm_mul_ps(da, da);
+				const __m128 closer = _mm_cmplt_ps(distance, best);
+
+				best = _mm_min_ps(distance, best);
+				closest = _mm_or_ps(_mm_and_ps(closer, _mm_set1_ps(static_cast<float>(p))), _mm_andnot_ps(closer, closest));
+			}
+
+			float indices[4];
+			_mm_storeu_ps(indices, closest);
+
+			for (unsigned int i = 0; i < 4; i++)
+			{
+				pIndices[t + i] = static_cast<unsigned char>(indices[i]);
+			}
+		}
+#else
+		for (unsigned int t = 0; t < 16; t++)
+		{
+			float best = FLT_MAX;
+
+			for (unsigned int p = 0; p < 8; p++)
+			{
+				const float distance = (block.a[t] - palette[p]) * (block.a[t] - palette[p]);
+
+				if (distance < best)
+				{
+					best = distance;
+					pIndices[t] = static_cast<unsigned char>(p);
+				}
+			}
+		}
+#endif
+	}
+
+	////////////////////////////////////////////////////////////
+	void TextureBaker::encodeColour(const Block_t& block, unsigned char* pOutput)
+	{
+		float mean[3] = { 0.0f, 0.0f, 0.0f };
+
+		for (unsigned int t = 0; t < 16; t++)
+		{
+			mean[0] += block.r[t];
+			mean[1] += block.g[t];
+			mean[2] += block.b[t];
+		}
+
+		mean[0] /= 16.0f;
+		mean[1] /= 16.0f;
+		mean[2] /= 16.0f;
+		//the covariance is symmetric, so only the upper triangle is kept (rr, rg, rb, gg, gb, bb)
+		float covariance[6] = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f };
+
+		for (unsigned int t = 0; t < 16; t++)
+		{
+			const float r = block.r[t] - mean[0];
+			const float g = block.g[t] - mean[1];
+			const float b = block.b[t] - mean[2];
+
+			covariance[0] += r * r;
+			covariance[1] += r * g;
+			covariance[2] += r * b;
+			covariance[3] += g * g;
+			covariance[4] += g * b;
+			covariance[5] += b * b;
+		}
+		//seeded from the row of the channel that varies the most, as a fixed seed can be orthogonal to the colours of the block
+		const unsigned int diagonal = covariance[0] >= covariance[3] && covariance[0] >= covariance[5] ? 0 : 
+			(covariance[3] >= covariance[5] ? 1 : 2);
+		const unsigned int rows[3][3] = { { 0, 1, 2 }, { 1, 3, 4 }, { 2, 4, 5 } };
+
+		float axis[3] = { covariance[rows[diagonal][0]], covariance[rows[diagonal][1]], covariance[rows[diagonal][2]] };
+		bool converged = normalise(axis);
+		//a few power iterations are enough to find the principal axis of 16 points
+		for (unsigned int i = 0; converged && i < 4; i++)
+		{
+			float next[3];
+			next[0] = covariance[0] * axis[0] + covariance[1] * axis[1] + covariance[2] * axis[2];
+			next[1] = covariance[1] * axis[0] + covariance[3] * axis[1] + covariance[4] * axis[2];
+			next[2] = covariance[2] * axis[0] + covariance[4] * axis[1] + covariance[5] * axis[2];
+
+			if (!normalise(next))
+			{
+				converged = false;
+				break;
+			}
+
+			std::copy(next, next + 3, axis);
+		}
+		//if the iteration collapses, the diagonal of the block's bounding box still runs between its extremes
+		if (!converged)
+		{
+			float minimum[3] = { block.r[0], block.g[0], block.b[0] };
+			float maximum[3] = { block.r[0], block.g[0], block.b[0] };
+
+			for (unsigned int t = 1; t < 16; t++)
+			{
+				minimum[0] = std::min(minimum[0], block.r[t]);
+				minimum[1] = std::min(minimum[1], block.g[t]);
+				minimum[2] = std::min(minimum[2], block.b[t]);
+				maximum[0] = std::max(maximum[0], block.r[t]);
+				maximum[1] = std::max(maximum[1], block.g[t]);
+				maximum[2] = std::max(maximum[2], block.b[t]);
+			}
+
+			for (unsigned int c = 0; c < 3; c++)
+			{
+				axis[c] = maximum[c] - minimum[c];
+			}
+			//a block of a single colour has no axis, and every texel projects onto the mean
+			if (!normalise(axis))
+			{
+				std::fill(axis, axis + 3, 0.0f);
+			}
+		}
+
+		float lowest = 0.0f;
+		float highest = 0.0f;
+
+		for (unsigned int t = 0; t < 16; t++)
+		{
+			const float projection = (block.r[t] - mean[0]) * axis[0] + (block.g[t] - mean[1]) * axis[1] + (block.b[t] - mean[2]) * axis[2];
+
+			lowest = std::min(lowest, projection);
+			highest = std::max(highest, projection);
+		}
+
+		float endpoints[2][3];
+
+		for (unsigned int c = 0; c < 3; c++)
+		{
+			endpoints[0][c] = mean[c] + axis[c] * highest;
+			endpoints[1][c] = mean[c] + axis[c] * lowest;
+		}
+
+		unsigned short colours[2] = { 0, 0 };
+		unsigned char indices[16];
+		float error = FLT_MAX;
+		//the second pass refits the endpoints to the indices of the first
+		for (unsigned int pass = 0; pass < 2; pass++)
+		{
+			unsigned short candidates[2] = { packColour(endpoints[0]), packColour(endpoints[1]) };
+			//the first colour must be the larger, otherwise the block is decoded with three colours and black
+			if (candidates[0] < candidates[1])
+			{
+				std::swap(candidates[0], candidates[1]);
+			}
+
+			float palette[3][4];
+			float first[3];
+			float second[3];
+			unpackColour(candidates[0], first);
+			unpackColour(candidates[1], second);
+
+			for (unsigned int c = 0; c < 3; c++)
+			{
+				palette[c][0] = first[c];
+				palette[c][1] = second[c];
+				palette[c][2] = (2.0f * first[c] + second[c]) / 3.0f;
+				palette[c][3] = (first[c] + 2.0f * second[c]) / 3.0f;
+			}
+
+			unsigned char candidateIndices[16];
+			const float candidateError = selectColours(block, palette, candidateIndices);
+
+			if (candidateError < error)
+			{
+				error = candidateError;
+				colours[0] = candidates[0];
+				colours[1] = candidates[1];
+				std::copy(candidateIndices, candidateIndices + 16, indices);
+			}
+
+			if (pass == 1 || colours[0] == colours[1])
+			{
+				break;
+			}
+			//least squares fit of the endpoints, each texel being weighted towards the endpoints by its index
+			const float weights[4] = { 1.0f, 0.0f, 2.0f / 3.0f, 1.0f / 3.0f };
+			float aa = 0.0f;
+			float ab = 0.0f;
+			float bb = 0.0f;
+			float ax[3] = { 0.0f, 0.0f, 0.0f };
+			float bx[3] = { 0.0f, 0.0f, 0.0f };
+
+			for (unsigned int t = 0; t < 16; t++)
+			{
+				const float a = weights[indices[t]];
+				const float b = 1.0f - a;
+				const float texel[3] = { block.r[t], block.g[t], block.b[t] };
+
+				aa += a * a;
+				ab += a * b;
+				bb += b * b;
+
+				for (unsigned int c = 0; c < 3; c++)
+				{
+					ax[c] += a * texel[c];
+					bx[c] += b * texel[c];
+				}
+			}
+
+			const float determinant = aa * bb - ab * ab;
+
+			if (std::fabs(determinant) < 1e-6f)
+			{
+				break;
+			}
+
+			for (unsigned int c = 0; c < 3; c++)
+			{
+				endpoints[0][c] = (bb * ax[c] - ab * bx[c]) / determinant;
+				endpoints[1][c] = (aa * bx[c] - ab * ax[c]) / determinant;
+			}
+		}
+
+		unsigned int bits = 0;
+		//a single colour uses the first endpoint everywhere, the last index would be black
+		if (colours[0] != colours[1])
+		{
+			for (unsigned int t = 0; t < 16; t++)
+			{
+				bits |= static_cast<unsigned int>(indices[t]) << (t * 2);
+			}
+		}
+
+		pOutput[0] = static_cast<unsigned char>(colours[0] & 0xFF);
+		pOutput[1] = static_cast<unsigned char>(colours[0] >> 8);
+		pOutput[2] = static_cast<unsigned char>(colours[1] & 0xFF);
+		pOutput[3] = static_cast<unsigned char>(colours[1] >> 8);
+
+		for (unsigned int i = 0; i < 4; i++)
+		{
+			pOutput[4 + i] = static_cast<unsigned char>((bits >> (i * 8)) & 0xFF);
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	void TextureBaker::encodeAlpha(const Block_t& block, unsigned char* pOutput)
+	{
+		const unsigned char highest = static_cast<unsigned char>(*std::max_element(block.a, block.a + 16));
+		const unsigned char lowest = static_cast<unsigned char>(*std::min_element(block.a, block.a + 16));
+
+		unsigned long long bits = 0;
+		//the first alpha being the larger gives six interpolated alphas rather than four and the extremes
+		if (highest != lowest)
+		{
+			float palette[8];
+			palette[0] = highest;
+			palette[1] = lowest;
+
+			for (unsigned int i = 2; i < 8; i++)
+			{
+				palette[i] = ((8 - i) * palette[0] + (i - 1) * palette[1]) / 7.0f;
+			}
+
+			unsigned char indices[16];
+			selectAlphas(block, palette, indices);
+
+			for (unsigned int t = 0; t < 16; t++)
+			{
+				bits |= static_cast<unsigned long long>(indices[t]) << (t * 3);
+			}
+		}
+
+		pOutput[0] = highest;
+		pOutput[1] = lowest;
+
+		for (unsigned int i = 0; i < 6; i++)
+		{
+			pOutput[2 + i] = static_cast<unsigned char>((bits >> (i * 8)) & 0xFF);
+		}
+	}
+
+	/*
+	====================
+	Getters and Setters
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	GLenum TextureBaker::getInternalFormat(const eBlockFormat format)
+	{
+		return format == eBlockFormat::BC1 ? GL_COMPRESSED_RGB_S3TC_DXT1_EXT : GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
+	}
+
+	////////////////////////////////////////////////////////////
+	unsigned int TextureBaker::getBlockSize(const eBlockFormat format)
+	{
+		return format == eBlockFormat::BC1 ? 8 : 16;
+	}
+
+	/*
+	====================
+	Methods
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	void TextureBaker::encode(const eBlockFormat format, const unsigned int width, const unsigned int height, const unsigned char* pTexels, 
+		std::vector<unsigned char>& blocks)
+	{
+		const unsigned int columns = (width + BLOCK_DIMENSION - 1) / BLOCK_DIMENSION;
+		const unsigned int rows = (height + BLOCK_DIMENSION - 1) / BLOCK_DIMENSION;
+		const unsigned int size = getBlockSize(format);
+
+		blocks.resize(columns * rows * size);
+
+		Block_t block;
+		unsigned char* pOutput = &blocks[0];
+
+		for (unsigned int y = 0; y < rows; y++)
+		{
+			for (unsigned int x = 0; x < columns; x++)
+			{
+				fetchBlock(width, height, pTexels, x * BLOCK_DIMENSION, y * BLOCK_DIMENSION, block);
+
+				if (format == eBlockFormat::BC3)
+				{
+					encodeAlpha(block, pOutput);
+					encodeColour(block, pOutput + 8);
+				}
+				else
+				{
+					encodeColour(block, pOutput);
+				}
+
+				pOutput += size;
+			}
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	void TextureBaker::downsample(const unsigned int width, const unsigned int height, const unsigned char* pTexels, 
+		std::vector<unsigned char>& result)
+	{
+		const unsigned int halfWidth = std::max(width / 2, 1u);
+		const unsigned int halfHeight = std::max(height / 2, 1u);
+
+		result.resize(halfWidth * halfHeight * 4);
+
+		for (unsigned int y = 0; y < halfHeight; y++)
+		{
+			const unsigned int top = std::min(y * 2, height - 1) * width;
+			const unsigned int bottom = std::min(y * 2 + 1, height - 1) * width;
+
+			for (unsigned int x = 0; x < halfWidth; x++)
+			{
+				const unsigned int left = std::min(x * 2, width - 1);
+				const unsigned int right = std::min(x * 2 + 1, width - 1);
+
+				for (unsigned int c = 0; c < 4; c++)
+				{
+					const unsigned int sum = pTexels[(top + left) * 4 + c] + pTexels[(top + right) * 4 + c] + 
+						pTexels[(bottom + left) * 4 + c] + pTexels[(bottom + right) * 4 + c];
+
+					result[(y * halfWidth + x) * 4 + c] = static_cast<unsigned char>((sum + 2) / 4);
+				}
+			}
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	void TextureBaker::bake(const eBlockFormat format, const unsigned int width, const unsigned int height, const unsigned char* pTexels, 
+		KTXFile& file)
+	{
+		file.create(getInternalFormat(format), width, height);
+
+		std::vector<unsigned char> level(pTexels, pTexels + width * height * 4);
+		std::vector<unsigned char> next;
+		std::vector<unsigned char> blocks;
+
+		unsigned int levelWidth = width;
+		unsigned int levelHeight = height;
+		//every level down to a single pixel, as the driver expects of a complete mipmap chain
+		while (true)
+		{
+			encode(format, levelWidth, levelHeight, &level[0], blocks);
+			file.addLevel(&blocks[0], static_cast<unsigned int>(blocks.size()));
+
+			if (levelWidth == 1 && levelHeight == 1)
+			{
+				break;
+			}
+
+			downsample(levelWidth, levelHeight, &level[0], next);
+			level.swap(next);
+
+			levelWidth = std::max(levelWidth / 2, 1u);
+			levelHeight = std::max(levelHeight / 2, 1u);
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	bool TextureBaker::bake(const String& source, const String& destination, const eBlockFormat format)
+	{
+		const std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+
+		SDL_Surface* pSurface = IMG_Load(source.getCString());
+
+		if (!pSurface)
+		{
+			DebugLog::warning("Failed to load image:", source);
+			return false;
+		}
+		//the same byte order the TextureLoader decodes to
+#if SDL_BYTEORDER == SDL_BIG_ENDIAN
+		SDL_Surface* pConverted = SDL_ConvertSurfaceFormat(pSurface, SDL_PIXELFORMAT_RGBA8888, 0);
+#else
+		SDL_Surface* pConverted = SDL_ConvertSurfaceFormat(pSurface, SDL_PIXELFORMAT_ABGR8888, 0);
+#endif
+		SDL_FreeSurface(pSurface);
+
+		if (!pConverted)
+		{
+			DebugLog::warning("Failed to convert image:", source);
+			return false;
+		}
+
+		const unsigned int width = pConverted->w;
+		const unsigned int height = pConverted->h;
+		const unsigned int row = width * 4;
+
+		std::vector<unsigned char> texels(row * height);
+
+		SDL_LockSurface(pConverted);
+
+		for (unsigned int y = 0; y < height; y++)
+		{
+			std::memcpy(&texels[y * row], static_cast<const unsigned char*>(pConverted->pixels) + y * pConverted->pitch, row);
+		}
+
+		SDL_UnlockSurface(pConverted);
+		SDL_FreeSurface(pConverted);
+
+		KTXFile file;
+		bake(format, width, height, &texels[0], file);
+
+		if (!file.save(destination))
+		{
+			return false;
+		}
+		//what the same chain would have cost uncompressed
+		unsigned int uncompressed = 0;
+
+		for (unsigned int i = 0; i < file.getLevelCount(); i++)
+		{
+			uncompressed += std::max(width >> i, 1u) * std::max(height >> i, 1u) * 4;
+		}
+
+		DebugLog::message("Baked", source, "to", destination, ":", width, "x", height, ",", file.getLevelCount(), "levels,", 
+			uncompressed, "bytes to", file.getSize(), "bytes in", getMilliseconds(start), "ms");
+
+		return true;
+	}
+
+}//namespace sparky
\ No newline at end of file
@@ -0,0 +1,261 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// 
+// Sparky Engine
+// 2016 - Benjamin Carter (benjamin.mark.carter@hotmail.com)
+// 
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+// 
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+// 
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgement
+//    in the product documentation would be appreciated but is not required.
+// 
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+// 
+// 3. This notice may not be removed or altered from any source distribution.
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+====================
+CPP Includes
+====================
+*/
+#include <algorithm>							// Moving the images to upload out of the queue.
+#include <cstring>								// Copying the rows of the decoded image.
+#include <iterator>								// Appending the images to upload.
+/*
+====================
+Class Includes
+====================
+*/
+#include <sparky\rendering\textureloader.hpp>	// Class definition.
+#include <sparky\rendering\texture.hpp>			// The textures that are loaded.
+#include <sparky\utils\threadmanager.hpp>		// Images are decoded on the worker threads.
+#include <sparky\utils\debug.hpp>				// Warnings for files that cannot be decoded.
+/*
+====================
+Additional Includes
+====================
+*/
+#include <SDL_image\SDL_image.h>				// Decoding the image files.
+
+namespace sparky
+{
+	/*
+	====================
+	Static Fields
+	====================
+	*/
+	const unsigned int TextureLoader::DEFAULT_BUDGET;
+
+	/*
+	====================
+	Private Ctor
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	TextureLoader::TextureLoader(void)
+		: Singleton<TextureLoader>(), m_images(), m_decoding(0), m_mutex(), m_condition(), m_budget(DEFAULT_BUDGET)
+	{
+		m_stats.pending = 0;
+		m_stats.uploads = 0;
+		m_stats.uploadedBytes = 0;
+		m_stats.failures = 0;
+		//the destructor waits on the workers, so the thread manager has to outlive the loader
+		ThreadManager::getInstance();
+	}
+
+	/*
+	====================
+	Dtor
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	TextureLoader::~TextureLoader(void)
+	{
+		std::unique_lock<std::mutex> lock(m_mutex);
+		//the worker threads write into the loader, so it cannot go away while they are decoding
+		m_condition.wait(lock, [this]{ return m_decoding == 0; });
+
+		for (auto& image : m_images)
+		{
+			Ref::release(image.pTexture);
+		}
+
+		m_images.clear();
+	}
+
+	/*
+	====================
+	Private Methods
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	void TextureLoader::decode(Texture* pTexture)
+	{
+		Image_t image;
+		image.pTexture = pTexture;
+		image.width = 0;
+		image.height = 0;
+
+		SDL_Surface* pSurface = nullptr;
+		//baked files already hold their blocks and mipmaps
+		if (pTexture->getFilename().endsWith(".ktx"))
+		{
+			if (image.baked.open(pTexture->getFilename()))
+			{
+				image.width = image.baked.getDimensions().x;
+				image.height = image.baked.getDimensions().y;
+			}
+		}
+		else
+		{
+			pSurface = IMG_Load(pTexture->getFilename().getCString());
+		}
+
+		if (pSurface)
+		{
+			//whatever the file holds, the upload always reads 4 bytes per texel in R, G, B, A order
+#if SDL_BYTEORDER == SDL_BIG_ENDIAN
+			SDL_Surface* pConverted = SDL_ConvertSurfaceFormat(pSurface, SDL_PIXELFORMAT_RGBA8888, 0);
+#else
+			SDL_Surface* pConverted = SDL_ConvertSurfaceFormat(pSurface, SDL_PIXELFORMAT_ABGR8888, 0);
+#endif
+			SDL_FreeSurface(pSurface);
+
+			if (pConverted)
+			{
+				SDL_LockSurface(pConverted);
+
+				image.width = pConverted->w;
+				image.height = pConverted->h;
+				image.texels.resize(image.width * image.height * 4);
+				//surfaces may pad their rows, the staging memory does not
+				const unsigned int row = image.width * 4;
+
+				for (unsigned int y = 0; y < image.height; y++)
+				{
+					std::memcpy(&image.texels[y * row], static_cast<const unsigned char*>(pConverted->pixels) + y * pConverted->pitch, row);
+				}
+
+				SDL_UnlockSurface(pConverted);
+				SDL_FreeSurface(pConverted);
+			}
+		}
+
+		std::lock_guard<std::mutex> guard(m_mutex);
+
+		m_images.push_back(std::move(image));
+		m_decoding--;
+
+		m_condition.notify_all();
+	}
+
+	////////////////////////////////////////////////////////////
+	unsigned int TextureLoader::getSize(const Image_t& image)
+	{
+		return static_cast<unsigned int>(image.texels.size()) + image.baked.getSize();
+	}
+
+	/*
+	====================
+	Getters and Setters
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	void TextureLoader::setBudget(const unsigned int budget)
+	{
+		m_budget = budget;
+	}
+
+	////////////////////////////////////////////////////////////
+	unsigned int TextureLoader::getBudget(void) const
+	{
+		return m_budget;
+	}
+
+	////////////////////////////////////////////////////////////
+	const TextureLoaderStats_t& TextureLoader::getStats(void) const
+	{
+		return m_stats;
+	}
+
+	/*
+	====================
+	Methods
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	void TextureLoader::load(Texture* pTexture)
+	{
+		pTexture->addRef();
+
+		{
+			std::lock_guard<std::mutex> guard(m_mutex);
+			m_decoding++;
+		}
+
+		ThreadManager::getInstance().addTask([this, pTexture]{ decode(pTexture); });
+	}
+
+	////////////////////////////////////////////////////////////
+	void TextureLoader::upload(void)
+	{
+		std::vector<Image_t> images;
+
+		{
+			std::lock_guard<std::mutex> guard(m_mutex);
+
+			unsigned int bytes = 0;
+			unsigned int count = 0;
+			//always take the first image, so one larger than the budget is not stuck forever
+			while (count < m_images.size() && (count == 0 || bytes + getSize(m_images[count]) <= m_budget))
+			{
+				bytes += getSize(m_images[count]);
+				count++;
+			}
+
+			images.reserve(count);
+			std::move(m_images.begin(), m_images.begin() + count, std::back_inserter(images));
+			m_images.erase(m_images.begin(), m_images.begin() + count);
+
+			m_stats.pending = m_decoding + static_cast<unsigned int>(m_images.size());
+		}
+
+		m_stats.uploads = 0;
+		m_stats.uploadedBytes = 0;
+
+		for (auto& image : images)
+		{
+			if (image.width == 0)
+			{
+				DebugLog::warning("Failed to load texture:", image.pTexture->getFilename());
+				m_stats.failures++;
+			}
+			else
+			{
+				if (image.baked.getLevelCount())
+				{
+					image.pTexture->upload(image.baked);
+				}
+				else
+				{
+					image.pTexture->upload(image.width, image.height, &image.texels[0]);
+				}
+
+				m_stats.uploads++;
+				m_stats.uploadedBytes += getSize(image);
+			}
+
+			Ref::release(image.pTexture);
+		}
+	}
+
+}//namespace sparky
\ No newline at end of file
@@ -29,6 +29,7 @@ Class Includes
 */
 #include <sparky\rendering\uniform.hpp>			// Class definition.
 #include <sparky\rendering\program.hpp>			// Accessing the location of a uniform needs access to the Program's ID.
+#include <sparky\utils\gldevice.hpp>			// Uniforms are set through the device's function table.
 /*
 ====================
 Additional Includes
@@ -51,31 +52,36 @@ namespace sparky
 
 	/*
 	====================
-	Private Methods
+	Getters and Setters
 	====================
 	*/
 	////////////////////////////////////////////////////////////
-	GLint Uniform::getLocation(const String& name) const
+	GLint Uniform::getLocation(const StringId& name) const
 	{
-		return glGetUniformLocation(m_pProgram->getID(), name.getCString());
+		return m_pProgram->getUniformLocation(name);
 	}
 
+	/*
+	====================
+	Methods
+	====================
+	*/
 	////////////////////////////////////////////////////////////
 	void Uniform::setParameter(GLint location, const int value) const
 	{
-		glUniform1i(location, value);
+		GLDevice::getFunctions().uniform1i(location, value);
 	}
 
 	////////////////////////////////////////////////////////////
 	void Uniform::setParameter(GLint location, const unsigned int value) const
 	{
-		glUniform1i(location, value);
+		GLDevice::getFunctions().uniform1i(location, value);
 	}
 
 	////////////////////////////////////////////////////////////
 	void Uniform::setParameter(GLint location, const Vector2i& vector) const
 	{
-		glUniform2i(location, vector.x, vector.y);
+		GLDevice::getFunctions().uniform2i(location, vector.x, vector.y);
 	}
 
 	////////////////////////////////////////////////////////////
@@ -87,7 +93,7 @@ namespace sparky
 	////////////////////////////////////////////////////////////
 	void Uniform::setParameter(GLint location, const Vector3i& vector) const
 	{
-		glUniform3i(location, vector.x, vector.y, vector.z);
+		GLDevice::getFunctions().uniform3i(location, vector.x, vector.y, vector.z);
 	}
 
 	////////////////////////////////////////////////////////////
@@ -99,7 +105,7 @@ namespace sparky
 	////////////////////////////////////////////////////////////
 	void Uniform::setParameter(GLint location, const Vector4i& vector) const
 	{
-		glUniform4i(location, vector.x, vector.y, vector.z, vector.w);
+		GLDevice::getFunctions().uniform4i(location, vector.x, vector.y, vector.z, vector.w);
 	}
 
 	////////////////////////////////////////////////////////////
@@ -111,13 +117,13 @@ namespace sparky
 	////////////////////////////////////////////////////////////
 	void Uniform::setParameter(GLint location, const float value) const
 	{
-		glUniform1f(location, value);
+		GLDevice::getFunctions().uniform1f(location, value);
 	}
 
 	////////////////////////////////////////////////////////////
 	void Uniform::setParameter(GLint location, const Vector2f& vector) const
 	{
-		glUniform2f(location, vector.x, vector.y);
+		GLDevice::getFunctions().uniform2f(location, vector.x, vector.y);
 	}
 
 	////////////////////////////////////////////////////////////
@@ -129,7 +135,7 @@ namespace sparky
 	////////////////////////////////////////////////////////////
 	void Uniform::setParameter(GLint location, const Vector3f& vector) const
 	{
-		glUniform3f(location, vector.x, vector.y, vector.z);
+		GLDevice::getFunctions().uniform3f(location, vector.x, vector.y, vector.z);
 	}
 
 	////////////////////////////////////////////////////////////
@@ -141,7 +147,7 @@ namespace sparky
 	////////////////////////////////////////////////////////////
 	void Uniform::setParameter(GLint location, const Vector4f& vector) const
 	{
-		glUniform4f(location, vector.x, vector.y, vector.z, vector.w);
+		GLDevice::getFunctions().uniform4f(location, vector.x, vector.y, vector.z, vector.w);
 	}
 
 	////////////////////////////////////////////////////////////
@@ -153,7 +159,7 @@ namespace sparky
 	////////////////////////////////////////////////////////////
 	void Uniform::setParameter(GLint location, const Matrix4f& matrix) const
 	{
-		glUniformMatrix4fv(location, 1, GL_FALSE, &matrix.m[0][0]);
+		GLDevice::getFunctions().uniformMatrix4fv(location, 1, GL_FALSE, &matrix.m[0][0]);
 	}
 
 }//namespace sparky
\ No newline at end of file
@@ -0,0 +1,145 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// 
+// Sparky Engine
+// 2016 - Benjamin Carter (benjamin.mark.carter@hotmail.com)
+// 
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+// 
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+// 
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgement
+//    in the product documentation would be appreciated but is not required.
+// 
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+// 
+// 3. This notice may not be removed or altered from any source distribution.
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+====================
+CPP Includes
+====================
+*/
+#include <cstring>								// Copying the data into the ring.
+/*
+====================
+Class Includes
+====================
+*/
+#include <sparky\rendering\uniformring.hpp>	// Class definition.
+
+namespace sparky
+{
+	/*
+	====================
+	Ctor and Dtor
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	UniformRing::UniformRing(const unsigned int alignment/*= 1*/)
+		: m_data(), m_alignment(alignment), m_head(0), m_wrapCount(0), m_wrapped(false)
+	{
+	}
+
+	/*
+	====================
+	Getters and Setters
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	unsigned int UniformRing::getCapacity(void) const
+	{
+		return m_data.size();
+	}
+
+	////////////////////////////////////////////////////////////
+	unsigned int UniformRing::getAlignment(void) const
+	{
+		return m_alignment;
+	}
+
+	////////////////////////////////////////////////////////////
+	void UniformRing::setAlignment(const unsigned int alignment)
+	{
+		m_alignment = alignment;
+	}
+
+	////////////////////////////////////////////////////////////
+	unsigned int UniformRing::getStride(const unsigned int size) const
+	{
+		//the alignment reported by OpenGL is not required to be a power of two
+		return ((size + m_alignment - 1) / m_alignment) * m_alignment;
+	}
+
+	////////////////////////////////////////////////////////////
+	unsigned int UniformRing::getWrapCount(void) const
+	{
+		return m_wrapCount;
+	}
+
+	////////////////////////////////////////////////////////////
+	bool UniformRing::hasWrapped(void) const
+	{
+		return m_wrapped;
+	}
+
+	////////////////////////////////////////////////////////////
+	const void* UniformRing::getData(const unsigned int offset) const
+	{
+		return &m_data[offset];
+	}
+
+	/*
+	====================
+	Methods
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	unsigned int UniformRing::allocate(const unsigned int size)
+	{
+		unsigned int offset = getStride(m_head);
+		m_wrapped = false;
+
+		if (size > m_data.size())
+		{
+			unsigned int capacity = 1;
+
+			while (capacity < size * FRAMES_IN_FLIGHT)
+			{
+				capacity <<= 1;
+			}
+
+			m_data.resize(capacity);
+			offset = 0;
+			m_wrapped = true;
+		}
+		else if (offset > m_data.size() - size)
+		{
+			offset = 0;
+			m_wrapped = true;
+		}
+
+		if (m_wrapped)
+		{
+			m_wrapCount++;
+		}
+
+		m_head = offset + size;
+
+		return offset;
+	}
+
+	////////////////////////////////////////////////////////////
+	void UniformRing::write(const unsigned int offset, const void* pData, const unsigned int size)
+	{
+		std::memcpy(&m_data[offset], pData, size);
+	}
+
+}//namespace sparky
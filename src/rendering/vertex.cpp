@@ -28,19 +28,25 @@ namespace sparky
 {
 	////////////////////////////////////////////////////////////
 	Vertex_t::Vertex_t(void)
-		: position(), normal(), uv()
+		: position(), normal(), uv(), layer(0.0f)
 	{
 	}
 
 	////////////////////////////////////////////////////////////
 	Vertex_t::Vertex_t(const Vector3f& position, const Vector2f& uv)
-		: position(position), normal(), uv(uv)
+		: position(position), normal(), uv(uv), layer(0.0f)
+	{
+	}
+
+	////////////////////////////////////////////////////////////
+	Vertex_t::Vertex_t(const Vector3f& position, const Vector2f& uv, const float layer)
+		: position(position), normal(), uv(uv), layer(layer)
 	{
 	}
 
 	////////////////////////////////////////////////////////////
 	Vertex_t::Vertex_t(const Vector3f& position, const Vector3f& normal, const Vector2f& uv)
-		: position(position), normal(normal), uv(uv)
+		: position(position), normal(normal), uv(uv), layer(0.0f)
 	{
 	}
 }
\ No newline at end of file
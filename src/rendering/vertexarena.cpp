@@ -0,0 +1,272 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// 
+// Sparky Engine
+// 2016 - Benjamin Carter (benjamin.mark.carter@hotmail.com)
+// 
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+// 
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+// 
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgement
+//    in the product documentation would be appreciated but is not required.
+// 
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+// 
+// 3. This notice may not be removed or altered from any source distribution.
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+====================
+Class Includes
+====================
+*/
+#include <sparky\rendering\vertexarena.hpp>	// Class definition.
+#include <sparky\rendering\buffers.hpp>		// The layout of the vertices is shared with the other buffers.
+#include <sparky\rendering\renderqueue.hpp>	// Draws are recorded into the render queue.
+#include <sparky\utils\gldevice.hpp>			// Vertex array binds are filtered by the device's state cache.
+
+namespace sparky
+{
+	/*
+	====================
+	Ctor and Dtor
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	VertexArena::VertexArena(void)
+		: m_vao(0), m_vbo(0), m_ibo(0), m_vertices(), m_indices(), m_meshes(), m_freeMeshes(), m_rebuildCount(0)
+	{
+	}
+
+	////////////////////////////////////////////////////////////
+	VertexArena::~VertexArena(void)
+	{
+		const GLFunctions_t& gl = GLDevice::getFunctions();
+
+		if (m_vao)
+		{
+			GLDevice::releaseVertexArray(m_vao);
+			gl.deleteVertexArrays(1, &m_vao);
+			m_vao = NULL;
+		}
+
+		if (m_vbo)
+		{
+			gl.deleteBuffers(1, &m_vbo);
+			m_vbo = NULL;
+		}
+
+		if (m_ibo)
+		{
+			gl.deleteBuffers(1, &m_ibo);
+			m_ibo = NULL;
+		}
+	}
+
+	/*
+	====================
+	Private Methods
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	void VertexArena::rebuild(const unsigned int vertices, const unsigned int indices)
+	{
+		const GLFunctions_t& gl = GLDevice::getFunctions();
+
+		const std::vector<RangeMove_t> vertexMoves = m_vertices.defragment();
+		const std::vector<RangeMove_t> indexMoves = m_indices.defragment();
+
+		m_vertices.grow(vertices);
+		m_indices.grow(indices);
+		//the data is copied into new buffers, as the packed ranges may overlap where they came from
+		const GLuint vbo = copyBuffer(m_vbo, m_vertices.getCapacity() * sizeof(Vertex_t), vertexMoves, sizeof(Vertex_t));
+		const GLuint ibo = copyBuffer(m_ibo, m_indices.getCapacity() * sizeof(GLuint), indexMoves, sizeof(GLuint));
+
+		if (m_vao)
+		{
+			GLDevice::releaseVertexArray(m_vao);
+			gl.deleteVertexArrays(1, &m_vao);
+
+			gl.deleteBuffers(1, &m_vbo);
+			gl.deleteBuffers(1, &m_ibo);
+		}
+
+		m_vbo = vbo;
+		m_ibo = ibo;
+
+		gl.genVertexArrays(1, &m_vao);
+		GLDevice::bindVertexArray(m_vao);
+
+		gl.bindBuffer(GL_ARRAY_BUFFER, m_vbo);
+		gl.bindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_ibo);
+
+		Buffer::setAttributePointers();
+		Buffer::enableAttributes();
+
+		m_rebuildCount++;
+	}
+
+	////////////////////////////////////////////////////////////
+	GLuint VertexArena::copyBuffer(const GLuint buffer, const GLsizeiptr size, const std::vector<RangeMove_t>& moves, const GLsizeiptr elementSize)
+	{
+		const GLFunctions_t& gl = GLDevice::getFunctions();
+
+		GLuint copy = 0;
+
+		gl.genBuffers(1, &copy);
+		gl.bindBuffer(GL_COPY_WRITE_BUFFER, copy);
+		gl.bufferData(GL_COPY_WRITE_BUFFER, size, nullptr, GL_STATIC_DRAW);
+
+		if (buffer)
+		{
+			gl.bindBuffer(GL_COPY_READ_BUFFER, buffer);
+
+			for (const auto& move : moves)
+			{
+				gl.copyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, move.from * elementSize, move.to * elementSize, move.size * elementSize);
+			}
+		}
+
+		return copy;
+	}
+
+	////////////////////////////////////////////////////////////
+	unsigned int VertexArena::getRequiredCapacity(const RangeAllocator& allocator, const unsigned int size)
+	{
+		unsigned int capacity = allocator.getCapacity();
+		//defragmenting joins all of the free space, so growing is only needed when there is not enough in total
+		while (capacity - allocator.getCapacity() + allocator.getFree() < size)
+		{
+			capacity *= 2;
+		}
+
+		return capacity;
+	}
+
+	/*
+	====================
+	Getters and Setters
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	GLuint VertexArena::getID(void) const
+	{
+		return m_vao;
+	}
+
+	////////////////////////////////////////////////////////////
+	RangeStats_t VertexArena::getVertexStats(void) const
+	{
+		return m_vertices.getStats();
+	}
+
+	////////////////////////////////////////////////////////////
+	RangeStats_t VertexArena::getIndexStats(void) const
+	{
+		return m_indices.getStats();
+	}
+
+	////////////////////////////////////////////////////////////
+	unsigned int VertexArena::getRebuildCount(void) const
+	{
+		return m_rebuildCount;
+	}
+
+	/*
+	====================
+	Methods
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	unsigned int VertexArena::allocate(const std::vector<Vertex_t>& vertices, const std::vector<GLuint>& indices)
+	{
+		const GLFunctions_t& gl = GLDevice::getFunctions();
+
+		if (vertices.empty() || indices.empty())
+		{
+			return INVALID_MESH;
+		}
+
+		if (!m_vao)
+		{
+			rebuild(INITIAL_VERTICES, INITIAL_INDICES);
+		}
+
+		Mesh_t mesh;
+		mesh.vertices = m_vertices.allocate(vertices.size());
+		mesh.indices = m_indices.allocate(indices.size());
+
+		if (mesh.vertices == RangeAllocator::INVALID_HANDLE || mesh.indices == RangeAllocator::INVALID_HANDLE)
+		{
+			if (mesh.vertices != RangeAllocator::INVALID_HANDLE)
+			{
+				m_vertices.free(mesh.vertices);
+			}
+
+			if (mesh.indices != RangeAllocator::INVALID_HANDLE)
+			{
+				m_indices.free(mesh.indices);
+			}
+
+			rebuild(getRequiredCapacity(m_vertices, vertices.size()), getRequiredCapacity(m_indices, indices.size()));
+
+			mesh.vertices = m_vertices.allocate(vertices.size());
+			mesh.indices = m_indices.allocate(indices.size());
+		}
+
+		gl.bindBuffer(GL_COPY_WRITE_BUFFER, m_vbo);
+		gl.bufferSubData(GL_COPY_WRITE_BUFFER, m_vertices.getOffset(mesh.vertices) * sizeof(Vertex_t), vertices.size() * sizeof(Vertex_t), &vertices[0]);
+
+		gl.bindBuffer(GL_COPY_WRITE_BUFFER, m_ibo);
+		gl.bufferSubData(GL_COPY_WRITE_BUFFER, m_indices.getOffset(mesh.indices) * sizeof(GLuint), indices.size() * sizeof(GLuint), &indices[0]);
+
+		unsigned int handle;
+
+		if (!m_freeMeshes.empty())
+		{
+			handle = m_freeMeshes.back();
+			m_freeMeshes.pop_back();
+
+			m_meshes[handle] = mesh;
+		}
+		else
+		{
+			handle = m_meshes.size();
+			m_meshes.push_back(mesh);
+		}
+
+		return handle;
+	}
+
+	////////////////////////////////////////////////////////////
+	void VertexArena::free(const unsigned int mesh)
+	{
+		if (mesh != INVALID_MESH)
+		{
+			m_vertices.free(m_meshes[mesh].vertices);
+			m_indices.free(m_meshes[mesh].indices);
+
+			m_freeMeshes.push_back(mesh);
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	void VertexArena::queue(const unsigned int mesh, IShaderComponent* pShader, const Texture* pTexture, const Transform& transform) const
+	{
+		if (mesh != INVALID_MESH)
+		{
+			const Mesh_t& ranges = m_meshes[mesh];
+
+			RenderQueue::getInstance().push(eRenderPass::GEOMETRY, pShader, pTexture, m_vao, static_cast<GLsizei>(m_indices.getSize(ranges.indices)), 
+				transform, m_indices.getOffset(ranges.indices), static_cast<GLint>(m_vertices.getOffset(ranges.vertices)));
+		}
+	}
+
+}//namespace sparky
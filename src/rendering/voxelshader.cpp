@@ -0,0 +1,58 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// 
+// Sparky Engine
+// 2016 - Benjamin Carter (benjamin.mark.carter@hotmail.com)
+// 
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+// 
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+// 
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgement
+//    in the product documentation would be appreciated but is not required.
+// 
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+// 
+// 3. This notice may not be removed or altered from any source distribution.
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+====================
+Class Includes
+====================
+*/
+#include <sparky\rendering\voxelshader.hpp>	// Class definition.
+#include <sparky\rendering\buffers.hpp>		// The bindings of the uniform blocks.
+
+namespace sparky
+{
+	////////////////////////////////////////////////////////////
+	VoxelShader::VoxelShader(void)
+		: IShaderComponent("shaders/voxel_vertex.glsl", "shaders/voxel_fragment.glsl"), 
+		  m_texturesLocation(-1)
+	{
+		loadUniforms();
+	}
+	
+	////////////////////////////////////////////////////////////
+	void VoxelShader::loadUniforms(void)
+	{
+		m_pProgram->setBlockBinding("FrameData", UNIFORM_BINDING_FRAME);
+		m_pProgram->setBlockBinding("ObjectData", UNIFORM_BINDING_OBJECT);
+
+		m_texturesLocation = m_uniform.getLocation("u_materials");
+	}
+
+	////////////////////////////////////////////////////////////
+	void VoxelShader::update(const Transform& transform)
+	{
+		m_uniform.setParameter(m_texturesLocation, 0);
+	}
+
+}//namespace sparky
\ No newline at end of file
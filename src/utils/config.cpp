@@ -37,6 +37,7 @@ Class Includes
 */
 #include <sparky\utils\config.hpp>	// Class definition.
 #include <sparky\utils\debug.hpp>  // Printing warnings and errors to the console screen.
+#include <sparky\utils\stringview.hpp>	// Slicing each line without copying it.
 
 namespace sparky
 {
@@ -68,47 +69,45 @@ namespace sparky
 	Getters and Setters
 	====================
 	*/
-	int ConfigFile::getInt(const String& variable) const
+	int ConfigFile::getInt(const StringId& variable) const
 	{
-		auto itr = m_values.find(std::make_pair(variable, "int"));
+		const String* pValue = getValue(variable, "int");
 
-		if (itr != m_values.end())
+		if (pValue)
 		{
-			std::stringstream ss(itr->second.getCString());
+			std::stringstream ss(pValue->getCString());
 			int value = 0;
 			ss >> value;
 
 			return value;
 		}
 
-		DebugLog::warning(variable, ": incorrect variable name or datatype");
 		return 0;
 	}
 
-	unsigned int ConfigFile::getUInt(const String& variable) const
+	unsigned int ConfigFile::getUInt(const StringId& variable) const
 	{
-		auto itr = m_values.find(std::make_pair(variable, "uint"));
+		const String* pValue = getValue(variable, "uint");
 
-		if (itr != m_values.end())
+		if (pValue)
 		{
-			std::stringstream ss(itr->second.getCString());
+			std::stringstream ss(pValue->getCString());
 			int value = 0;
 			ss >> value;
 
 			return value;
 		}
 
-		DebugLog::warning(variable, ": incorrect variable name or datatype");
 		return 0;
 	}
 
-	bool ConfigFile::getBoolean(const String& variable) const
+	bool ConfigFile::getBoolean(const StringId& variable) const
 	{
-		auto itr = m_values.find(std::make_pair(variable, "bool"));
+		const String* pValue = getValue(variable, "bool");
 
-		if (itr != m_values.end())
+		if (pValue)
 		{
-			if (itr->second.getLength() == 5)
+			if (pValue->getLength() == 5)
 			{
 				return false;
 			}
@@ -116,55 +115,51 @@ namespace sparky
 			return true;
 		}
 
-		DebugLog::warning(variable, ": incorrect variable name or datatype");
 		return false;
 	}
 
 
-	float ConfigFile::getFloat(const String& variable) const
+	float ConfigFile::getFloat(const StringId& variable) const
 	{
-		auto itr = m_values.find(std::make_pair(variable, "float"));
+		const String* pValue = getValue(variable, "float");
 
-		if (itr != m_values.end())
+		if (pValue)
 		{
-			std::stringstream ss(itr->second.getCString());
+			std::stringstream ss(pValue->getCString());
 			float value = 0.0f;
 			ss >> value;
 
 			return value;
 		}
 
-		DebugLog::warning(variable, ": incorrect variable name or datatype");
 		return 0.0f;
 	}
 
-	double ConfigFile::getDouble(const String& variable) const
+	double ConfigFile::getDouble(const StringId& variable) const
 	{
-		auto itr = m_values.find(std::make_pair(variable, "double"));
+		const String* pValue = getValue(variable, "double");
 
-		if (itr != m_values.end())
+		if (pValue)
 		{
-			std::stringstream ss(itr->second.getCString());
+			std::stringstream ss(pValue->getCString());
 			double value = 0.0;
 			ss >> value;
 
 			return value;
 		}
 
-		DebugLog::warning(variable, ": incorrect variable name or datatype");
 		return 0.0;
 	}
 
-	String ConfigFile::getString(const String& variable) const
+	String ConfigFile::getString(const StringId& variable) const
 	{
-		auto itr = m_values.find(std::make_pair(variable, "string"));
+		const String* pValue = getValue(variable, "string");
 
-		if (itr != m_values.end())
+		if (pValue)
 		{
-			return itr->second;
+			return *pValue;
 		}
 
-		DebugLog::warning(variable, ": incorrect variable name or datatype");
 		return "";
 	}
 
@@ -187,6 +182,19 @@ namespace sparky
 		}
 	}
 
+	const String* ConfigFile::getValue(const StringId& variable, const StringId& datatype) const
+	{
+		const ConfigValue_t* pValue = m_values.find(variable);
+
+		if (pValue && pValue->datatype == datatype)
+		{
+			return &pValue->value;
+		}
+
+		DebugLog::warning(variable, ": incorrect variable name or datatype");
+		return nullptr;
+	}
+
 	/*
 	====================
 	Methods
@@ -241,21 +249,11 @@ namespace sparky
 				lineNumber++;
 				continue;
 			}
-			//set to undefined as if they stay as this value, the current line read has not been parsed correctly
-			int namePos = UNDEFINED;
-			int dataPos = UNDEFINED;
-			//loops through the current string and records the positions where name and datatype start
-			for (unsigned int i = 0; i < currentLine.getLength(); i++)
-			{
-				if (currentLine[i] == ':' && namePos == UNDEFINED)
-				{
-					namePos = i;
-				}
-				else if (currentLine[i] == '=' && dataPos == UNDEFINED)
-				{
-					dataPos = i;
-				}
-			}
+			//the line is sliced through a view so no temporary Strings are created while searching it
+			StringView line(currentLine);
+			//if these stay undefined, the current line read has not been parsed correctly
+			int namePos = line.find(':');
+			int dataPos = line.find('=');
 			//if the positions are undefined, there is undefined behaviour or errors on the current line in the config file
 			if (namePos == UNDEFINED || dataPos == UNDEFINED)
 			{
@@ -264,11 +262,11 @@ namespace sparky
 				continue;
 			}
 			//stores the variable name from the current line and forces all letters to be lower-case
-			String variable = currentLine.substring(0, namePos).toLower();
+			String variable = String(line.substring(0, namePos)).toLower();
 			//stores the data type from the current line and forces all letters to be lower-case
-			String datatype = currentLine.substring(namePos + 1, dataPos).toLower();
+			String datatype = String(line.substring(namePos + 1, dataPos)).toLower();
 			//stores the value from the current line
-			String value = currentLine.substring(dataPos + 1, currentLine.getLength());
+			String value(line.substring(dataPos + 1, line.getLength()));
 
 			//remove any potential inline comments next to the value
 			this->removeComments(value);
@@ -279,20 +277,10 @@ namespace sparky
 				String s = section + "." + variable;
 				variable = s;
 			}
-			//checks to see if the current variable being parsed has already been declared within the config file
-			bool contained = false;
-			for (const auto& itr : m_values)
-			{
-				//checks to see if it matches any of the current variables
-				if (itr.first.first == variable)
-				{
-					DebugLog::warning(variable, "has already been declared within the config file", lineNumber, "will not be parsed");
-					contained = true;
-				}
-			}
 			//if a variable is already in the config file, the current line is not parsed
-			if (contained)
+			if (m_values.find(variable))
 			{
+				DebugLog::warning(variable, "has already been declared within the config file", lineNumber, "will not be parsed");
 				lineNumber++;
 				continue;
 			}
@@ -340,7 +328,11 @@ namespace sparky
 				}
 			}
 			//if none of the previous statements and check fail, then the current variable, its datatype and value are added to the map
-			m_values.insert(std::make_pair(std::make_pair(variable, datatype), value));
+			ConfigValue_t entry;
+			entry.datatype = datatype;
+			entry.value = value;
+
+			m_values.insert(variable, entry);
 			lineNumber++;
 		}
 		//closes the file as the class is done from reading from it
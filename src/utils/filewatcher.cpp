@@ -0,0 +1,285 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// 
+// Sparky Engine
+// 2016 - Benjamin Carter (benjamin.mark.carter@hotmail.com)
+// 
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+// 
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+// 
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgement
+//    in the product documentation would be appreciated but is not required.
+// 
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+// 
+// 3. This notice may not be removed or altered from any source distribution.
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+====================
+CPP Includes
+====================
+*/
+#include <chrono>						// The interval between scans of the polled directories.
+#if __linux__
+#include <sys/inotify.h>				// Waiting for files to be written.
+#include <poll.h>						// Waiting on inotify with a timeout, so the thread can be stopped.
+#include <unistd.h>						// Reading the inotify events.
+#else
+#include <sys/stat.h>					// The modification times of the polled files.
+#endif
+/*
+====================
+Class Includes
+====================
+*/
+#include <sparky\utils\filewatcher.hpp>	// Class definition.
+#include <sparky\utils\debug.hpp>		// Warnings for directories that cannot be watched.
+#if !__linux__
+#include <sparky\utils\directory.hpp>	// Listing the files of the polled directories.
+#endif
+
+namespace sparky
+{
+	/*
+	====================
+	Ctor and Dtor
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	FileWatcher::FileWatcher(void)
+		: m_directories(), m_changes(), m_mutex(), m_thread(), m_running(false)
+	{
+#if __linux__
+		m_inotify = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+
+		if (m_inotify < 0)
+		{
+			DebugLog::warning("Unable to create an inotify instance, files will not be watched.");
+		}
+#endif
+	}
+
+	////////////////////////////////////////////////////////////
+	FileWatcher::~FileWatcher(void)
+	{
+		stop();
+
+#if __linux__
+		if (m_inotify >= 0)
+		{
+			close(m_inotify);
+			m_inotify = -1;
+		}
+#endif
+	}
+
+	/*
+	====================
+	Private Methods
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	void FileWatcher::run(void)
+	{
+#if __linux__
+		//large enough for many events at once, aligned so the events can be read in place
+		alignas(inotify_event) char buffer[4096];
+
+		while (m_running)
+		{
+			pollfd descriptor = { m_inotify, POLLIN, 0 };
+			//wakes up regularly to check whether the watcher has been stopped
+			if (::poll(&descriptor, 1, 100) <= 0)
+			{
+				continue;
+			}
+
+			const ssize_t length = read(m_inotify, buffer, sizeof(buffer));
+
+			for (ssize_t offset = 0; offset < length;)
+			{
+				const inotify_event* pEvent = reinterpret_cast<const inotify_event*>(buffer + offset);
+
+				if (pEvent->len > 0 && !(pEvent->mask & IN_ISDIR))
+				{
+					for (unsigned int i = 0; i < m_watches.size(); i++)
+					{
+						if (m_watches[i] == pEvent->wd)
+						{
+							addChange(String::concat(m_directories[i], pEvent->name));
+							break;
+						}
+					}
+				}
+
+				offset += sizeof(inotify_event) + pEvent->len;
+			}
+		}
+#else
+		while (m_running)
+		{
+			std::this_thread::sleep_for(std::chrono::milliseconds(250));
+			scan(true);
+		}
+#endif
+	}
+
+	////////////////////////////////////////////////////////////
+	void FileWatcher::addChange(const String& path)
+	{
+		std::lock_guard<std::mutex> guard(m_mutex);
+		//editors often write a file several times when saving, it only needs reloading once
+		for (const auto& change : m_changes)
+		{
+			if (change == path)
+			{
+				return;
+			}
+		}
+
+		m_changes.push_back(path);
+	}
+
+#if !__linux__
+	////////////////////////////////////////////////////////////
+	void FileWatcher::scan(const bool notify)
+	{
+		for (const auto& directory : m_directories)
+		{
+			Directory listing;
+
+			if (!listing.open(directory))
+			{
+				continue;
+			}
+
+			for (const auto& file : listing.files)
+			{
+				const String path = String::concat(directory, file);
+				struct stat info;
+
+				if (stat(path.getCString(), &info) != 0)
+				{
+					continue;
+				}
+
+				std::time_t* pTime = m_times.find(path);
+
+				if (!pTime)
+				{
+					m_times.insert(path, info.st_mtime);
+				}
+				else if (*pTime != info.st_mtime)
+				{
+					*pTime = info.st_mtime;
+
+					if (notify)
+					{
+						addChange(path);
+					}
+				}
+			}
+		}
+	}
+#endif
+
+	/*
+	====================
+	Getters and Setters
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	bool FileWatcher::isRunning(void) const
+	{
+		return m_running;
+	}
+
+	/*
+	====================
+	Methods
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	bool FileWatcher::watch(const String& directory)
+	{
+		if (m_running)
+		{
+			DebugLog::warning("Directories must be watched before the FileWatcher is started:", directory);
+			return false;
+		}
+
+#if __linux__
+		if (m_inotify < 0)
+		{
+			return false;
+		}
+		//editors either write the file in place or write a copy and move it over the original
+		const int watch = inotify_add_watch(m_inotify, directory.getCString(), IN_CLOSE_WRITE | IN_MOVED_TO);
+
+		if (watch < 0)
+		{
+			DebugLog::warning(directory, "cannot be watched for changes.");
+			return false;
+		}
+
+		m_watches.push_back(watch);
+#else
+		Directory listing;
+
+		if (!listing.open(directory))
+		{
+			return false;
+		}
+#endif
+
+		m_directories.push_back(directory);
+
+		return true;
+	}
+
+	////////////////////////////////////////////////////////////
+	void FileWatcher::start(void)
+	{
+		if (m_running || m_directories.empty())
+		{
+			return;
+		}
+
+#if !__linux__
+		//the first scan only records the times, so existing files are not reported as changed
+		scan(false);
+#endif
+
+		m_running = true;
+		m_thread = std::thread(&FileWatcher::run, this);
+	}
+
+	////////////////////////////////////////////////////////////
+	void FileWatcher::stop(void)
+	{
+		m_running = false;
+
+		if (m_thread.joinable())
+		{
+			m_thread.join();
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	void FileWatcher::poll(std::vector<String>& changes)
+	{
+		std::lock_guard<std::mutex> guard(m_mutex);
+
+		changes.insert(changes.end(), m_changes.begin(), m_changes.end());
+		m_changes.clear();
+	}
+
+}//namespace sparky
\ No newline at end of file
@@ -28,10 +28,82 @@ Class Includes
 ====================
 */
 #include <sparky\utils\gldevice.hpp>	// Class definition.
+#include <sparky\utils\glrecorder.hpp>	// The stub functions used without a context.
 #include <sparky\utils\debug.hpp>		// Print warning and error messages.
 
 namespace sparky
 {
+	/*
+	====================
+	Static Fields
+	====================
+	*/
+	GLFunctions_t		GLDevice::m_sFunctions	= {};
+	GLDevice::State_t	GLDevice::m_sState		= {};
+	GLStats_t			GLDevice::m_sStats		= {};
+
+	/*
+	====================
+	Private Methods
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	bool* GLDevice::getFlag(GLenum mode)
+	{
+		switch (mode)
+		{
+		case GL_BLEND:		return &m_sState.blend;
+		case GL_DEPTH_TEST:	return &m_sState.depthTest;
+		case GL_CULL_FACE:	return &m_sState.cullFace;
+		default:			return nullptr;
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	bool GLDevice::count(const bool issue)
+	{
+		if (issue)
+		{
+			m_sStats.issuedCalls++;
+		}
+		else
+		{
+			m_sStats.filteredCalls++;
+		}
+
+		return issue;
+	}
+
+	/*
+	====================
+	Getters and Setters
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	const GLFunctions_t& GLDevice::getFunctions(void)
+	{
+		return m_sFunctions;
+	}
+
+	////////////////////////////////////////////////////////////
+	void GLDevice::setFunctions(const GLFunctions_t& functions)
+	{
+		m_sFunctions = functions;
+	}
+
+	////////////////////////////////////////////////////////////
+	const GLStats_t& GLDevice::getStats(void)
+	{
+		return m_sStats;
+	}
+
+	////////////////////////////////////////////////////////////
+	void GLDevice::resetStats(void)
+	{
+		m_sStats.issuedCalls = 0;
+		m_sStats.filteredCalls = 0;
+	}
+
 	/*
 	====================
 	Methods
@@ -46,25 +118,242 @@ namespace sparky
 		if (error != GLEW_OK)
 		{
 			DebugLog::error("GLEW has failed to initialise:", glewGetErrorString(error));
+			return;
+		}
+
+		m_sFunctions.createProgram		= glCreateProgram;
+		m_sFunctions.deleteProgram		= glDeleteProgram;
+		m_sFunctions.attachShader		= glAttachShader;
+		m_sFunctions.detachShader		= glDetachShader;
+		m_sFunctions.linkProgram		= glLinkProgram;
+		m_sFunctions.useProgram			= glUseProgram;
+		m_sFunctions.getProgramiv		= glGetProgramiv;
+		m_sFunctions.getProgramInfoLog	= glGetProgramInfoLog;
+		//program binaries are optional, the shader registry compiles from source when they are missing
+		m_sFunctions.programParameteri	= GLEW_ARB_get_program_binary ? glProgramParameteri : nullptr;
+		m_sFunctions.getProgramBinary	= GLEW_ARB_get_program_binary ? glGetProgramBinary : nullptr;
+		m_sFunctions.programBinary		= GLEW_ARB_get_program_binary ? glProgramBinary : nullptr;
+		m_sFunctions.getActiveUniform	= glGetActiveUniform;
+		m_sFunctions.getUniformLocation = glGetUniformLocation;
+		m_sFunctions.uniform1i			= glUniform1i;
+		m_sFunctions.uniform2i			= glUniform2i;
+		m_sFunctions.uniform3i			= glUniform3i;
+		m_sFunctions.uniform4i			= glUniform4i;
+		m_sFunctions.uniform1f			= glUniform1f;
+		m_sFunctions.uniform2f			= glUniform2f;
+		m_sFunctions.uniform3f			= glUniform3f;
+		m_sFunctions.uniform4f			= glUniform4f;
+		m_sFunctions.uniformMatrix4fv	= glUniformMatrix4fv;
+		m_sFunctions.getUniformBlockIndex = glGetUniformBlockIndex;
+		m_sFunctions.uniformBlockBinding = glUniformBlockBinding;
+		m_sFunctions.bindVertexArray	= glBindVertexArray;
+		m_sFunctions.activeTexture		= glActiveTexture;
+		m_sFunctions.bindTexture		= glBindTexture;
+		m_sFunctions.enable				= glEnable;
+		m_sFunctions.disable			= glDisable;
+		m_sFunctions.depthMask			= glDepthMask;
+
+		m_sFunctions.createShader		= glCreateShader;
+		m_sFunctions.deleteShader		= glDeleteShader;
+		m_sFunctions.shaderSource		= glShaderSource;
+		m_sFunctions.compileShader		= glCompileShader;
+		m_sFunctions.getShaderiv		= glGetShaderiv;
+		m_sFunctions.getShaderInfoLog	= glGetShaderInfoLog;
+
+		m_sFunctions.genBuffers			= glGenBuffers;
+		m_sFunctions.deleteBuffers		= glDeleteBuffers;
+		m_sFunctions.bindBuffer			= glBindBuffer;
+		m_sFunctions.bufferData			= glBufferData;
+		m_sFunctions.bufferSubData		= glBufferSubData;
+		m_sFunctions.copyBufferSubData	= glCopyBufferSubData;
+		m_sFunctions.bindBufferBase		= glBindBufferBase;
+		m_sFunctions.bindBufferRange	= glBindBufferRange;
+		m_sFunctions.texBuffer			= glTexBuffer;
+
+		m_sFunctions.genVertexArrays	= glGenVertexArrays;
+		m_sFunctions.deleteVertexArrays = glDeleteVertexArrays;
+		m_sFunctions.vertexAttribPointer = glVertexAttribPointer;
+		m_sFunctions.enableVertexAttribArray = glEnableVertexAttribArray;
+		m_sFunctions.disableVertexAttribArray = glDisableVertexAttribArray;
+
+		m_sFunctions.genTextures		= glGenTextures;
+		m_sFunctions.deleteTextures		= glDeleteTextures;
+		m_sFunctions.texParameteri		= glTexParameteri;
+		m_sFunctions.texImage2D			= glTexImage2D;
+		m_sFunctions.compressedTexImage2D = glCompressedTexImage2D;
+		m_sFunctions.texImage3D			= glTexImage3D;
+		m_sFunctions.compressedTexImage3D = glCompressedTexImage3D;
+		m_sFunctions.generateMipmap		= glGenerateMipmap;
+
+		m_sFunctions.genFramebuffers	= glGenFramebuffers;
+		m_sFunctions.deleteFramebuffers = glDeleteFramebuffers;
+		m_sFunctions.bindFramebuffer	= glBindFramebuffer;
+		m_sFunctions.framebufferTexture2D = glFramebufferTexture2D;
+		m_sFunctions.checkFramebufferStatus = glCheckFramebufferStatus;
+		m_sFunctions.genRenderbuffers	= glGenRenderbuffers;
+		m_sFunctions.bindRenderbuffer	= glBindRenderbuffer;
+		m_sFunctions.renderbufferStorage = glRenderbufferStorage;
+		m_sFunctions.framebufferRenderbuffer = glFramebufferRenderbuffer;
+		m_sFunctions.drawBuffers		= glDrawBuffers;
+
+		m_sFunctions.getIntegerv		= glGetIntegerv;
+		m_sFunctions.getString			= glGetString;
+		m_sFunctions.clear				= glClear;
+		m_sFunctions.clearColor			= glClearColor;
+		m_sFunctions.scissor			= glScissor;
+		m_sFunctions.blendFunc			= glBlendFunc;
+		m_sFunctions.cullFace			= glCullFace;
+		m_sFunctions.polygonMode		= glPolygonMode;
+		m_sFunctions.drawElements		= glDrawElements;
+		m_sFunctions.drawElementsInstancedBaseVertex = glDrawElementsInstancedBaseVertex;
+
+		resetState();
+	}
+
+	////////////////////////////////////////////////////////////
+	void GLDevice::initHeadless(void)
+	{
+		m_sFunctions = GLRecorder::getFunctions();
+
+		resetState();
+	}
+
+	////////////////////////////////////////////////////////////
+	void GLDevice::resetState(void)
+	{
+		m_sState = State_t();
+		//a new context starts with depth writes enabled and everything else off or unbound
+		m_sState.depthMask = true;
+	}
+
+	////////////////////////////////////////////////////////////
+	void GLDevice::useProgram(GLuint program)
+	{
+		if (count(m_sState.program != program))
+		{
+			m_sFunctions.useProgram(program);
+			m_sState.program = program;
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	void GLDevice::bindVertexArray(GLuint vao)
+	{
+		if (count(m_sState.vao != vao))
+		{
+			m_sFunctions.bindVertexArray(vao);
+			m_sState.vao = vao;
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	void GLDevice::bindTexture(GLenum target, GLuint unit, GLuint texture)
+	{
+		if (unit < State_t::MAX_UNITS)
+		{
+			TextureUnit_t& bound = m_sState.textures[unit];
+
+			if (!count(bound.texture != texture || bound.target != target))
+			{
+				return;
+			}
+
+			bound.target = target;
+			bound.texture = texture;
+		}
+		else
+		{
+			count(true);
+		}
+
+		if (m_sState.activeUnit != unit)
+		{
+			m_sFunctions.activeTexture(GL_TEXTURE0 + unit);
+			m_sState.activeUnit = unit;
+		}
+
+		m_sFunctions.bindTexture(target, texture);
+	}
+
+	////////////////////////////////////////////////////////////
+	void GLDevice::setDepthMask(const bool enabled)
+	{
+		if (count(m_sState.depthMask != enabled))
+		{
+			m_sFunctions.depthMask(enabled ? GL_TRUE : GL_FALSE);
+			m_sState.depthMask = enabled;
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	void GLDevice::releaseProgram(GLuint program)
+	{
+		//the deleted ID may be handed out again, so it can no longer be trusted to be in use
+		if (m_sState.program == program)
+		{
+			useProgram(NULL);
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	void GLDevice::releaseVertexArray(GLuint vao)
+	{
+		//OpenGL reverts the binding to zero when a bound vertex array is deleted
+		if (m_sState.vao == vao)
+		{
+			m_sState.vao = NULL;
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	void GLDevice::releaseTexture(GLuint texture)
+	{
+		//OpenGL reverts the binding of every unit holding a deleted texture to zero
+		for (auto& bound : m_sState.textures)
+		{
+			if (bound.texture == texture)
+			{
+				bound.texture = NULL;
+			}
 		}
 	}
 
 	////////////////////////////////////////////////////////////
 	void GLDevice::enableWireframe(void)
 	{
-		glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
+		m_sFunctions.polygonMode(GL_FRONT_AND_BACK, GL_LINE);
 	}
 
 	////////////////////////////////////////////////////////////
 	void GLDevice::enable(GLenum mode)
 	{
-		glEnable(mode);
+		bool* pFlag = getFlag(mode);
+
+		if (count(!pFlag || !*pFlag))
+		{
+			m_sFunctions.enable(mode);
+
+			if (pFlag)
+			{
+				*pFlag = true;
+			}
+		}
 	}
 
 	////////////////////////////////////////////////////////////
 	void GLDevice::disable(GLenum mode)
 	{
-		glDisable(mode);
+		bool* pFlag = getFlag(mode);
+
+		if (count(!pFlag || *pFlag))
+		{
+			m_sFunctions.disable(mode);
+
+			if (pFlag)
+			{
+				*pFlag = false;
+			}
+		}
 	}
 
 }//namespace sparky
\ No newline at end of file
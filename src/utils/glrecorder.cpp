@@ -0,0 +1,808 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// 
+// Sparky Engine
+// 2016 - Benjamin Carter (benjamin.mark.carter@hotmail.com)
+// 
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+// 
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+// 
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgement
+//    in the product documentation would be appreciated but is not required.
+// 
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+// 
+// 3. This notice may not be removed or altered from any source distribution.
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+====================
+CPP Includes
+====================
+*/
+#include <algorithm>					// Clearing the queried viewport.
+/*
+====================
+Class Includes
+====================
+*/
+#include <sparky\utils\glrecorder.hpp>	// Class definition.
+
+namespace sparky
+{
+	/*
+	====================
+	Recording State
+	====================
+	*/
+	struct Recording_t
+	{
+		GLRecordStats_t stats;		///< The calls recorded since the last reset.
+		GLuint			nextName;	///< The next object name to hand out, names are never reused.
+	};
+
+	////////////////////////////////////////////////////////////
+	static Recording_t& getRecording(void)
+	{
+		static Recording_t recording = { {}, 1 };
+		return recording;
+	}
+
+	////////////////////////////////////////////////////////////
+	static GLRecordStats_t& record(void)
+	{
+		GLRecordStats_t& stats = getRecording().stats;
+		stats.calls++;
+
+		return stats;
+	}
+
+	////////////////////////////////////////////////////////////
+	static void generate(GLsizei n, GLuint* pNames, unsigned int& created)
+	{
+		for (GLsizei i = 0; i < n; i++)
+		{
+			pNames[i] = getRecording().nextName++;
+		}
+
+		created += n;
+	}
+
+	////////////////////////////////////////////////////////////
+	static unsigned long long getTexelSize(GLenum format, GLenum type)
+	{
+		unsigned long long components = 4;
+
+		switch (format)
+		{
+		case GL_RED:
+		case GL_RED_INTEGER:
+		case GL_DEPTH_COMPONENT:	components = 1; break;
+		case GL_RG:
+		case GL_RG_INTEGER:			components = 2; break;
+		case GL_RGB:
+		case GL_BGR:				components = 3; break;
+		}
+
+		switch (type)
+		{
+		case GL_BYTE:
+		case GL_UNSIGNED_BYTE:		return components;
+		case GL_SHORT:
+		case GL_UNSIGNED_SHORT:
+		case GL_HALF_FLOAT:			return components * 2;
+		default:					return components * 4;
+		}
+	}
+
+	/*
+	====================
+	Recorded Programs
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	static GLuint GLAPIENTRY recordCreateProgram(void)
+	{
+		GLuint program = 0;
+		generate(1, &program, record().programs);
+
+		return program;
+	}
+
+	////////////////////////////////////////////////////////////
+	static void GLAPIENTRY recordDeleteProgram(GLuint)
+	{
+		record();
+	}
+
+	////////////////////////////////////////////////////////////
+	static void GLAPIENTRY recordAttachShader(GLuint, GLuint)
+	{
+		record();
+	}
+
+	////////////////////////////////////////////////////////////
+	static void GLAPIENTRY recordDetachShader(GLuint, GLuint)
+	{
+		record();
+	}
+
+	////////////////////////////////////////////////////////////
+	static void GLAPIENTRY recordLinkProgram(GLuint)
+	{
+		record();
+	}
+
+	////////////////////////////////////////////////////////////
+	static void GLAPIENTRY recordProgramParameteri(GLuint, GLenum, GLint)
+	{
+		record();
+	}
+
+	////////////////////////////////////////////////////////////
+	static void GLAPIENTRY recordGetProgramBinary(GLuint, GLsizei, GLsizei* pLength, GLenum* pFormat, void*)
+	{
+		record();
+		//there is nothing to retrieve, so a binary is never written to the cache
+		if (pLength)
+		{
+			*pLength = 0;
+		}
+
+		*pFormat = 0;
+	}
+
+	////////////////////////////////////////////////////////////
+	static void GLAPIENTRY recordProgramBinary(GLuint, GLenum, const void*, GLsizei length)
+	{
+		record().uploadBytes += length;
+	}
+
+	////////////////////////////////////////////////////////////
+	static void GLAPIENTRY recordUseProgram(GLuint)
+	{
+		record();
+	}
+
+	////////////////////////////////////////////////////////////
+	static void GLAPIENTRY recordGetProgramiv(GLuint, GLenum pname, GLint* pParam)
+	{
+		record();
+		*pParam = (pname == GL_LINK_STATUS) ? GL_TRUE : 0;
+	}
+
+	////////////////////////////////////////////////////////////
+	static void GLAPIENTRY recordGetProgramInfoLog(GLuint, GLsizei bufSize, GLsizei* pLength, GLchar* pLog)
+	{
+		record();
+
+		if (pLength)
+		{
+			*pLength = 0;
+		}
+
+		if (bufSize > 0)
+		{
+			pLog[0] = '\0';
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	static void GLAPIENTRY recordGetActiveUniform(GLuint, GLuint, GLsizei maxLength, GLsizei* pLength, GLint* pSize, GLenum* pType, GLchar* pName)
+	{
+		record();
+		*pLength = 0;
+		*pSize = 0;
+		*pType = 0;
+
+		if (maxLength > 0)
+		{
+			pName[0] = '\0';
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	static GLint GLAPIENTRY recordGetUniformLocation(GLuint, const GLchar*)
+	{
+		record();
+		return -1;
+	}
+
+	////////////////////////////////////////////////////////////
+	static void GLAPIENTRY recordUniform1i(GLint, GLint)
+	{
+		record();
+	}
+
+	////////////////////////////////////////////////////////////
+	static void GLAPIENTRY recordUniform2i(GLint, GLint, GLint)
+	{
+		record();
+	}
+
+	////////////////////////////////////////////////////////////
+	static void GLAPIENTRY recordUniform3i(GLint, GLint, GLint, GLint)
+	{
+		record();
+	}
+
+	////////////////////////////////////////////////////////////
+	static void GLAPIENTRY recordUniform4i(GLint, GLint, GLint, GLint, GLint)
+	{
+		record();
+	}
+
+	////////////////////////////////////////////////////////////
+	static void GLAPIENTRY recordUniform1f(GLint, GLfloat)
+	{
+		record();
+	}
+
+	////////////////////////////////////////////////////////////
+	static void GLAPIENTRY recordUniform2f(GLint, GLfloat, GLfloat)
+	{
+		record();
+	}
+
+	////////////////////////////////////////////////////////////
+	static void GLAPIENTRY recordUniform3f(GLint, GLfloat, GLfloat, GLfloat)
+	{
+		record();
+	}
+
+	////////////////////////////////////////////////////////////
+	static void GLAPIENTRY recordUniform4f(GLint, GLfloat, GLfloat, GLfloat, GLfloat)
+	{
+		record();
+	}
+
+	////////////////////////////////////////////////////////////
+	static void GLAPIENTRY recordUniformMatrix4fv(GLint, GLsizei, GLboolean, const GLfloat*)
+	{
+		record();
+	}
+
+	////////////////////////////////////////////////////////////
+	static GLuint GLAPIENTRY recordGetUniformBlockIndex(GLuint, const GLchar*)
+	{
+		record();
+		return GL_INVALID_INDEX;
+	}
+
+	////////////////////////////////////////////////////////////
+	static void GLAPIENTRY recordUniformBlockBinding(GLuint, GLuint, GLuint)
+	{
+		record();
+	}
+
+	/*
+	====================
+	Recorded Shaders
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	static GLuint GLAPIENTRY recordCreateShader(GLenum)
+	{
+		GLuint shader = 0;
+		generate(1, &shader, record().shaders);
+
+		return shader;
+	}
+
+	////////////////////////////////////////////////////////////
+	static void GLAPIENTRY recordDeleteShader(GLuint)
+	{
+		record();
+	}
+
+	////////////////////////////////////////////////////////////
+	static void GLAPIENTRY recordShaderSource(GLuint, GLsizei, const GLchar* const*, const GLint*)
+	{
+		record();
+	}
+
+	////////////////////////////////////////////////////////////
+	static void GLAPIENTRY recordCompileShader(GLuint)
+	{
+		record();
+	}
+
+	////////////////////////////////////////////////////////////
+	static void GLAPIENTRY recordGetShaderiv(GLuint, GLenum pname, GLint* pParam)
+	{
+		record();
+		*pParam = (pname == GL_COMPILE_STATUS) ? GL_TRUE : 0;
+	}
+
+	////////////////////////////////////////////////////////////
+	static void GLAPIENTRY recordGetShaderInfoLog(GLuint, GLsizei bufSize, GLsizei* pLength, GLchar* pLog)
+	{
+		record();
+
+		if (pLength)
+		{
+			*pLength = 0;
+		}
+
+		if (bufSize > 0)
+		{
+			pLog[0] = '\0';
+		}
+	}
+
+	/*
+	====================
+	Recorded Buffers
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	static void GLAPIENTRY recordGenBuffers(GLsizei n, GLuint* pBuffers)
+	{
+		generate(n, pBuffers, record().buffers);
+	}
+
+	////////////////////////////////////////////////////////////
+	static void GLAPIENTRY recordDeleteBuffers(GLsizei, const GLuint*)
+	{
+		record();
+	}
+
+	////////////////////////////////////////////////////////////
+	static void GLAPIENTRY recordBindBuffer(GLenum, GLuint)
+	{
+		record();
+	}
+
+	////////////////////////////////////////////////////////////
+	static void GLAPIENTRY recordBufferData(GLenum, GLsizeiptr size, const void* pData, GLenum)
+	{
+		GLRecordStats_t& stats = record();
+		stats.bufferBytes += size;
+
+		if (pData)
+		{
+			stats.uploadBytes += size;
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	static void GLAPIENTRY recordBufferSubData(GLenum, GLintptr, GLsizeiptr size, const void*)
+	{
+		record().uploadBytes += size;
+	}
+
+	////////////////////////////////////////////////////////////
+	static void GLAPIENTRY recordCopyBufferSubData(GLenum, GLenum, GLintptr, GLintptr, GLsizeiptr)
+	{
+		record();
+	}
+
+	////////////////////////////////////////////////////////////
+	static void GLAPIENTRY recordBindBufferBase(GLenum, GLuint, GLuint)
+	{
+		record();
+	}
+
+	////////////////////////////////////////////////////////////
+	static void GLAPIENTRY recordBindBufferRange(GLenum, GLuint, GLuint, GLintptr, GLsizeiptr)
+	{
+		record();
+	}
+
+	////////////////////////////////////////////////////////////
+	static void GLAPIENTRY recordTexBuffer(GLenum, GLenum, GLuint)
+	{
+		record();
+	}
+
+	/*
+	====================
+	Recorded Vertex Arrays
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	static void GLAPIENTRY recordGenVertexArrays(GLsizei n, GLuint* pArrays)
+	{
+		generate(n, pArrays, record().vertexArrays);
+	}
+
+	////////////////////////////////////////////////////////////
+	static void GLAPIENTRY recordDeleteVertexArrays(GLsizei, const GLuint*)
+	{
+		record();
+	}
+
+	////////////////////////////////////////////////////////////
+	static void GLAPIENTRY recordBindVertexArray(GLuint)
+	{
+		record();
+	}
+
+	////////////////////////////////////////////////////////////
+	static void GLAPIENTRY recordVertexAttribPointer(GLuint, GLint, GLenum, GLboolean, GLsizei, const void*)
+	{
+		record();
+	}
+
+	////////////////////////////////////////////////////////////
+	static void GLAPIENTRY recordEnableVertexAttribArray(GLuint)
+	{
+		record();
+	}
+
+	////////////////////////////////////////////////////////////
+	static void GLAPIENTRY recordDisableVertexAttribArray(GLuint)
+	{
+		record();
+	}
+
+	/*
+	====================
+	Recorded Textures
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	static void GLAPIENTRY recordGenTextures(GLsizei n, GLuint* pTextures)
+	{
+		generate(n, pTextures, record().textures);
+	}
+
+	////////////////////////////////////////////////////////////
+	static void GLAPIENTRY recordDeleteTextures(GLsizei, const GLuint*)
+	{
+		record();
+	}
+
+	////////////////////////////////////////////////////////////
+	static void GLAPIENTRY recordActiveTexture(GLenum)
+	{
+		record();
+	}
+
+	////////////////////////////////////////////////////////////
+	static void GLAPIENTRY recordBindTexture(GLenum, GLuint)
+	{
+		record();
+	}
+
+	////////////////////////////////////////////////////////////
+	static void GLAPIENTRY recordTexParameteri(GLenum, GLenum, GLint)
+	{
+		record();
+	}
+
+	////////////////////////////////////////////////////////////
+	static void GLAPIENTRY recordTexImage2D(GLenum, GLint, GLint, GLsizei width, GLsizei height, GLint, GLenum format, GLenum type, const GLvoid* pPixels)
+	{
+		GLRecordStats_t& stats = record();
+		const unsigned long long size = getTexelSize(format, type) * width * height;
+
+		stats.textureBytes += size;
+
+		if (pPixels)
+		{
+			stats.uploadBytes += size;
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	static void GLAPIENTRY recordTexImage3D(GLenum, GLint, GLint, GLsizei width, GLsizei height, GLsizei depth, GLint, GLenum format, GLenum type, const GLvoid* pPixels)
+	{
+		GLRecordStats_t& stats = record();
+		const unsigned long long size = getTexelSize(format, type) * width * height * depth;
+
+		stats.textureBytes += size;
+
+		if (pPixels)
+		{
+			stats.uploadBytes += size;
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	static void GLAPIENTRY recordCompressedTexImage2D(GLenum, GLint, GLenum, GLsizei, GLsizei, GLint, GLsizei size, const GLvoid* pData)
+	{
+		GLRecordStats_t& stats = record();
+		//every level is counted, as compressed textures carry their own mipmaps
+		stats.textureBytes += size;
+
+		if (pData)
+		{
+			stats.uploadBytes += size;
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	static void GLAPIENTRY recordCompressedTexImage3D(GLenum, GLint, GLenum, GLsizei, GLsizei, GLsizei, GLint, GLsizei size, const GLvoid* pData)
+	{
+		GLRecordStats_t& stats = record();
+		//the size already covers every layer of the level
+		stats.textureBytes += size;
+
+		if (pData)
+		{
+			stats.uploadBytes += size;
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	static void GLAPIENTRY recordGenerateMipmap(GLenum)
+	{
+		record();
+	}
+
+	/*
+	====================
+	Recorded Framebuffers
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	static void GLAPIENTRY recordGenFramebuffers(GLsizei n, GLuint* pFramebuffers)
+	{
+		generate(n, pFramebuffers, record().framebuffers);
+	}
+
+	////////////////////////////////////////////////////////////
+	static void GLAPIENTRY recordDeleteFramebuffers(GLsizei, const GLuint*)
+	{
+		record();
+	}
+
+	////////////////////////////////////////////////////////////
+	static void GLAPIENTRY recordBindFramebuffer(GLenum, GLuint)
+	{
+		record();
+	}
+
+	////////////////////////////////////////////////////////////
+	static void GLAPIENTRY recordFramebufferTexture2D(GLenum, GLenum, GLenum, GLuint, GLint)
+	{
+		record();
+	}
+
+	////////////////////////////////////////////////////////////
+	static GLenum GLAPIENTRY recordCheckFramebufferStatus(GLenum)
+	{
+		record();
+		return GL_FRAMEBUFFER_COMPLETE;
+	}
+
+	////////////////////////////////////////////////////////////
+	static void GLAPIENTRY recordGenRenderbuffers(GLsizei n, GLuint* pRenderbuffers)
+	{
+		generate(n, pRenderbuffers, record().framebuffers);
+	}
+
+	////////////////////////////////////////////////////////////
+	static void GLAPIENTRY recordBindRenderbuffer(GLenum, GLuint)
+	{
+		record();
+	}
+
+	////////////////////////////////////////////////////////////
+	static void GLAPIENTRY recordRenderbufferStorage(GLenum, GLenum, GLsizei width, GLsizei height)
+	{
+		record().textureBytes += 4ull * width * height;
+	}
+
+	////////////////////////////////////////////////////////////
+	static void GLAPIENTRY recordFramebufferRenderbuffer(GLenum, GLenum, GLenum, GLuint)
+	{
+		record();
+	}
+
+	////////////////////////////////////////////////////////////
+	static void GLAPIENTRY recordDrawBuffers(GLsizei, const GLenum*)
+	{
+		record();
+	}
+
+	/*
+	====================
+	Recorded State and Drawing
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	static void GLAPIENTRY recordGetIntegerv(GLenum pname, GLint* pData)
+	{
+		record();
+		//there is no surface, so the viewport is empty
+		if (pname == GL_VIEWPORT)
+		{
+			std::fill(pData, pData + 4, 0);
+			return;
+		}
+		//the largest alignment allowed, so offsets are valid on any driver
+		*pData = (pname == GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT) ? 256 : 0;
+	}
+
+	////////////////////////////////////////////////////////////
+	static const GLubyte* GLAPIENTRY recordGetString(GLenum)
+	{
+		record();
+		return reinterpret_cast<const GLubyte*>("GLRecorder");
+	}
+
+	////////////////////////////////////////////////////////////
+	static void GLAPIENTRY recordEnable(GLenum)
+	{
+		record();
+	}
+
+	////////////////////////////////////////////////////////////
+	static void GLAPIENTRY recordDisable(GLenum)
+	{
+		record();
+	}
+
+	////////////////////////////////////////////////////////////
+	static void GLAPIENTRY recordDepthMask(GLboolean)
+	{
+		record();
+	}
+
+	////////////////////////////////////////////////////////////
+	static void GLAPIENTRY recordClear(GLbitfield)
+	{
+		record();
+	}
+
+	////////////////////////////////////////////////////////////
+	static void GLAPIENTRY recordClearColor(GLfloat, GLfloat, GLfloat, GLfloat)
+	{
+		record();
+	}
+
+	////////////////////////////////////////////////////////////
+	static void GLAPIENTRY recordScissor(GLint, GLint, GLsizei, GLsizei)
+	{
+		record();
+	}
+
+	////////////////////////////////////////////////////////////
+	static void GLAPIENTRY recordBlendFunc(GLenum, GLenum)
+	{
+		record();
+	}
+
+	////////////////////////////////////////////////////////////
+	static void GLAPIENTRY recordCullFace(GLenum)
+	{
+		record();
+	}
+
+	////////////////////////////////////////////////////////////
+	static void GLAPIENTRY recordPolygonMode(GLenum, GLenum)
+	{
+		record();
+	}
+
+	////////////////////////////////////////////////////////////
+	static void GLAPIENTRY recordDrawElements(GLenum, GLsizei count, GLenum, const GLvoid*)
+	{
+		GLRecordStats_t& stats = record();
+		stats.drawCalls++;
+		stats.indices += count;
+	}
+
+	////////////////////////////////////////////////////////////
+	static void GLAPIENTRY recordDrawElementsInstancedBaseVertex(GLenum, GLsizei count, GLenum, const void*, GLsizei instances, GLint)
+	{
+		GLRecordStats_t& stats = record();
+		stats.drawCalls++;
+		stats.indices += static_cast<unsigned long long>(count) * instances;
+	}
+
+	/*
+	====================
+	Getters and Setters
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	GLFunctions_t GLRecorder::getFunctions(void)
+	{
+		//a slot left unassigned is a null call rather than a jump through garbage
+		GLFunctions_t functions = {};
+
+		functions.createProgram = recordCreateProgram;
+		functions.deleteProgram = recordDeleteProgram;
+		functions.attachShader = recordAttachShader;
+		functions.detachShader = recordDetachShader;
+		functions.linkProgram = recordLinkProgram;
+		functions.useProgram = recordUseProgram;
+		functions.getProgramiv = recordGetProgramiv;
+		functions.getProgramInfoLog = recordGetProgramInfoLog;
+		functions.programParameteri = recordProgramParameteri;
+		functions.getProgramBinary = recordGetProgramBinary;
+		functions.programBinary = recordProgramBinary;
+		functions.getActiveUniform = recordGetActiveUniform;
+		functions.getUniformLocation = recordGetUniformLocation;
+		functions.uniform1i = recordUniform1i;
+		functions.uniform2i = recordUniform2i;
+		functions.uniform3i = recordUniform3i;
+		functions.uniform4i = recordUniform4i;
+		functions.uniform1f = recordUniform1f;
+		functions.uniform2f = recordUniform2f;
+		functions.uniform3f = recordUniform3f;
+		functions.uniform4f = recordUniform4f;
+		functions.uniformMatrix4fv = recordUniformMatrix4fv;
+		functions.getUniformBlockIndex = recordGetUniformBlockIndex;
+		functions.uniformBlockBinding = recordUniformBlockBinding;
+		functions.createShader = recordCreateShader;
+		functions.deleteShader = recordDeleteShader;
+		functions.shaderSource = recordShaderSource;
+		functions.compileShader = recordCompileShader;
+		functions.getShaderiv = recordGetShaderiv;
+		functions.getShaderInfoLog = recordGetShaderInfoLog;
+		functions.genBuffers = recordGenBuffers;
+		functions.deleteBuffers = recordDeleteBuffers;
+		functions.bindBuffer = recordBindBuffer;
+		functions.bufferData = recordBufferData;
+		functions.bufferSubData = recordBufferSubData;
+		functions.copyBufferSubData = recordCopyBufferSubData;
+		functions.bindBufferBase = recordBindBufferBase;
+		functions.bindBufferRange = recordBindBufferRange;
+		functions.texBuffer = recordTexBuffer;
+		functions.genVertexArrays = recordGenVertexArrays;
+		functions.deleteVertexArrays = recordDeleteVertexArrays;
+		functions.bindVertexArray = recordBindVertexArray;
+		functions.vertexAttribPointer = recordVertexAttribPointer;
+		functions.enableVertexAttribArray = recordEnableVertexAttribArray;
+		functions.disableVertexAttribArray = recordDisableVertexAttribArray;
+		functions.genTextures = recordGenTextures;
+		functions.deleteTextures = recordDeleteTextures;
+		functions.activeTexture = recordActiveTexture;
+		functions.bindTexture = recordBindTexture;
+		functions.texParameteri = recordTexParameteri;
+		functions.texImage2D = recordTexImage2D;
+		functions.compressedTexImage2D = recordCompressedTexImage2D;
+		functions.texImage3D = recordTexImage3D;
+		functions.compressedTexImage3D = recordCompressedTexImage3D;
+		functions.generateMipmap = recordGenerateMipmap;
+		functions.genFramebuffers = recordGenFramebuffers;
+		functions.deleteFramebuffers = recordDeleteFramebuffers;
+		functions.bindFramebuffer = recordBindFramebuffer;
+		functions.framebufferTexture2D = recordFramebufferTexture2D;
+		functions.checkFramebufferStatus = recordCheckFramebufferStatus;
+		functions.genRenderbuffers = recordGenRenderbuffers;
+		functions.bindRenderbuffer = recordBindRenderbuffer;
+		functions.renderbufferStorage = recordRenderbufferStorage;
+		functions.framebufferRenderbuffer = recordFramebufferRenderbuffer;
+		functions.drawBuffers = recordDrawBuffers;
+		functions.getIntegerv = recordGetIntegerv;
+		functions.getString = recordGetString;
+		functions.enable = recordEnable;
+		functions.disable = recordDisable;
+		functions.depthMask = recordDepthMask;
+		functions.clear = recordClear;
+		functions.clearColor = recordClearColor;
+		functions.scissor = recordScissor;
+		functions.blendFunc = recordBlendFunc;
+		functions.cullFace = recordCullFace;
+		functions.polygonMode = recordPolygonMode;
+		functions.drawElements = recordDrawElements;
+		functions.drawElementsInstancedBaseVertex = recordDrawElementsInstancedBaseVertex;
+
+		return functions;
+	}
+
+	////////////////////////////////////////////////////////////
+	const GLRecordStats_t& GLRecorder::getStats(void)
+	{
+		return getRecording().stats;
+	}
+
+	////////////////////////////////////////////////////////////
+	void GLRecorder::resetStats(void)
+	{
+		getRecording().stats = GLRecordStats_t();
+	}
+
+}//namespace sparky
\ No newline at end of file
@@ -0,0 +1,196 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// 
+// Sparky Engine
+// 2016 - Benjamin Carter (benjamin.mark.carter@hotmail.com)
+// 
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+// 
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+// 
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgement
+//    in the product documentation would be appreciated but is not required.
+// 
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+// 
+// 3. This notice may not be removed or altered from any source distribution.
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+====================
+CPP Includes
+====================
+*/
+#if _WIN32
+#include <Windows.h>					// Mapping files with CreateFileMapping and MapViewOfFile.
+#else
+#include <sys/mman.h>					// Mapping files with mmap.
+#include <sys/stat.h>					// The size of the mapped file.
+#include <fcntl.h>						// Opening the mapped file.
+#include <unistd.h>						// Closing the descriptor once the file is mapped.
+#endif
+/*
+====================
+Class Includes
+====================
+*/
+#include <sparky\utils\mappedfile.hpp>	// Class definition.
+
+namespace sparky
+{
+	/*
+	====================
+	Ctor and Dtor
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	MappedFile::MappedFile(void)
+		: m_pData(nullptr), m_size(0)
+#if _WIN32
+		, m_file(INVALID_HANDLE_VALUE), m_mapping(nullptr)
+#endif
+	{
+	}
+
+	////////////////////////////////////////////////////////////
+	MappedFile::~MappedFile(void)
+	{
+		this->close();
+	}
+
+	/*
+	====================
+	Getters and Setters
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	bool MappedFile::isOpen(void) const
+	{
+		return m_pData != nullptr;
+	}
+
+	////////////////////////////////////////////////////////////
+	const unsigned char* MappedFile::getData(void) const
+	{
+		return m_pData;
+	}
+
+	////////////////////////////////////////////////////////////
+	std::size_t MappedFile::getSize(void) const
+	{
+		return m_size;
+	}
+
+	/*
+	====================
+	Methods
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	bool MappedFile::open(const String& filename)
+	{
+		this->close();
+
+#if _WIN32
+		m_file = CreateFileA(filename.getCString(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+
+		if (m_file == INVALID_HANDLE_VALUE)
+		{
+			return false;
+		}
+
+		LARGE_INTEGER size;
+
+		if (!GetFileSizeEx(m_file, &size) || size.QuadPart == 0)
+		{
+			this->close();
+			return false;
+		}
+
+		m_mapping = CreateFileMappingA(m_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+		if (!m_mapping)
+		{
+			this->close();
+			return false;
+		}
+
+		m_pData = static_cast<const unsigned char*>(MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0));
+
+		if (!m_pData)
+		{
+			this->close();
+			return false;
+		}
+
+		m_size = static_cast<std::size_t>(size.QuadPart);
+#else
+		const int descriptor = ::open(filename.getCString(), O_RDONLY);
+
+		if (descriptor < 0)
+		{
+			return false;
+		}
+
+		struct stat info;
+
+		if (fstat(descriptor, &info) != 0 || info.st_size == 0)
+		{
+			::close(descriptor);
+			return false;
+		}
+
+		void* pData = mmap(nullptr, static_cast<std::size_t>(info.st_size), PROT_READ, MAP_PRIVATE, descriptor, 0);
+		//the mapping keeps the file alive, the descriptor is no longer needed
+		::close(descriptor);
+
+		if (pData == MAP_FAILED)
+		{
+			return false;
+		}
+
+		m_pData = static_cast<const unsigned char*>(pData);
+		m_size = static_cast<std::size_t>(info.st_size);
+#endif
+
+		return true;
+	}
+
+	////////////////////////////////////////////////////////////
+	void MappedFile::close(void)
+	{
+#if _WIN32
+		if (m_pData)
+		{
+			UnmapViewOfFile(m_pData);
+		}
+
+		if (m_mapping)
+		{
+			CloseHandle(m_mapping);
+			m_mapping = nullptr;
+		}
+
+		if (m_file != INVALID_HANDLE_VALUE)
+		{
+			CloseHandle(m_file);
+			m_file = INVALID_HANDLE_VALUE;
+		}
+#else
+		if (m_pData)
+		{
+			munmap(const_cast<unsigned char*>(m_pData), m_size);
+		}
+#endif
+
+		m_pData = nullptr;
+		m_size = 0;
+	}
+
+}//namespace sparky
\ No newline at end of file
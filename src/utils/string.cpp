@@ -27,8 +27,9 @@
 CPP Includes
 ====================
 */
-#include <algorithm>				// Transform needed for forcing all letters to upper or lower case.
-#include <cctype>					// Lambda functions passed into std::transform.
+#include <algorithm>				// Removing characters without a for-loop.
+#include <cctype>					// Forcing all letters to upper or lower case.
+#include <cstring>					// Copying and comparing the characters.
 /*
 ====================
 Class Includes
@@ -38,6 +39,14 @@ Class Includes
 
 namespace sparky
 {
+	/*
+	====================
+	Static Fields
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	std::atomic<unsigned int> String::m_sHeapAllocations(0);
+
 	/*
 	====================
 	Ctor and Dtor
@@ -45,24 +54,58 @@ namespace sparky
 	*/
 	////////////////////////////////////////////////////////////
 	String::String(void)
-		: m_data()
+		: m_length(0), m_isHeap(false)
 	{
+		m_inline[0] = '\0';
 	}
 
 	////////////////////////////////////////////////////////////
 	String::String(const char* pData)
-		: m_data()
+		: m_length(0), m_isHeap(false)
 	{
-		m_data.clear();
-		m_data.assign(pData, pData + strlen(pData));
-		// Insert terminator.
-		nullTerminator();
+		m_inline[0] = '\0';
+		assign(pData, strlen(pData));
+	}
+
+	////////////////////////////////////////////////////////////
+	String::String(const char* pData, const unsigned int length)
+		: m_length(0), m_isHeap(false)
+	{
+		m_inline[0] = '\0';
+		assign(pData, length);
+	}
+
+	////////////////////////////////////////////////////////////
+	String::String(const StringView& view)
+		: m_length(0), m_isHeap(false)
+	{
+		m_inline[0] = '\0';
+		assign(view.getData(), view.getLength());
+	}
+
+	////////////////////////////////////////////////////////////
+	String::String(const String& string)
+		: m_length(0), m_isHeap(false)
+	{
+		m_inline[0] = '\0';
+		assign(string.getCString(), string.m_length);
+	}
+
+	////////////////////////////////////////////////////////////
+	String::String(String&& string)
+		: m_length(0), m_isHeap(false)
+	{
+		m_inline[0] = '\0';
+		swap(string);
 	}
 
 	////////////////////////////////////////////////////////////
 	String::~String(void)
 	{
-		m_data.clear();
+		if (m_isHeap)
+		{
+			delete[] m_heap.pData;
+		}
 	}
 
 	/*
@@ -70,12 +113,33 @@ namespace sparky
 	Operators
 	====================
 	*/
+	////////////////////////////////////////////////////////////
 	String& String::operator=(const char* pStr)
 	{
-		m_data.clear();
-		m_data.assign(pStr, pStr + strlen(pStr));
-		// Insert terminator.
-		nullTerminator();
+		assign(pStr, strlen(pStr));
+
+		return *this;
+	}
+
+	////////////////////////////////////////////////////////////
+	String& String::operator=(const String& string)
+	{
+		if (this != &string)
+		{
+			assign(string.getCString(), string.m_length);
+		}
+
+		return *this;
+	}
+
+	////////////////////////////////////////////////////////////
+	String& String::operator=(String&& string)
+	{
+		if (this != &string)
+		{
+			clear();
+			swap(string);
+		}
 
 		return *this;
 	}
@@ -83,8 +147,10 @@ namespace sparky
 	////////////////////////////////////////////////////////////
 	String String::operator+(const String& string) const
 	{
-		String result = *this;
+		String result;
+		result.reserve(m_length + string.m_length);
 
+		result.append(*this);
 		result.append(string);
 
 		return result;
@@ -95,9 +161,7 @@ namespace sparky
 	{
 		String result = *this;
 
-		result.remove(getLength());
-		result.m_data.push_back(letter);
-		result.nullTerminator();
+		result += letter;
 
 		return result;
 	}
@@ -113,13 +177,7 @@ namespace sparky
 	////////////////////////////////////////////////////////////
 	const String& String::operator+=(const char letter)
 	{
-		if (!isEmpty())
-		{
-			remove(getLength());
-		}
-
-		m_data.push_back(letter);
-		nullTerminator();
+		append(StringView(&letter, 1));
 
 		return *this;
 	}
@@ -127,7 +185,7 @@ namespace sparky
 	////////////////////////////////////////////////////////////
 	bool String::operator==(const String& string) const
 	{
-		return m_data == string.m_data;
+		return StringView(*this) == StringView(string);
 	}
 
 	////////////////////////////////////////////////////////////
@@ -151,23 +209,24 @@ namespace sparky
 	////////////////////////////////////////////////////////////
 	char String::operator[](const unsigned int index) const
 	{
-		return m_data[index];
+		return getCString()[index];
 	}
 
 	////////////////////////////////////////////////////////////
 	char& String::operator[](const unsigned int index)
 	{
-		return m_data[index];
+		return getData()[index];
 	}
 
 	////////////////////////////////////////////////////////////
 	std::size_t String::operator()(const String& key) const
 	{
 		std::size_t value = 0;
+		const char* pData = key.getCString();
 
-		for (char c : key.m_data)
+		for (unsigned int i = 0; i < key.m_length; i++)
 		{
-			value = 37 * value + c;
+			value = 37 * value + pData[i];
 		}
 
 		return value;
@@ -181,25 +240,37 @@ namespace sparky
 	////////////////////////////////////////////////////////////
 	unsigned int String::getLength(void) const
 	{
-		return m_data.size() - 1;
+		return m_length;
 	}
 
 	////////////////////////////////////////////////////////////
 	unsigned int String::getSize(void) const
 	{
-		return m_data.size();
+		return m_length + 1;
 	}
 
 	////////////////////////////////////////////////////////////
 	bool String::isEmpty(void) const
 	{
-		return m_data.empty();
+		return m_length == 0;
 	}
 
 	////////////////////////////////////////////////////////////
 	const char* String::getCString(void) const
 	{
-		return &m_data[0];
+		return m_isHeap ? m_heap.pData : m_inline;
+	}
+
+	////////////////////////////////////////////////////////////
+	unsigned int String::getCapacity(void) const
+	{
+		return m_isHeap ? m_heap.capacity : m_sInlineCapacity;
+	}
+
+	////////////////////////////////////////////////////////////
+	unsigned int String::getHeapAllocations(void)
+	{
+		return m_sHeapAllocations.load(std::memory_order_relaxed);
 	}
 
 	////////////////////////////////////////////////////////////
@@ -231,12 +302,22 @@ namespace sparky
 	====================
 	*/
 	////////////////////////////////////////////////////////////
-	void String::nullTerminator(void)
+	char* String::getData(void)
 	{
-		if (m_data.back() != '\0')
-		{
-			m_data.push_back('\0');
-		}
+		return m_isHeap ? m_heap.pData : m_inline;
+	}
+
+	////////////////////////////////////////////////////////////
+	void String::assign(const char* pData, const unsigned int length)
+	{
+		// A view of this String is never longer than it, so reserving will not free the characters.
+		reserve(length);
+
+		// memmove as the characters may be a view of this String.
+		memmove(getData(), pData, length);
+		getData()[length] = '\0';
+
+		m_length = length;
 	}
 
 	/*
@@ -247,93 +328,145 @@ namespace sparky
 	////////////////////////////////////////////////////////////
 	void String::remove(const unsigned int index)
 	{
-		m_data.erase(m_data.begin() + index);
+		if (index < m_length)
+		{
+			char* pData = getData();
+
+			// Shifts the remaining characters, including the null terminator.
+			memmove(pData + index, pData + index + 1, m_length - index);
+			m_length--;
+		}
 	}
 
 	////////////////////////////////////////////////////////////
 	void String::remove(const String& characters)
 	{
-		for (const auto& c : characters.m_data)
+		char* pData = getData();
+		const char* pCharacters = characters.getCString();
+
+		char* pEnd = std::remove_if(pData, pData + m_length, [pCharacters](const char c)
 		{
-			m_data.erase(std::remove(m_data.begin(), m_data.end(), c), m_data.end());
-		}
+			return strchr(pCharacters, c) != nullptr;
+		});
+
+		m_length = pEnd - pData;
+		pData[m_length] = '\0';
 	}
 
 	////////////////////////////////////////////////////////////
 	void String::clear(void)
 	{
-		m_data.clear();
+		m_length = 0;
+		getData()[0] = '\0';
 	}
 
 	////////////////////////////////////////////////////////////
-	void String::append(const String& string)
+	void String::reserve(const unsigned int capacity)
+	{
+		if (capacity <= getCapacity())
+		{
+			return;
+		}
+
+		char* pData = new char[capacity + 1];
+		memcpy(pData, getCString(), m_length + 1);
+
+		m_sHeapAllocations.fetch_add(1, std::memory_order_relaxed);
+
+		if (m_isHeap)
+		{
+			delete[] m_heap.pData;
+		}
+
+		m_heap.pData = pData;
+		m_heap.capacity = capacity;
+		m_isHeap = true;
+	}
+
+	////////////////////////////////////////////////////////////
+	void String::append(const StringView& string)
 	{
-		//remove the null terminator, don't one of these hanging around the middle of the vector
 		if (!string.isEmpty())
 		{
-			if (!isEmpty())
+			const unsigned int length = m_length + string.getLength();
+
+			if (length > getCapacity())
 			{
-				//remove the null terminator
-				remove(getLength());
+				const char* pData = getCString();
+
+				// Growing frees the current characters, so a view of this String is copied first.
+				if (string.getData() >= pData && string.getData() <= pData + m_length)
+				{
+					append(StringView(String(string)));
+					return;
+				}
+
+				// Grow geometrically, so appending a character at a time does not allocate each time.
+				reserve(std::max(length, getCapacity() * 2));
 			}
 
-			m_data.insert(m_data.end(), string.m_data.begin(), string.m_data.end());
+			// memmove as the characters may be a view of this String.
+			memmove(getData() + m_length, string.getData(), string.getLength());
+			getData()[length] = '\0';
 
-			nullTerminator();
+			m_length = length;
 		}
 	}
 
 	////////////////////////////////////////////////////////////
 	String String::toLower(void)
 	{
-		std::transform(m_data.begin(), m_data.end(), m_data.begin(), std::tolower);
+		char* pData = getData();
+		std::transform(pData, pData + m_length, pData, [](const char c) { return static_cast<char>(::tolower(c)); });
+
 		return *this;
 	}
 
 	////////////////////////////////////////////////////////////
 	String String::toUpper(void)
 	{
-		std::transform(m_data.begin(), m_data.end(), m_data.begin(), std::toupper);
+		char* pData = getData();
+		std::transform(pData, pData + m_length, pData, [](const char c) { return static_cast<char>(::toupper(c)); });
+
 		return *this;
 	}
 
 	////////////////////////////////////////////////////////////
 	void String::trim(void)
 	{
-		m_data.erase(std::remove(m_data.begin(), m_data.end(), ' '), m_data.end());
-		m_data.erase(std::remove(m_data.begin(), m_data.end(), '\r'), m_data.end());
-		m_data.erase(std::remove(m_data.begin(), m_data.end(), '\t'), m_data.end());
-		m_data.erase(std::remove(m_data.begin(), m_data.end(), '\n'), m_data.end());
+		remove(" \r\t\n");
 	}
 
 	////////////////////////////////////////////////////////////
-	bool String::beginsWith(const String& begin) const
+	bool String::beginsWith(const StringView& begin) const
 	{
-		return begin.getSize() < this->getSize() && std::equal(begin.m_data.begin(), begin.m_data.end() - 1, m_data.begin());
+		return StringView(*this).beginsWith(begin);
 	}
 
 	////////////////////////////////////////////////////////////
-	bool String::endsWith(const String& end) const
+	bool String::endsWith(const StringView& end) const
 	{
-		return end.getSize() < this->getSize() && std::equal(end.m_data.rbegin(), end.m_data.rend(), m_data.rbegin());
+		return StringView(*this).endsWith(end);
 	}
 
 	////////////////////////////////////////////////////////////
 	String String::substring(const unsigned int start, const unsigned int end) const
 	{
-		String sub;
-
-		sub.m_data.resize(end - start + 1);
-		memcpy(&sub.m_data[0], getCString() + start, end - start);
-
-		sub.nullTerminator();
-
-		return sub;
+		return String(StringView(*this).substring(start, end));
 	}
 
 	////////////////////////////////////////////////////////////
 	void String::swap(String& other)
 	{
-		m_data.swap(other.m_data);
+		// The inline buffer and heap data share storage, so the whole representation is exchanged.
+		char storage[sizeof(m_inline)];
+
+		memcpy(storage, m_inline, sizeof(m_inline));
+		memcpy(m_inline, other.m_inline, sizeof(m_inline));
+		memcpy(other.m_inline, storage, sizeof(m_inline));
+
+		std::swap(m_length, other.m_length);
+		std::swap(m_isHeap, other.m_isHeap);
 	}
-}
\ No newline at end of file
+
+}//namespace sparky
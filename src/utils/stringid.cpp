@@ -0,0 +1,216 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// 
+// Sparky Engine
+// 2016 - Benjamin Carter (benjamin.mark.carter@hotmail.com)
+// 
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+// 
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+// 
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgement
+//    in the product documentation would be appreciated but is not required.
+// 
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+// 
+// 3. This notice may not be removed or altered from any source distribution.
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+====================
+CPP Includes
+====================
+*/
+#include <mutex>						// Guards the debug lookup table, as ids are created from many threads.
+#include <memory>						// The per-thread sets are owned by the lookup table.
+#include <sstream>						// Formatting the hash of unregistered ids.
+#include <unordered_map>				// Debug lookup table from hashes back to strings.
+#include <unordered_set>				// The hashes each thread has already registered.
+#include <vector>						// Every thread's set of registered hashes.
+/*
+====================
+Class Includes
+====================
+*/
+#include <sparky\utils\stringid.hpp>	// Class definition.
+#include <sparky\utils\debug.hpp>		// Warning of hash collisions in debug builds.
+
+namespace sparky
+{
+#if SPARKY_DEBUG
+	/*
+	====================
+	Debug Lookup Table
+	====================
+	*/
+	struct StringTable_t
+	{
+		std::mutex mutex;							///< Guards the names, ids can be created from any thread.
+		std::unordered_map<unsigned int, String> names;	///< The string each registered hash was created from.
+		std::vector<std::unique_ptr<std::unordered_set<unsigned int>>> threads;	///< The hashes each thread has registered.
+	};
+
+	//ids are built on hot paths of every thread, so a hash already registered by the thread skips the lock
+	static SPARKY_THREAD_LOCAL std::unordered_set<unsigned int>* s_pRegistered = nullptr;
+
+	////////////////////////////////////////////////////////////
+	static StringTable_t& getStringTable(void)
+	{
+		// Intentionally leaked so ids used during static destruction can still be printed.
+		static StringTable_t* pTable = new StringTable_t();
+		return *pTable;
+	}
+#endif
+
+	/*
+	====================
+	Ctor and Dtor
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	StringId::StringId(void)
+		: m_hash(hash("", 0))
+	{
+	}
+
+	////////////////////////////////////////////////////////////
+	StringId::StringId(const char* pStr)
+		: StringId(StringView(pStr))
+	{
+	}
+
+	////////////////////////////////////////////////////////////
+	StringId::StringId(const String& string)
+		: StringId(StringView(string))
+	{
+	}
+
+	////////////////////////////////////////////////////////////
+	StringId::StringId(const StringView& view)
+		: m_hash(hash(view.getData(), view.getLength()))
+	{
+		registerName(view);
+	}
+
+	/*
+	====================
+	Operators
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	bool StringId::operator==(const StringId& id) const
+	{
+		return m_hash == id.m_hash;
+	}
+
+	////////////////////////////////////////////////////////////
+	bool StringId::operator!=(const StringId& id) const
+	{
+		return m_hash != id.m_hash;
+	}
+
+	////////////////////////////////////////////////////////////
+	bool StringId::operator<(const StringId& id) const
+	{
+		return m_hash < id.m_hash;
+	}
+
+	////////////////////////////////////////////////////////////
+	std::ostream& operator<<(std::ostream& os, const StringId& id)
+	{
+		return os << id.getString();
+	}
+
+	/*
+	====================
+	Getters and Setters
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	String StringId::getString(void) const
+	{
+#if SPARKY_DEBUG
+		StringTable_t& table = getStringTable();
+		std::lock_guard<std::mutex> lock(table.mutex);
+
+		auto itr = table.names.find(m_hash);
+
+		if (itr != table.names.end())
+		{
+			return itr->second;
+		}
+#endif
+
+		std::stringstream ss;
+		ss << "#" << m_hash;
+
+		return String(ss.str().c_str());
+	}
+
+	/*
+	====================
+	Methods
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	unsigned int StringId::hash(const char* pStr, const std::size_t length, const unsigned int seed/*= 2166136261u*/)
+	{
+		unsigned int result = seed;
+
+		for (std::size_t i = 0; i < length; i++)
+		{
+			result = (result ^ static_cast<unsigned char>(pStr[i])) * 16777619u;
+		}
+
+		return result;
+	}
+
+	/*
+	====================
+	Private Methods
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	void StringId::registerName(const StringView& view) const
+	{
+#if SPARKY_DEBUG
+		if (s_pRegistered && s_pRegistered->count(m_hash))
+		{
+			return;
+		}
+
+		StringTable_t& table = getStringTable();
+		std::lock_guard<std::mutex> lock(table.mutex);
+
+		if (!s_pRegistered)
+		{
+			std::unique_ptr<std::unordered_set<unsigned int>> pRegistered(new std::unordered_set<unsigned int>());
+			s_pRegistered = pRegistered.get();
+
+			table.threads.push_back(std::move(pRegistered));
+		}
+
+		s_pRegistered->insert(m_hash);
+
+		auto itr = table.names.find(m_hash);
+
+		if (itr == table.names.end())
+		{
+			table.names.insert(std::make_pair(m_hash, String(view)));
+		}
+		else if (StringView(itr->second) != view)
+		{
+			DebugLog::warning("StringId collision between", itr->second, "and", view);
+		}
+#else
+		(void)view;
+#endif
+	}
+
+}//namespace sparky
@@ -0,0 +1,186 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// 
+// Sparky Engine
+// 2016 - Benjamin Carter (benjamin.mark.carter@hotmail.com)
+// 
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+// 
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+// 
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgement
+//    in the product documentation would be appreciated but is not required.
+// 
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+// 
+// 3. This notice may not be removed or altered from any source distribution.
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+====================
+CPP Includes
+====================
+*/
+#include <cstring>						// Comparing and measuring the characters of a view.
+/*
+====================
+Class Includes
+====================
+*/
+#include <sparky\utils\stringview.hpp>	// Class definition.
+#include <sparky\utils\string.hpp>		// Viewing the characters of a String.
+
+namespace sparky
+{
+	/*
+	====================
+	Ctor and Dtor
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	StringView::StringView(void)
+		: m_pData(""), m_length(0)
+	{
+	}
+
+	////////////////////////////////////////////////////////////
+	StringView::StringView(const char* pData)
+		: m_pData(pData), m_length(strlen(pData))
+	{
+	}
+
+	////////////////////////////////////////////////////////////
+	StringView::StringView(const char* pData, const unsigned int length)
+		: m_pData(pData), m_length(length)
+	{
+	}
+
+	////////////////////////////////////////////////////////////
+	StringView::StringView(const String& string)
+		: m_pData(string.getCString()), m_length(string.getLength())
+	{
+	}
+
+	/*
+	====================
+	Operators
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	std::ostream& operator<<(std::ostream& os, const StringView& view)
+	{
+		return os.write(view.getData(), view.getLength());
+	}
+
+	////////////////////////////////////////////////////////////
+	char StringView::operator[](const unsigned int index) const
+	{
+		return m_pData[index];
+	}
+
+	////////////////////////////////////////////////////////////
+	bool StringView::operator==(const StringView& view) const
+	{
+		return m_length == view.m_length && memcmp(m_pData, view.m_pData, m_length) == 0;
+	}
+
+	////////////////////////////////////////////////////////////
+	bool StringView::operator!=(const StringView& view) const
+	{
+		return !(*this == view);
+	}
+
+	/*
+	====================
+	Getters and Setters
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	const char* StringView::getData(void) const
+	{
+		return m_pData;
+	}
+
+	////////////////////////////////////////////////////////////
+	unsigned int StringView::getLength(void) const
+	{
+		return m_length;
+	}
+
+	////////////////////////////////////////////////////////////
+	bool StringView::isEmpty(void) const
+	{
+		return m_length == 0;
+	}
+
+	/*
+	====================
+	Methods
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	int StringView::find(const char character, const unsigned int start) const
+	{
+		for (unsigned int i = start; i < m_length; i++)
+		{
+			if (m_pData[i] == character)
+			{
+				return i;
+			}
+		}
+
+		return -1;
+	}
+
+	////////////////////////////////////////////////////////////
+	StringView StringView::substring(const unsigned int start, const unsigned int end) const
+	{
+		const unsigned int last = (end < m_length) ? end : m_length;
+		const unsigned int first = (start < last) ? start : last;
+
+		return StringView(m_pData + first, last - first);
+	}
+
+	////////////////////////////////////////////////////////////
+	StringView StringView::trim(void) const
+	{
+		auto isWhitespace = [](const char c)
+		{
+			return c == ' ' || c == '\t' || c == '\r' || c == '\n' || c == '\0';
+		};
+
+		unsigned int first = 0;
+		unsigned int last = m_length;
+
+		while (first < last && isWhitespace(m_pData[first]))
+		{
+			first++;
+		}
+
+		while (last > first && isWhitespace(m_pData[last - 1]))
+		{
+			last--;
+		}
+
+		return StringView(m_pData + first, last - first);
+	}
+
+	////////////////////////////////////////////////////////////
+	bool StringView::beginsWith(const StringView& view) const
+	{
+		return view.m_length <= m_length && memcmp(m_pData, view.m_pData, view.m_length) == 0;
+	}
+
+	////////////////////////////////////////////////////////////
+	bool StringView::endsWith(const StringView& view) const
+	{
+		return view.m_length <= m_length && memcmp(m_pData + m_length - view.m_length, view.m_pData, view.m_length) == 0;
+	}
+
+}//namespace sparky
@@ -0,0 +1,134 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// 
+// Sparky Engine
+// 2016 - Benjamin Carter (benjamin.mark.carter@hotmail.com)
+// 
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+// 
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+// 
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgement
+//    in the product documentation would be appreciated but is not required.
+// 
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+// 
+// 3. This notice may not be removed or altered from any source distribution.
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+====================
+Class Includes
+====================
+*/
+#include <sparky\utils\task.hpp>	// Class definition.
+
+namespace sparky
+{
+	/*
+	====================
+	Static Fields
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	std::atomic<unsigned int> Task::m_sHeapAllocations(0);
+
+	/*
+	====================
+	Ctor and Dtor
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	Task::Task(void)
+		: m_buffer(), m_pManager(nullptr)
+	{
+	}
+
+	////////////////////////////////////////////////////////////
+	Task::Task(Task&& other)
+		: m_buffer(), m_pManager(other.m_pManager)
+	{
+		if (m_pManager)
+		{
+			m_pManager(TASK_MOVE, &m_buffer, &other.m_buffer);
+			other.m_pManager = nullptr;
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	Task::~Task(void)
+	{
+		this->reset();
+	}
+
+	/*
+	====================
+	Operators
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	Task& Task::operator=(Task&& other)
+	{
+		if (this != &other)
+		{
+			this->reset();
+
+			if (other.m_pManager)
+			{
+				m_pManager = other.m_pManager;
+				m_pManager(TASK_MOVE, &m_buffer, &other.m_buffer);
+				other.m_pManager = nullptr;
+			}
+		}
+
+		return *this;
+	}
+
+	////////////////////////////////////////////////////////////
+	void Task::operator()(void)
+	{
+		if (m_pManager)
+		{
+			m_pManager(TASK_INVOKE, &m_buffer, nullptr);
+		}
+	}
+
+	/*
+	====================
+	Getters and Setters
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	bool Task::isEmpty(void) const
+	{
+		return m_pManager == nullptr;
+	}
+
+	////////////////////////////////////////////////////////////
+	unsigned int Task::getHeapAllocations(void)
+	{
+		return m_sHeapAllocations.load(std::memory_order_relaxed);
+	}
+
+	/*
+	====================
+	Methods
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	void Task::reset(void)
+	{
+		if (m_pManager)
+		{
+			m_pManager(TASK_DESTROY, &m_buffer, nullptr);
+			m_pManager = nullptr;
+		}
+	}
+
+}//namespace sparky
@@ -12,9 +12,9 @@ namespace sparky
 		m_pool.join();
 	}
 
-	void ThreadManager::addTask(const std::function<void()>& function)
+	void ThreadManager::addTask(Task task)
 	{
-		m_pool.addTask(function);
+		m_pool.addTask(std::move(task));
 	}
 
 }//namespace sparky
\ No newline at end of file
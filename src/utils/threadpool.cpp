@@ -22,6 +22,12 @@
 //
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
+/*
+====================
+CPP Includes
+====================
+*/
+#include <algorithm>					// Keeping at least one worker.
 /*
 ====================
 Class Includes
@@ -38,9 +44,10 @@ namespace sparky
 	*/
 	////////////////////////////////////////////////////////////
 	ThreadPool::ThreadPool(const unsigned int threads)
-		: m_stopped(false)
+		: m_workers(), m_tasks(64), m_head(0), m_count(0), m_mutex(), m_condition(), m_stopped(false)
 	{
-		for (unsigned int i = 0; i < threads; i++)
+		//hardware_concurrency is 0 when it cannot be determined, and a pool without workers never runs the tasks waited on
+		for (unsigned int i = 0; i < std::max(threads, 1u); i++)
 		{
 			m_workers.emplace_back(std::thread(&ThreadPool::run, this));
 		}
@@ -63,25 +70,27 @@ namespace sparky
 	////////////////////////////////////////////////////////////
 	void ThreadPool::run(void)
 	{
-		std::function<void()> task;
+		Task task;
 
 		while (true)
 		{
 			std::unique_lock<std::mutex> guard(m_mutex);
 
-			m_condition.wait(guard, [this]{ return !m_tasks.empty(); });
+			m_condition.wait(guard, [this]{ return m_stopped || m_count > 0; });
 
-			if (m_tasks.empty())
+			if (m_count == 0)
 			{
 				return;
 			}
 
-			task = std::move(m_tasks.front());
+			task = std::move(m_tasks[m_head]);
 
-			m_tasks.pop();
+			m_head = (m_head + 1) % m_tasks.size();
+			--m_count;
 			guard.unlock();
 
 			task();
+			task.reset();
 		}
 	}
 
@@ -91,10 +100,26 @@ namespace sparky
 	====================
 	*/
 	////////////////////////////////////////////////////////////
-	void ThreadPool::addTask(const std::function<void()>& function)
+	void ThreadPool::addTask(Task task)
 	{
 		std::unique_lock<std::mutex> guard(m_mutex);
-		m_tasks.push(std::move(function));
+
+		if (m_count == m_tasks.size())
+		{
+			// Grow the ring buffer, unwrapping the waiting tasks to the front.
+			std::vector<Task> tasks(m_tasks.size() * 2);
+
+			for (std::size_t i = 0; i < m_count; ++i)
+			{
+				tasks[i] = std::move(m_tasks[(m_head + i) % m_tasks.size()]);
+			}
+
+			m_tasks.swap(tasks);
+			m_head = 0;
+		}
+
+		m_tasks[(m_head + m_count) % m_tasks.size()] = std::move(task);
+		++m_count;
 
 		guard.unlock();
 
@@ -104,13 +129,19 @@ namespace sparky
 	////////////////////////////////////////////////////////////
 	void ThreadPool::join(void)
 	{
+		std::unique_lock<std::mutex> guard(m_mutex);
 		m_stopped = true;
+		guard.unlock();
+
 		m_condition.notify_all();
 
 		for (auto& worker : m_workers)
 		{
-			worker.join();
+			if (worker.joinable())
+			{
+				worker.join();
+			}
 		}
 	}
 
-}//namespace sparky
\ No newline at end of file
+}//namespace sparky
@@ -0,0 +1,159 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// 
+// Sparky Engine
+// 2016 - Benjamin Carter (benjamin.mark.carter@hotmail.com)
+// 
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+// 
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+// 
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgement
+//    in the product documentation would be appreciated but is not required.
+// 
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+// 
+// 3. This notice may not be removed or altered from any source distribution.
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/*
+====================
+CPP Includes
+====================
+*/
+#include <algorithm>					// Finding the sampled bounds.
+#include <cmath>						// Sampling the surface of the sphere.
+/*
+====================
+Class Includes
+====================
+*/
+#include "unittest.hpp"					// The checks of the suite.
+#include <sparky\math\frustum.hpp>		// The projection under test.
+#include <sparky\math\mathutils.hpp>	// Converting the field of view to radians.
+
+namespace sparky
+{
+	/*
+	====================
+	Reference Projection
+	====================
+	*/
+	static const float PI = 3.14159265f;
+
+	////////////////////////////////////////////////////////////
+	static bool sampleSphere(const Vector3f& centre, const float radius, const float fov, const float aspectRatio, const float nearPlane, Rectf& rect)
+	{
+		const float tanY = std::tan(MathUtils<float>::toRadians(fov / 2.0f));
+		const float tanX = tanY * aspectRatio;
+		const unsigned int steps = 400;
+
+		float left = 1.0f, right = -1.0f, bottom = 1.0f, top = -1.0f;
+		bool visible = false;
+		//every point of the solid sphere projects inside the silhouette of its surface, or the near plane's cut
+		for (unsigned int i = 0; i <= steps; i++)
+		{
+			const float theta = PI * i / steps;
+
+			for (unsigned int j = 0; j < steps; j++)
+			{
+				const float phi = 2.0f * PI * j / steps;
+
+				for (unsigned int k = 1; k <= 2; k++)
+				{
+					const float r = radius * k / 2.0f;
+					const float x = centre.x + r * std::sin(theta) * std::cos(phi);
+					const float y = centre.y + r * std::sin(theta) * std::sin(phi);
+					const float z = centre.z + r * std::cos(theta);
+
+					if (z < nearPlane)
+					{
+						continue;
+					}
+
+					visible = true;
+					left = std::min(left, x / (z * tanX));
+					right = std::max(right, x / (z * tanX));
+					bottom = std::min(bottom, y / (z * tanY));
+					top = std::max(top, y / (z * tanY));
+				}
+			}
+		}
+
+		left = std::max(left, -1.0f);
+		bottom = std::max(bottom, -1.0f);
+		right = std::min(right, 1.0f);
+		top = std::min(top, 1.0f);
+
+		rect = Rectf(left, bottom, right - left, top - bottom);
+
+		return visible && left < right && bottom < top;
+	}
+
+	////////////////////////////////////////////////////////////
+	static bool isClose(const float a, const float b)
+	{
+		return std::abs(a - b) < 0.02f;
+	}
+
+	/*
+	====================
+	Test Suites
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	void testFrustum(void)
+	{
+		Rectf rect;
+		Rectf reference;
+		//straddling the near plane, the part behind it is cut away
+		const Vector3f straddling(1.5f, -1.5f, 1.0f);
+		SPARKY_CHECK(Frustum::projectSphere(straddling, 1.2f, 90.0f, 1.0f, 1.0f, rect));
+		SPARKY_CHECK(sampleSphere(straddling, 1.2f, 90.0f, 1.0f, 1.0f, reference));
+		SPARKY_CHECK(isClose(rect.position.x, reference.position.x));
+		SPARKY_CHECK(isClose(rect.position.y, reference.position.y));
+		SPARKY_CHECK(isClose(rect.size.x, reference.size.x));
+		SPARKY_CHECK(isClose(rect.size.y, reference.size.y));
+		//the near plane's cut reaches the edges of the screen
+		SPARKY_CHECK(rect.position.x + rect.size.x == 1.0f);
+		SPARKY_CHECK(rect.position.y == -1.0f);
+
+		//the same for a wide screen, where only the horizontal bounds change
+		SPARKY_CHECK(Frustum::projectSphere(straddling, 1.2f, 60.0f, 16.0f / 9.0f, 0.5f, rect));
+		SPARKY_CHECK(sampleSphere(straddling, 1.2f, 60.0f, 16.0f / 9.0f, 0.5f, reference));
+		SPARKY_CHECK(isClose(rect.position.x, reference.position.x));
+		SPARKY_CHECK(isClose(rect.position.y, reference.position.y));
+		SPARKY_CHECK(isClose(rect.size.x, reference.size.x));
+		SPARKY_CHECK(isClose(rect.size.y, reference.size.y));
+
+		//fully in front of the camera
+		const Vector3f inside(0.5f, 0.25f, 10.0f);
+		SPARKY_CHECK(Frustum::projectSphere(inside, 2.0f, 70.0f, 16.0f / 9.0f, 0.1f, rect));
+		SPARKY_CHECK(sampleSphere(inside, 2.0f, 70.0f, 16.0f / 9.0f, 0.1f, reference));
+		SPARKY_CHECK(isClose(rect.position.x, reference.position.x));
+		SPARKY_CHECK(isClose(rect.position.y, reference.position.y));
+		SPARKY_CHECK(isClose(rect.size.x, reference.size.x));
+		SPARKY_CHECK(isClose(rect.size.y, reference.size.y));
+
+		//fully off to the side, above, and behind the camera
+		SPARKY_CHECK(!Frustum::projectSphere(Vector3f(100.0f, 0.0f, 10.0f), 1.0f, 70.0f, 16.0f / 9.0f, 0.1f, rect));
+		SPARKY_CHECK(!Frustum::projectSphere(Vector3f(0.0f, 50.0f, 10.0f), 1.0f, 70.0f, 16.0f / 9.0f, 0.1f, rect));
+		SPARKY_CHECK(!Frustum::projectSphere(Vector3f(0.0f, 0.0f, -10.0f), 1.0f, 70.0f, 16.0f / 9.0f, 0.1f, rect));
+		//behind the camera but reaching past the near plane
+		SPARKY_CHECK(Frustum::projectSphere(Vector3f(0.0f, 0.0f, -1.0f), 1.5f, 70.0f, 16.0f / 9.0f, 0.1f, rect));
+
+		//the camera is inside the sphere, which covers the whole screen
+		SPARKY_CHECK(Frustum::projectSphere(Vector3f(0.0f, 0.0f, 0.0f), 5.0f, 70.0f, 16.0f / 9.0f, 0.1f, rect));
+		SPARKY_CHECK(rect.position.x == -1.0f && rect.position.y == -1.0f);
+		SPARKY_CHECK(rect.size.x == 2.0f && rect.size.y == 2.0f);
+
+		SPARKY_CHECK(Frustum::projectSphere(Vector3f(1.0f, -1.0f, -2.0f), 3.0f, 70.0f, 16.0f / 9.0f, 0.1f, rect));
+		SPARKY_CHECK(rect.size.x == 2.0f && rect.size.y == 2.0f);
+	}
+
+}//namespace sparky
\ No newline at end of file
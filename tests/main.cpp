@@ -0,0 +1,17 @@
+#include <cstdlib>
+#include <iostream>
+
+#include "unittest.hpp"
+
+using namespace sparky;
+
+int main(int argc, char** argv)
+{
+	testUniforms();
+	testRangeAllocator();
+	testFrustum();
+
+	std::cout << UnitTest::getChecks() - UnitTest::getFailures() << " of " << UnitTest::getChecks() << " checks passed" << std::endl;
+
+	return UnitTest::getFailures() == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
\ No newline at end of file
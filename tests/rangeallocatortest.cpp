@@ -0,0 +1,129 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// 
+// Sparky Engine
+// 2016 - Benjamin Carter (benjamin.mark.carter@hotmail.com)
+// 
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+// 
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+// 
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgement
+//    in the product documentation would be appreciated but is not required.
+// 
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+// 
+// 3. This notice may not be removed or altered from any source distribution.
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/*
+====================
+Class Includes
+====================
+*/
+#include "unittest.hpp"						// The checks of the suite.
+#include <sparky\core\rangeallocator.hpp>	// The allocator under test.
+
+namespace sparky
+{
+	/*
+	====================
+	Test Suites
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	void testRangeAllocator(void)
+	{
+		RangeAllocator allocator(100);
+		//|a:10|b:30|c:10|d:20|e:10|f:20|
+		const unsigned int a = allocator.allocate(10);
+		const unsigned int b = allocator.allocate(30);
+		const unsigned int c = allocator.allocate(10);
+		const unsigned int d = allocator.allocate(20);
+		const unsigned int e = allocator.allocate(10);
+		const unsigned int f = allocator.allocate(20);
+		SPARKY_CHECK(f != RangeAllocator::INVALID_HANDLE);
+		SPARKY_CHECK(allocator.getOffset(f) == 80);
+		SPARKY_CHECK(allocator.getFree() == 0);
+		SPARKY_CHECK(allocator.allocate(1) == RangeAllocator::INVALID_HANDLE);
+
+		//|a:10|free:30|c:10|free:20|e:10|f:20|
+		allocator.free(b);
+		allocator.free(d);
+
+		RangeStats_t stats = allocator.getStats();
+		SPARKY_CHECK(stats.capacity == 100);
+		SPARKY_CHECK(stats.used == 50);
+		SPARKY_CHECK(stats.freeRanges == 2);
+		SPARKY_CHECK(stats.largestFree == 30);
+		SPARKY_CHECK(stats.fragmentation > 0.39f && stats.fragmentation < 0.41f);
+
+		//best fit, the 20 sized range is taken although the 30 sized one comes first
+		const unsigned int g = allocator.allocate(15);
+		SPARKY_CHECK(allocator.getOffset(g) == 50);
+		SPARKY_CHECK(allocator.getSize(g) == 15);
+		//an exact fit consumes the range
+		const unsigned int h = allocator.allocate(30);
+		SPARKY_CHECK(allocator.getOffset(h) == 10);
+		SPARKY_CHECK(allocator.getStats().freeRanges == 1);
+		SPARKY_CHECK(allocator.allocate(6) == RangeAllocator::INVALID_HANDLE);
+
+		//freeing the neighbours of a free range coalesces all three
+		//|a:10|h:30|free:30|e:10|f:20|
+		allocator.free(c);
+		allocator.free(g);
+		stats = allocator.getStats();
+		SPARKY_CHECK(stats.freeRanges == 1);
+		SPARKY_CHECK(stats.largestFree == 30);
+		SPARKY_CHECK(stats.fragmentation == 0.0f);
+
+		allocator.free(e);
+		stats = allocator.getStats();
+		SPARKY_CHECK(stats.freeRanges == 1);
+		SPARKY_CHECK(stats.largestFree == 40);
+		const unsigned int i = allocator.allocate(40);
+		SPARKY_CHECK(allocator.getOffset(i) == 40);
+		allocator.free(i);
+
+		//|free:10|h:30|free:40|f:20|
+		allocator.free(a);
+		stats = allocator.getStats();
+		SPARKY_CHECK(stats.freeRanges == 2);
+		SPARKY_CHECK(stats.used == 50);
+
+		//|h:30|f:20|free:50|
+		const std::vector<RangeMove_t> moves = allocator.defragment();
+		SPARKY_CHECK(moves.size() == 2);
+		if (moves.size() == 2)
+		{
+			SPARKY_CHECK(moves[0].from == 10 && moves[0].to == 0 && moves[0].size == 30);
+			SPARKY_CHECK(moves[1].from == 80 && moves[1].to == 30 && moves[1].size == 20);
+		}
+		SPARKY_CHECK(allocator.getOffset(h) == 0);
+		SPARKY_CHECK(allocator.getOffset(f) == 30);
+
+		stats = allocator.getStats();
+		SPARKY_CHECK(stats.freeRanges == 1);
+		SPARKY_CHECK(stats.largestFree == 50);
+		SPARKY_CHECK(stats.fragmentation == 0.0f);
+
+		//growing extends the free range at the end
+		allocator.grow(150);
+		stats = allocator.getStats();
+		SPARKY_CHECK(stats.capacity == 150);
+		SPARKY_CHECK(stats.freeRanges == 1);
+		SPARKY_CHECK(stats.largestFree == 100);
+
+		//freed handles are reused
+		const unsigned int j = allocator.allocate(100);
+		SPARKY_CHECK(j != RangeAllocator::INVALID_HANDLE && j != h && j != f);
+		SPARKY_CHECK(allocator.getOffset(j) == 50);
+		SPARKY_CHECK(allocator.getFree() == 0);
+	}
+
+}//namespace sparky
\ No newline at end of file
@@ -0,0 +1,149 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// 
+// Sparky Engine
+// 2016 - Benjamin Carter (benjamin.mark.carter@hotmail.com)
+// 
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+// 
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+// 
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgement
+//    in the product documentation would be appreciated but is not required.
+// 
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+// 
+// 3. This notice may not be removed or altered from any source distribution.
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+====================
+CPP Includes
+====================
+*/
+#include <cstring>						// Copying and comparing the names of the mocked uniforms.
+/*
+====================
+Class Includes
+====================
+*/
+#include "unittest.hpp"					// The checks of the suite.
+#include <sparky\rendering\program.hpp>	// The program whose uniforms are cached.
+#include <sparky\rendering\uniform.hpp>	// Setting the uniforms by name.
+#include <sparky\utils\gldevice.hpp>	// The function table the mocks are installed into.
+#include <sparky\utils\glrecorder.hpp>	// Every other function is recorded.
+#include <sparky\math\matrix4.hpp>		// The value of the matrix uniforms.
+
+namespace sparky
+{
+	/*
+	====================
+	Mocked Program
+	====================
+	*/
+	static const char* const UNIFORM_NAMES[] = { "u_mvp", "u_model", "u_texture" };
+	static const GLint UNIFORM_COUNT = 3;
+
+	static unsigned int s_locationQueries = 0;
+	static unsigned int s_matrixUploads = 0;
+	static GLint s_lastLocation = -1;
+
+	////////////////////////////////////////////////////////////
+	static void GLAPIENTRY mockGetProgramiv(GLuint, GLenum pname, GLint* pParam)
+	{
+		switch (pname)
+		{
+		case GL_LINK_STATUS:					*pParam = GL_TRUE; break;
+		case GL_ACTIVE_UNIFORMS:				*pParam = UNIFORM_COUNT; break;
+		case GL_ACTIVE_UNIFORM_MAX_LENGTH:		*pParam = 16; break;
+		default:								*pParam = 0; break;
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	static void GLAPIENTRY mockGetActiveUniform(GLuint, GLuint index, GLsizei maxLength, GLsizei* pLength, GLint* pSize, GLenum* pType, GLchar* pName)
+	{
+		std::strncpy(pName, UNIFORM_NAMES[index], maxLength);
+
+		*pLength = static_cast<GLsizei>(std::strlen(pName));
+		*pSize = 1;
+		*pType = GL_FLOAT_MAT4;
+	}
+
+	////////////////////////////////////////////////////////////
+	static GLint GLAPIENTRY mockGetUniformLocation(GLuint, const GLchar* pName)
+	{
+		s_locationQueries++;
+
+		for (GLint i = 0; i < UNIFORM_COUNT; i++)
+		{
+			if (std::strcmp(pName, UNIFORM_NAMES[i]) == 0)
+			{
+				//offset, so a location is never mistaken for an index
+				return i + 10;
+			}
+		}
+
+		return -1;
+	}
+
+	////////////////////////////////////////////////////////////
+	static void GLAPIENTRY mockUniformMatrix4fv(GLint location, GLsizei, GLboolean, const GLfloat*)
+	{
+		s_matrixUploads++;
+		s_lastLocation = location;
+	}
+
+	/*
+	====================
+	Test Suites
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	void testUniforms(void)
+	{
+		GLDevice::initHeadless();
+
+		GLFunctions_t functions = GLDevice::getFunctions();
+		functions.getProgramiv = mockGetProgramiv;
+		functions.getActiveUniform = mockGetActiveUniform;
+		functions.getUniformLocation = mockGetUniformLocation;
+		functions.uniformMatrix4fv = mockUniformMatrix4fv;
+
+		GLDevice::setFunctions(functions);
+
+		Program program;
+		program.link();
+		//every active uniform is located once when the program is linked
+		SPARKY_CHECK(program.getUniformCount() == static_cast<unsigned int>(UNIFORM_COUNT));
+		SPARKY_CHECK(s_locationQueries == static_cast<unsigned int>(UNIFORM_COUNT));
+
+		Uniform uniform(&program);
+		const Matrix4f matrix;
+		const unsigned int queries = s_locationQueries;
+		GLRecorder::resetStats();
+		//a frame of draws, each setting its matrices by name
+		for (unsigned int draw = 0; draw < 100; draw++)
+		{
+			uniform.setParameter("u_mvp", matrix);
+			uniform.setParameter("u_model", matrix);
+		}
+
+		SPARKY_CHECK(s_locationQueries == queries);
+		SPARKY_CHECK(s_matrixUploads == 200);
+		SPARKY_CHECK(s_lastLocation == 11);
+		//the draws reached OpenGL only through the mocks, nothing else was called
+		SPARKY_CHECK(GLRecorder::getStats().calls == 0);
+
+		SPARKY_CHECK(uniform.getLocation("u_texture") == 12);
+		SPARKY_CHECK(uniform.getLocation("u_missing") == -1);
+		SPARKY_CHECK(s_locationQueries == queries);
+	}
+
+}//namespace sparky
\ No newline at end of file
@@ -0,0 +1,84 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// 
+// Sparky Engine
+// 2016 - Benjamin Carter (benjamin.mark.carter@hotmail.com)
+// 
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+// 
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+// 
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgement
+//    in the product documentation would be appreciated but is not required.
+// 
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+// 
+// 3. This notice may not be removed or altered from any source distribution.
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+====================
+CPP Includes
+====================
+*/
+#include <iostream>		// Printing failed checks.
+/*
+====================
+Class Includes
+====================
+*/
+#include "unittest.hpp"	// Class definition.
+
+namespace sparky
+{
+	/*
+	====================
+	Static Fields
+	====================
+	*/
+	unsigned int UnitTest::m_sChecks = 0;
+	unsigned int UnitTest::m_sFailures = 0;
+
+	/*
+	====================
+	Getters and Setters
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	unsigned int UnitTest::getChecks(void)
+	{
+		return m_sChecks;
+	}
+
+	////////////////////////////////////////////////////////////
+	unsigned int UnitTest::getFailures(void)
+	{
+		return m_sFailures;
+	}
+
+	/*
+	====================
+	Methods
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	bool UnitTest::check(const bool condition, const char* pExpression, const char* pFile, const int line)
+	{
+		m_sChecks++;
+
+		if (!condition)
+		{
+			m_sFailures++;
+			std::cout << pFile << "(" << line << "): check failed: " << pExpression << std::endl;
+		}
+
+		return condition;
+	}
+
+}//namespace sparky
\ No newline at end of file
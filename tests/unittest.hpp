@@ -0,0 +1,131 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// 
+// Sparky Engine
+// 2016 - Benjamin Carter (benjamin.mark.carter@hotmail.com)
+// 
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+// 
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+// 
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgement
+//    in the product documentation would be appreciated but is not required.
+// 
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+// 
+// 3. This notice may not be removed or altered from any source distribution.
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __SPARKY_UNIT_TEST_HPP__
+#define __SPARKY_UNIT_TEST_HPP__
+
+namespace sparky
+{
+	class UnitTest final
+	{
+	private:
+		/*
+		====================
+		Member Variables
+		====================
+		*/
+		static unsigned int m_sChecks;		///< The amount of checks made.
+		static unsigned int m_sFailures;	///< The amount of checks that failed.
+
+	public:
+		/*
+		====================
+		Getters and Setters
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Retrieves the amount of checks made so far.
+		///
+		/// \retval unsigned int	The amount of checks.
+		///
+		////////////////////////////////////////////////////////////
+		static unsigned int getChecks(void);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Retrieves the amount of checks that failed so far.
+		///
+		/// \retval unsigned int	The amount of failed checks.
+		///
+		////////////////////////////////////////////////////////////
+		static unsigned int getFailures(void);
+
+		/*
+		====================
+		Methods
+		====================
+		*/
+		////////////////////////////////////////////////////////////
+		/// \brief Records the result of a check.
+		///
+		/// Failed checks are printed with their expression and line,
+		/// the tests carry on so every failure of a run is reported.
+		///
+		/// \param condition	The result of the check.
+		/// \param pExpression	The checked expression.
+		/// \param pFile		The file of the check.
+		/// \param line			The line of the check.
+		///
+		/// \retval bool		The result of the check.
+		///
+		////////////////////////////////////////////////////////////
+		static bool check(const bool condition, const char* pExpression, const char* pFile, const int line);
+	};
+
+	/*
+	====================
+	Test Suites
+	====================
+	*/
+	////////////////////////////////////////////////////////////
+	/// \brief Checks that uniform locations are only queried when
+	///		   a Program is linked.
+	////////////////////////////////////////////////////////////
+	void testUniforms(void);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Checks the best fit, coalescing, defragmentation and
+	///		   statistics of the RangeAllocator.
+	////////////////////////////////////////////////////////////
+	void testRangeAllocator(void);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Checks the screen area Frustum::projectSphere finds
+	///		   against a sampled sphere, including spheres cut by
+	///		   the near plane, off screen and around the camera.
+	////////////////////////////////////////////////////////////
+	void testFrustum(void);
+
+}//namespace sparky
+
+#define SPARKY_CHECK(condition) sparky::UnitTest::check((condition), #condition, __FILE__, __LINE__)
+
+#endif//__SPARKY_UNIT_TEST_HPP__
+
+////////////////////////////////////////////////////////////
+/// \class sparky::UnitTest
+/// \ingroup tests
+///
+/// sparky::UnitTest counts the checks made by the test suites of
+/// the engine. The suites exercise the CPU side of components, with
+/// OpenGL replaced by the GLRecorder, so they run on any machine.
+/// The test executable returns a non-zero exit code if any of the
+/// checks failed.
+///
+/// Usage example:
+/// \code
+/// sparky::RangeAllocator allocator(64);
+/// SPARKY_CHECK(allocator.allocate(16) != sparky::RangeAllocator::INVALID_HANDLE);
+/// \endcode
+///
+////////////////////////////////////////////////////////////
\ No newline at end of file